@@ -120,6 +120,7 @@ else{
 
 SOURCES += \
     src/Application.cpp \
+    src/autogenerated/EmojiTableAutogen.cpp \
     src/autogenerated/ResourcesAutogen.cpp \
     src/BaseSettings.cpp \
     src/BaseTheme.cpp \
@@ -141,6 +142,7 @@ SOURCES += \
     src/common/NetworkRequest.cpp \
     src/common/NetworkResult.cpp \
     src/common/QLogging.cpp \
+    src/common/StartupTasks.cpp \
     src/common/Version.cpp \
     src/common/WindowDescriptors.cpp \
     src/controllers/accounts/Account.cpp \
@@ -160,6 +162,7 @@ SOURCES += \
     src/controllers/highlights/HighlightPhrase.cpp \
     src/controllers/highlights/UserHighlightModel.cpp \
     src/controllers/ignores/IgnoreModel.cpp \
+    src/controllers/ignores/IgnorePhraseMatcher.cpp \
     src/controllers/moderationactions/ModerationAction.cpp \
     src/controllers/moderationactions/ModerationActionModel.cpp \
     src/controllers/notifications/NotificationController.cpp \
@@ -168,6 +171,7 @@ SOURCES += \
     src/controllers/taggedusers/TaggedUser.cpp \
     src/controllers/taggedusers/TaggedUsersModel.cpp \
     src/debug/Benchmark.cpp \
+    src/debug/Trace.cpp \
     src/main.cpp \
     src/messages/Emote.cpp \
     src/messages/Image.cpp \
@@ -176,6 +180,7 @@ SOURCES += \
     src/messages/layouts/MessageLayoutContainer.cpp \
     src/messages/layouts/MessageLayoutElement.cpp \
     src/messages/Link.cpp \
+    src/messages/MemoryUsage.cpp \
     src/messages/Message.cpp \
     src/messages/MessageBuilder.cpp \
     src/messages/MessageColor.cpp \
@@ -187,6 +192,7 @@ SOURCES += \
     src/messages/search/MessageFlagsPredicate.cpp \
     src/messages/search/SubstringPredicate.cpp \
     src/messages/SharedMessageBuilder.cpp \
+    src/messages/UserMessageIndex.cpp \
     src/providers/bttv/BttvEmotes.cpp \
     src/providers/bttv/LoadBttvChannelEmote.cpp \
     src/providers/chatterino/ChatterinoBadges.cpp \
@@ -222,6 +228,7 @@ SOURCES += \
     src/providers/twitch/TwitchMessageBuilder.cpp \
     src/providers/twitch/TwitchUser.cpp \
     src/RunGui.cpp \
+    src/RunReplay.cpp \
     src/singletons/Badges.cpp \
     src/singletons/Emotes.cpp \
     src/singletons/Fonts.cpp \
@@ -237,6 +244,7 @@ SOURCES += \
     src/singletons/TooltipPreviewImage.cpp \
     src/singletons/Updates.cpp \
     src/singletons/WindowManager.cpp \
+    src/util/Arena.cpp \
     src/util/AttachToConsole.cpp \
     src/util/Clipboard.cpp \
     src/util/DebugCount.cpp \
@@ -289,6 +297,7 @@ SOURCES += \
     src/widgets/helper/DebugPopup.cpp \
     src/widgets/helper/EditableModelView.cpp \
     src/widgets/helper/EffectLabel.cpp \
+    src/widgets/helper/EmoteGrid.cpp \
     src/widgets/helper/NotebookButton.cpp \
     src/widgets/helper/NotebookTab.cpp \
     src/widgets/helper/QColorPicker.cpp \
@@ -332,6 +341,7 @@ SOURCES += \
 
 HEADERS += \
     src/Application.hpp \
+    src/autogenerated/EmojiTableAutogen.hpp \
     src/autogenerated/ResourcesAutogen.hpp \
     src/BaseSettings.hpp \
     src/BaseTheme.hpp \
@@ -365,6 +375,7 @@ HEADERS += \
     src/common/SignalVector.hpp \
     src/common/SignalVectorModel.hpp \
     src/common/Singleton.hpp \
+    src/common/StartupTasks.hpp \
     src/common/UniqueAccess.hpp \
     src/common/Version.hpp \
     src/common/WindowDescriptors.hpp \
@@ -390,6 +401,7 @@ HEADERS += \
     src/controllers/ignores/IgnoreController.hpp \
     src/controllers/ignores/IgnoreModel.hpp \
     src/controllers/ignores/IgnorePhrase.hpp \
+    src/controllers/ignores/IgnorePhraseMatcher.hpp \
     src/controllers/moderationactions/ModerationAction.hpp \
     src/controllers/moderationactions/ModerationActionModel.hpp \
     src/controllers/notifications/NotificationController.hpp \
@@ -399,6 +411,7 @@ HEADERS += \
     src/controllers/taggedusers/TaggedUsersModel.hpp \
     src/debug/AssertInGuiThread.hpp \
     src/debug/Benchmark.hpp \
+    src/debug/Trace.hpp \
     src/ForwardDecl.hpp \
     src/messages/Emote.hpp \
     src/messages/Image.hpp \
@@ -409,6 +422,7 @@ HEADERS += \
     src/messages/LimitedQueue.hpp \
     src/messages/LimitedQueueSnapshot.hpp \
     src/messages/Link.hpp \
+    src/messages/MemoryUsage.hpp \
     src/messages/Message.hpp \
     src/messages/MessageBuilder.hpp \
     src/messages/MessageColor.hpp \
@@ -423,6 +437,7 @@ HEADERS += \
     src/messages/search/SubstringPredicate.hpp \
     src/messages/Selection.hpp \
     src/messages/SharedMessageBuilder.hpp \
+    src/messages/UserMessageIndex.hpp \
     src/PrecompiledHeader.hpp \
     src/providers/bttv/BttvEmotes.hpp \
     src/providers/bttv/LoadBttvChannelEmote.hpp \
@@ -462,6 +477,7 @@ HEADERS += \
     src/providers/twitch/TwitchMessageBuilder.hpp \
     src/providers/twitch/TwitchUser.hpp \
     src/RunGui.hpp \
+    src/RunReplay.hpp \
     src/singletons/Badges.hpp \
     src/singletons/Emotes.hpp \
     src/singletons/Fonts.hpp \
@@ -477,6 +493,7 @@ HEADERS += \
     src/singletons/TooltipPreviewImage.hpp \
     src/singletons/Updates.hpp \
     src/singletons/WindowManager.hpp \
+    src/util/Arena.hpp \
     src/util/AttachToConsole.hpp \
     src/util/Clamp.hpp \
     src/util/Clipboard.hpp \
@@ -552,6 +569,7 @@ HEADERS += \
     src/widgets/helper/DebugPopup.hpp \
     src/widgets/helper/EditableModelView.hpp \
     src/widgets/helper/EffectLabel.hpp \
+    src/widgets/helper/EmoteGrid.hpp \
     src/widgets/helper/Line.hpp \
     src/widgets/helper/NotebookButton.hpp \
     src/widgets/helper/NotebookTab.hpp \
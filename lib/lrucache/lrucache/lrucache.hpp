@@ -84,6 +84,16 @@ public:
         }
     }
 
+    void erase(const key_t &key)
+    {
+        auto it = _cache_items_map.find(key);
+        if (it != _cache_items_map.end())
+        {
+            _cache_items_list.erase(it->second);
+            _cache_items_map.erase(it);
+        }
+    }
+
     bool exists(const key_t &key) const
     {
         return _cache_items_map.find(key) != _cache_items_map.end();
@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+# Generates src/autogenerated/EmojiTableAutogen.{hpp,cpp} from emoji.json so
+# the emoji data doesn't have to be parsed at runtime.
+# Run this from the resources directory after updating emoji.json
+# (see tools/update-emoji-data.sh)
+import json
+
+tone_names = {
+    '1F3FB': 'tone1',
+    '1F3FC': 'tone2',
+    '1F3FD': 'tone3',
+    '1F3FE': 'tone4',
+    '1F3FF': 'tone5',
+}
+
+# Must match EmojiCapability in EmojiTableAutogen.hpp
+capability_flags = [
+    ('has_img_apple', 1 << 0),
+    ('has_img_google', 1 << 1),
+    ('has_img_twitter', 1 << 2),
+    ('has_img_facebook', 1 << 3),
+]
+
+header = \
+'''#pragma once
+
+// This file is generated by resources/generate_emoji_table.py, do not edit
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chatterino {
+
+enum class EmojiCapability : uint8_t {
+    Apple = (1 << 0),
+    Google = (1 << 1),
+    Twitter = (1 << 2),
+    Facebook = (1 << 3),
+};
+
+struct EmojiTableEntry {
+    // i.e. 1F468-200D-2695-FE0F
+    const char *unifiedCode;
+    // nullptr if the emoji has no non-qualified form
+    const char *nonQualifiedCode;
+
+    // range in emojiTableCodepoints making up the emojis value
+    uint16_t valueOffset;
+    uint8_t valueLength;
+
+    // combination of EmojiCapability flags
+    uint8_t capabilities;
+
+    // range in emojiTableShortCodes
+    uint16_t shortCodesOffset;
+    uint8_t shortCodesCount;
+};
+
+extern const char32_t emojiTableCodepoints[];
+extern const char *const emojiTableShortCodes[];
+extern const EmojiTableEntry emojiTable[];
+extern const size_t emojiTableSize;
+
+}  // namespace chatterino
+'''
+
+
+def parse_codepoints(code):
+    return [int(part, 16) for part in code.split('-')]
+
+
+class Table:
+    def __init__(self):
+        self.codepoints = []
+        self.codepoint_offsets = {}
+        self.short_codes = []
+        self.entries = []
+
+    def add_codepoints(self, code):
+        if code in self.codepoint_offsets:
+            return self.codepoint_offsets[code]
+
+        offset = len(self.codepoints)
+        self.codepoints.extend(parse_codepoints(code))
+        self.codepoint_offsets[code] = offset
+        return offset
+
+    def add(self, emoji, short_codes):
+        unified = emoji['unified']
+        non_qualified = emoji.get('non_qualified')
+        value_code = non_qualified if non_qualified else unified
+
+        capabilities = 0
+        for (key, flag) in capability_flags:
+            if emoji.get(key):
+                capabilities |= flag
+
+        value_length = len(value_code.split('-'))
+        assert 0 < value_length <= 9
+
+        self.entries.append({
+            'unified': unified,
+            'non_qualified': non_qualified,
+            'value_offset': self.add_codepoints(value_code),
+            'value_length': value_length,
+            'capabilities': capabilities,
+            'short_codes_offset': len(self.short_codes),
+            'short_codes_count': len(short_codes),
+        })
+        self.short_codes.extend(short_codes)
+
+
+def tone_name(tones):
+    return '-'.join(tone_names[tone] for tone in tones.split('-'))
+
+
+def c_string(value):
+    if value is None:
+        return 'nullptr'
+    return '"' + value.replace('\\', '\\\\').replace('"', '\\"') + '"'
+
+
+with open('./emoji.json', encoding='utf-8') as f:
+    emojis = json.load(f)
+
+table = Table()
+
+for emoji in emojis:
+    table.add(emoji, emoji['short_names'])
+
+    for (tones, variation) in (emoji.get('skin_variations') or {}).items():
+        table.add(variation,
+                  [emoji['short_names'][0] + '_' + tone_name(tones)])
+
+assert len(table.codepoints) < 2**16
+assert len(table.short_codes) < 2**16
+
+with open('../src/autogenerated/EmojiTableAutogen.hpp', 'w') as out:
+    out.write(header)
+
+with open('../src/autogenerated/EmojiTableAutogen.cpp', 'w') as out:
+    out.write('#include "EmojiTableAutogen.hpp"\n\n')
+    out.write('// This file is generated by resources/generate_emoji_table.py, '
+              'do not edit\n\n')
+    out.write('namespace chatterino {\n\n')
+
+    out.write('const char32_t emojiTableCodepoints[] = {\n')
+    for i in range(0, len(table.codepoints), 8):
+        chunk = table.codepoints[i:i + 8]
+        out.write('    ' + ', '.join(f'0x{c:X}' for c in chunk) + ',\n')
+    out.write('};\n\n')
+
+    out.write('const char *const emojiTableShortCodes[] = {\n')
+    for short_code in table.short_codes:
+        out.write(f'    {c_string(short_code)},\n')
+    out.write('};\n\n')
+
+    out.write('const EmojiTableEntry emojiTable[] = {\n')
+    for entry in table.entries:
+        out.write(f'    {{{c_string(entry["unified"])}, '
+                  f'{c_string(entry["non_qualified"])}, '
+                  f'{entry["value_offset"]}, {entry["value_length"]}, '
+                  f'{entry["capabilities"]}, '
+                  f'{entry["short_codes_offset"]}, '
+                  f'{entry["short_codes_count"]}}},\n')
+    out.write('};\n\n')
+
+    out.write('const size_t emojiTableSize =\n'
+              '    sizeof(emojiTable) / sizeof(emojiTable[0]);\n\n')
+
+    out.write('}  // namespace chatterino\n')
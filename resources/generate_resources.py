@@ -4,7 +4,8 @@ from pathlib import Path
 from _generate_resources import *
 
 ignored_files = ['qt.conf', 'resources.qrc', 'resources_autogenerated.qrc', 'windows.rc',
-        'generate_resources.py', '_generate_resources.py']
+        'generate_resources.py', '_generate_resources.py', 'generate_emoji_table.py',
+        'emoji.json']
 
 ignored_names = ['.gitignore', '.DS_Store']
 
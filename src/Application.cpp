@@ -3,6 +3,8 @@
 #include <atomic>
 
 #include "common/Args.hpp"
+#include "common/Channel.hpp"
+#include "common/Env.hpp"
 #include "common/QLogging.hpp"
 #include "common/Version.hpp"
 #include "controllers/accounts/AccountController.hpp"
@@ -30,14 +32,21 @@
 #include "singletons/Toasts.hpp"
 #include "singletons/Updates.hpp"
 #include "singletons/WindowManager.hpp"
+#include "util/DebugCount.hpp"
 #include "util/IsBigEndian.hpp"
 #include "util/PostToThread.hpp"
 #include "util/RapidjsonHelpers.hpp"
+#include "util/StreamerMode.hpp"
 #include "widgets/Notebook.hpp"
 #include "widgets/Window.hpp"
 #include "widgets/splits/Split.hpp"
 
 #include <QDesktopServices>
+#include <QFile>
+#include <QTimer>
+#include <boost/core/demangle.hpp>
+
+#include <typeinfo>
 
 namespace chatterino {
 
@@ -79,8 +88,24 @@ void Application::initialize(Settings &settings, Paths &paths)
     assert(isAppInitialized == false);
     isAppInitialized = true;
 
+    // messages are built on worker threads, which check the streamer mode
+    initStreamerMode();
+
+    // Work that doesn't need the GUI thread starts right away, so it runs
+    // while the changelog prompt is shown and the singletons before the
+    // ones that need it are initialized
+    auto emojiTable = this->startup_.add(
+        "load emoji table", StartupTasks::Thread::Background, {}, [this] {
+            this->emotes->emojis.loadTable();
+        });
+    auto windowLayout = this->startup_.add(
+        "read window layout", StartupTasks::Thread::Background, {}, [this] {
+            this->windows->preloadWindowLayout();
+        });
+    this->startup_.start();
+
     // Show changelog
-    if (!getArgs().isFramelessEmbed &&
+    if (!getArgs().isFramelessEmbed && !getArgs().replayFile &&
         getSettings()->currentVersion.getValue() != "" &&
         getSettings()->currentVersion.getValue() != CHATTERINO_VERSION)
     {
@@ -105,11 +130,32 @@ void Application::initialize(Settings &settings, Paths &paths)
         }
     }
 
+    // The singletons expect the ones before them to be initialized (e.g. the
+    // emotes connect to the account change before the accounts are loaded),
+    // so each of them depends on the previous one
+    std::vector<StartupTasks::TaskId> previous;
     for (auto &singleton : this->singletons_)
     {
-        singleton->initialize(settings, paths);
+        auto dependencies = previous;
+        if (singleton.get() == this->emotes)
+        {
+            dependencies.push_back(emojiTable);
+        }
+        else if (singleton.get() == this->windows)
+        {
+            dependencies.push_back(windowLayout);
+        }
+
+        previous = {this->startup_.add(
+            "initialize " + singletonName(*singleton),
+            StartupTasks::Thread::Gui, std::move(dependencies),
+            [&singleton, &settings, &paths] {
+                singleton->initialize(settings, paths);
+            })};
     }
 
+    this->startup_.runAll();
+
     // add crash message
     if (!getArgs().isFramelessEmbed && getArgs().crashRecovery)
     {
@@ -134,22 +180,37 @@ void Application::initialize(Settings &settings, Paths &paths)
 
     this->windows->updateWordTypeMask();
 
+    auto start = this->startup_.elapsed();
     if (!getArgs().isFramelessEmbed)
     {
         this->initNm(paths);
     }
     this->initPubsub();
+    this->initStatsFile();
+    this->initScrollbackBudget();
+    this->startup_.addTiming("initialize native messaging and pubsub", start,
+                             this->startup_.elapsed() - start);
 }
 
 int Application::run(QApplication &qtApp)
 {
     assert(isAppInitialized);
 
+    this->startingUp_ = false;
     this->twitch.server->connect();
 
     if (!getArgs().isFramelessEmbed)
     {
+        auto start = this->startup_.elapsed();
         this->windows->getMainWindow().show();
+
+        // runs once the events of the first show, including its first paint,
+        // were handled
+        QTimer::singleShot(0, [this, start] {
+            this->startup_.addTiming("show main window", start,
+                                     this->startup_.elapsed() - start);
+            this->reportStartup();
+        });
     }
 
     getSettings()->betaUpdates.connect(
@@ -175,6 +236,31 @@ int Application::run(QApplication &qtApp)
     return qtApp.exec();
 }
 
+bool Application::isStartingUp() const
+{
+    return this->startingUp_;
+}
+
+void Application::reportStartup()
+{
+    qCInfo(chatterinoApp).noquote()
+        << QString("Started in %1 ms:\n").arg(this->startup_.elapsed()) +
+               this->startup_.report();
+
+    for (auto &&timing : this->startup_.timings())
+    {
+        DebugCount::set("startup ms " + timing.name, timing.duration);
+    }
+    DebugCount::set("startup ms total", this->startup_.elapsed());
+}
+
+QString Application::singletonName(const Singleton &singleton)
+{
+    return QString::fromStdString(
+               boost::core::demangle(typeid(singleton).name()))
+        .remove("chatterino::");
+}
+
 void Application::save()
 {
     for (auto &singleton : this->singletons_)
@@ -195,6 +281,42 @@ void Application::initNm(Paths &paths)
 #endif
 }
 
+void Application::initStatsFile()
+{
+    auto path = Env::get().statsFile;
+    if (path.isEmpty())
+    {
+        return;
+    }
+
+    // used by tools/mock-servers to read the counters of a running instance
+    auto timer = new QTimer(qApp);
+    QObject::connect(timer, &QTimer::timeout, [path] {
+        QFile file(path);
+        if (file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        {
+            file.write(DebugCount::getDebugText().toUtf8());
+        }
+    });
+    timer->start(1000);
+}
+
+void Application::initScrollbackBudget()
+{
+    auto update = [] {
+        Channel::updateMemoryBudgets(
+            int64_t(getSettings()->scrollbackMemoryBudget.getValue()) * 1024 *
+            1024);
+    };
+
+    getSettings()->scrollbackMemoryBudget.connect(update, false);
+
+    // the shares of the channels follow their activity
+    auto timer = new QTimer(qApp);
+    QObject::connect(timer, &QTimer::timeout, update);
+    timer->start(5000);
+}
+
 void Application::initPubsub()
 {
     this->twitch.pubsub->signals_.moderation.chatCleared.connect(
@@ -412,7 +534,11 @@ void Application::initPubsub()
         }
     });
 
-    this->twitch.pubsub->start();
+    // captures are replayed without connecting to Twitch
+    if (!getArgs().replayFile)
+    {
+        this->twitch.pubsub->start();
+    }
 
     auto RequestModerationActions = [=]() {
         this->twitch.server->pubsub->unlistenAllModerationActions();
@@ -5,6 +5,7 @@
 
 #include "common/SignalVector.hpp"
 #include "common/Singleton.hpp"
+#include "common/StartupTasks.hpp"
 #include "singletons/NativeMessaging.hpp"
 
 namespace chatterino {
@@ -30,6 +31,9 @@ class FfzBadges;
 
 class Application
 {
+    // times the startup, constructed before the singletons so it can time
+    // their constructors as well
+    StartupTasks startup_;
     std::vector<std::unique_ptr<Singleton>> singletons_;
     int argc_;
     char **argv_;
@@ -45,6 +49,10 @@ public:
 
     int run(QApplication &qtApp);
 
+    /// True until run() is called, e.g. while the channels of the window
+    /// layout are opened
+    bool isStartingUp() const;
+
     friend void test();
 
     Theme *const themes{};
@@ -72,17 +80,27 @@ private:
     void addSingleton(Singleton *singleton);
     void initPubsub();
     void initNm(Paths &paths);
+    void initStatsFile();
+    void initScrollbackBudget();
+    void reportStartup();
 
     template <typename T,
               typename = std::enable_if_t<std::is_base_of<Singleton, T>::value>>
     T &emplace()
     {
+        auto start = this->startup_.elapsed();
         auto t = new T;
+        this->startup_.addTiming("construct " + singletonName(*t), start,
+                                 this->startup_.elapsed() - start);
+
         this->singletons_.push_back(std::unique_ptr<T>(t));
         return *t;
     }
 
+    static QString singletonName(const Singleton &singleton);
+
     NativeMessagingServer nmServer{};
+    bool startingUp_ = true;
 };
 
 Application *getApp();
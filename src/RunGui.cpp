@@ -13,6 +13,7 @@
 #include "common/Modes.hpp"
 #include "common/NetworkManager.hpp"
 #include "common/QLogging.hpp"
+#include "debug/Trace.hpp"
 #include "singletons/Paths.hpp"
 #include "singletons/Resources.hpp"
 #include "singletons/Settings.hpp"
@@ -227,6 +228,11 @@ void runGui(QApplication &a, Paths &paths, Settings &settings)
 
     chatterino::NetworkManager::deinit();
 
+    if (getArgs().traceFile)
+    {
+        Trace::exportJson(*getArgs().traceFile);
+    }
+
 #ifdef USEWINSDK
     // flushing windows clipboard to keep copied messages
     flushClipboard();
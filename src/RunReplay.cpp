@@ -0,0 +1,392 @@
+#include "RunReplay.hpp"
+
+#include <QApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QPixmap>
+#include <QRegularExpression>
+#include <QStyleFactory>
+#include <QTextStream>
+#include <QTimer>
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "Application.hpp"
+#include "common/Args.hpp"
+#include "common/NetworkManager.hpp"
+#include "common/QLogging.hpp"
+#include "debug/Trace.hpp"
+#include "providers/twitch/PubsubClient.hpp"
+#include "providers/twitch/TwitchIrcServer.hpp"
+#include "singletons/Resources.hpp"
+#include "singletons/Settings.hpp"
+#include "util/DebugCount.hpp"
+#include "widgets/helper/ChannelView.hpp"
+
+// Events within this many milliseconds of capture time are handled together
+// and followed by one paint, like a frame at 60 fps
+#define REPLAY_FRAME_MS 16
+#define REPLAY_VIEW_WIDTH 500
+#define REPLAY_VIEW_HEIGHT 800
+
+namespace chatterino {
+namespace {
+    struct ReplayEvent {
+        enum class Type { Irc, PubSub } type;
+        // ms since epoch
+        int64_t time;
+        QString data;
+    };
+
+    struct Frame {
+        // time spent in the message handlers
+        int64_t dispatchUs;
+        // time spent painting the views
+        int64_t paintUs;
+        // how late the frame was compared to the capture, realtime only
+        int64_t lateMs;
+    };
+
+    int64_t sentTime(const QString &ircMessage)
+    {
+        static QRegularExpression regex(R"(^@\S*\btmi-sent-ts=(\d+))");
+
+        auto match = regex.match(ircMessage);
+        return match.hasMatch() ? match.captured(1).toLongLong() : 0;
+    }
+
+    bool readCapture(const QString &path, std::vector<ReplayEvent> &events)
+    {
+        QFile file(path);
+        if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+        {
+            return false;
+        }
+
+        static QRegularExpression timedRegex(R"(^(\d+) (irc|pubsub) (.*)$)");
+
+        QTextStream stream(&file);
+        stream.setCodec("UTF-8");
+
+        int64_t lastTime = 0;
+        while (!stream.atEnd())
+        {
+            auto line = stream.readLine();
+            if (line.isEmpty() || line.startsWith('#'))
+            {
+                continue;
+            }
+
+            ReplayEvent event{ReplayEvent::Type::Irc, 0, line};
+
+            auto match = timedRegex.match(line);
+            if (match.hasMatch())
+            {
+                event.time = match.captured(1).toLongLong();
+                event.data = match.captured(3);
+                if (match.captured(2) == "pubsub")
+                {
+                    event.type = ReplayEvent::Type::PubSub;
+                }
+            }
+            else
+            {
+                event.time = sentTime(line);
+            }
+
+            // lines without a time happen together with the previous one
+            lastTime = event.time = std::max(event.time, lastTime);
+            events.push_back(std::move(event));
+        }
+
+        // lines before the first time (e.g. JOIN and ROOMSTATE) happen
+        // together with the first timed line
+        auto firstTimed = std::find_if(events.begin(), events.end(),
+                                       [](const ReplayEvent &event) {
+                                           return event.time != 0;
+                                       });
+        if (firstTimed != events.end())
+        {
+            for (auto it = events.begin(); it != firstTimed; ++it)
+            {
+                it->time = firstTimed->time;
+            }
+        }
+
+        return true;
+    }
+
+    int64_t percentile(std::vector<int64_t> values, double p)
+    {
+        if (values.empty())
+        {
+            return 0;
+        }
+
+        auto nth = values.begin() + size_t((values.size() - 1) * p);
+        std::nth_element(values.begin(), nth, values.end());
+        return *nth;
+    }
+
+    QString describe(const std::vector<int64_t> &values, double scale,
+                     const QString &unit)
+    {
+        auto format = [&](int64_t value) {
+            return QString::number(double(value) / scale, 'f', 2);
+        };
+
+        int64_t sum = 0;
+        for (auto value : values)
+        {
+            sum += value;
+        }
+        auto average = values.empty() ? 0 : sum / int64_t(values.size());
+
+        return QString("avg %1, p50 %2, p95 %3, p99 %4, max %5 %6")
+            .arg(format(average))
+            .arg(format(percentile(values, 0.5)))
+            .arg(format(percentile(values, 0.95)))
+            .arg(format(percentile(values, 0.99)))
+            .arg(format(percentile(values, 1)))
+            .arg(unit);
+    }
+
+    class Replay
+    {
+    public:
+        Replay(std::vector<ReplayEvent> events, bool realtime)
+            : events_(std::move(events))
+            , realtime_(realtime)
+        {
+        }
+
+        void start()
+        {
+            this->timer_.start();
+            this->step();
+        }
+
+    private:
+        void step()
+        {
+            if (this->index_ >= this->events_.size())
+            {
+                QApplication::exit(this->report() ? 0 : 1);
+                return;
+            }
+
+            auto frameStart = this->events_[this->index_].time;
+            int64_t lateMs = 0;
+
+            if (this->realtime_)
+            {
+                auto due = frameStart - this->events_.front().time;
+                auto now = this->timer_.elapsed();
+                if (due > now)
+                {
+                    auto delay = std::min<int64_t>(
+                        due - now, std::numeric_limits<int>::max());
+                    QTimer::singleShot(int(delay), [this] {
+                        this->step();
+                    });
+                    return;
+                }
+                lateMs = now - due;
+            }
+
+            QElapsedTimer timer;
+            timer.start();
+
+            while (this->index_ < this->events_.size() &&
+                   this->events_[this->index_].time <
+                       frameStart + REPLAY_FRAME_MS)
+            {
+                this->dispatch(this->events_[this->index_++]);
+            }
+
+            auto dispatchUs = timer.nsecsElapsed() / 1000;
+            timer.restart();
+
+            for (auto &view : this->views_)
+            {
+                QPixmap target(view.second->size());
+                view.second->render(&target);
+            }
+
+            this->frames_.push_back(
+                {dispatchUs, timer.nsecsElapsed() / 1000, lateMs});
+
+            // let queued work (e.g. decoded images) run between frames
+            QTimer::singleShot(0, [this] {
+                this->step();
+            });
+        }
+
+        void dispatch(const ReplayEvent &event)
+        {
+            auto app = getApp();
+
+            if (event.type == ReplayEvent::Type::PubSub)
+            {
+                this->pubsubCount_++;
+                app->twitch.pubsub->addFakeMessage(event.data);
+                return;
+            }
+
+            static QRegularExpression channelRegex(
+                R"(^(?:@\S* )?(?::\S+ )?[A-Z0-9]+ #(\w+))");
+
+            auto match = channelRegex.match(event.data);
+            if (match.hasMatch())
+            {
+                this->addView(match.captured(1));
+            }
+
+            this->ircCount_++;
+            app->twitch.server->addFakeMessage(event.data);
+        }
+
+        void addView(const QString &channelName)
+        {
+            if (this->views_.count(channelName) != 0)
+            {
+                return;
+            }
+
+            auto view = std::make_unique<ChannelView>();
+            // the views have to be "visible" to lay out their messages
+            view->setAttribute(Qt::WA_DontShowOnScreen);
+            view->resize(REPLAY_VIEW_WIDTH, REPLAY_VIEW_HEIGHT);
+            view->setChannel(
+                getApp()->twitch.server->getOrAddChannel(channelName));
+            view->show();
+
+            this->views_.emplace(channelName, std::move(view));
+        }
+
+        // Returns false if the replay sent requests to the network, which
+        // would make it depend on what the servers return at the time
+        bool report()
+        {
+            std::vector<int64_t> dispatch, paint, total, late;
+            int overBudget = 0;
+
+            for (auto &frame : this->frames_)
+            {
+                dispatch.push_back(frame.dispatchUs);
+                paint.push_back(frame.paintUs);
+                total.push_back(frame.dispatchUs + frame.paintUs);
+                late.push_back(frame.lateMs);
+
+                if (frame.dispatchUs + frame.paintUs > 1000000 / 60)
+                {
+                    overBudget++;
+                }
+            }
+
+            auto elapsedMs = std::max<int64_t>(1, this->timer_.elapsed());
+            auto captureMs = this->events_.empty()
+                                 ? 0
+                                 : this->events_.back().time -
+                                       this->events_.front().time;
+
+            QString text;
+            QTextStream out(&text);
+            out << "Replayed " << this->events_.size() << " events ("
+                << this->ircCount_ << " irc, " << this->pubsubCount_
+                << " pubsub) into " << this->views_.size() << " channels\n";
+            out << "capture duration: " << captureMs << " ms\n";
+            out << "replay duration:  " << elapsedMs << " ms\n";
+            out << "throughput:       "
+                << this->events_.size() * 1000 / elapsedMs << " events/s\n";
+            out << "frames:           " << this->frames_.size() << ", "
+                << overBudget << " over 16.7 ms\n";
+            out << "dispatch:         " << describe(dispatch, 1000, "ms")
+                << "\n";
+            out << "paint:            " << describe(paint, 1000, "ms")
+                << "\n";
+            out << "frame:            " << describe(total, 1000, "ms")
+                << "\n";
+            if (this->realtime_)
+            {
+                out << "behind capture:   " << describe(late, 1, "ms")
+                    << "\n";
+            }
+
+            int64_t networkRequests = 0;
+            for (auto priority : {NetworkRequestPriority::Interactive,
+                                  NetworkRequestPriority::Metadata,
+                                  NetworkRequestPriority::Image})
+            {
+                networkRequests += NetworkManager::stats(priority).started;
+            }
+            out << "network requests: " << networkRequests << "\n";
+
+            out << "\n" << DebugCount::getDebugText();
+
+            qInfo().noquote() << text;
+
+            if (networkRequests != 0)
+            {
+                qCWarning(chatterinoApp)
+                    << "The replay sent" << networkRequests
+                    << "network requests";
+                return false;
+            }
+            return true;
+        }
+
+        std::vector<ReplayEvent> events_;
+        bool realtime_;
+        size_t index_ = 0;
+        QElapsedTimer timer_;
+
+        std::unordered_map<QString, std::unique_ptr<ChannelView>> views_;
+        std::vector<Frame> frames_;
+        size_t ircCount_ = 0;
+        size_t pubsubCount_ = 0;
+    };
+}  // namespace
+
+void runReplay(QApplication &a, Paths &paths, Settings &settings)
+{
+    QApplication::setAttribute(Qt::AA_Use96Dpi, true);
+    QApplication::setStyle(QStyleFactory::create("Fusion"));
+    initResources();
+
+    std::vector<ReplayEvent> events;
+    if (!readCapture(getArgs().replayFile.get(), events))
+    {
+        qCWarning(chatterinoApp)
+            << "Unable to read capture" << getArgs().replayFile.get();
+        _exit(1);
+    }
+
+    // images and emotes are only loaded from the cache, so the replay
+    // doesn't depend on the network
+    chatterino::NetworkManager::init();
+    chatterino::NetworkManager::setOffline(true);
+
+    Application app(settings, paths);
+    app.initialize(settings, paths);
+
+    Replay replay(std::move(events), getArgs().replayRealtime);
+    QTimer::singleShot(0, [&replay] {
+        replay.start();
+    });
+    auto result = a.exec();
+
+    chatterino::NetworkManager::deinit();
+
+    if (getArgs().traceFile)
+    {
+        Trace::exportJson(*getArgs().traceFile);
+    }
+
+    _exit(result);
+}
+
+}  // namespace chatterino
@@ -0,0 +1,19 @@
+#pragma once
+
+class QApplication;
+
+namespace chatterino {
+class Paths;
+class Settings;
+
+/// Replays the capture passed with --replay through the message handlers,
+/// channels and offscreen chat views, then prints a performance report.
+///
+/// Every line of the capture is one of
+///   <ms since epoch> irc <raw irc message>
+///   <ms since epoch> pubsub <pubsub message json>
+///   <raw irc message>
+/// Raw irc messages without a time use their tmi-sent-ts tag. Empty lines and
+/// lines starting with # are skipped.
+void runReplay(QApplication &a, Paths &paths, Settings &settings);
+}  // namespace chatterino
@@ -0,0 +1,8274 @@
+#include "EmojiTableAutogen.hpp"
+
+// This file is generated by resources/generate_emoji_table.py, do not edit
+
+namespace chatterino {
+
+const char32_t emojiTableCodepoints[] = {
+    0x23, 0x20E3, 0x2A, 0x20E3, 0x30, 0x20E3, 0x31, 0x20E3,
+    0x32, 0x20E3, 0x33, 0x20E3, 0x34, 0x20E3, 0x35, 0x20E3,
+    0x36, 0x20E3, 0x37, 0x20E3, 0x38, 0x20E3, 0x39, 0x20E3,
+    0xA9, 0xAE, 0x1F004, 0x1F0CF, 0x1F170, 0x1F171, 0x1F17E, 0x1F17F,
+    0x1F18E, 0x1F191, 0x1F192, 0x1F193, 0x1F194, 0x1F195, 0x1F196, 0x1F197,
+    0x1F198, 0x1F199, 0x1F19A, 0x1F1E6, 0x1F1E8, 0x1F1E6, 0x1F1E9, 0x1F1E6,
+    0x1F1EA, 0x1F1E6, 0x1F1EB, 0x1F1E6, 0x1F1EC, 0x1F1E6, 0x1F1EE, 0x1F1E6,
+    0x1F1F1, 0x1F1E6, 0x1F1F2, 0x1F1E6, 0x1F1F4, 0x1F1E6, 0x1F1F6, 0x1F1E6,
+    0x1F1F7, 0x1F1E6, 0x1F1F8, 0x1F1E6, 0x1F1F9, 0x1F1E6, 0x1F1FA, 0x1F1E6,
+    0x1F1FC, 0x1F1E6, 0x1F1FD, 0x1F1E6, 0x1F1FF, 0x1F1E7, 0x1F1E6, 0x1F1E7,
+    0x1F1E7, 0x1F1E7, 0x1F1E9, 0x1F1E7, 0x1F1EA, 0x1F1E7, 0x1F1EB, 0x1F1E7,
+    0x1F1EC, 0x1F1E7, 0x1F1ED, 0x1F1E7, 0x1F1EE, 0x1F1E7, 0x1F1EF, 0x1F1E7,
+    0x1F1F1, 0x1F1E7, 0x1F1F2, 0x1F1E7, 0x1F1F3, 0x1F1E7, 0x1F1F4, 0x1F1E7,
+    0x1F1F6, 0x1F1E7, 0x1F1F7, 0x1F1E7, 0x1F1F8, 0x1F1E7, 0x1F1F9, 0x1F1E7,
+    0x1F1FB, 0x1F1E7, 0x1F1FC, 0x1F1E7, 0x1F1FE, 0x1F1E7, 0x1F1FF, 0x1F1E8,
+    0x1F1E6, 0x1F1E8, 0x1F1E8, 0x1F1E8, 0x1F1E9, 0x1F1E8, 0x1F1EB, 0x1F1E8,
+    0x1F1EC, 0x1F1E8, 0x1F1ED, 0x1F1E8, 0x1F1EE, 0x1F1E8, 0x1F1F0, 0x1F1E8,
+    0x1F1F1, 0x1F1E8, 0x1F1F2, 0x1F1E8, 0x1F1F3, 0x1F1E8, 0x1F1F4, 0x1F1E8,
+    0x1F1F5, 0x1F1E8, 0x1F1F7, 0x1F1E8, 0x1F1FA, 0x1F1E8, 0x1F1FB, 0x1F1E8,
+    0x1F1FC, 0x1F1E8, 0x1F1FD, 0x1F1E8, 0x1F1FE, 0x1F1E8, 0x1F1FF, 0x1F1E9,
+    0x1F1EA, 0x1F1E9, 0x1F1EC, 0x1F1E9, 0x1F1EF, 0x1F1E9, 0x1F1F0, 0x1F1E9,
+    0x1F1F2, 0x1F1E9, 0x1F1F4, 0x1F1E9, 0x1F1FF, 0x1F1EA, 0x1F1E6, 0x1F1EA,
+    0x1F1E8, 0x1F1EA, 0x1F1EA, 0x1F1EA, 0x1F1EC, 0x1F1EA, 0x1F1ED, 0x1F1EA,
+    0x1F1F7, 0x1F1EA, 0x1F1F8, 0x1F1EA, 0x1F1F9, 0x1F1EA, 0x1F1FA, 0x1F1EB,
+    0x1F1EE, 0x1F1EB, 0x1F1EF, 0x1F1EB, 0x1F1F0, 0x1F1EB, 0x1F1F2, 0x1F1EB,
+    0x1F1F4, 0x1F1EB, 0x1F1F7, 0x1F1EC, 0x1F1E6, 0x1F1EC, 0x1F1E7, 0x1F1EC,
+    0x1F1E9, 0x1F1EC, 0x1F1EA, 0x1F1EC, 0x1F1EB, 0x1F1EC, 0x1F1EC, 0x1F1EC,
+    0x1F1ED, 0x1F1EC, 0x1F1EE, 0x1F1EC, 0x1F1F1, 0x1F1EC, 0x1F1F2, 0x1F1EC,
+    0x1F1F3, 0x1F1EC, 0x1F1F5, 0x1F1EC, 0x1F1F6, 0x1F1EC, 0x1F1F7, 0x1F1EC,
+    0x1F1F8, 0x1F1EC, 0x1F1F9, 0x1F1EC, 0x1F1FA, 0x1F1EC, 0x1F1FC, 0x1F1EC,
+    0x1F1FE, 0x1F1ED, 0x1F1F0, 0x1F1ED, 0x1F1F2, 0x1F1ED, 0x1F1F3, 0x1F1ED,
+    0x1F1F7, 0x1F1ED, 0x1F1F9, 0x1F1ED, 0x1F1FA, 0x1F1EE, 0x1F1E8, 0x1F1EE,
+    0x1F1E9, 0x1F1EE, 0x1F1EA, 0x1F1EE, 0x1F1F1, 0x1F1EE, 0x1F1F2, 0x1F1EE,
+    0x1F1F3, 0x1F1EE, 0x1F1F4, 0x1F1EE, 0x1F1F6, 0x1F1EE, 0x1F1F7, 0x1F1EE,
+    0x1F1F8, 0x1F1EE, 0x1F1F9, 0x1F1EF, 0x1F1EA, 0x1F1EF, 0x1F1F2, 0x1F1EF,
+    0x1F1F4, 0x1F1EF, 0x1F1F5, 0x1F1F0, 0x1F1EA, 0x1F1F0, 0x1F1EC, 0x1F1F0,
+    0x1F1ED, 0x1F1F0, 0x1F1EE, 0x1F1F0, 0x1F1F2, 0x1F1F0, 0x1F1F3, 0x1F1F0,
+    0x1F1F5, 0x1F1F0, 0x1F1F7, 0x1F1F0, 0x1F1FC, 0x1F1F0, 0x1F1FE, 0x1F1F0,
+    0x1F1FF, 0x1F1F1, 0x1F1E6, 0x1F1F1, 0x1F1E7, 0x1F1F1, 0x1F1E8, 0x1F1F1,
+    0x1F1EE, 0x1F1F1, 0x1F1F0, 0x1F1F1, 0x1F1F7, 0x1F1F1, 0x1F1F8, 0x1F1F1,
+    0x1F1F9, 0x1F1F1, 0x1F1FA, 0x1F1F1, 0x1F1FB, 0x1F1F1, 0x1F1FE, 0x1F1F2,
+    0x1F1E6, 0x1F1F2, 0x1F1E8, 0x1F1F2, 0x1F1E9, 0x1F1F2, 0x1F1EA, 0x1F1F2,
+    0x1F1EB, 0x1F1F2, 0x1F1EC, 0x1F1F2, 0x1F1ED, 0x1F1F2, 0x1F1F0, 0x1F1F2,
+    0x1F1F1, 0x1F1F2, 0x1F1F2, 0x1F1F2, 0x1F1F3, 0x1F1F2, 0x1F1F4, 0x1F1F2,
+    0x1F1F5, 0x1F1F2, 0x1F1F6, 0x1F1F2, 0x1F1F7, 0x1F1F2, 0x1F1F8, 0x1F1F2,
+    0x1F1F9, 0x1F1F2, 0x1F1FA, 0x1F1F2, 0x1F1FB, 0x1F1F2, 0x1F1FC, 0x1F1F2,
+    0x1F1FD, 0x1F1F2, 0x1F1FE, 0x1F1F2, 0x1F1FF, 0x1F1F3, 0x1F1E6, 0x1F1F3,
+    0x1F1E8, 0x1F1F3, 0x1F1EA, 0x1F1F3, 0x1F1EB, 0x1F1F3, 0x1F1EC, 0x1F1F3,
+    0x1F1EE, 0x1F1F3, 0x1F1F1, 0x1F1F3, 0x1F1F4, 0x1F1F3, 0x1F1F5, 0x1F1F3,
+    0x1F1F7, 0x1F1F3, 0x1F1FA, 0x1F1F3, 0x1F1FF, 0x1F1F4, 0x1F1F2, 0x1F1F5,
+    0x1F1E6, 0x1F1F5, 0x1F1EA, 0x1F1F5, 0x1F1EB, 0x1F1F5, 0x1F1EC, 0x1F1F5,
+    0x1F1ED, 0x1F1F5, 0x1F1F0, 0x1F1F5, 0x1F1F1, 0x1F1F5, 0x1F1F2, 0x1F1F5,
+    0x1F1F3, 0x1F1F5, 0x1F1F7, 0x1F1F5, 0x1F1F8, 0x1F1F5, 0x1F1F9, 0x1F1F5,
+    0x1F1FC, 0x1F1F5, 0x1F1FE, 0x1F1F6, 0x1F1E6, 0x1F1F7, 0x1F1EA, 0x1F1F7,
+    0x1F1F4, 0x1F1F7, 0x1F1F8, 0x1F1F7, 0x1F1FA, 0x1F1F7, 0x1F1FC, 0x1F1F8,
+    0x1F1E6, 0x1F1F8, 0x1F1E7, 0x1F1F8, 0x1F1E8, 0x1F1F8, 0x1F1E9, 0x1F1F8,
+    0x1F1EA, 0x1F1F8, 0x1F1EC, 0x1F1F8, 0x1F1ED, 0x1F1F8, 0x1F1EE, 0x1F1F8,
+    0x1F1EF, 0x1F1F8, 0x1F1F0, 0x1F1F8, 0x1F1F1, 0x1F1F8, 0x1F1F2, 0x1F1F8,
+    0x1F1F3, 0x1F1F8, 0x1F1F4, 0x1F1F8, 0x1F1F7, 0x1F1F8, 0x1F1F8, 0x1F1F8,
+    0x1F1F9, 0x1F1F8, 0x1F1FB, 0x1F1F8, 0x1F1FD, 0x1F1F8, 0x1F1FE, 0x1F1F8,
+    0x1F1FF, 0x1F1F9, 0x1F1E6, 0x1F1F9, 0x1F1E8, 0x1F1F9, 0x1F1E9, 0x1F1F9,
+    0x1F1EB, 0x1F1F9, 0x1F1EC, 0x1F1F9, 0x1F1ED, 0x1F1F9, 0x1F1EF, 0x1F1F9,
+    0x1F1F0, 0x1F1F9, 0x1F1F1, 0x1F1F9, 0x1F1F2, 0x1F1F9, 0x1F1F3, 0x1F1F9,
+    0x1F1F4, 0x1F1F9, 0x1F1F7, 0x1F1F9, 0x1F1F9, 0x1F1F9, 0x1F1FB, 0x1F1F9,
+    0x1F1FC, 0x1F1F9, 0x1F1FF, 0x1F1FA, 0x1F1E6, 0x1F1FA, 0x1F1EC, 0x1F1FA,
+    0x1F1F2, 0x1F1FA, 0x1F1F3, 0x1F1FA, 0x1F1F8, 0x1F1FA, 0x1F1FE, 0x1F1FA,
+    0x1F1FF, 0x1F1FB, 0x1F1E6, 0x1F1FB, 0x1F1E8, 0x1F1FB, 0x1F1EA, 0x1F1FB,
+    0x1F1EC, 0x1F1FB, 0x1F1EE, 0x1F1FB, 0x1F1F3, 0x1F1FB, 0x1F1FA, 0x1F1FC,
+    0x1F1EB, 0x1F1FC, 0x1F1F8, 0x1F1FD, 0x1F1F0, 0x1F1FE, 0x1F1EA, 0x1F1FE,
+    0x1F1F9, 0x1F1FF, 0x1F1E6, 0x1F1FF, 0x1F1F2, 0x1F1FF, 0x1F1FC, 0x1F201,
+    0x1F202, 0x1F21A, 0x1F22F, 0x1F232, 0x1F233, 0x1F234, 0x1F235, 0x1F236,
+    0x1F237, 0x1F238, 0x1F239, 0x1F23A, 0x1F250, 0x1F251, 0x1F300, 0x1F301,
+    0x1F302, 0x1F303, 0x1F304, 0x1F305, 0x1F306, 0x1F307, 0x1F308, 0x1F309,
+    0x1F30A, 0x1F30B, 0x1F30C, 0x1F30D, 0x1F30E, 0x1F30F, 0x1F310, 0x1F311,
+    0x1F312, 0x1F313, 0x1F314, 0x1F315, 0x1F316, 0x1F317, 0x1F318, 0x1F319,
+    0x1F31A, 0x1F31B, 0x1F31C, 0x1F31D, 0x1F31E, 0x1F31F, 0x1F320, 0x1F321,
+    0x1F324, 0x1F325, 0x1F326, 0x1F327, 0x1F328, 0x1F329, 0x1F32A, 0x1F32B,
+    0x1F32C, 0x1F32D, 0x1F32E, 0x1F32F, 0x1F330, 0x1F331, 0x1F332, 0x1F333,
+    0x1F334, 0x1F335, 0x1F336, 0x1F337, 0x1F338, 0x1F339, 0x1F33A, 0x1F33B,
+    0x1F33C, 0x1F33D, 0x1F33E, 0x1F33F, 0x1F340, 0x1F341, 0x1F342, 0x1F343,
+    0x1F344, 0x1F345, 0x1F346, 0x1F347, 0x1F348, 0x1F349, 0x1F34A, 0x1F34B,
+    0x1F34C, 0x1F34D, 0x1F34E, 0x1F34F, 0x1F350, 0x1F351, 0x1F352, 0x1F353,
+    0x1F354, 0x1F355, 0x1F356, 0x1F357, 0x1F358, 0x1F359, 0x1F35A, 0x1F35B,
+    0x1F35C, 0x1F35D, 0x1F35E, 0x1F35F, 0x1F360, 0x1F361, 0x1F362, 0x1F363,
+    0x1F364, 0x1F365, 0x1F366, 0x1F367, 0x1F368, 0x1F369, 0x1F36A, 0x1F36B,
+    0x1F36C, 0x1F36D, 0x1F36E, 0x1F36F, 0x1F370, 0x1F371, 0x1F372, 0x1F373,
+    0x1F374, 0x1F375, 0x1F376, 0x1F377, 0x1F378, 0x1F379, 0x1F37A, 0x1F37B,
+    0x1F37C, 0x1F37D, 0x1F37E, 0x1F37F, 0x1F380, 0x1F381, 0x1F382, 0x1F383,
+    0x1F384, 0x1F385, 0x1F385, 0x1F3FB, 0x1F385, 0x1F3FC, 0x1F385, 0x1F3FD,
+    0x1F385, 0x1F3FE, 0x1F385, 0x1F3FF, 0x1F386, 0x1F387, 0x1F388, 0x1F389,
+    0x1F38A, 0x1F38B, 0x1F38C, 0x1F38D, 0x1F38E, 0x1F38F, 0x1F390, 0x1F391,
+    0x1F392, 0x1F393, 0x1F396, 0x1F397, 0x1F399, 0x1F39A, 0x1F39B, 0x1F39E,
+    0x1F39F, 0x1F3A0, 0x1F3A1, 0x1F3A2, 0x1F3A3, 0x1F3A4, 0x1F3A5, 0x1F3A6,
+    0x1F3A7, 0x1F3A8, 0x1F3A9, 0x1F3AA, 0x1F3AB, 0x1F3AC, 0x1F3AD, 0x1F3AE,
+    0x1F3AF, 0x1F3B0, 0x1F3B1, 0x1F3B2, 0x1F3B3, 0x1F3B4, 0x1F3B5, 0x1F3B6,
+    0x1F3B7, 0x1F3B8, 0x1F3B9, 0x1F3BA, 0x1F3BB, 0x1F3BC, 0x1F3BD, 0x1F3BE,
+    0x1F3BF, 0x1F3C0, 0x1F3C1, 0x1F3C2, 0x1F3C2, 0x1F3FB, 0x1F3C2, 0x1F3FC,
+    0x1F3C2, 0x1F3FD, 0x1F3C2, 0x1F3FE, 0x1F3C2, 0x1F3FF, 0x1F3C3, 0x200D,
+    0x2640, 0x1F3C3, 0x1F3FB, 0x200D, 0x2640, 0x1F3C3, 0x1F3FC, 0x200D,
+    0x2640, 0x1F3C3, 0x1F3FD, 0x200D, 0x2640, 0x1F3C3, 0x1F3FE, 0x200D,
+    0x2640, 0x1F3C3, 0x1F3FF, 0x200D, 0x2640, 0x1F3C3, 0x200D, 0x2642,
+    0x1F3C3, 0x1F3FB, 0x200D, 0x2642, 0x1F3C3, 0x1F3FC, 0x200D, 0x2642,
+    0x1F3C3, 0x1F3FD, 0x200D, 0x2642, 0x1F3C3, 0x1F3FE, 0x200D, 0x2642,
+    0x1F3C3, 0x1F3FF, 0x200D, 0x2642, 0x1F3C3, 0x1F3C3, 0x1F3FB, 0x1F3C3,
+    0x1F3FC, 0x1F3C3, 0x1F3FD, 0x1F3C3, 0x1F3FE, 0x1F3C3, 0x1F3FF, 0x1F3C4,
+    0x200D, 0x2640, 0x1F3C4, 0x1F3FB, 0x200D, 0x2640, 0x1F3C4, 0x1F3FC,
+    0x200D, 0x2640, 0x1F3C4, 0x1F3FD, 0x200D, 0x2640, 0x1F3C4, 0x1F3FE,
+    0x200D, 0x2640, 0x1F3C4, 0x1F3FF, 0x200D, 0x2640, 0x1F3C4, 0x200D,
+    0x2642, 0x1F3C4, 0x1F3FB, 0x200D, 0x2642, 0x1F3C4, 0x1F3FC, 0x200D,
+    0x2642, 0x1F3C4, 0x1F3FD, 0x200D, 0x2642, 0x1F3C4, 0x1F3FE, 0x200D,
+    0x2642, 0x1F3C4, 0x1F3FF, 0x200D, 0x2642, 0x1F3C4, 0x1F3C4, 0x1F3FB,
+    0x1F3C4, 0x1F3FC, 0x1F3C4, 0x1F3FD, 0x1F3C4, 0x1F3FE, 0x1F3C4, 0x1F3FF,
+    0x1F3C5, 0x1F3C6, 0x1F3C7, 0x1F3C7, 0x1F3FB, 0x1F3C7, 0x1F3FC, 0x1F3C7,
+    0x1F3FD, 0x1F3C7, 0x1F3FE, 0x1F3C7, 0x1F3FF, 0x1F3C8, 0x1F3C9, 0x1F3CA,
+    0x200D, 0x2640, 0x1F3CA, 0x1F3FB, 0x200D, 0x2640, 0x1F3CA, 0x1F3FC,
+    0x200D, 0x2640, 0x1F3CA, 0x1F3FD, 0x200D, 0x2640, 0x1F3CA, 0x1F3FE,
+    0x200D, 0x2640, 0x1F3CA, 0x1F3FF, 0x200D, 0x2640, 0x1F3CA, 0x200D,
+    0x2642, 0x1F3CA, 0x1F3FB, 0x200D, 0x2642, 0x1F3CA, 0x1F3FC, 0x200D,
+    0x2642, 0x1F3CA, 0x1F3FD, 0x200D, 0x2642, 0x1F3CA, 0x1F3FE, 0x200D,
+    0x2642, 0x1F3CA, 0x1F3FF, 0x200D, 0x2642, 0x1F3CA, 0x1F3CA, 0x1F3FB,
+    0x1F3CA, 0x1F3FC, 0x1F3CA, 0x1F3FD, 0x1F3CA, 0x1F3FE, 0x1F3CA, 0x1F3FF,
+    0x1F3CB, 0xFE0F, 0x200D, 0x2640, 0xFE0F, 0x1F3CB, 0x1F3FB, 0x200D,
+    0x2640, 0x1F3CB, 0x1F3FC, 0x200D, 0x2640, 0x1F3CB, 0x1F3FD, 0x200D,
+    0x2640, 0x1F3CB, 0x1F3FE, 0x200D, 0x2640, 0x1F3CB, 0x1F3FF, 0x200D,
+    0x2640, 0x1F3CB, 0xFE0F, 0x200D, 0x2642, 0xFE0F, 0x1F3CB, 0x1F3FB,
+    0x200D, 0x2642, 0x1F3CB, 0x1F3FC, 0x200D, 0x2642, 0x1F3CB, 0x1F3FD,
+    0x200D, 0x2642, 0x1F3CB, 0x1F3FE, 0x200D, 0x2642, 0x1F3CB, 0x1F3FF,
+    0x200D, 0x2642, 0x1F3CB, 0x1F3CB, 0x1F3FB, 0x1F3CB, 0x1F3FC, 0x1F3CB,
+    0x1F3FD, 0x1F3CB, 0x1F3FE, 0x1F3CB, 0x1F3FF, 0x1F3CC, 0xFE0F, 0x200D,
+    0x2640, 0xFE0F, 0x1F3CC, 0x1F3FB, 0x200D, 0x2640, 0x1F3CC, 0x1F3FC,
+    0x200D, 0x2640, 0x1F3CC, 0x1F3FD, 0x200D, 0x2640, 0x1F3CC, 0x1F3FE,
+    0x200D, 0x2640, 0x1F3CC, 0x1F3FF, 0x200D, 0x2640, 0x1F3CC, 0xFE0F,
+    0x200D, 0x2642, 0xFE0F, 0x1F3CC, 0x1F3FB, 0x200D, 0x2642, 0x1F3CC,
+    0x1F3FC, 0x200D, 0x2642, 0x1F3CC, 0x1F3FD, 0x200D, 0x2642, 0x1F3CC,
+    0x1F3FE, 0x200D, 0x2642, 0x1F3CC, 0x1F3FF, 0x200D, 0x2642, 0x1F3CC,
+    0x1F3CC, 0x1F3FB, 0x1F3CC, 0x1F3FC, 0x1F3CC, 0x1F3FD, 0x1F3CC, 0x1F3FE,
+    0x1F3CC, 0x1F3FF, 0x1F3CD, 0x1F3CE, 0x1F3CF, 0x1F3D0, 0x1F3D1, 0x1F3D2,
+    0x1F3D3, 0x1F3D4, 0x1F3D5, 0x1F3D6, 0x1F3D7, 0x1F3D8, 0x1F3D9, 0x1F3DA,
+    0x1F3DB, 0x1F3DC, 0x1F3DD, 0x1F3DE, 0x1F3DF, 0x1F3E0, 0x1F3E1, 0x1F3E2,
+    0x1F3E3, 0x1F3E4, 0x1F3E5, 0x1F3E6, 0x1F3E7, 0x1F3E8, 0x1F3E9, 0x1F3EA,
+    0x1F3EB, 0x1F3EC, 0x1F3ED, 0x1F3EE, 0x1F3EF, 0x1F3F0, 0x1F3F3, 0x200D,
+    0x1F308, 0x1F3F3, 0xFE0F, 0x200D, 0x26A7, 0xFE0F, 0x1F3F3, 0x1F3F4,
+    0x200D, 0x2620, 0x1F3F4, 0xE0067, 0xE0062, 0xE0065, 0xE006E, 0xE0067,
+    0xE007F, 0x1F3F4, 0xE0067, 0xE0062, 0xE0073, 0xE0063, 0xE0074, 0xE007F,
+    0x1F3F4, 0xE0067, 0xE0062, 0xE0077, 0xE006C, 0xE0073, 0xE007F, 0x1F3F4,
+    0x1F3F5, 0x1F3F7, 0x1F3F8, 0x1F3F9, 0x1F3FA, 0x1F3FB, 0x1F3FC, 0x1F3FD,
+    0x1F3FE, 0x1F3FF, 0x1F400, 0x1F401, 0x1F402, 0x1F403, 0x1F404, 0x1F405,
+    0x1F406, 0x1F407, 0x1F408, 0x200D, 0x2B1B, 0x1F408, 0x1F409, 0x1F40A,
+    0x1F40B, 0x1F40C, 0x1F40D, 0x1F40E, 0x1F40F, 0x1F410, 0x1F411, 0x1F412,
+    0x1F413, 0x1F414, 0x1F415, 0x200D, 0x1F9BA, 0x1F415, 0x1F416, 0x1F417,
+    0x1F418, 0x1F419, 0x1F41A, 0x1F41B, 0x1F41C, 0x1F41D, 0x1F41E, 0x1F41F,
+    0x1F420, 0x1F421, 0x1F422, 0x1F423, 0x1F424, 0x1F425, 0x1F426, 0x1F427,
+    0x1F428, 0x1F429, 0x1F42A, 0x1F42B, 0x1F42C, 0x1F42D, 0x1F42E, 0x1F42F,
+    0x1F430, 0x1F431, 0x1F432, 0x1F433, 0x1F434, 0x1F435, 0x1F436, 0x1F437,
+    0x1F438, 0x1F439, 0x1F43A, 0x1F43B, 0x200D, 0x2744, 0x1F43B, 0x1F43C,
+    0x1F43D, 0x1F43E, 0x1F43F, 0x1F440, 0x1F441, 0xFE0F, 0x200D, 0x1F5E8,
+    0xFE0F, 0x1F441, 0x1F442, 0x1F442, 0x1F3FB, 0x1F442, 0x1F3FC, 0x1F442,
+    0x1F3FD, 0x1F442, 0x1F3FE, 0x1F442, 0x1F3FF, 0x1F443, 0x1F443, 0x1F3FB,
+    0x1F443, 0x1F3FC, 0x1F443, 0x1F3FD, 0x1F443, 0x1F3FE, 0x1F443, 0x1F3FF,
+    0x1F444, 0x1F445, 0x1F446, 0x1F446, 0x1F3FB, 0x1F446, 0x1F3FC, 0x1F446,
+    0x1F3FD, 0x1F446, 0x1F3FE, 0x1F446, 0x1F3FF, 0x1F447, 0x1F447, 0x1F3FB,
+    0x1F447, 0x1F3FC, 0x1F447, 0x1F3FD, 0x1F447, 0x1F3FE, 0x1F447, 0x1F3FF,
+    0x1F448, 0x1F448, 0x1F3FB, 0x1F448, 0x1F3FC, 0x1F448, 0x1F3FD, 0x1F448,
+    0x1F3FE, 0x1F448, 0x1F3FF, 0x1F449, 0x1F449, 0x1F3FB, 0x1F449, 0x1F3FC,
+    0x1F449, 0x1F3FD, 0x1F449, 0x1F3FE, 0x1F449, 0x1F3FF, 0x1F44A, 0x1F44A,
+    0x1F3FB, 0x1F44A, 0x1F3FC, 0x1F44A, 0x1F3FD, 0x1F44A, 0x1F3FE, 0x1F44A,
+    0x1F3FF, 0x1F44B, 0x1F44B, 0x1F3FB, 0x1F44B, 0x1F3FC, 0x1F44B, 0x1F3FD,
+    0x1F44B, 0x1F3FE, 0x1F44B, 0x1F3FF, 0x1F44C, 0x1F44C, 0x1F3FB, 0x1F44C,
+    0x1F3FC, 0x1F44C, 0x1F3FD, 0x1F44C, 0x1F3FE, 0x1F44C, 0x1F3FF, 0x1F44D,
+    0x1F44D, 0x1F3FB, 0x1F44D, 0x1F3FC, 0x1F44D, 0x1F3FD, 0x1F44D, 0x1F3FE,
+    0x1F44D, 0x1F3FF, 0x1F44E, 0x1F44E, 0x1F3FB, 0x1F44E, 0x1F3FC, 0x1F44E,
+    0x1F3FD, 0x1F44E, 0x1F3FE, 0x1F44E, 0x1F3FF, 0x1F44F, 0x1F44F, 0x1F3FB,
+    0x1F44F, 0x1F3FC, 0x1F44F, 0x1F3FD, 0x1F44F, 0x1F3FE, 0x1F44F, 0x1F3FF,
+    0x1F450, 0x1F450, 0x1F3FB, 0x1F450, 0x1F3FC, 0x1F450, 0x1F3FD, 0x1F450,
+    0x1F3FE, 0x1F450, 0x1F3FF, 0x1F451, 0x1F452, 0x1F453, 0x1F454, 0x1F455,
+    0x1F456, 0x1F457, 0x1F458, 0x1F459, 0x1F45A, 0x1F45B, 0x1F45C, 0x1F45D,
+    0x1F45E, 0x1F45F, 0x1F460, 0x1F461, 0x1F462, 0x1F463, 0x1F464, 0x1F465,
+    0x1F466, 0x1F466, 0x1F3FB, 0x1F466, 0x1F3FC, 0x1F466, 0x1F3FD, 0x1F466,
+    0x1F3FE, 0x1F466, 0x1F3FF, 0x1F467, 0x1F467, 0x1F3FB, 0x1F467, 0x1F3FC,
+    0x1F467, 0x1F3FD, 0x1F467, 0x1F3FE, 0x1F467, 0x1F3FF, 0x1F468, 0x200D,
+    0x1F33E, 0x1F468, 0x1F3FB, 0x200D, 0x1F33E, 0x1F468, 0x1F3FC, 0x200D,
+    0x1F33E, 0x1F468, 0x1F3FD, 0x200D, 0x1F33E, 0x1F468, 0x1F3FE, 0x200D,
+    0x1F33E, 0x1F468, 0x1F3FF, 0x200D, 0x1F33E, 0x1F468, 0x200D, 0x1F373,
+    0x1F468, 0x1F3FB, 0x200D, 0x1F373, 0x1F468, 0x1F3FC, 0x200D, 0x1F373,
+    0x1F468, 0x1F3FD, 0x200D, 0x1F373, 0x1F468, 0x1F3FE, 0x200D, 0x1F373,
+    0x1F468, 0x1F3FF, 0x200D, 0x1F373, 0x1F468, 0x200D, 0x1F37C, 0x1F468,
+    0x1F3FB, 0x200D, 0x1F37C, 0x1F468, 0x1F3FC, 0x200D, 0x1F37C, 0x1F468,
+    0x1F3FD, 0x200D, 0x1F37C, 0x1F468, 0x1F3FE, 0x200D, 0x1F37C, 0x1F468,
+    0x1F3FF, 0x200D, 0x1F37C, 0x1F468, 0x200D, 0x1F393, 0x1F468, 0x1F3FB,
+    0x200D, 0x1F393, 0x1F468, 0x1F3FC, 0x200D, 0x1F393, 0x1F468, 0x1F3FD,
+    0x200D, 0x1F393, 0x1F468, 0x1F3FE, 0x200D, 0x1F393, 0x1F468, 0x1F3FF,
+    0x200D, 0x1F393, 0x1F468, 0x200D, 0x1F3A4, 0x1F468, 0x1F3FB, 0x200D,
+    0x1F3A4, 0x1F468, 0x1F3FC, 0x200D, 0x1F3A4, 0x1F468, 0x1F3FD, 0x200D,
+    0x1F3A4, 0x1F468, 0x1F3FE, 0x200D, 0x1F3A4, 0x1F468, 0x1F3FF, 0x200D,
+    0x1F3A4, 0x1F468, 0x200D, 0x1F3A8, 0x1F468, 0x1F3FB, 0x200D, 0x1F3A8,
+    0x1F468, 0x1F3FC, 0x200D, 0x1F3A8, 0x1F468, 0x1F3FD, 0x200D, 0x1F3A8,
+    0x1F468, 0x1F3FE, 0x200D, 0x1F3A8, 0x1F468, 0x1F3FF, 0x200D, 0x1F3A8,
+    0x1F468, 0x200D, 0x1F3EB, 0x1F468, 0x1F3FB, 0x200D, 0x1F3EB, 0x1F468,
+    0x1F3FC, 0x200D, 0x1F3EB, 0x1F468, 0x1F3FD, 0x200D, 0x1F3EB, 0x1F468,
+    0x1F3FE, 0x200D, 0x1F3EB, 0x1F468, 0x1F3FF, 0x200D, 0x1F3EB, 0x1F468,
+    0x200D, 0x1F3ED, 0x1F468, 0x1F3FB, 0x200D, 0x1F3ED, 0x1F468, 0x1F3FC,
+    0x200D, 0x1F3ED, 0x1F468, 0x1F3FD, 0x200D, 0x1F3ED, 0x1F468, 0x1F3FE,
+    0x200D, 0x1F3ED, 0x1F468, 0x1F3FF, 0x200D, 0x1F3ED, 0x1F468, 0x200D,
+    0x1F466, 0x200D, 0x1F466, 0x1F468, 0x200D, 0x1F466, 0x1F468, 0x200D,
+    0x1F467, 0x200D, 0x1F466, 0x1F468, 0x200D, 0x1F467, 0x200D, 0x1F467,
+    0x1F468, 0x200D, 0x1F467, 0x1F468, 0x200D, 0x1F468, 0x200D, 0x1F466,
+    0x1F468, 0x200D, 0x1F468, 0x200D, 0x1F466, 0x200D, 0x1F466, 0x1F468,
+    0x200D, 0x1F468, 0x200D, 0x1F467, 0x1F468, 0x200D, 0x1F468, 0x200D,
+    0x1F467, 0x200D, 0x1F466, 0x1F468, 0x200D, 0x1F468, 0x200D, 0x1F467,
+    0x200D, 0x1F467, 0x1F468, 0x200D, 0x1F469, 0x200D, 0x1F466, 0x1F468,
+    0x200D, 0x1F469, 0x200D, 0x1F466, 0x200D, 0x1F466, 0x1F468, 0x200D,
+    0x1F469, 0x200D, 0x1F467, 0x1F468, 0x200D, 0x1F469, 0x200D, 0x1F467,
+    0x200D, 0x1F466, 0x1F468, 0x200D, 0x1F469, 0x200D, 0x1F467, 0x200D,
+    0x1F467, 0x1F468, 0x200D, 0x1F4BB, 0x1F468, 0x1F3FB, 0x200D, 0x1F4BB,
+    0x1F468, 0x1F3FC, 0x200D, 0x1F4BB, 0x1F468, 0x1F3FD, 0x200D, 0x1F4BB,
+    0x1F468, 0x1F3FE, 0x200D, 0x1F4BB, 0x1F468, 0x1F3FF, 0x200D, 0x1F4BB,
+    0x1F468, 0x200D, 0x1F4BC, 0x1F468, 0x1F3FB, 0x200D, 0x1F4BC, 0x1F468,
+    0x1F3FC, 0x200D, 0x1F4BC, 0x1F468, 0x1F3FD, 0x200D, 0x1F4BC, 0x1F468,
+    0x1F3FE, 0x200D, 0x1F4BC, 0x1F468, 0x1F3FF, 0x200D, 0x1F4BC, 0x1F468,
+    0x200D, 0x1F527, 0x1F468, 0x1F3FB, 0x200D, 0x1F527, 0x1F468, 0x1F3FC,
+    0x200D, 0x1F527, 0x1F468, 0x1F3FD, 0x200D, 0x1F527, 0x1F468, 0x1F3FE,
+    0x200D, 0x1F527, 0x1F468, 0x1F3FF, 0x200D, 0x1F527, 0x1F468, 0x200D,
+    0x1F52C, 0x1F468, 0x1F3FB, 0x200D, 0x1F52C, 0x1F468, 0x1F3FC, 0x200D,
+    0x1F52C, 0x1F468, 0x1F3FD, 0x200D, 0x1F52C, 0x1F468, 0x1F3FE, 0x200D,
+    0x1F52C, 0x1F468, 0x1F3FF, 0x200D, 0x1F52C, 0x1F468, 0x200D, 0x1F680,
+    0x1F468, 0x1F3FB, 0x200D, 0x1F680, 0x1F468, 0x1F3FC, 0x200D, 0x1F680,
+    0x1F468, 0x1F3FD, 0x200D, 0x1F680, 0x1F468, 0x1F3FE, 0x200D, 0x1F680,
+    0x1F468, 0x1F3FF, 0x200D, 0x1F680, 0x1F468, 0x200D, 0x1F692, 0x1F468,
+    0x1F3FB, 0x200D, 0x1F692, 0x1F468, 0x1F3FC, 0x200D, 0x1F692, 0x1F468,
+    0x1F3FD, 0x200D, 0x1F692, 0x1F468, 0x1F3FE, 0x200D, 0x1F692, 0x1F468,
+    0x1F3FF, 0x200D, 0x1F692, 0x1F468, 0x200D, 0x1F9AF, 0x1F468, 0x1F3FB,
+    0x200D, 0x1F9AF, 0x1F468, 0x1F3FC, 0x200D, 0x1F9AF, 0x1F468, 0x1F3FD,
+    0x200D, 0x1F9AF, 0x1F468, 0x1F3FE, 0x200D, 0x1F9AF, 0x1F468, 0x1F3FF,
+    0x200D, 0x1F9AF, 0x1F468, 0x200D, 0x1F9B0, 0x1F468, 0x1F3FB, 0x200D,
+    0x1F9B0, 0x1F468, 0x1F3FC, 0x200D, 0x1F9B0, 0x1F468, 0x1F3FD, 0x200D,
+    0x1F9B0, 0x1F468, 0x1F3FE, 0x200D, 0x1F9B0, 0x1F468, 0x1F3FF, 0x200D,
+    0x1F9B0, 0x1F468, 0x200D, 0x1F9B1, 0x1F468, 0x1F3FB, 0x200D, 0x1F9B1,
+    0x1F468, 0x1F3FC, 0x200D, 0x1F9B1, 0x1F468, 0x1F3FD, 0x200D, 0x1F9B1,
+    0x1F468, 0x1F3FE, 0x200D, 0x1F9B1, 0x1F468, 0x1F3FF, 0x200D, 0x1F9B1,
+    0x1F468, 0x200D, 0x1F9B2, 0x1F468, 0x1F3FB, 0x200D, 0x1F9B2, 0x1F468,
+    0x1F3FC, 0x200D, 0x1F9B2, 0x1F468, 0x1F3FD, 0x200D, 0x1F9B2, 0x1F468,
+    0x1F3FE, 0x200D, 0x1F9B2, 0x1F468, 0x1F3FF, 0x200D, 0x1F9B2, 0x1F468,
+    0x200D, 0x1F9B3, 0x1F468, 0x1F3FB, 0x200D, 0x1F9B3, 0x1F468, 0x1F3FC,
+    0x200D, 0x1F9B3, 0x1F468, 0x1F3FD, 0x200D, 0x1F9B3, 0x1F468, 0x1F3FE,
+    0x200D, 0x1F9B3, 0x1F468, 0x1F3FF, 0x200D, 0x1F9B3, 0x1F468, 0x200D,
+    0x1F9BC, 0x1F468, 0x1F3FB, 0x200D, 0x1F9BC, 0x1F468, 0x1F3FC, 0x200D,
+    0x1F9BC, 0x1F468, 0x1F3FD, 0x200D, 0x1F9BC, 0x1F468, 0x1F3FE, 0x200D,
+    0x1F9BC, 0x1F468, 0x1F3FF, 0x200D, 0x1F9BC, 0x1F468, 0x200D, 0x1F9BD,
+    0x1F468, 0x1F3FB, 0x200D, 0x1F9BD, 0x1F468, 0x1F3FC, 0x200D, 0x1F9BD,
+    0x1F468, 0x1F3FD, 0x200D, 0x1F9BD, 0x1F468, 0x1F3FE, 0x200D, 0x1F9BD,
+    0x1F468, 0x1F3FF, 0x200D, 0x1F9BD, 0x1F468, 0x200D, 0x2695, 0x1F468,
+    0x1F3FB, 0x200D, 0x2695, 0x1F468, 0x1F3FC, 0x200D, 0x2695, 0x1F468,
+    0x1F3FD, 0x200D, 0x2695, 0x1F468, 0x1F3FE, 0x200D, 0x2695, 0x1F468,
+    0x1F3FF, 0x200D, 0x2695, 0x1F468, 0x200D, 0x2696, 0x1F468, 0x1F3FB,
+    0x200D, 0x2696, 0x1F468, 0x1F3FC, 0x200D, 0x2696, 0x1F468, 0x1F3FD,
+    0x200D, 0x2696, 0x1F468, 0x1F3FE, 0x200D, 0x2696, 0x1F468, 0x1F3FF,
+    0x200D, 0x2696, 0x1F468, 0x200D, 0x2708, 0x1F468, 0x1F3FB, 0x200D,
+    0x2708, 0x1F468, 0x1F3FC, 0x200D, 0x2708, 0x1F468, 0x1F3FD, 0x200D,
+    0x2708, 0x1F468, 0x1F3FE, 0x200D, 0x2708, 0x1F468, 0x1F3FF, 0x200D,
+    0x2708, 0x1F468, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F468, 0x1F3FB,
+    0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FB, 0x1F468, 0x1F3FB, 0x200D,
+    0x2764, 0x200D, 0x1F468, 0x1F3FC, 0x1F468, 0x1F3FB, 0x200D, 0x2764,
+    0x200D, 0x1F468, 0x1F3FD, 0x1F468, 0x1F3FB, 0x200D, 0x2764, 0x200D,
+    0x1F468, 0x1F3FE, 0x1F468, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F468,
+    0x1F3FF, 0x1F468, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FB,
+    0x1F468, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FC, 0x1F468,
+    0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FD, 0x1F468, 0x1F3FC,
+    0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FE, 0x1F468, 0x1F3FC, 0x200D,
+    0x2764, 0x200D, 0x1F468, 0x1F3FF, 0x1F468, 0x1F3FD, 0x200D, 0x2764,
+    0x200D, 0x1F468, 0x1F3FB, 0x1F468, 0x1F3FD, 0x200D, 0x2764, 0x200D,
+    0x1F468, 0x1F3FC, 0x1F468, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F468,
+    0x1F3FD, 0x1F468, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FE,
+    0x1F468, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FF, 0x1F468,
+    0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FB, 0x1F468, 0x1F3FE,
+    0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FC, 0x1F468, 0x1F3FE, 0x200D,
+    0x2764, 0x200D, 0x1F468, 0x1F3FD, 0x1F468, 0x1F3FE, 0x200D, 0x2764,
+    0x200D, 0x1F468, 0x1F3FE, 0x1F468, 0x1F3FE, 0x200D, 0x2764, 0x200D,
+    0x1F468, 0x1F3FF, 0x1F468, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F468,
+    0x1F3FB, 0x1F468, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FC,
+    0x1F468, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FD, 0x1F468,
+    0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FE, 0x1F468, 0x1F3FF,
+    0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FF, 0x1F468, 0x200D, 0x2764,
+    0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F468, 0x1F3FB, 0x200D, 0x2764,
+    0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FB, 0x1F468, 0x1F3FB, 0x200D,
+    0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FC, 0x1F468, 0x1F3FB,
+    0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FD, 0x1F468,
+    0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FE,
+    0x1F468, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468,
+    0x1F3FF, 0x1F468, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D,
+    0x1F468, 0x1F3FB, 0x1F468, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B,
+    0x200D, 0x1F468, 0x1F3FC, 0x1F468, 0x1F3FC, 0x200D, 0x2764, 0x200D,
+    0x1F48B, 0x200D, 0x1F468, 0x1F3FD, 0x1F468, 0x1F3FC, 0x200D, 0x2764,
+    0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FE, 0x1F468, 0x1F3FC, 0x200D,
+    0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FF, 0x1F468, 0x1F3FD,
+    0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FB, 0x1F468,
+    0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FC,
+    0x1F468, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468,
+    0x1F3FD, 0x1F468, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D,
+    0x1F468, 0x1F3FE, 0x1F468, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B,
+    0x200D, 0x1F468, 0x1F3FF, 0x1F468, 0x1F3FE, 0x200D, 0x2764, 0x200D,
+    0x1F48B, 0x200D, 0x1F468, 0x1F3FB, 0x1F468, 0x1F3FE, 0x200D, 0x2764,
+    0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FC, 0x1F468, 0x1F3FE, 0x200D,
+    0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FD, 0x1F468, 0x1F3FE,
+    0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FE, 0x1F468,
+    0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FF,
+    0x1F468, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468,
+    0x1F3FB, 0x1F468, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D,
+    0x1F468, 0x1F3FC, 0x1F468, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B,
+    0x200D, 0x1F468, 0x1F3FD, 0x1F468, 0x1F3FF, 0x200D, 0x2764, 0x200D,
+    0x1F48B, 0x200D, 0x1F468, 0x1F3FE, 0x1F468, 0x1F3FF, 0x200D, 0x2764,
+    0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FF, 0x1F468, 0x1F468, 0x1F3FB,
+    0x1F468, 0x1F3FC, 0x1F468, 0x1F3FD, 0x1F468, 0x1F3FE, 0x1F468, 0x1F3FF,
+    0x1F469, 0x200D, 0x1F33E, 0x1F469, 0x1F3FB, 0x200D, 0x1F33E, 0x1F469,
+    0x1F3FC, 0x200D, 0x1F33E, 0x1F469, 0x1F3FD, 0x200D, 0x1F33E, 0x1F469,
+    0x1F3FE, 0x200D, 0x1F33E, 0x1F469, 0x1F3FF, 0x200D, 0x1F33E, 0x1F469,
+    0x200D, 0x1F373, 0x1F469, 0x1F3FB, 0x200D, 0x1F373, 0x1F469, 0x1F3FC,
+    0x200D, 0x1F373, 0x1F469, 0x1F3FD, 0x200D, 0x1F373, 0x1F469, 0x1F3FE,
+    0x200D, 0x1F373, 0x1F469, 0x1F3FF, 0x200D, 0x1F373, 0x1F469, 0x200D,
+    0x1F37C, 0x1F469, 0x1F3FB, 0x200D, 0x1F37C, 0x1F469, 0x1F3FC, 0x200D,
+    0x1F37C, 0x1F469, 0x1F3FD, 0x200D, 0x1F37C, 0x1F469, 0x1F3FE, 0x200D,
+    0x1F37C, 0x1F469, 0x1F3FF, 0x200D, 0x1F37C, 0x1F469, 0x200D, 0x1F393,
+    0x1F469, 0x1F3FB, 0x200D, 0x1F393, 0x1F469, 0x1F3FC, 0x200D, 0x1F393,
+    0x1F469, 0x1F3FD, 0x200D, 0x1F393, 0x1F469, 0x1F3FE, 0x200D, 0x1F393,
+    0x1F469, 0x1F3FF, 0x200D, 0x1F393, 0x1F469, 0x200D, 0x1F3A4, 0x1F469,
+    0x1F3FB, 0x200D, 0x1F3A4, 0x1F469, 0x1F3FC, 0x200D, 0x1F3A4, 0x1F469,
+    0x1F3FD, 0x200D, 0x1F3A4, 0x1F469, 0x1F3FE, 0x200D, 0x1F3A4, 0x1F469,
+    0x1F3FF, 0x200D, 0x1F3A4, 0x1F469, 0x200D, 0x1F3A8, 0x1F469, 0x1F3FB,
+    0x200D, 0x1F3A8, 0x1F469, 0x1F3FC, 0x200D, 0x1F3A8, 0x1F469, 0x1F3FD,
+    0x200D, 0x1F3A8, 0x1F469, 0x1F3FE, 0x200D, 0x1F3A8, 0x1F469, 0x1F3FF,
+    0x200D, 0x1F3A8, 0x1F469, 0x200D, 0x1F3EB, 0x1F469, 0x1F3FB, 0x200D,
+    0x1F3EB, 0x1F469, 0x1F3FC, 0x200D, 0x1F3EB, 0x1F469, 0x1F3FD, 0x200D,
+    0x1F3EB, 0x1F469, 0x1F3FE, 0x200D, 0x1F3EB, 0x1F469, 0x1F3FF, 0x200D,
+    0x1F3EB, 0x1F469, 0x200D, 0x1F3ED, 0x1F469, 0x1F3FB, 0x200D, 0x1F3ED,
+    0x1F469, 0x1F3FC, 0x200D, 0x1F3ED, 0x1F469, 0x1F3FD, 0x200D, 0x1F3ED,
+    0x1F469, 0x1F3FE, 0x200D, 0x1F3ED, 0x1F469, 0x1F3FF, 0x200D, 0x1F3ED,
+    0x1F469, 0x200D, 0x1F466, 0x200D, 0x1F466, 0x1F469, 0x200D, 0x1F466,
+    0x1F469, 0x200D, 0x1F467, 0x200D, 0x1F466, 0x1F469, 0x200D, 0x1F467,
+    0x200D, 0x1F467, 0x1F469, 0x200D, 0x1F467, 0x1F469, 0x200D, 0x1F469,
+    0x200D, 0x1F466, 0x1F469, 0x200D, 0x1F469, 0x200D, 0x1F466, 0x200D,
+    0x1F466, 0x1F469, 0x200D, 0x1F469, 0x200D, 0x1F467, 0x1F469, 0x200D,
+    0x1F469, 0x200D, 0x1F467, 0x200D, 0x1F466, 0x1F469, 0x200D, 0x1F469,
+    0x200D, 0x1F467, 0x200D, 0x1F467, 0x1F469, 0x200D, 0x1F4BB, 0x1F469,
+    0x1F3FB, 0x200D, 0x1F4BB, 0x1F469, 0x1F3FC, 0x200D, 0x1F4BB, 0x1F469,
+    0x1F3FD, 0x200D, 0x1F4BB, 0x1F469, 0x1F3FE, 0x200D, 0x1F4BB, 0x1F469,
+    0x1F3FF, 0x200D, 0x1F4BB, 0x1F469, 0x200D, 0x1F4BC, 0x1F469, 0x1F3FB,
+    0x200D, 0x1F4BC, 0x1F469, 0x1F3FC, 0x200D, 0x1F4BC, 0x1F469, 0x1F3FD,
+    0x200D, 0x1F4BC, 0x1F469, 0x1F3FE, 0x200D, 0x1F4BC, 0x1F469, 0x1F3FF,
+    0x200D, 0x1F4BC, 0x1F469, 0x200D, 0x1F527, 0x1F469, 0x1F3FB, 0x200D,
+    0x1F527, 0x1F469, 0x1F3FC, 0x200D, 0x1F527, 0x1F469, 0x1F3FD, 0x200D,
+    0x1F527, 0x1F469, 0x1F3FE, 0x200D, 0x1F527, 0x1F469, 0x1F3FF, 0x200D,
+    0x1F527, 0x1F469, 0x200D, 0x1F52C, 0x1F469, 0x1F3FB, 0x200D, 0x1F52C,
+    0x1F469, 0x1F3FC, 0x200D, 0x1F52C, 0x1F469, 0x1F3FD, 0x200D, 0x1F52C,
+    0x1F469, 0x1F3FE, 0x200D, 0x1F52C, 0x1F469, 0x1F3FF, 0x200D, 0x1F52C,
+    0x1F469, 0x200D, 0x1F680, 0x1F469, 0x1F3FB, 0x200D, 0x1F680, 0x1F469,
+    0x1F3FC, 0x200D, 0x1F680, 0x1F469, 0x1F3FD, 0x200D, 0x1F680, 0x1F469,
+    0x1F3FE, 0x200D, 0x1F680, 0x1F469, 0x1F3FF, 0x200D, 0x1F680, 0x1F469,
+    0x200D, 0x1F692, 0x1F469, 0x1F3FB, 0x200D, 0x1F692, 0x1F469, 0x1F3FC,
+    0x200D, 0x1F692, 0x1F469, 0x1F3FD, 0x200D, 0x1F692, 0x1F469, 0x1F3FE,
+    0x200D, 0x1F692, 0x1F469, 0x1F3FF, 0x200D, 0x1F692, 0x1F469, 0x200D,
+    0x1F9AF, 0x1F469, 0x1F3FB, 0x200D, 0x1F9AF, 0x1F469, 0x1F3FC, 0x200D,
+    0x1F9AF, 0x1F469, 0x1F3FD, 0x200D, 0x1F9AF, 0x1F469, 0x1F3FE, 0x200D,
+    0x1F9AF, 0x1F469, 0x1F3FF, 0x200D, 0x1F9AF, 0x1F469, 0x200D, 0x1F9B0,
+    0x1F469, 0x1F3FB, 0x200D, 0x1F9B0, 0x1F469, 0x1F3FC, 0x200D, 0x1F9B0,
+    0x1F469, 0x1F3FD, 0x200D, 0x1F9B0, 0x1F469, 0x1F3FE, 0x200D, 0x1F9B0,
+    0x1F469, 0x1F3FF, 0x200D, 0x1F9B0, 0x1F469, 0x200D, 0x1F9B1, 0x1F469,
+    0x1F3FB, 0x200D, 0x1F9B1, 0x1F469, 0x1F3FC, 0x200D, 0x1F9B1, 0x1F469,
+    0x1F3FD, 0x200D, 0x1F9B1, 0x1F469, 0x1F3FE, 0x200D, 0x1F9B1, 0x1F469,
+    0x1F3FF, 0x200D, 0x1F9B1, 0x1F469, 0x200D, 0x1F9B2, 0x1F469, 0x1F3FB,
+    0x200D, 0x1F9B2, 0x1F469, 0x1F3FC, 0x200D, 0x1F9B2, 0x1F469, 0x1F3FD,
+    0x200D, 0x1F9B2, 0x1F469, 0x1F3FE, 0x200D, 0x1F9B2, 0x1F469, 0x1F3FF,
+    0x200D, 0x1F9B2, 0x1F469, 0x200D, 0x1F9B3, 0x1F469, 0x1F3FB, 0x200D,
+    0x1F9B3, 0x1F469, 0x1F3FC, 0x200D, 0x1F9B3, 0x1F469, 0x1F3FD, 0x200D,
+    0x1F9B3, 0x1F469, 0x1F3FE, 0x200D, 0x1F9B3, 0x1F469, 0x1F3FF, 0x200D,
+    0x1F9B3, 0x1F469, 0x200D, 0x1F9BC, 0x1F469, 0x1F3FB, 0x200D, 0x1F9BC,
+    0x1F469, 0x1F3FC, 0x200D, 0x1F9BC, 0x1F469, 0x1F3FD, 0x200D, 0x1F9BC,
+    0x1F469, 0x1F3FE, 0x200D, 0x1F9BC, 0x1F469, 0x1F3FF, 0x200D, 0x1F9BC,
+    0x1F469, 0x200D, 0x1F9BD, 0x1F469, 0x1F3FB, 0x200D, 0x1F9BD, 0x1F469,
+    0x1F3FC, 0x200D, 0x1F9BD, 0x1F469, 0x1F3FD, 0x200D, 0x1F9BD, 0x1F469,
+    0x1F3FE, 0x200D, 0x1F9BD, 0x1F469, 0x1F3FF, 0x200D, 0x1F9BD, 0x1F469,
+    0x200D, 0x2695, 0x1F469, 0x1F3FB, 0x200D, 0x2695, 0x1F469, 0x1F3FC,
+    0x200D, 0x2695, 0x1F469, 0x1F3FD, 0x200D, 0x2695, 0x1F469, 0x1F3FE,
+    0x200D, 0x2695, 0x1F469, 0x1F3FF, 0x200D, 0x2695, 0x1F469, 0x200D,
+    0x2696, 0x1F469, 0x1F3FB, 0x200D, 0x2696, 0x1F469, 0x1F3FC, 0x200D,
+    0x2696, 0x1F469, 0x1F3FD, 0x200D, 0x2696, 0x1F469, 0x1F3FE, 0x200D,
+    0x2696, 0x1F469, 0x1F3FF, 0x200D, 0x2696, 0x1F469, 0x200D, 0x2708,
+    0x1F469, 0x1F3FB, 0x200D, 0x2708, 0x1F469, 0x1F3FC, 0x200D, 0x2708,
+    0x1F469, 0x1F3FD, 0x200D, 0x2708, 0x1F469, 0x1F3FE, 0x200D, 0x2708,
+    0x1F469, 0x1F3FF, 0x200D, 0x2708, 0x1F469, 0x200D, 0x2764, 0x200D,
+    0x1F468, 0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FB,
+    0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FC, 0x1F469,
+    0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FD, 0x1F469, 0x1F3FB,
+    0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FE, 0x1F469, 0x1F3FB, 0x200D,
+    0x2764, 0x200D, 0x1F468, 0x1F3FF, 0x1F469, 0x1F3FC, 0x200D, 0x2764,
+    0x200D, 0x1F468, 0x1F3FB, 0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D,
+    0x1F468, 0x1F3FC, 0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F468,
+    0x1F3FD, 0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FE,
+    0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FF, 0x1F469,
+    0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FB, 0x1F469, 0x1F3FD,
+    0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FC, 0x1F469, 0x1F3FD, 0x200D,
+    0x2764, 0x200D, 0x1F468, 0x1F3FD, 0x1F469, 0x1F3FD, 0x200D, 0x2764,
+    0x200D, 0x1F468, 0x1F3FE, 0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D,
+    0x1F468, 0x1F3FF, 0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F468,
+    0x1F3FB, 0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FC,
+    0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FD, 0x1F469,
+    0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FE, 0x1F469, 0x1F3FE,
+    0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FF, 0x1F469, 0x1F3FF, 0x200D,
+    0x2764, 0x200D, 0x1F468, 0x1F3FB, 0x1F469, 0x1F3FF, 0x200D, 0x2764,
+    0x200D, 0x1F468, 0x1F3FC, 0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D,
+    0x1F468, 0x1F3FD, 0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F468,
+    0x1F3FE, 0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F468, 0x1F3FF,
+    0x1F469, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F469, 0x1F3FB, 0x200D,
+    0x2764, 0x200D, 0x1F469, 0x1F3FB, 0x1F469, 0x1F3FB, 0x200D, 0x2764,
+    0x200D, 0x1F469, 0x1F3FC, 0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D,
+    0x1F469, 0x1F3FD, 0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F469,
+    0x1F3FE, 0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FF,
+    0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FB, 0x1F469,
+    0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FC, 0x1F469, 0x1F3FC,
+    0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FD, 0x1F469, 0x1F3FC, 0x200D,
+    0x2764, 0x200D, 0x1F469, 0x1F3FE, 0x1F469, 0x1F3FC, 0x200D, 0x2764,
+    0x200D, 0x1F469, 0x1F3FF, 0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D,
+    0x1F469, 0x1F3FB, 0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F469,
+    0x1F3FC, 0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FD,
+    0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FE, 0x1F469,
+    0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FF, 0x1F469, 0x1F3FE,
+    0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FB, 0x1F469, 0x1F3FE, 0x200D,
+    0x2764, 0x200D, 0x1F469, 0x1F3FC, 0x1F469, 0x1F3FE, 0x200D, 0x2764,
+    0x200D, 0x1F469, 0x1F3FD, 0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D,
+    0x1F469, 0x1F3FE, 0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F469,
+    0x1F3FF, 0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FB,
+    0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FC, 0x1F469,
+    0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FD, 0x1F469, 0x1F3FF,
+    0x200D, 0x2764, 0x200D, 0x1F469, 0x1F3FE, 0x1F469, 0x1F3FF, 0x200D,
+    0x2764, 0x200D, 0x1F469, 0x1F3FF, 0x1F469, 0x200D, 0x2764, 0x200D,
+    0x1F48B, 0x200D, 0x1F468, 0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D,
+    0x1F48B, 0x200D, 0x1F468, 0x1F3FB, 0x1F469, 0x1F3FB, 0x200D, 0x2764,
+    0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FC, 0x1F469, 0x1F3FB, 0x200D,
+    0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FD, 0x1F469, 0x1F3FB,
+    0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FE, 0x1F469,
+    0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FF,
+    0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468,
+    0x1F3FB, 0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D,
+    0x1F468, 0x1F3FC, 0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B,
+    0x200D, 0x1F468, 0x1F3FD, 0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D,
+    0x1F48B, 0x200D, 0x1F468, 0x1F3FE, 0x1F469, 0x1F3FC, 0x200D, 0x2764,
+    0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FF, 0x1F469, 0x1F3FD, 0x200D,
+    0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FB, 0x1F469, 0x1F3FD,
+    0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FC, 0x1F469,
+    0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FD,
+    0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468,
+    0x1F3FE, 0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D,
+    0x1F468, 0x1F3FF, 0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F48B,
+    0x200D, 0x1F468, 0x1F3FB, 0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D,
+    0x1F48B, 0x200D, 0x1F468, 0x1F3FC, 0x1F469, 0x1F3FE, 0x200D, 0x2764,
+    0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FD, 0x1F469, 0x1F3FE, 0x200D,
+    0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FE, 0x1F469, 0x1F3FE,
+    0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FF, 0x1F469,
+    0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468, 0x1F3FB,
+    0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F468,
+    0x1F3FC, 0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D,
+    0x1F468, 0x1F3FD, 0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B,
+    0x200D, 0x1F468, 0x1F3FE, 0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D,
+    0x1F48B, 0x200D, 0x1F468, 0x1F3FF, 0x1F469, 0x200D, 0x2764, 0x200D,
+    0x1F48B, 0x200D, 0x1F469, 0x1F469, 0x1F3FB, 0x200D, 0x2764, 0x200D,
+    0x1F48B, 0x200D, 0x1F469, 0x1F3FB, 0x1F469, 0x1F3FB, 0x200D, 0x2764,
+    0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FC, 0x1F469, 0x1F3FB, 0x200D,
+    0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FD, 0x1F469, 0x1F3FB,
+    0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FE, 0x1F469,
+    0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FF,
+    0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469,
+    0x1F3FB, 0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D,
+    0x1F469, 0x1F3FC, 0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F48B,
+    0x200D, 0x1F469, 0x1F3FD, 0x1F469, 0x1F3FC, 0x200D, 0x2764, 0x200D,
+    0x1F48B, 0x200D, 0x1F469, 0x1F3FE, 0x1F469, 0x1F3FC, 0x200D, 0x2764,
+    0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FF, 0x1F469, 0x1F3FD, 0x200D,
+    0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FB, 0x1F469, 0x1F3FD,
+    0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FC, 0x1F469,
+    0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FD,
+    0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469,
+    0x1F3FE, 0x1F469, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D,
+    0x1F469, 0x1F3FF, 0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F48B,
+    0x200D, 0x1F469, 0x1F3FB, 0x1F469, 0x1F3FE, 0x200D, 0x2764, 0x200D,
+    0x1F48B, 0x200D, 0x1F469, 0x1F3FC, 0x1F469, 0x1F3FE, 0x200D, 0x2764,
+    0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FD, 0x1F469, 0x1F3FE, 0x200D,
+    0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FE, 0x1F469, 0x1F3FE,
+    0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FF, 0x1F469,
+    0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469, 0x1F3FB,
+    0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F469,
+    0x1F3FC, 0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D,
+    0x1F469, 0x1F3FD, 0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B,
+    0x200D, 0x1F469, 0x1F3FE, 0x1F469, 0x1F3FF, 0x200D, 0x2764, 0x200D,
+    0x1F48B, 0x200D, 0x1F469, 0x1F3FF, 0x1F469, 0x1F469, 0x1F3FB, 0x1F469,
+    0x1F3FC, 0x1F469, 0x1F3FD, 0x1F469, 0x1F3FE, 0x1F469, 0x1F3FF, 0x1F46A,
+    0x1F46B, 0x1F46B, 0x1F3FB, 0x1F46B, 0x1F3FC, 0x1F46B, 0x1F3FD, 0x1F46B,
+    0x1F3FE, 0x1F46B, 0x1F3FF, 0x1F469, 0x1F3FB, 0x200D, 0x1F91D, 0x200D,
+    0x1F468, 0x1F3FC, 0x1F469, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F468,
+    0x1F3FD, 0x1F469, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FE,
+    0x1F469, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FF, 0x1F469,
+    0x1F3FC, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FB, 0x1F469, 0x1F3FC,
+    0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FD, 0x1F469, 0x1F3FC, 0x200D,
+    0x1F91D, 0x200D, 0x1F468, 0x1F3FE, 0x1F469, 0x1F3FC, 0x200D, 0x1F91D,
+    0x200D, 0x1F468, 0x1F3FF, 0x1F469, 0x1F3FD, 0x200D, 0x1F91D, 0x200D,
+    0x1F468, 0x1F3FB, 0x1F469, 0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F468,
+    0x1F3FC, 0x1F469, 0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FE,
+    0x1F469, 0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FF, 0x1F469,
+    0x1F3FE, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FB, 0x1F469, 0x1F3FE,
+    0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FC, 0x1F469, 0x1F3FE, 0x200D,
+    0x1F91D, 0x200D, 0x1F468, 0x1F3FD, 0x1F469, 0x1F3FE, 0x200D, 0x1F91D,
+    0x200D, 0x1F468, 0x1F3FF, 0x1F469, 0x1F3FF, 0x200D, 0x1F91D, 0x200D,
+    0x1F468, 0x1F3FB, 0x1F469, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F468,
+    0x1F3FC, 0x1F469, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FD,
+    0x1F469, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FE, 0x1F46C,
+    0x1F46C, 0x1F3FB, 0x1F46C, 0x1F3FC, 0x1F46C, 0x1F3FD, 0x1F46C, 0x1F3FE,
+    0x1F46C, 0x1F3FF, 0x1F468, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F468,
+    0x1F3FC, 0x1F468, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FD,
+    0x1F468, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FE, 0x1F468,
+    0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FF, 0x1F468, 0x1F3FC,
+    0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FB, 0x1F468, 0x1F3FC, 0x200D,
+    0x1F91D, 0x200D, 0x1F468, 0x1F3FD, 0x1F468, 0x1F3FC, 0x200D, 0x1F91D,
+    0x200D, 0x1F468, 0x1F3FE, 0x1F468, 0x1F3FC, 0x200D, 0x1F91D, 0x200D,
+    0x1F468, 0x1F3FF, 0x1F468, 0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F468,
+    0x1F3FB, 0x1F468, 0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FC,
+    0x1F468, 0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FE, 0x1F468,
+    0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FF, 0x1F468, 0x1F3FE,
+    0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FB, 0x1F468, 0x1F3FE, 0x200D,
+    0x1F91D, 0x200D, 0x1F468, 0x1F3FC, 0x1F468, 0x1F3FE, 0x200D, 0x1F91D,
+    0x200D, 0x1F468, 0x1F3FD, 0x1F468, 0x1F3FE, 0x200D, 0x1F91D, 0x200D,
+    0x1F468, 0x1F3FF, 0x1F468, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F468,
+    0x1F3FB, 0x1F468, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FC,
+    0x1F468, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FD, 0x1F468,
+    0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F468, 0x1F3FE, 0x1F46D, 0x1F46D,
+    0x1F3FB, 0x1F46D, 0x1F3FC, 0x1F46D, 0x1F3FD, 0x1F46D, 0x1F3FE, 0x1F46D,
+    0x1F3FF, 0x1F469, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FC,
+    0x1F469, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FD, 0x1F469,
+    0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FE, 0x1F469, 0x1F3FB,
+    0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FF, 0x1F469, 0x1F3FC, 0x200D,
+    0x1F91D, 0x200D, 0x1F469, 0x1F3FB, 0x1F469, 0x1F3FC, 0x200D, 0x1F91D,
+    0x200D, 0x1F469, 0x1F3FD, 0x1F469, 0x1F3FC, 0x200D, 0x1F91D, 0x200D,
+    0x1F469, 0x1F3FE, 0x1F469, 0x1F3FC, 0x200D, 0x1F91D, 0x200D, 0x1F469,
+    0x1F3FF, 0x1F469, 0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FB,
+    0x1F469, 0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FC, 0x1F469,
+    0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FE, 0x1F469, 0x1F3FD,
+    0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FF, 0x1F469, 0x1F3FE, 0x200D,
+    0x1F91D, 0x200D, 0x1F469, 0x1F3FB, 0x1F469, 0x1F3FE, 0x200D, 0x1F91D,
+    0x200D, 0x1F469, 0x1F3FC, 0x1F469, 0x1F3FE, 0x200D, 0x1F91D, 0x200D,
+    0x1F469, 0x1F3FD, 0x1F469, 0x1F3FE, 0x200D, 0x1F91D, 0x200D, 0x1F469,
+    0x1F3FF, 0x1F469, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FB,
+    0x1F469, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FC, 0x1F469,
+    0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FD, 0x1F469, 0x1F3FF,
+    0x200D, 0x1F91D, 0x200D, 0x1F469, 0x1F3FE, 0x1F46E, 0x200D, 0x2640,
+    0x1F46E, 0x1F3FB, 0x200D, 0x2640, 0x1F46E, 0x1F3FC, 0x200D, 0x2640,
+    0x1F46E, 0x1F3FD, 0x200D, 0x2640, 0x1F46E, 0x1F3FE, 0x200D, 0x2640,
+    0x1F46E, 0x1F3FF, 0x200D, 0x2640, 0x1F46E, 0x200D, 0x2642, 0x1F46E,
+    0x1F3FB, 0x200D, 0x2642, 0x1F46E, 0x1F3FC, 0x200D, 0x2642, 0x1F46E,
+    0x1F3FD, 0x200D, 0x2642, 0x1F46E, 0x1F3FE, 0x200D, 0x2642, 0x1F46E,
+    0x1F3FF, 0x200D, 0x2642, 0x1F46E, 0x1F46E, 0x1F3FB, 0x1F46E, 0x1F3FC,
+    0x1F46E, 0x1F3FD, 0x1F46E, 0x1F3FE, 0x1F46E, 0x1F3FF, 0x1F46F, 0x200D,
+    0x2640, 0x1F46F, 0x200D, 0x2642, 0x1F46F, 0x1F470, 0x200D, 0x2640,
+    0x1F470, 0x1F3FB, 0x200D, 0x2640, 0x1F470, 0x1F3FC, 0x200D, 0x2640,
+    0x1F470, 0x1F3FD, 0x200D, 0x2640, 0x1F470, 0x1F3FE, 0x200D, 0x2640,
+    0x1F470, 0x1F3FF, 0x200D, 0x2640, 0x1F470, 0x200D, 0x2642, 0x1F470,
+    0x1F3FB, 0x200D, 0x2642, 0x1F470, 0x1F3FC, 0x200D, 0x2642, 0x1F470,
+    0x1F3FD, 0x200D, 0x2642, 0x1F470, 0x1F3FE, 0x200D, 0x2642, 0x1F470,
+    0x1F3FF, 0x200D, 0x2642, 0x1F470, 0x1F470, 0x1F3FB, 0x1F470, 0x1F3FC,
+    0x1F470, 0x1F3FD, 0x1F470, 0x1F3FE, 0x1F470, 0x1F3FF, 0x1F471, 0x200D,
+    0x2640, 0x1F471, 0x1F3FB, 0x200D, 0x2640, 0x1F471, 0x1F3FC, 0x200D,
+    0x2640, 0x1F471, 0x1F3FD, 0x200D, 0x2640, 0x1F471, 0x1F3FE, 0x200D,
+    0x2640, 0x1F471, 0x1F3FF, 0x200D, 0x2640, 0x1F471, 0x200D, 0x2642,
+    0x1F471, 0x1F3FB, 0x200D, 0x2642, 0x1F471, 0x1F3FC, 0x200D, 0x2642,
+    0x1F471, 0x1F3FD, 0x200D, 0x2642, 0x1F471, 0x1F3FE, 0x200D, 0x2642,
+    0x1F471, 0x1F3FF, 0x200D, 0x2642, 0x1F471, 0x1F471, 0x1F3FB, 0x1F471,
+    0x1F3FC, 0x1F471, 0x1F3FD, 0x1F471, 0x1F3FE, 0x1F471, 0x1F3FF, 0x1F472,
+    0x1F472, 0x1F3FB, 0x1F472, 0x1F3FC, 0x1F472, 0x1F3FD, 0x1F472, 0x1F3FE,
+    0x1F472, 0x1F3FF, 0x1F473, 0x200D, 0x2640, 0x1F473, 0x1F3FB, 0x200D,
+    0x2640, 0x1F473, 0x1F3FC, 0x200D, 0x2640, 0x1F473, 0x1F3FD, 0x200D,
+    0x2640, 0x1F473, 0x1F3FE, 0x200D, 0x2640, 0x1F473, 0x1F3FF, 0x200D,
+    0x2640, 0x1F473, 0x200D, 0x2642, 0x1F473, 0x1F3FB, 0x200D, 0x2642,
+    0x1F473, 0x1F3FC, 0x200D, 0x2642, 0x1F473, 0x1F3FD, 0x200D, 0x2642,
+    0x1F473, 0x1F3FE, 0x200D, 0x2642, 0x1F473, 0x1F3FF, 0x200D, 0x2642,
+    0x1F473, 0x1F473, 0x1F3FB, 0x1F473, 0x1F3FC, 0x1F473, 0x1F3FD, 0x1F473,
+    0x1F3FE, 0x1F473, 0x1F3FF, 0x1F474, 0x1F474, 0x1F3FB, 0x1F474, 0x1F3FC,
+    0x1F474, 0x1F3FD, 0x1F474, 0x1F3FE, 0x1F474, 0x1F3FF, 0x1F475, 0x1F475,
+    0x1F3FB, 0x1F475, 0x1F3FC, 0x1F475, 0x1F3FD, 0x1F475, 0x1F3FE, 0x1F475,
+    0x1F3FF, 0x1F476, 0x1F476, 0x1F3FB, 0x1F476, 0x1F3FC, 0x1F476, 0x1F3FD,
+    0x1F476, 0x1F3FE, 0x1F476, 0x1F3FF, 0x1F477, 0x200D, 0x2640, 0x1F477,
+    0x1F3FB, 0x200D, 0x2640, 0x1F477, 0x1F3FC, 0x200D, 0x2640, 0x1F477,
+    0x1F3FD, 0x200D, 0x2640, 0x1F477, 0x1F3FE, 0x200D, 0x2640, 0x1F477,
+    0x1F3FF, 0x200D, 0x2640, 0x1F477, 0x200D, 0x2642, 0x1F477, 0x1F3FB,
+    0x200D, 0x2642, 0x1F477, 0x1F3FC, 0x200D, 0x2642, 0x1F477, 0x1F3FD,
+    0x200D, 0x2642, 0x1F477, 0x1F3FE, 0x200D, 0x2642, 0x1F477, 0x1F3FF,
+    0x200D, 0x2642, 0x1F477, 0x1F477, 0x1F3FB, 0x1F477, 0x1F3FC, 0x1F477,
+    0x1F3FD, 0x1F477, 0x1F3FE, 0x1F477, 0x1F3FF, 0x1F478, 0x1F478, 0x1F3FB,
+    0x1F478, 0x1F3FC, 0x1F478, 0x1F3FD, 0x1F478, 0x1F3FE, 0x1F478, 0x1F3FF,
+    0x1F479, 0x1F47A, 0x1F47B, 0x1F47C, 0x1F47C, 0x1F3FB, 0x1F47C, 0x1F3FC,
+    0x1F47C, 0x1F3FD, 0x1F47C, 0x1F3FE, 0x1F47C, 0x1F3FF, 0x1F47D, 0x1F47E,
+    0x1F47F, 0x1F480, 0x1F481, 0x200D, 0x2640, 0x1F481, 0x1F3FB, 0x200D,
+    0x2640, 0x1F481, 0x1F3FC, 0x200D, 0x2640, 0x1F481, 0x1F3FD, 0x200D,
+    0x2640, 0x1F481, 0x1F3FE, 0x200D, 0x2640, 0x1F481, 0x1F3FF, 0x200D,
+    0x2640, 0x1F481, 0x200D, 0x2642, 0x1F481, 0x1F3FB, 0x200D, 0x2642,
+    0x1F481, 0x1F3FC, 0x200D, 0x2642, 0x1F481, 0x1F3FD, 0x200D, 0x2642,
+    0x1F481, 0x1F3FE, 0x200D, 0x2642, 0x1F481, 0x1F3FF, 0x200D, 0x2642,
+    0x1F481, 0x1F481, 0x1F3FB, 0x1F481, 0x1F3FC, 0x1F481, 0x1F3FD, 0x1F481,
+    0x1F3FE, 0x1F481, 0x1F3FF, 0x1F482, 0x200D, 0x2640, 0x1F482, 0x1F3FB,
+    0x200D, 0x2640, 0x1F482, 0x1F3FC, 0x200D, 0x2640, 0x1F482, 0x1F3FD,
+    0x200D, 0x2640, 0x1F482, 0x1F3FE, 0x200D, 0x2640, 0x1F482, 0x1F3FF,
+    0x200D, 0x2640, 0x1F482, 0x200D, 0x2642, 0x1F482, 0x1F3FB, 0x200D,
+    0x2642, 0x1F482, 0x1F3FC, 0x200D, 0x2642, 0x1F482, 0x1F3FD, 0x200D,
+    0x2642, 0x1F482, 0x1F3FE, 0x200D, 0x2642, 0x1F482, 0x1F3FF, 0x200D,
+    0x2642, 0x1F482, 0x1F482, 0x1F3FB, 0x1F482, 0x1F3FC, 0x1F482, 0x1F3FD,
+    0x1F482, 0x1F3FE, 0x1F482, 0x1F3FF, 0x1F483, 0x1F483, 0x1F3FB, 0x1F483,
+    0x1F3FC, 0x1F483, 0x1F3FD, 0x1F483, 0x1F3FE, 0x1F483, 0x1F3FF, 0x1F484,
+    0x1F485, 0x1F485, 0x1F3FB, 0x1F485, 0x1F3FC, 0x1F485, 0x1F3FD, 0x1F485,
+    0x1F3FE, 0x1F485, 0x1F3FF, 0x1F486, 0x200D, 0x2640, 0x1F486, 0x1F3FB,
+    0x200D, 0x2640, 0x1F486, 0x1F3FC, 0x200D, 0x2640, 0x1F486, 0x1F3FD,
+    0x200D, 0x2640, 0x1F486, 0x1F3FE, 0x200D, 0x2640, 0x1F486, 0x1F3FF,
+    0x200D, 0x2640, 0x1F486, 0x200D, 0x2642, 0x1F486, 0x1F3FB, 0x200D,
+    0x2642, 0x1F486, 0x1F3FC, 0x200D, 0x2642, 0x1F486, 0x1F3FD, 0x200D,
+    0x2642, 0x1F486, 0x1F3FE, 0x200D, 0x2642, 0x1F486, 0x1F3FF, 0x200D,
+    0x2642, 0x1F486, 0x1F486, 0x1F3FB, 0x1F486, 0x1F3FC, 0x1F486, 0x1F3FD,
+    0x1F486, 0x1F3FE, 0x1F486, 0x1F3FF, 0x1F487, 0x200D, 0x2640, 0x1F487,
+    0x1F3FB, 0x200D, 0x2640, 0x1F487, 0x1F3FC, 0x200D, 0x2640, 0x1F487,
+    0x1F3FD, 0x200D, 0x2640, 0x1F487, 0x1F3FE, 0x200D, 0x2640, 0x1F487,
+    0x1F3FF, 0x200D, 0x2640, 0x1F487, 0x200D, 0x2642, 0x1F487, 0x1F3FB,
+    0x200D, 0x2642, 0x1F487, 0x1F3FC, 0x200D, 0x2642, 0x1F487, 0x1F3FD,
+    0x200D, 0x2642, 0x1F487, 0x1F3FE, 0x200D, 0x2642, 0x1F487, 0x1F3FF,
+    0x200D, 0x2642, 0x1F487, 0x1F487, 0x1F3FB, 0x1F487, 0x1F3FC, 0x1F487,
+    0x1F3FD, 0x1F487, 0x1F3FE, 0x1F487, 0x1F3FF, 0x1F488, 0x1F489, 0x1F48A,
+    0x1F48B, 0x1F48C, 0x1F48D, 0x1F48E, 0x1F48F, 0x1F48F, 0x1F3FB, 0x1F48F,
+    0x1F3FC, 0x1F48F, 0x1F3FD, 0x1F48F, 0x1F3FE, 0x1F48F, 0x1F3FF, 0x1F9D1,
+    0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FC,
+    0x1F9D1, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1,
+    0x1F3FD, 0x1F9D1, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D,
+    0x1F9D1, 0x1F3FE, 0x1F9D1, 0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F48B,
+    0x200D, 0x1F9D1, 0x1F3FF, 0x1F9D1, 0x1F3FC, 0x200D, 0x2764, 0x200D,
+    0x1F48B, 0x200D, 0x1F9D1, 0x1F3FB, 0x1F9D1, 0x1F3FC, 0x200D, 0x2764,
+    0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FD, 0x1F9D1, 0x1F3FC, 0x200D,
+    0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FE, 0x1F9D1, 0x1F3FC,
+    0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FF, 0x1F9D1,
+    0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FB,
+    0x1F9D1, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1,
+    0x1F3FC, 0x1F9D1, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D,
+    0x1F9D1, 0x1F3FE, 0x1F9D1, 0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F48B,
+    0x200D, 0x1F9D1, 0x1F3FF, 0x1F9D1, 0x1F3FE, 0x200D, 0x2764, 0x200D,
+    0x1F48B, 0x200D, 0x1F9D1, 0x1F3FB, 0x1F9D1, 0x1F3FE, 0x200D, 0x2764,
+    0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FC, 0x1F9D1, 0x1F3FE, 0x200D,
+    0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FD, 0x1F9D1, 0x1F3FE,
+    0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FF, 0x1F9D1,
+    0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1, 0x1F3FB,
+    0x1F9D1, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D, 0x1F9D1,
+    0x1F3FC, 0x1F9D1, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B, 0x200D,
+    0x1F9D1, 0x1F3FD, 0x1F9D1, 0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F48B,
+    0x200D, 0x1F9D1, 0x1F3FE, 0x1F490, 0x1F491, 0x1F491, 0x1F3FB, 0x1F491,
+    0x1F3FC, 0x1F491, 0x1F3FD, 0x1F491, 0x1F3FE, 0x1F491, 0x1F3FF, 0x1F9D1,
+    0x1F3FB, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FC, 0x1F9D1, 0x1F3FB,
+    0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FD, 0x1F9D1, 0x1F3FB, 0x200D,
+    0x2764, 0x200D, 0x1F9D1, 0x1F3FE, 0x1F9D1, 0x1F3FB, 0x200D, 0x2764,
+    0x200D, 0x1F9D1, 0x1F3FF, 0x1F9D1, 0x1F3FC, 0x200D, 0x2764, 0x200D,
+    0x1F9D1, 0x1F3FB, 0x1F9D1, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F9D1,
+    0x1F3FD, 0x1F9D1, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FE,
+    0x1F9D1, 0x1F3FC, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FF, 0x1F9D1,
+    0x1F3FD, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FB, 0x1F9D1, 0x1F3FD,
+    0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FC, 0x1F9D1, 0x1F3FD, 0x200D,
+    0x2764, 0x200D, 0x1F9D1, 0x1F3FE, 0x1F9D1, 0x1F3FD, 0x200D, 0x2764,
+    0x200D, 0x1F9D1, 0x1F3FF, 0x1F9D1, 0x1F3FE, 0x200D, 0x2764, 0x200D,
+    0x1F9D1, 0x1F3FB, 0x1F9D1, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F9D1,
+    0x1F3FC, 0x1F9D1, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FD,
+    0x1F9D1, 0x1F3FE, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FF, 0x1F9D1,
+    0x1F3FF, 0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FB, 0x1F9D1, 0x1F3FF,
+    0x200D, 0x2764, 0x200D, 0x1F9D1, 0x1F3FC, 0x1F9D1, 0x1F3FF, 0x200D,
+    0x2764, 0x200D, 0x1F9D1, 0x1F3FD, 0x1F9D1, 0x1F3FF, 0x200D, 0x2764,
+    0x200D, 0x1F9D1, 0x1F3FE, 0x1F492, 0x1F493, 0x1F494, 0x1F495, 0x1F496,
+    0x1F497, 0x1F498, 0x1F499, 0x1F49A, 0x1F49B, 0x1F49C, 0x1F49D, 0x1F49E,
+    0x1F49F, 0x1F4A0, 0x1F4A1, 0x1F4A2, 0x1F4A3, 0x1F4A4, 0x1F4A5, 0x1F4A6,
+    0x1F4A7, 0x1F4A8, 0x1F4A9, 0x1F4AA, 0x1F4AA, 0x1F3FB, 0x1F4AA, 0x1F3FC,
+    0x1F4AA, 0x1F3FD, 0x1F4AA, 0x1F3FE, 0x1F4AA, 0x1F3FF, 0x1F4AB, 0x1F4AC,
+    0x1F4AD, 0x1F4AE, 0x1F4AF, 0x1F4B0, 0x1F4B1, 0x1F4B2, 0x1F4B3, 0x1F4B4,
+    0x1F4B5, 0x1F4B6, 0x1F4B7, 0x1F4B8, 0x1F4B9, 0x1F4BA, 0x1F4BB, 0x1F4BC,
+    0x1F4BD, 0x1F4BE, 0x1F4BF, 0x1F4C0, 0x1F4C1, 0x1F4C2, 0x1F4C3, 0x1F4C4,
+    0x1F4C5, 0x1F4C6, 0x1F4C7, 0x1F4C8, 0x1F4C9, 0x1F4CA, 0x1F4CB, 0x1F4CC,
+    0x1F4CD, 0x1F4CE, 0x1F4CF, 0x1F4D0, 0x1F4D1, 0x1F4D2, 0x1F4D3, 0x1F4D4,
+    0x1F4D5, 0x1F4D6, 0x1F4D7, 0x1F4D8, 0x1F4D9, 0x1F4DA, 0x1F4DB, 0x1F4DC,
+    0x1F4DD, 0x1F4DE, 0x1F4DF, 0x1F4E0, 0x1F4E1, 0x1F4E2, 0x1F4E3, 0x1F4E4,
+    0x1F4E5, 0x1F4E6, 0x1F4E7, 0x1F4E8, 0x1F4E9, 0x1F4EA, 0x1F4EB, 0x1F4EC,
+    0x1F4ED, 0x1F4EE, 0x1F4EF, 0x1F4F0, 0x1F4F1, 0x1F4F2, 0x1F4F3, 0x1F4F4,
+    0x1F4F5, 0x1F4F6, 0x1F4F7, 0x1F4F8, 0x1F4F9, 0x1F4FA, 0x1F4FB, 0x1F4FC,
+    0x1F4FD, 0x1F4FF, 0x1F500, 0x1F501, 0x1F502, 0x1F503, 0x1F504, 0x1F505,
+    0x1F506, 0x1F507, 0x1F508, 0x1F509, 0x1F50A, 0x1F50B, 0x1F50C, 0x1F50D,
+    0x1F50E, 0x1F50F, 0x1F510, 0x1F511, 0x1F512, 0x1F513, 0x1F514, 0x1F515,
+    0x1F516, 0x1F517, 0x1F518, 0x1F519, 0x1F51A, 0x1F51B, 0x1F51C, 0x1F51D,
+    0x1F51E, 0x1F51F, 0x1F520, 0x1F521, 0x1F522, 0x1F523, 0x1F524, 0x1F525,
+    0x1F526, 0x1F527, 0x1F528, 0x1F529, 0x1F52A, 0x1F52B, 0x1F52C, 0x1F52D,
+    0x1F52E, 0x1F52F, 0x1F530, 0x1F531, 0x1F532, 0x1F533, 0x1F534, 0x1F535,
+    0x1F536, 0x1F537, 0x1F538, 0x1F539, 0x1F53A, 0x1F53B, 0x1F53C, 0x1F53D,
+    0x1F549, 0x1F54A, 0x1F54B, 0x1F54C, 0x1F54D, 0x1F54E, 0x1F550, 0x1F551,
+    0x1F552, 0x1F553, 0x1F554, 0x1F555, 0x1F556, 0x1F557, 0x1F558, 0x1F559,
+    0x1F55A, 0x1F55B, 0x1F55C, 0x1F55D, 0x1F55E, 0x1F55F, 0x1F560, 0x1F561,
+    0x1F562, 0x1F563, 0x1F564, 0x1F565, 0x1F566, 0x1F567, 0x1F56F, 0x1F570,
+    0x1F573, 0x1F574, 0x1F574, 0x1F3FB, 0x1F574, 0x1F3FC, 0x1F574, 0x1F3FD,
+    0x1F574, 0x1F3FE, 0x1F574, 0x1F3FF, 0x1F575, 0xFE0F, 0x200D, 0x2640,
+    0xFE0F, 0x1F575, 0x1F3FB, 0x200D, 0x2640, 0x1F575, 0x1F3FC, 0x200D,
+    0x2640, 0x1F575, 0x1F3FD, 0x200D, 0x2640, 0x1F575, 0x1F3FE, 0x200D,
+    0x2640, 0x1F575, 0x1F3FF, 0x200D, 0x2640, 0x1F575, 0xFE0F, 0x200D,
+    0x2642, 0xFE0F, 0x1F575, 0x1F3FB, 0x200D, 0x2642, 0x1F575, 0x1F3FC,
+    0x200D, 0x2642, 0x1F575, 0x1F3FD, 0x200D, 0x2642, 0x1F575, 0x1F3FE,
+    0x200D, 0x2642, 0x1F575, 0x1F3FF, 0x200D, 0x2642, 0x1F575, 0x1F575,
+    0x1F3FB, 0x1F575, 0x1F3FC, 0x1F575, 0x1F3FD, 0x1F575, 0x1F3FE, 0x1F575,
+    0x1F3FF, 0x1F576, 0x1F577, 0x1F578, 0x1F579, 0x1F57A, 0x1F57A, 0x1F3FB,
+    0x1F57A, 0x1F3FC, 0x1F57A, 0x1F3FD, 0x1F57A, 0x1F3FE, 0x1F57A, 0x1F3FF,
+    0x1F587, 0x1F58A, 0x1F58B, 0x1F58C, 0x1F58D, 0x1F590, 0x1F590, 0x1F3FB,
+    0x1F590, 0x1F3FC, 0x1F590, 0x1F3FD, 0x1F590, 0x1F3FE, 0x1F590, 0x1F3FF,
+    0x1F595, 0x1F595, 0x1F3FB, 0x1F595, 0x1F3FC, 0x1F595, 0x1F3FD, 0x1F595,
+    0x1F3FE, 0x1F595, 0x1F3FF, 0x1F596, 0x1F596, 0x1F3FB, 0x1F596, 0x1F3FC,
+    0x1F596, 0x1F3FD, 0x1F596, 0x1F3FE, 0x1F596, 0x1F3FF, 0x1F5A4, 0x1F5A5,
+    0x1F5A8, 0x1F5B1, 0x1F5B2, 0x1F5BC, 0x1F5C2, 0x1F5C3, 0x1F5C4, 0x1F5D1,
+    0x1F5D2, 0x1F5D3, 0x1F5DC, 0x1F5DD, 0x1F5DE, 0x1F5E1, 0x1F5E3, 0x1F5E8,
+    0x1F5EF, 0x1F5F3, 0x1F5FA, 0x1F5FB, 0x1F5FC, 0x1F5FD, 0x1F5FE, 0x1F5FF,
+    0x1F600, 0x1F601, 0x1F602, 0x1F603, 0x1F604, 0x1F605, 0x1F606, 0x1F607,
+    0x1F608, 0x1F609, 0x1F60A, 0x1F60B, 0x1F60C, 0x1F60D, 0x1F60E, 0x1F60F,
+    0x1F610, 0x1F611, 0x1F612, 0x1F613, 0x1F614, 0x1F615, 0x1F616, 0x1F617,
+    0x1F618, 0x1F619, 0x1F61A, 0x1F61B, 0x1F61C, 0x1F61D, 0x1F61E, 0x1F61F,
+    0x1F620, 0x1F621, 0x1F622, 0x1F623, 0x1F624, 0x1F625, 0x1F626, 0x1F627,
+    0x1F628, 0x1F629, 0x1F62A, 0x1F62B, 0x1F62C, 0x1F62D, 0x1F62E, 0x200D,
+    0x1F4A8, 0x1F62E, 0x1F62F, 0x1F630, 0x1F631, 0x1F632, 0x1F633, 0x1F634,
+    0x1F635, 0x200D, 0x1F4AB, 0x1F635, 0x1F636, 0x200D, 0x1F32B, 0x1F636,
+    0x1F637, 0x1F638, 0x1F639, 0x1F63A, 0x1F63B, 0x1F63C, 0x1F63D, 0x1F63E,
+    0x1F63F, 0x1F640, 0x1F641, 0x1F642, 0x1F643, 0x1F644, 0x1F645, 0x200D,
+    0x2640, 0x1F645, 0x1F3FB, 0x200D, 0x2640, 0x1F645, 0x1F3FC, 0x200D,
+    0x2640, 0x1F645, 0x1F3FD, 0x200D, 0x2640, 0x1F645, 0x1F3FE, 0x200D,
+    0x2640, 0x1F645, 0x1F3FF, 0x200D, 0x2640, 0x1F645, 0x200D, 0x2642,
+    0x1F645, 0x1F3FB, 0x200D, 0x2642, 0x1F645, 0x1F3FC, 0x200D, 0x2642,
+    0x1F645, 0x1F3FD, 0x200D, 0x2642, 0x1F645, 0x1F3FE, 0x200D, 0x2642,
+    0x1F645, 0x1F3FF, 0x200D, 0x2642, 0x1F645, 0x1F645, 0x1F3FB, 0x1F645,
+    0x1F3FC, 0x1F645, 0x1F3FD, 0x1F645, 0x1F3FE, 0x1F645, 0x1F3FF, 0x1F646,
+    0x200D, 0x2640, 0x1F646, 0x1F3FB, 0x200D, 0x2640, 0x1F646, 0x1F3FC,
+    0x200D, 0x2640, 0x1F646, 0x1F3FD, 0x200D, 0x2640, 0x1F646, 0x1F3FE,
+    0x200D, 0x2640, 0x1F646, 0x1F3FF, 0x200D, 0x2640, 0x1F646, 0x200D,
+    0x2642, 0x1F646, 0x1F3FB, 0x200D, 0x2642, 0x1F646, 0x1F3FC, 0x200D,
+    0x2642, 0x1F646, 0x1F3FD, 0x200D, 0x2642, 0x1F646, 0x1F3FE, 0x200D,
+    0x2642, 0x1F646, 0x1F3FF, 0x200D, 0x2642, 0x1F646, 0x1F646, 0x1F3FB,
+    0x1F646, 0x1F3FC, 0x1F646, 0x1F3FD, 0x1F646, 0x1F3FE, 0x1F646, 0x1F3FF,
+    0x1F647, 0x200D, 0x2640, 0x1F647, 0x1F3FB, 0x200D, 0x2640, 0x1F647,
+    0x1F3FC, 0x200D, 0x2640, 0x1F647, 0x1F3FD, 0x200D, 0x2640, 0x1F647,
+    0x1F3FE, 0x200D, 0x2640, 0x1F647, 0x1F3FF, 0x200D, 0x2640, 0x1F647,
+    0x200D, 0x2642, 0x1F647, 0x1F3FB, 0x200D, 0x2642, 0x1F647, 0x1F3FC,
+    0x200D, 0x2642, 0x1F647, 0x1F3FD, 0x200D, 0x2642, 0x1F647, 0x1F3FE,
+    0x200D, 0x2642, 0x1F647, 0x1F3FF, 0x200D, 0x2642, 0x1F647, 0x1F647,
+    0x1F3FB, 0x1F647, 0x1F3FC, 0x1F647, 0x1F3FD, 0x1F647, 0x1F3FE, 0x1F647,
+    0x1F3FF, 0x1F648, 0x1F649, 0x1F64A, 0x1F64B, 0x200D, 0x2640, 0x1F64B,
+    0x1F3FB, 0x200D, 0x2640, 0x1F64B, 0x1F3FC, 0x200D, 0x2640, 0x1F64B,
+    0x1F3FD, 0x200D, 0x2640, 0x1F64B, 0x1F3FE, 0x200D, 0x2640, 0x1F64B,
+    0x1F3FF, 0x200D, 0x2640, 0x1F64B, 0x200D, 0x2642, 0x1F64B, 0x1F3FB,
+    0x200D, 0x2642, 0x1F64B, 0x1F3FC, 0x200D, 0x2642, 0x1F64B, 0x1F3FD,
+    0x200D, 0x2642, 0x1F64B, 0x1F3FE, 0x200D, 0x2642, 0x1F64B, 0x1F3FF,
+    0x200D, 0x2642, 0x1F64B, 0x1F64B, 0x1F3FB, 0x1F64B, 0x1F3FC, 0x1F64B,
+    0x1F3FD, 0x1F64B, 0x1F3FE, 0x1F64B, 0x1F3FF, 0x1F64C, 0x1F64C, 0x1F3FB,
+    0x1F64C, 0x1F3FC, 0x1F64C, 0x1F3FD, 0x1F64C, 0x1F3FE, 0x1F64C, 0x1F3FF,
+    0x1F64D, 0x200D, 0x2640, 0x1F64D, 0x1F3FB, 0x200D, 0x2640, 0x1F64D,
+    0x1F3FC, 0x200D, 0x2640, 0x1F64D, 0x1F3FD, 0x200D, 0x2640, 0x1F64D,
+    0x1F3FE, 0x200D, 0x2640, 0x1F64D, 0x1F3FF, 0x200D, 0x2640, 0x1F64D,
+    0x200D, 0x2642, 0x1F64D, 0x1F3FB, 0x200D, 0x2642, 0x1F64D, 0x1F3FC,
+    0x200D, 0x2642, 0x1F64D, 0x1F3FD, 0x200D, 0x2642, 0x1F64D, 0x1F3FE,
+    0x200D, 0x2642, 0x1F64D, 0x1F3FF, 0x200D, 0x2642, 0x1F64D, 0x1F64D,
+    0x1F3FB, 0x1F64D, 0x1F3FC, 0x1F64D, 0x1F3FD, 0x1F64D, 0x1F3FE, 0x1F64D,
+    0x1F3FF, 0x1F64E, 0x200D, 0x2640, 0x1F64E, 0x1F3FB, 0x200D, 0x2640,
+    0x1F64E, 0x1F3FC, 0x200D, 0x2640, 0x1F64E, 0x1F3FD, 0x200D, 0x2640,
+    0x1F64E, 0x1F3FE, 0x200D, 0x2640, 0x1F64E, 0x1F3FF, 0x200D, 0x2640,
+    0x1F64E, 0x200D, 0x2642, 0x1F64E, 0x1F3FB, 0x200D, 0x2642, 0x1F64E,
+    0x1F3FC, 0x200D, 0x2642, 0x1F64E, 0x1F3FD, 0x200D, 0x2642, 0x1F64E,
+    0x1F3FE, 0x200D, 0x2642, 0x1F64E, 0x1F3FF, 0x200D, 0x2642, 0x1F64E,
+    0x1F64E, 0x1F3FB, 0x1F64E, 0x1F3FC, 0x1F64E, 0x1F3FD, 0x1F64E, 0x1F3FE,
+    0x1F64E, 0x1F3FF, 0x1F64F, 0x1F64F, 0x1F3FB, 0x1F64F, 0x1F3FC, 0x1F64F,
+    0x1F3FD, 0x1F64F, 0x1F3FE, 0x1F64F, 0x1F3FF, 0x1F680, 0x1F681, 0x1F682,
+    0x1F683, 0x1F684, 0x1F685, 0x1F686, 0x1F687, 0x1F688, 0x1F689, 0x1F68A,
+    0x1F68B, 0x1F68C, 0x1F68D, 0x1F68E, 0x1F68F, 0x1F690, 0x1F691, 0x1F692,
+    0x1F693, 0x1F694, 0x1F695, 0x1F696, 0x1F697, 0x1F698, 0x1F699, 0x1F69A,
+    0x1F69B, 0x1F69C, 0x1F69D, 0x1F69E, 0x1F69F, 0x1F6A0, 0x1F6A1, 0x1F6A2,
+    0x1F6A3, 0x200D, 0x2640, 0x1F6A3, 0x1F3FB, 0x200D, 0x2640, 0x1F6A3,
+    0x1F3FC, 0x200D, 0x2640, 0x1F6A3, 0x1F3FD, 0x200D, 0x2640, 0x1F6A3,
+    0x1F3FE, 0x200D, 0x2640, 0x1F6A3, 0x1F3FF, 0x200D, 0x2640, 0x1F6A3,
+    0x200D, 0x2642, 0x1F6A3, 0x1F3FB, 0x200D, 0x2642, 0x1F6A3, 0x1F3FC,
+    0x200D, 0x2642, 0x1F6A3, 0x1F3FD, 0x200D, 0x2642, 0x1F6A3, 0x1F3FE,
+    0x200D, 0x2642, 0x1F6A3, 0x1F3FF, 0x200D, 0x2642, 0x1F6A3, 0x1F6A3,
+    0x1F3FB, 0x1F6A3, 0x1F3FC, 0x1F6A3, 0x1F3FD, 0x1F6A3, 0x1F3FE, 0x1F6A3,
+    0x1F3FF, 0x1F6A4, 0x1F6A5, 0x1F6A6, 0x1F6A7, 0x1F6A8, 0x1F6A9, 0x1F6AA,
+    0x1F6AB, 0x1F6AC, 0x1F6AD, 0x1F6AE, 0x1F6AF, 0x1F6B0, 0x1F6B1, 0x1F6B2,
+    0x1F6B3, 0x1F6B4, 0x200D, 0x2640, 0x1F6B4, 0x1F3FB, 0x200D, 0x2640,
+    0x1F6B4, 0x1F3FC, 0x200D, 0x2640, 0x1F6B4, 0x1F3FD, 0x200D, 0x2640,
+    0x1F6B4, 0x1F3FE, 0x200D, 0x2640, 0x1F6B4, 0x1F3FF, 0x200D, 0x2640,
+    0x1F6B4, 0x200D, 0x2642, 0x1F6B4, 0x1F3FB, 0x200D, 0x2642, 0x1F6B4,
+    0x1F3FC, 0x200D, 0x2642, 0x1F6B4, 0x1F3FD, 0x200D, 0x2642, 0x1F6B4,
+    0x1F3FE, 0x200D, 0x2642, 0x1F6B4, 0x1F3FF, 0x200D, 0x2642, 0x1F6B4,
+    0x1F6B4, 0x1F3FB, 0x1F6B4, 0x1F3FC, 0x1F6B4, 0x1F3FD, 0x1F6B4, 0x1F3FE,
+    0x1F6B4, 0x1F3FF, 0x1F6B5, 0x200D, 0x2640, 0x1F6B5, 0x1F3FB, 0x200D,
+    0x2640, 0x1F6B5, 0x1F3FC, 0x200D, 0x2640, 0x1F6B5, 0x1F3FD, 0x200D,
+    0x2640, 0x1F6B5, 0x1F3FE, 0x200D, 0x2640, 0x1F6B5, 0x1F3FF, 0x200D,
+    0x2640, 0x1F6B5, 0x200D, 0x2642, 0x1F6B5, 0x1F3FB, 0x200D, 0x2642,
+    0x1F6B5, 0x1F3FC, 0x200D, 0x2642, 0x1F6B5, 0x1F3FD, 0x200D, 0x2642,
+    0x1F6B5, 0x1F3FE, 0x200D, 0x2642, 0x1F6B5, 0x1F3FF, 0x200D, 0x2642,
+    0x1F6B5, 0x1F6B5, 0x1F3FB, 0x1F6B5, 0x1F3FC, 0x1F6B5, 0x1F3FD, 0x1F6B5,
+    0x1F3FE, 0x1F6B5, 0x1F3FF, 0x1F6B6, 0x200D, 0x2640, 0x1F6B6, 0x1F3FB,
+    0x200D, 0x2640, 0x1F6B6, 0x1F3FC, 0x200D, 0x2640, 0x1F6B6, 0x1F3FD,
+    0x200D, 0x2640, 0x1F6B6, 0x1F3FE, 0x200D, 0x2640, 0x1F6B6, 0x1F3FF,
+    0x200D, 0x2640, 0x1F6B6, 0x200D, 0x2642, 0x1F6B6, 0x1F3FB, 0x200D,
+    0x2642, 0x1F6B6, 0x1F3FC, 0x200D, 0x2642, 0x1F6B6, 0x1F3FD, 0x200D,
+    0x2642, 0x1F6B6, 0x1F3FE, 0x200D, 0x2642, 0x1F6B6, 0x1F3FF, 0x200D,
+    0x2642, 0x1F6B6, 0x1F6B6, 0x1F3FB, 0x1F6B6, 0x1F3FC, 0x1F6B6, 0x1F3FD,
+    0x1F6B6, 0x1F3FE, 0x1F6B6, 0x1F3FF, 0x1F6B7, 0x1F6B8, 0x1F6B9, 0x1F6BA,
+    0x1F6BB, 0x1F6BC, 0x1F6BD, 0x1F6BE, 0x1F6BF, 0x1F6C0, 0x1F6C0, 0x1F3FB,
+    0x1F6C0, 0x1F3FC, 0x1F6C0, 0x1F3FD, 0x1F6C0, 0x1F3FE, 0x1F6C0, 0x1F3FF,
+    0x1F6C1, 0x1F6C2, 0x1F6C3, 0x1F6C4, 0x1F6C5, 0x1F6CB, 0x1F6CC, 0x1F6CC,
+    0x1F3FB, 0x1F6CC, 0x1F3FC, 0x1F6CC, 0x1F3FD, 0x1F6CC, 0x1F3FE, 0x1F6CC,
+    0x1F3FF, 0x1F6CD, 0x1F6CE, 0x1F6CF, 0x1F6D0, 0x1F6D1, 0x1F6D2, 0x1F6D5,
+    0x1F6D6, 0x1F6D7, 0x1F6E0, 0x1F6E1, 0x1F6E2, 0x1F6E3, 0x1F6E4, 0x1F6E5,
+    0x1F6E9, 0x1F6EB, 0x1F6EC, 0x1F6F0, 0x1F6F3, 0x1F6F4, 0x1F6F5, 0x1F6F6,
+    0x1F6F7, 0x1F6F8, 0x1F6F9, 0x1F6FA, 0x1F6FB, 0x1F6FC, 0x1F7E0, 0x1F7E1,
+    0x1F7E2, 0x1F7E3, 0x1F7E4, 0x1F7E5, 0x1F7E6, 0x1F7E7, 0x1F7E8, 0x1F7E9,
+    0x1F7EA, 0x1F7EB, 0x1F90C, 0x1F90C, 0x1F3FB, 0x1F90C, 0x1F3FC, 0x1F90C,
+    0x1F3FD, 0x1F90C, 0x1F3FE, 0x1F90C, 0x1F3FF, 0x1F90D, 0x1F90E, 0x1F90F,
+    0x1F90F, 0x1F3FB, 0x1F90F, 0x1F3FC, 0x1F90F, 0x1F3FD, 0x1F90F, 0x1F3FE,
+    0x1F90F, 0x1F3FF, 0x1F910, 0x1F911, 0x1F912, 0x1F913, 0x1F914, 0x1F915,
+    0x1F916, 0x1F917, 0x1F918, 0x1F918, 0x1F3FB, 0x1F918, 0x1F3FC, 0x1F918,
+    0x1F3FD, 0x1F918, 0x1F3FE, 0x1F918, 0x1F3FF, 0x1F919, 0x1F919, 0x1F3FB,
+    0x1F919, 0x1F3FC, 0x1F919, 0x1F3FD, 0x1F919, 0x1F3FE, 0x1F919, 0x1F3FF,
+    0x1F91A, 0x1F91A, 0x1F3FB, 0x1F91A, 0x1F3FC, 0x1F91A, 0x1F3FD, 0x1F91A,
+    0x1F3FE, 0x1F91A, 0x1F3FF, 0x1F91B, 0x1F91B, 0x1F3FB, 0x1F91B, 0x1F3FC,
+    0x1F91B, 0x1F3FD, 0x1F91B, 0x1F3FE, 0x1F91B, 0x1F3FF, 0x1F91C, 0x1F91C,
+    0x1F3FB, 0x1F91C, 0x1F3FC, 0x1F91C, 0x1F3FD, 0x1F91C, 0x1F3FE, 0x1F91C,
+    0x1F3FF, 0x1F91D, 0x1F91E, 0x1F91E, 0x1F3FB, 0x1F91E, 0x1F3FC, 0x1F91E,
+    0x1F3FD, 0x1F91E, 0x1F3FE, 0x1F91E, 0x1F3FF, 0x1F91F, 0x1F91F, 0x1F3FB,
+    0x1F91F, 0x1F3FC, 0x1F91F, 0x1F3FD, 0x1F91F, 0x1F3FE, 0x1F91F, 0x1F3FF,
+    0x1F920, 0x1F921, 0x1F922, 0x1F923, 0x1F924, 0x1F925, 0x1F926, 0x200D,
+    0x2640, 0x1F926, 0x1F3FB, 0x200D, 0x2640, 0x1F926, 0x1F3FC, 0x200D,
+    0x2640, 0x1F926, 0x1F3FD, 0x200D, 0x2640, 0x1F926, 0x1F3FE, 0x200D,
+    0x2640, 0x1F926, 0x1F3FF, 0x200D, 0x2640, 0x1F926, 0x200D, 0x2642,
+    0x1F926, 0x1F3FB, 0x200D, 0x2642, 0x1F926, 0x1F3FC, 0x200D, 0x2642,
+    0x1F926, 0x1F3FD, 0x200D, 0x2642, 0x1F926, 0x1F3FE, 0x200D, 0x2642,
+    0x1F926, 0x1F3FF, 0x200D, 0x2642, 0x1F926, 0x1F926, 0x1F3FB, 0x1F926,
+    0x1F3FC, 0x1F926, 0x1F3FD, 0x1F926, 0x1F3FE, 0x1F926, 0x1F3FF, 0x1F927,
+    0x1F928, 0x1F929, 0x1F92A, 0x1F92B, 0x1F92C, 0x1F92D, 0x1F92E, 0x1F92F,
+    0x1F930, 0x1F930, 0x1F3FB, 0x1F930, 0x1F3FC, 0x1F930, 0x1F3FD, 0x1F930,
+    0x1F3FE, 0x1F930, 0x1F3FF, 0x1F931, 0x1F931, 0x1F3FB, 0x1F931, 0x1F3FC,
+    0x1F931, 0x1F3FD, 0x1F931, 0x1F3FE, 0x1F931, 0x1F3FF, 0x1F932, 0x1F932,
+    0x1F3FB, 0x1F932, 0x1F3FC, 0x1F932, 0x1F3FD, 0x1F932, 0x1F3FE, 0x1F932,
+    0x1F3FF, 0x1F933, 0x1F933, 0x1F3FB, 0x1F933, 0x1F3FC, 0x1F933, 0x1F3FD,
+    0x1F933, 0x1F3FE, 0x1F933, 0x1F3FF, 0x1F934, 0x1F934, 0x1F3FB, 0x1F934,
+    0x1F3FC, 0x1F934, 0x1F3FD, 0x1F934, 0x1F3FE, 0x1F934, 0x1F3FF, 0x1F935,
+    0x200D, 0x2640, 0x1F935, 0x1F3FB, 0x200D, 0x2640, 0x1F935, 0x1F3FC,
+    0x200D, 0x2640, 0x1F935, 0x1F3FD, 0x200D, 0x2640, 0x1F935, 0x1F3FE,
+    0x200D, 0x2640, 0x1F935, 0x1F3FF, 0x200D, 0x2640, 0x1F935, 0x200D,
+    0x2642, 0x1F935, 0x1F3FB, 0x200D, 0x2642, 0x1F935, 0x1F3FC, 0x200D,
+    0x2642, 0x1F935, 0x1F3FD, 0x200D, 0x2642, 0x1F935, 0x1F3FE, 0x200D,
+    0x2642, 0x1F935, 0x1F3FF, 0x200D, 0x2642, 0x1F935, 0x1F935, 0x1F3FB,
+    0x1F935, 0x1F3FC, 0x1F935, 0x1F3FD, 0x1F935, 0x1F3FE, 0x1F935, 0x1F3FF,
+    0x1F936, 0x1F936, 0x1F3FB, 0x1F936, 0x1F3FC, 0x1F936, 0x1F3FD, 0x1F936,
+    0x1F3FE, 0x1F936, 0x1F3FF, 0x1F937, 0x200D, 0x2640, 0x1F937, 0x1F3FB,
+    0x200D, 0x2640, 0x1F937, 0x1F3FC, 0x200D, 0x2640, 0x1F937, 0x1F3FD,
+    0x200D, 0x2640, 0x1F937, 0x1F3FE, 0x200D, 0x2640, 0x1F937, 0x1F3FF,
+    0x200D, 0x2640, 0x1F937, 0x200D, 0x2642, 0x1F937, 0x1F3FB, 0x200D,
+    0x2642, 0x1F937, 0x1F3FC, 0x200D, 0x2642, 0x1F937, 0x1F3FD, 0x200D,
+    0x2642, 0x1F937, 0x1F3FE, 0x200D, 0x2642, 0x1F937, 0x1F3FF, 0x200D,
+    0x2642, 0x1F937, 0x1F937, 0x1F3FB, 0x1F937, 0x1F3FC, 0x1F937, 0x1F3FD,
+    0x1F937, 0x1F3FE, 0x1F937, 0x1F3FF, 0x1F938, 0x200D, 0x2640, 0x1F938,
+    0x1F3FB, 0x200D, 0x2640, 0x1F938, 0x1F3FC, 0x200D, 0x2640, 0x1F938,
+    0x1F3FD, 0x200D, 0x2640, 0x1F938, 0x1F3FE, 0x200D, 0x2640, 0x1F938,
+    0x1F3FF, 0x200D, 0x2640, 0x1F938, 0x200D, 0x2642, 0x1F938, 0x1F3FB,
+    0x200D, 0x2642, 0x1F938, 0x1F3FC, 0x200D, 0x2642, 0x1F938, 0x1F3FD,
+    0x200D, 0x2642, 0x1F938, 0x1F3FE, 0x200D, 0x2642, 0x1F938, 0x1F3FF,
+    0x200D, 0x2642, 0x1F938, 0x1F938, 0x1F3FB, 0x1F938, 0x1F3FC, 0x1F938,
+    0x1F3FD, 0x1F938, 0x1F3FE, 0x1F938, 0x1F3FF, 0x1F939, 0x200D, 0x2640,
+    0x1F939, 0x1F3FB, 0x200D, 0x2640, 0x1F939, 0x1F3FC, 0x200D, 0x2640,
+    0x1F939, 0x1F3FD, 0x200D, 0x2640, 0x1F939, 0x1F3FE, 0x200D, 0x2640,
+    0x1F939, 0x1F3FF, 0x200D, 0x2640, 0x1F939, 0x200D, 0x2642, 0x1F939,
+    0x1F3FB, 0x200D, 0x2642, 0x1F939, 0x1F3FC, 0x200D, 0x2642, 0x1F939,
+    0x1F3FD, 0x200D, 0x2642, 0x1F939, 0x1F3FE, 0x200D, 0x2642, 0x1F939,
+    0x1F3FF, 0x200D, 0x2642, 0x1F939, 0x1F939, 0x1F3FB, 0x1F939, 0x1F3FC,
+    0x1F939, 0x1F3FD, 0x1F939, 0x1F3FE, 0x1F939, 0x1F3FF, 0x1F93A, 0x1F93C,
+    0x200D, 0x2640, 0x1F93C, 0x200D, 0x2642, 0x1F93C, 0x1F93D, 0x200D,
+    0x2640, 0x1F93D, 0x1F3FB, 0x200D, 0x2640, 0x1F93D, 0x1F3FC, 0x200D,
+    0x2640, 0x1F93D, 0x1F3FD, 0x200D, 0x2640, 0x1F93D, 0x1F3FE, 0x200D,
+    0x2640, 0x1F93D, 0x1F3FF, 0x200D, 0x2640, 0x1F93D, 0x200D, 0x2642,
+    0x1F93D, 0x1F3FB, 0x200D, 0x2642, 0x1F93D, 0x1F3FC, 0x200D, 0x2642,
+    0x1F93D, 0x1F3FD, 0x200D, 0x2642, 0x1F93D, 0x1F3FE, 0x200D, 0x2642,
+    0x1F93D, 0x1F3FF, 0x200D, 0x2642, 0x1F93D, 0x1F93D, 0x1F3FB, 0x1F93D,
+    0x1F3FC, 0x1F93D, 0x1F3FD, 0x1F93D, 0x1F3FE, 0x1F93D, 0x1F3FF, 0x1F93E,
+    0x200D, 0x2640, 0x1F93E, 0x1F3FB, 0x200D, 0x2640, 0x1F93E, 0x1F3FC,
+    0x200D, 0x2640, 0x1F93E, 0x1F3FD, 0x200D, 0x2640, 0x1F93E, 0x1F3FE,
+    0x200D, 0x2640, 0x1F93E, 0x1F3FF, 0x200D, 0x2640, 0x1F93E, 0x200D,
+    0x2642, 0x1F93E, 0x1F3FB, 0x200D, 0x2642, 0x1F93E, 0x1F3FC, 0x200D,
+    0x2642, 0x1F93E, 0x1F3FD, 0x200D, 0x2642, 0x1F93E, 0x1F3FE, 0x200D,
+    0x2642, 0x1F93E, 0x1F3FF, 0x200D, 0x2642, 0x1F93E, 0x1F93E, 0x1F3FB,
+    0x1F93E, 0x1F3FC, 0x1F93E, 0x1F3FD, 0x1F93E, 0x1F3FE, 0x1F93E, 0x1F3FF,
+    0x1F93F, 0x1F940, 0x1F941, 0x1F942, 0x1F943, 0x1F944, 0x1F945, 0x1F947,
+    0x1F948, 0x1F949, 0x1F94A, 0x1F94B, 0x1F94C, 0x1F94D, 0x1F94E, 0x1F94F,
+    0x1F950, 0x1F951, 0x1F952, 0x1F953, 0x1F954, 0x1F955, 0x1F956, 0x1F957,
+    0x1F958, 0x1F959, 0x1F95A, 0x1F95B, 0x1F95C, 0x1F95D, 0x1F95E, 0x1F95F,
+    0x1F960, 0x1F961, 0x1F962, 0x1F963, 0x1F964, 0x1F965, 0x1F966, 0x1F967,
+    0x1F968, 0x1F969, 0x1F96A, 0x1F96B, 0x1F96C, 0x1F96D, 0x1F96E, 0x1F96F,
+    0x1F970, 0x1F971, 0x1F972, 0x1F973, 0x1F974, 0x1F975, 0x1F976, 0x1F977,
+    0x1F977, 0x1F3FB, 0x1F977, 0x1F3FC, 0x1F977, 0x1F3FD, 0x1F977, 0x1F3FE,
+    0x1F977, 0x1F3FF, 0x1F978, 0x1F97A, 0x1F97B, 0x1F97C, 0x1F97D, 0x1F97E,
+    0x1F97F, 0x1F980, 0x1F981, 0x1F982, 0x1F983, 0x1F984, 0x1F985, 0x1F986,
+    0x1F987, 0x1F988, 0x1F989, 0x1F98A, 0x1F98B, 0x1F98C, 0x1F98D, 0x1F98E,
+    0x1F98F, 0x1F990, 0x1F991, 0x1F992, 0x1F993, 0x1F994, 0x1F995, 0x1F996,
+    0x1F997, 0x1F998, 0x1F999, 0x1F99A, 0x1F99B, 0x1F99C, 0x1F99D, 0x1F99E,
+    0x1F99F, 0x1F9A0, 0x1F9A1, 0x1F9A2, 0x1F9A3, 0x1F9A4, 0x1F9A5, 0x1F9A6,
+    0x1F9A7, 0x1F9A8, 0x1F9A9, 0x1F9AA, 0x1F9AB, 0x1F9AC, 0x1F9AD, 0x1F9AE,
+    0x1F9AF, 0x1F9B4, 0x1F9B5, 0x1F9B5, 0x1F3FB, 0x1F9B5, 0x1F3FC, 0x1F9B5,
+    0x1F3FD, 0x1F9B5, 0x1F3FE, 0x1F9B5, 0x1F3FF, 0x1F9B6, 0x1F9B6, 0x1F3FB,
+    0x1F9B6, 0x1F3FC, 0x1F9B6, 0x1F3FD, 0x1F9B6, 0x1F3FE, 0x1F9B6, 0x1F3FF,
+    0x1F9B7, 0x1F9B8, 0x200D, 0x2640, 0x1F9B8, 0x1F3FB, 0x200D, 0x2640,
+    0x1F9B8, 0x1F3FC, 0x200D, 0x2640, 0x1F9B8, 0x1F3FD, 0x200D, 0x2640,
+    0x1F9B8, 0x1F3FE, 0x200D, 0x2640, 0x1F9B8, 0x1F3FF, 0x200D, 0x2640,
+    0x1F9B8, 0x200D, 0x2642, 0x1F9B8, 0x1F3FB, 0x200D, 0x2642, 0x1F9B8,
+    0x1F3FC, 0x200D, 0x2642, 0x1F9B8, 0x1F3FD, 0x200D, 0x2642, 0x1F9B8,
+    0x1F3FE, 0x200D, 0x2642, 0x1F9B8, 0x1F3FF, 0x200D, 0x2642, 0x1F9B8,
+    0x1F9B8, 0x1F3FB, 0x1F9B8, 0x1F3FC, 0x1F9B8, 0x1F3FD, 0x1F9B8, 0x1F3FE,
+    0x1F9B8, 0x1F3FF, 0x1F9B9, 0x200D, 0x2640, 0x1F9B9, 0x1F3FB, 0x200D,
+    0x2640, 0x1F9B9, 0x1F3FC, 0x200D, 0x2640, 0x1F9B9, 0x1F3FD, 0x200D,
+    0x2640, 0x1F9B9, 0x1F3FE, 0x200D, 0x2640, 0x1F9B9, 0x1F3FF, 0x200D,
+    0x2640, 0x1F9B9, 0x200D, 0x2642, 0x1F9B9, 0x1F3FB, 0x200D, 0x2642,
+    0x1F9B9, 0x1F3FC, 0x200D, 0x2642, 0x1F9B9, 0x1F3FD, 0x200D, 0x2642,
+    0x1F9B9, 0x1F3FE, 0x200D, 0x2642, 0x1F9B9, 0x1F3FF, 0x200D, 0x2642,
+    0x1F9B9, 0x1F9B9, 0x1F3FB, 0x1F9B9, 0x1F3FC, 0x1F9B9, 0x1F3FD, 0x1F9B9,
+    0x1F3FE, 0x1F9B9, 0x1F3FF, 0x1F9BA, 0x1F9BB, 0x1F9BB, 0x1F3FB, 0x1F9BB,
+    0x1F3FC, 0x1F9BB, 0x1F3FD, 0x1F9BB, 0x1F3FE, 0x1F9BB, 0x1F3FF, 0x1F9BC,
+    0x1F9BD, 0x1F9BE, 0x1F9BF, 0x1F9C0, 0x1F9C1, 0x1F9C2, 0x1F9C3, 0x1F9C4,
+    0x1F9C5, 0x1F9C6, 0x1F9C7, 0x1F9C8, 0x1F9C9, 0x1F9CA, 0x1F9CB, 0x1F9CD,
+    0x200D, 0x2640, 0x1F9CD, 0x1F3FB, 0x200D, 0x2640, 0x1F9CD, 0x1F3FC,
+    0x200D, 0x2640, 0x1F9CD, 0x1F3FD, 0x200D, 0x2640, 0x1F9CD, 0x1F3FE,
+    0x200D, 0x2640, 0x1F9CD, 0x1F3FF, 0x200D, 0x2640, 0x1F9CD, 0x200D,
+    0x2642, 0x1F9CD, 0x1F3FB, 0x200D, 0x2642, 0x1F9CD, 0x1F3FC, 0x200D,
+    0x2642, 0x1F9CD, 0x1F3FD, 0x200D, 0x2642, 0x1F9CD, 0x1F3FE, 0x200D,
+    0x2642, 0x1F9CD, 0x1F3FF, 0x200D, 0x2642, 0x1F9CD, 0x1F9CD, 0x1F3FB,
+    0x1F9CD, 0x1F3FC, 0x1F9CD, 0x1F3FD, 0x1F9CD, 0x1F3FE, 0x1F9CD, 0x1F3FF,
+    0x1F9CE, 0x200D, 0x2640, 0x1F9CE, 0x1F3FB, 0x200D, 0x2640, 0x1F9CE,
+    0x1F3FC, 0x200D, 0x2640, 0x1F9CE, 0x1F3FD, 0x200D, 0x2640, 0x1F9CE,
+    0x1F3FE, 0x200D, 0x2640, 0x1F9CE, 0x1F3FF, 0x200D, 0x2640, 0x1F9CE,
+    0x200D, 0x2642, 0x1F9CE, 0x1F3FB, 0x200D, 0x2642, 0x1F9CE, 0x1F3FC,
+    0x200D, 0x2642, 0x1F9CE, 0x1F3FD, 0x200D, 0x2642, 0x1F9CE, 0x1F3FE,
+    0x200D, 0x2642, 0x1F9CE, 0x1F3FF, 0x200D, 0x2642, 0x1F9CE, 0x1F9CE,
+    0x1F3FB, 0x1F9CE, 0x1F3FC, 0x1F9CE, 0x1F3FD, 0x1F9CE, 0x1F3FE, 0x1F9CE,
+    0x1F3FF, 0x1F9CF, 0x200D, 0x2640, 0x1F9CF, 0x1F3FB, 0x200D, 0x2640,
+    0x1F9CF, 0x1F3FC, 0x200D, 0x2640, 0x1F9CF, 0x1F3FD, 0x200D, 0x2640,
+    0x1F9CF, 0x1F3FE, 0x200D, 0x2640, 0x1F9CF, 0x1F3FF, 0x200D, 0x2640,
+    0x1F9CF, 0x200D, 0x2642, 0x1F9CF, 0x1F3FB, 0x200D, 0x2642, 0x1F9CF,
+    0x1F3FC, 0x200D, 0x2642, 0x1F9CF, 0x1F3FD, 0x200D, 0x2642, 0x1F9CF,
+    0x1F3FE, 0x200D, 0x2642, 0x1F9CF, 0x1F3FF, 0x200D, 0x2642, 0x1F9CF,
+    0x1F9CF, 0x1F3FB, 0x1F9CF, 0x1F3FC, 0x1F9CF, 0x1F3FD, 0x1F9CF, 0x1F3FE,
+    0x1F9CF, 0x1F3FF, 0x1F9D0, 0x1F9D1, 0x200D, 0x1F33E, 0x1F9D1, 0x1F3FB,
+    0x200D, 0x1F33E, 0x1F9D1, 0x1F3FC, 0x200D, 0x1F33E, 0x1F9D1, 0x1F3FD,
+    0x200D, 0x1F33E, 0x1F9D1, 0x1F3FE, 0x200D, 0x1F33E, 0x1F9D1, 0x1F3FF,
+    0x200D, 0x1F33E, 0x1F9D1, 0x200D, 0x1F373, 0x1F9D1, 0x1F3FB, 0x200D,
+    0x1F373, 0x1F9D1, 0x1F3FC, 0x200D, 0x1F373, 0x1F9D1, 0x1F3FD, 0x200D,
+    0x1F373, 0x1F9D1, 0x1F3FE, 0x200D, 0x1F373, 0x1F9D1, 0x1F3FF, 0x200D,
+    0x1F373, 0x1F9D1, 0x200D, 0x1F37C, 0x1F9D1, 0x1F3FB, 0x200D, 0x1F37C,
+    0x1F9D1, 0x1F3FC, 0x200D, 0x1F37C, 0x1F9D1, 0x1F3FD, 0x200D, 0x1F37C,
+    0x1F9D1, 0x1F3FE, 0x200D, 0x1F37C, 0x1F9D1, 0x1F3FF, 0x200D, 0x1F37C,
+    0x1F9D1, 0x200D, 0x1F384, 0x1F9D1, 0x1F3FB, 0x200D, 0x1F384, 0x1F9D1,
+    0x1F3FC, 0x200D, 0x1F384, 0x1F9D1, 0x1F3FD, 0x200D, 0x1F384, 0x1F9D1,
+    0x1F3FE, 0x200D, 0x1F384, 0x1F9D1, 0x1F3FF, 0x200D, 0x1F384, 0x1F9D1,
+    0x200D, 0x1F393, 0x1F9D1, 0x1F3FB, 0x200D, 0x1F393, 0x1F9D1, 0x1F3FC,
+    0x200D, 0x1F393, 0x1F9D1, 0x1F3FD, 0x200D, 0x1F393, 0x1F9D1, 0x1F3FE,
+    0x200D, 0x1F393, 0x1F9D1, 0x1F3FF, 0x200D, 0x1F393, 0x1F9D1, 0x200D,
+    0x1F3A4, 0x1F9D1, 0x1F3FB, 0x200D, 0x1F3A4, 0x1F9D1, 0x1F3FC, 0x200D,
+    0x1F3A4, 0x1F9D1, 0x1F3FD, 0x200D, 0x1F3A4, 0x1F9D1, 0x1F3FE, 0x200D,
+    0x1F3A4, 0x1F9D1, 0x1F3FF, 0x200D, 0x1F3A4, 0x1F9D1, 0x200D, 0x1F3A8,
+    0x1F9D1, 0x1F3FB, 0x200D, 0x1F3A8, 0x1F9D1, 0x1F3FC, 0x200D, 0x1F3A8,
+    0x1F9D1, 0x1F3FD, 0x200D, 0x1F3A8, 0x1F9D1, 0x1F3FE, 0x200D, 0x1F3A8,
+    0x1F9D1, 0x1F3FF, 0x200D, 0x1F3A8, 0x1F9D1, 0x200D, 0x1F3EB, 0x1F9D1,
+    0x1F3FB, 0x200D, 0x1F3EB, 0x1F9D1, 0x1F3FC, 0x200D, 0x1F3EB, 0x1F9D1,
+    0x1F3FD, 0x200D, 0x1F3EB, 0x1F9D1, 0x1F3FE, 0x200D, 0x1F3EB, 0x1F9D1,
+    0x1F3FF, 0x200D, 0x1F3EB, 0x1F9D1, 0x200D, 0x1F3ED, 0x1F9D1, 0x1F3FB,
+    0x200D, 0x1F3ED, 0x1F9D1, 0x1F3FC, 0x200D, 0x1F3ED, 0x1F9D1, 0x1F3FD,
+    0x200D, 0x1F3ED, 0x1F9D1, 0x1F3FE, 0x200D, 0x1F3ED, 0x1F9D1, 0x1F3FF,
+    0x200D, 0x1F3ED, 0x1F9D1, 0x200D, 0x1F4BB, 0x1F9D1, 0x1F3FB, 0x200D,
+    0x1F4BB, 0x1F9D1, 0x1F3FC, 0x200D, 0x1F4BB, 0x1F9D1, 0x1F3FD, 0x200D,
+    0x1F4BB, 0x1F9D1, 0x1F3FE, 0x200D, 0x1F4BB, 0x1F9D1, 0x1F3FF, 0x200D,
+    0x1F4BB, 0x1F9D1, 0x200D, 0x1F4BC, 0x1F9D1, 0x1F3FB, 0x200D, 0x1F4BC,
+    0x1F9D1, 0x1F3FC, 0x200D, 0x1F4BC, 0x1F9D1, 0x1F3FD, 0x200D, 0x1F4BC,
+    0x1F9D1, 0x1F3FE, 0x200D, 0x1F4BC, 0x1F9D1, 0x1F3FF, 0x200D, 0x1F4BC,
+    0x1F9D1, 0x200D, 0x1F527, 0x1F9D1, 0x1F3FB, 0x200D, 0x1F527, 0x1F9D1,
+    0x1F3FC, 0x200D, 0x1F527, 0x1F9D1, 0x1F3FD, 0x200D, 0x1F527, 0x1F9D1,
+    0x1F3FE, 0x200D, 0x1F527, 0x1F9D1, 0x1F3FF, 0x200D, 0x1F527, 0x1F9D1,
+    0x200D, 0x1F52C, 0x1F9D1, 0x1F3FB, 0x200D, 0x1F52C, 0x1F9D1, 0x1F3FC,
+    0x200D, 0x1F52C, 0x1F9D1, 0x1F3FD, 0x200D, 0x1F52C, 0x1F9D1, 0x1F3FE,
+    0x200D, 0x1F52C, 0x1F9D1, 0x1F3FF, 0x200D, 0x1F52C, 0x1F9D1, 0x200D,
+    0x1F680, 0x1F9D1, 0x1F3FB, 0x200D, 0x1F680, 0x1F9D1, 0x1F3FC, 0x200D,
+    0x1F680, 0x1F9D1, 0x1F3FD, 0x200D, 0x1F680, 0x1F9D1, 0x1F3FE, 0x200D,
+    0x1F680, 0x1F9D1, 0x1F3FF, 0x200D, 0x1F680, 0x1F9D1, 0x200D, 0x1F692,
+    0x1F9D1, 0x1F3FB, 0x200D, 0x1F692, 0x1F9D1, 0x1F3FC, 0x200D, 0x1F692,
+    0x1F9D1, 0x1F3FD, 0x200D, 0x1F692, 0x1F9D1, 0x1F3FE, 0x200D, 0x1F692,
+    0x1F9D1, 0x1F3FF, 0x200D, 0x1F692, 0x1F9D1, 0x200D, 0x1F91D, 0x200D,
+    0x1F9D1, 0x1F9D1, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FB,
+    0x1F9D1, 0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FC, 0x1F9D1,
+    0x1F3FB, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FD, 0x1F9D1, 0x1F3FB,
+    0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FE, 0x1F9D1, 0x1F3FB, 0x200D,
+    0x1F91D, 0x200D, 0x1F9D1, 0x1F3FF, 0x1F9D1, 0x1F3FC, 0x200D, 0x1F91D,
+    0x200D, 0x1F9D1, 0x1F3FB, 0x1F9D1, 0x1F3FC, 0x200D, 0x1F91D, 0x200D,
+    0x1F9D1, 0x1F3FC, 0x1F9D1, 0x1F3FC, 0x200D, 0x1F91D, 0x200D, 0x1F9D1,
+    0x1F3FD, 0x1F9D1, 0x1F3FC, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FE,
+    0x1F9D1, 0x1F3FC, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FF, 0x1F9D1,
+    0x1F3FD, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FB, 0x1F9D1, 0x1F3FD,
+    0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FC, 0x1F9D1, 0x1F3FD, 0x200D,
+    0x1F91D, 0x200D, 0x1F9D1, 0x1F3FD, 0x1F9D1, 0x1F3FD, 0x200D, 0x1F91D,
+    0x200D, 0x1F9D1, 0x1F3FE, 0x1F9D1, 0x1F3FD, 0x200D, 0x1F91D, 0x200D,
+    0x1F9D1, 0x1F3FF, 0x1F9D1, 0x1F3FE, 0x200D, 0x1F91D, 0x200D, 0x1F9D1,
+    0x1F3FB, 0x1F9D1, 0x1F3FE, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FC,
+    0x1F9D1, 0x1F3FE, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FD, 0x1F9D1,
+    0x1F3FE, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FE, 0x1F9D1, 0x1F3FE,
+    0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FF, 0x1F9D1, 0x1F3FF, 0x200D,
+    0x1F91D, 0x200D, 0x1F9D1, 0x1F3FB, 0x1F9D1, 0x1F3FF, 0x200D, 0x1F91D,
+    0x200D, 0x1F9D1, 0x1F3FC, 0x1F9D1, 0x1F3FF, 0x200D, 0x1F91D, 0x200D,
+    0x1F9D1, 0x1F3FD, 0x1F9D1, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F9D1,
+    0x1F3FE, 0x1F9D1, 0x1F3FF, 0x200D, 0x1F91D, 0x200D, 0x1F9D1, 0x1F3FF,
+    0x1F9D1, 0x200D, 0x1F9AF, 0x1F9D1, 0x1F3FB, 0x200D, 0x1F9AF, 0x1F9D1,
+    0x1F3FC, 0x200D, 0x1F9AF, 0x1F9D1, 0x1F3FD, 0x200D, 0x1F9AF, 0x1F9D1,
+    0x1F3FE, 0x200D, 0x1F9AF, 0x1F9D1, 0x1F3FF, 0x200D, 0x1F9AF, 0x1F9D1,
+    0x200D, 0x1F9B0, 0x1F9D1, 0x1F3FB, 0x200D, 0x1F9B0, 0x1F9D1, 0x1F3FC,
+    0x200D, 0x1F9B0, 0x1F9D1, 0x1F3FD, 0x200D, 0x1F9B0, 0x1F9D1, 0x1F3FE,
+    0x200D, 0x1F9B0, 0x1F9D1, 0x1F3FF, 0x200D, 0x1F9B0, 0x1F9D1, 0x200D,
+    0x1F9B1, 0x1F9D1, 0x1F3FB, 0x200D, 0x1F9B1, 0x1F9D1, 0x1F3FC, 0x200D,
+    0x1F9B1, 0x1F9D1, 0x1F3FD, 0x200D, 0x1F9B1, 0x1F9D1, 0x1F3FE, 0x200D,
+    0x1F9B1, 0x1F9D1, 0x1F3FF, 0x200D, 0x1F9B1, 0x1F9D1, 0x200D, 0x1F9B2,
+    0x1F9D1, 0x1F3FB, 0x200D, 0x1F9B2, 0x1F9D1, 0x1F3FC, 0x200D, 0x1F9B2,
+    0x1F9D1, 0x1F3FD, 0x200D, 0x1F9B2, 0x1F9D1, 0x1F3FE, 0x200D, 0x1F9B2,
+    0x1F9D1, 0x1F3FF, 0x200D, 0x1F9B2, 0x1F9D1, 0x200D, 0x1F9B3, 0x1F9D1,
+    0x1F3FB, 0x200D, 0x1F9B3, 0x1F9D1, 0x1F3FC, 0x200D, 0x1F9B3, 0x1F9D1,
+    0x1F3FD, 0x200D, 0x1F9B3, 0x1F9D1, 0x1F3FE, 0x200D, 0x1F9B3, 0x1F9D1,
+    0x1F3FF, 0x200D, 0x1F9B3, 0x1F9D1, 0x200D, 0x1F9BC, 0x1F9D1, 0x1F3FB,
+    0x200D, 0x1F9BC, 0x1F9D1, 0x1F3FC, 0x200D, 0x1F9BC, 0x1F9D1, 0x1F3FD,
+    0x200D, 0x1F9BC, 0x1F9D1, 0x1F3FE, 0x200D, 0x1F9BC, 0x1F9D1, 0x1F3FF,
+    0x200D, 0x1F9BC, 0x1F9D1, 0x200D, 0x1F9BD, 0x1F9D1, 0x1F3FB, 0x200D,
+    0x1F9BD, 0x1F9D1, 0x1F3FC, 0x200D, 0x1F9BD, 0x1F9D1, 0x1F3FD, 0x200D,
+    0x1F9BD, 0x1F9D1, 0x1F3FE, 0x200D, 0x1F9BD, 0x1F9D1, 0x1F3FF, 0x200D,
+    0x1F9BD, 0x1F9D1, 0x200D, 0x2695, 0x1F9D1, 0x1F3FB, 0x200D, 0x2695,
+    0x1F9D1, 0x1F3FC, 0x200D, 0x2695, 0x1F9D1, 0x1F3FD, 0x200D, 0x2695,
+    0x1F9D1, 0x1F3FE, 0x200D, 0x2695, 0x1F9D1, 0x1F3FF, 0x200D, 0x2695,
+    0x1F9D1, 0x200D, 0x2696, 0x1F9D1, 0x1F3FB, 0x200D, 0x2696, 0x1F9D1,
+    0x1F3FC, 0x200D, 0x2696, 0x1F9D1, 0x1F3FD, 0x200D, 0x2696, 0x1F9D1,
+    0x1F3FE, 0x200D, 0x2696, 0x1F9D1, 0x1F3FF, 0x200D, 0x2696, 0x1F9D1,
+    0x200D, 0x2708, 0x1F9D1, 0x1F3FB, 0x200D, 0x2708, 0x1F9D1, 0x1F3FC,
+    0x200D, 0x2708, 0x1F9D1, 0x1F3FD, 0x200D, 0x2708, 0x1F9D1, 0x1F3FE,
+    0x200D, 0x2708, 0x1F9D1, 0x1F3FF, 0x200D, 0x2708, 0x1F9D1, 0x1F9D1,
+    0x1F3FB, 0x1F9D1, 0x1F3FC, 0x1F9D1, 0x1F3FD, 0x1F9D1, 0x1F3FE, 0x1F9D1,
+    0x1F3FF, 0x1F9D2, 0x1F9D2, 0x1F3FB, 0x1F9D2, 0x1F3FC, 0x1F9D2, 0x1F3FD,
+    0x1F9D2, 0x1F3FE, 0x1F9D2, 0x1F3FF, 0x1F9D3, 0x1F9D3, 0x1F3FB, 0x1F9D3,
+    0x1F3FC, 0x1F9D3, 0x1F3FD, 0x1F9D3, 0x1F3FE, 0x1F9D3, 0x1F3FF, 0x1F9D4,
+    0x200D, 0x2640, 0x1F9D4, 0x1F3FB, 0x200D, 0x2640, 0x1F9D4, 0x1F3FC,
+    0x200D, 0x2640, 0x1F9D4, 0x1F3FD, 0x200D, 0x2640, 0x1F9D4, 0x1F3FE,
+    0x200D, 0x2640, 0x1F9D4, 0x1F3FF, 0x200D, 0x2640, 0x1F9D4, 0x200D,
+    0x2642, 0x1F9D4, 0x1F3FB, 0x200D, 0x2642, 0x1F9D4, 0x1F3FC, 0x200D,
+    0x2642, 0x1F9D4, 0x1F3FD, 0x200D, 0x2642, 0x1F9D4, 0x1F3FE, 0x200D,
+    0x2642, 0x1F9D4, 0x1F3FF, 0x200D, 0x2642, 0x1F9D4, 0x1F9D4, 0x1F3FB,
+    0x1F9D4, 0x1F3FC, 0x1F9D4, 0x1F3FD, 0x1F9D4, 0x1F3FE, 0x1F9D4, 0x1F3FF,
+    0x1F9D5, 0x1F9D5, 0x1F3FB, 0x1F9D5, 0x1F3FC, 0x1F9D5, 0x1F3FD, 0x1F9D5,
+    0x1F3FE, 0x1F9D5, 0x1F3FF, 0x1F9D6, 0x200D, 0x2640, 0x1F9D6, 0x1F3FB,
+    0x200D, 0x2640, 0x1F9D6, 0x1F3FC, 0x200D, 0x2640, 0x1F9D6, 0x1F3FD,
+    0x200D, 0x2640, 0x1F9D6, 0x1F3FE, 0x200D, 0x2640, 0x1F9D6, 0x1F3FF,
+    0x200D, 0x2640, 0x1F9D6, 0x200D, 0x2642, 0x1F9D6, 0x1F3FB, 0x200D,
+    0x2642, 0x1F9D6, 0x1F3FC, 0x200D, 0x2642, 0x1F9D6, 0x1F3FD, 0x200D,
+    0x2642, 0x1F9D6, 0x1F3FE, 0x200D, 0x2642, 0x1F9D6, 0x1F3FF, 0x200D,
+    0x2642, 0x1F9D6, 0x1F9D6, 0x1F3FB, 0x1F9D6, 0x1F3FC, 0x1F9D6, 0x1F3FD,
+    0x1F9D6, 0x1F3FE, 0x1F9D6, 0x1F3FF, 0x1F9D7, 0x200D, 0x2640, 0x1F9D7,
+    0x1F3FB, 0x200D, 0x2640, 0x1F9D7, 0x1F3FC, 0x200D, 0x2640, 0x1F9D7,
+    0x1F3FD, 0x200D, 0x2640, 0x1F9D7, 0x1F3FE, 0x200D, 0x2640, 0x1F9D7,
+    0x1F3FF, 0x200D, 0x2640, 0x1F9D7, 0x200D, 0x2642, 0x1F9D7, 0x1F3FB,
+    0x200D, 0x2642, 0x1F9D7, 0x1F3FC, 0x200D, 0x2642, 0x1F9D7, 0x1F3FD,
+    0x200D, 0x2642, 0x1F9D7, 0x1F3FE, 0x200D, 0x2642, 0x1F9D7, 0x1F3FF,
+    0x200D, 0x2642, 0x1F9D7, 0x1F9D7, 0x1F3FB, 0x1F9D7, 0x1F3FC, 0x1F9D7,
+    0x1F3FD, 0x1F9D7, 0x1F3FE, 0x1F9D7, 0x1F3FF, 0x1F9D8, 0x200D, 0x2640,
+    0x1F9D8, 0x1F3FB, 0x200D, 0x2640, 0x1F9D8, 0x1F3FC, 0x200D, 0x2640,
+    0x1F9D8, 0x1F3FD, 0x200D, 0x2640, 0x1F9D8, 0x1F3FE, 0x200D, 0x2640,
+    0x1F9D8, 0x1F3FF, 0x200D, 0x2640, 0x1F9D8, 0x200D, 0x2642, 0x1F9D8,
+    0x1F3FB, 0x200D, 0x2642, 0x1F9D8, 0x1F3FC, 0x200D, 0x2642, 0x1F9D8,
+    0x1F3FD, 0x200D, 0x2642, 0x1F9D8, 0x1F3FE, 0x200D, 0x2642, 0x1F9D8,
+    0x1F3FF, 0x200D, 0x2642, 0x1F9D8, 0x1F9D8, 0x1F3FB, 0x1F9D8, 0x1F3FC,
+    0x1F9D8, 0x1F3FD, 0x1F9D8, 0x1F3FE, 0x1F9D8, 0x1F3FF, 0x1F9D9, 0x200D,
+    0x2640, 0x1F9D9, 0x1F3FB, 0x200D, 0x2640, 0x1F9D9, 0x1F3FC, 0x200D,
+    0x2640, 0x1F9D9, 0x1F3FD, 0x200D, 0x2640, 0x1F9D9, 0x1F3FE, 0x200D,
+    0x2640, 0x1F9D9, 0x1F3FF, 0x200D, 0x2640, 0x1F9D9, 0x200D, 0x2642,
+    0x1F9D9, 0x1F3FB, 0x200D, 0x2642, 0x1F9D9, 0x1F3FC, 0x200D, 0x2642,
+    0x1F9D9, 0x1F3FD, 0x200D, 0x2642, 0x1F9D9, 0x1F3FE, 0x200D, 0x2642,
+    0x1F9D9, 0x1F3FF, 0x200D, 0x2642, 0x1F9D9, 0x1F9D9, 0x1F3FB, 0x1F9D9,
+    0x1F3FC, 0x1F9D9, 0x1F3FD, 0x1F9D9, 0x1F3FE, 0x1F9D9, 0x1F3FF, 0x1F9DA,
+    0x200D, 0x2640, 0x1F9DA, 0x1F3FB, 0x200D, 0x2640, 0x1F9DA, 0x1F3FC,
+    0x200D, 0x2640, 0x1F9DA, 0x1F3FD, 0x200D, 0x2640, 0x1F9DA, 0x1F3FE,
+    0x200D, 0x2640, 0x1F9DA, 0x1F3FF, 0x200D, 0x2640, 0x1F9DA, 0x200D,
+    0x2642, 0x1F9DA, 0x1F3FB, 0x200D, 0x2642, 0x1F9DA, 0x1F3FC, 0x200D,
+    0x2642, 0x1F9DA, 0x1F3FD, 0x200D, 0x2642, 0x1F9DA, 0x1F3FE, 0x200D,
+    0x2642, 0x1F9DA, 0x1F3FF, 0x200D, 0x2642, 0x1F9DA, 0x1F9DA, 0x1F3FB,
+    0x1F9DA, 0x1F3FC, 0x1F9DA, 0x1F3FD, 0x1F9DA, 0x1F3FE, 0x1F9DA, 0x1F3FF,
+    0x1F9DB, 0x200D, 0x2640, 0x1F9DB, 0x1F3FB, 0x200D, 0x2640, 0x1F9DB,
+    0x1F3FC, 0x200D, 0x2640, 0x1F9DB, 0x1F3FD, 0x200D, 0x2640, 0x1F9DB,
+    0x1F3FE, 0x200D, 0x2640, 0x1F9DB, 0x1F3FF, 0x200D, 0x2640, 0x1F9DB,
+    0x200D, 0x2642, 0x1F9DB, 0x1F3FB, 0x200D, 0x2642, 0x1F9DB, 0x1F3FC,
+    0x200D, 0x2642, 0x1F9DB, 0x1F3FD, 0x200D, 0x2642, 0x1F9DB, 0x1F3FE,
+    0x200D, 0x2642, 0x1F9DB, 0x1F3FF, 0x200D, 0x2642, 0x1F9DB, 0x1F9DB,
+    0x1F3FB, 0x1F9DB, 0x1F3FC, 0x1F9DB, 0x1F3FD, 0x1F9DB, 0x1F3FE, 0x1F9DB,
+    0x1F3FF, 0x1F9DC, 0x200D, 0x2640, 0x1F9DC, 0x1F3FB, 0x200D, 0x2640,
+    0x1F9DC, 0x1F3FC, 0x200D, 0x2640, 0x1F9DC, 0x1F3FD, 0x200D, 0x2640,
+    0x1F9DC, 0x1F3FE, 0x200D, 0x2640, 0x1F9DC, 0x1F3FF, 0x200D, 0x2640,
+    0x1F9DC, 0x200D, 0x2642, 0x1F9DC, 0x1F3FB, 0x200D, 0x2642, 0x1F9DC,
+    0x1F3FC, 0x200D, 0x2642, 0x1F9DC, 0x1F3FD, 0x200D, 0x2642, 0x1F9DC,
+    0x1F3FE, 0x200D, 0x2642, 0x1F9DC, 0x1F3FF, 0x200D, 0x2642, 0x1F9DC,
+    0x1F9DC, 0x1F3FB, 0x1F9DC, 0x1F3FC, 0x1F9DC, 0x1F3FD, 0x1F9DC, 0x1F3FE,
+    0x1F9DC, 0x1F3FF, 0x1F9DD, 0x200D, 0x2640, 0x1F9DD, 0x1F3FB, 0x200D,
+    0x2640, 0x1F9DD, 0x1F3FC, 0x200D, 0x2640, 0x1F9DD, 0x1F3FD, 0x200D,
+    0x2640, 0x1F9DD, 0x1F3FE, 0x200D, 0x2640, 0x1F9DD, 0x1F3FF, 0x200D,
+    0x2640, 0x1F9DD, 0x200D, 0x2642, 0x1F9DD, 0x1F3FB, 0x200D, 0x2642,
+    0x1F9DD, 0x1F3FC, 0x200D, 0x2642, 0x1F9DD, 0x1F3FD, 0x200D, 0x2642,
+    0x1F9DD, 0x1F3FE, 0x200D, 0x2642, 0x1F9DD, 0x1F3FF, 0x200D, 0x2642,
+    0x1F9DD, 0x1F9DD, 0x1F3FB, 0x1F9DD, 0x1F3FC, 0x1F9DD, 0x1F3FD, 0x1F9DD,
+    0x1F3FE, 0x1F9DD, 0x1F3FF, 0x1F9DE, 0x200D, 0x2640, 0x1F9DE, 0x200D,
+    0x2642, 0x1F9DE, 0x1F9DF, 0x200D, 0x2640, 0x1F9DF, 0x200D, 0x2642,
+    0x1F9DF, 0x1F9E0, 0x1F9E1, 0x1F9E2, 0x1F9E3, 0x1F9E4, 0x1F9E5, 0x1F9E6,
+    0x1F9E7, 0x1F9E8, 0x1F9E9, 0x1F9EA, 0x1F9EB, 0x1F9EC, 0x1F9ED, 0x1F9EE,
+    0x1F9EF, 0x1F9F0, 0x1F9F1, 0x1F9F2, 0x1F9F3, 0x1F9F4, 0x1F9F5, 0x1F9F6,
+    0x1F9F7, 0x1F9F8, 0x1F9F9, 0x1F9FA, 0x1F9FB, 0x1F9FC, 0x1F9FD, 0x1F9FE,
+    0x1F9FF, 0x1FA70, 0x1FA71, 0x1FA72, 0x1FA73, 0x1FA74, 0x1FA78, 0x1FA79,
+    0x1FA7A, 0x1FA80, 0x1FA81, 0x1FA82, 0x1FA83, 0x1FA84, 0x1FA85, 0x1FA86,
+    0x1FA90, 0x1FA91, 0x1FA92, 0x1FA93, 0x1FA94, 0x1FA95, 0x1FA96, 0x1FA97,
+    0x1FA98, 0x1FA99, 0x1FA9A, 0x1FA9B, 0x1FA9C, 0x1FA9D, 0x1FA9E, 0x1FA9F,
+    0x1FAA0, 0x1FAA1, 0x1FAA2, 0x1FAA3, 0x1FAA4, 0x1FAA5, 0x1FAA6, 0x1FAA7,
+    0x1FAA8, 0x1FAB0, 0x1FAB1, 0x1FAB2, 0x1FAB3, 0x1FAB4, 0x1FAB5, 0x1FAB6,
+    0x1FAC0, 0x1FAC1, 0x1FAC2, 0x1FAD0, 0x1FAD1, 0x1FAD2, 0x1FAD3, 0x1FAD4,
+    0x1FAD5, 0x1FAD6, 0x203C, 0x2049, 0x2122, 0x2139, 0x2194, 0x2195,
+    0x2196, 0x2197, 0x2198, 0x2199, 0x21A9, 0x21AA, 0x231A, 0x231B,
+    0x2328, 0x23CF, 0x23E9, 0x23EA, 0x23EB, 0x23EC, 0x23ED, 0x23EE,
+    0x23EF, 0x23F0, 0x23F1, 0x23F2, 0x23F3, 0x23F8, 0x23F9, 0x23FA,
+    0x24C2, 0x25AA, 0x25AB, 0x25B6, 0x25C0, 0x25FB, 0x25FC, 0x25FD,
+    0x25FE, 0x2600, 0x2601, 0x2602, 0x2603, 0x2604, 0x260E, 0x2611,
+    0x2614, 0x2615, 0x2618, 0x261D, 0x261D, 0x1F3FB, 0x261D, 0x1F3FC,
+    0x261D, 0x1F3FD, 0x261D, 0x1F3FE, 0x261D, 0x1F3FF, 0x2620, 0x2622,
+    0x2623, 0x2626, 0x262A, 0x262E, 0x262F, 0x2638, 0x2639, 0x263A,
+    0x2640, 0x2642, 0x2648, 0x2649, 0x264A, 0x264B, 0x264C, 0x264D,
+    0x264E, 0x264F, 0x2650, 0x2651, 0x2652, 0x2653, 0x265F, 0x2660,
+    0x2663, 0x2665, 0x2666, 0x2668, 0x267B, 0x267E, 0x267F, 0x2692,
+    0x2693, 0x2694, 0x2695, 0x2696, 0x2697, 0x2699, 0x269B, 0x269C,
+    0x26A0, 0x26A1, 0x26A7, 0x26AA, 0x26AB, 0x26B0, 0x26B1, 0x26BD,
+    0x26BE, 0x26C4, 0x26C5, 0x26C8, 0x26CE, 0x26CF, 0x26D1, 0x26D3,
+    0x26D4, 0x26E9, 0x26EA, 0x26F0, 0x26F1, 0x26F2, 0x26F3, 0x26F4,
+    0x26F5, 0x26F7, 0x26F8, 0x26F9, 0xFE0F, 0x200D, 0x2640, 0xFE0F,
+    0x26F9, 0x1F3FB, 0x200D, 0x2640, 0x26F9, 0x1F3FC, 0x200D, 0x2640,
+    0x26F9, 0x1F3FD, 0x200D, 0x2640, 0x26F9, 0x1F3FE, 0x200D, 0x2640,
+    0x26F9, 0x1F3FF, 0x200D, 0x2640, 0x26F9, 0xFE0F, 0x200D, 0x2642,
+    0xFE0F, 0x26F9, 0x1F3FB, 0x200D, 0x2642, 0x26F9, 0x1F3FC, 0x200D,
+    0x2642, 0x26F9, 0x1F3FD, 0x200D, 0x2642, 0x26F9, 0x1F3FE, 0x200D,
+    0x2642, 0x26F9, 0x1F3FF, 0x200D, 0x2642, 0x26F9, 0x26F9, 0x1F3FB,
+    0x26F9, 0x1F3FC, 0x26F9, 0x1F3FD, 0x26F9, 0x1F3FE, 0x26F9, 0x1F3FF,
+    0x26FA, 0x26FD, 0x2702, 0x2705, 0x2708, 0x2709, 0x270A, 0x270A,
+    0x1F3FB, 0x270A, 0x1F3FC, 0x270A, 0x1F3FD, 0x270A, 0x1F3FE, 0x270A,
+    0x1F3FF, 0x270B, 0x270B, 0x1F3FB, 0x270B, 0x1F3FC, 0x270B, 0x1F3FD,
+    0x270B, 0x1F3FE, 0x270B, 0x1F3FF, 0x270C, 0x270C, 0x1F3FB, 0x270C,
+    0x1F3FC, 0x270C, 0x1F3FD, 0x270C, 0x1F3FE, 0x270C, 0x1F3FF, 0x270D,
+    0x270D, 0x1F3FB, 0x270D, 0x1F3FC, 0x270D, 0x1F3FD, 0x270D, 0x1F3FE,
+    0x270D, 0x1F3FF, 0x270F, 0x2712, 0x2714, 0x2716, 0x271D, 0x2721,
+    0x2728, 0x2733, 0x2734, 0x2744, 0x2747, 0x274C, 0x274E, 0x2753,
+    0x2754, 0x2755, 0x2757, 0x2763, 0x2764, 0x200D, 0x1F525, 0x2764,
+    0x200D, 0x1FA79, 0x2764, 0x2795, 0x2796, 0x2797, 0x27A1, 0x27B0,
+    0x27BF, 0x2934, 0x2935, 0x2B05, 0x2B06, 0x2B07, 0x2B1B, 0x2B1C,
+    0x2B50, 0x2B55, 0x3030, 0x303D, 0x3297, 0x3299,
+};
+
+const char *const emojiTableShortCodes[] = {
+    "hash",
+    "keycap_star",
+    "zero",
+    "one",
+    "two",
+    "three",
+    "four",
+    "five",
+    "six",
+    "seven",
+    "eight",
+    "nine",
+    "copyright",
+    "registered",
+    "mahjong",
+    "black_joker",
+    "a",
+    "b",
+    "o2",
+    "parking",
+    "ab",
+    "cl",
+    "cool",
+    "free",
+    "id",
+    "new",
+    "ng",
+    "ok",
+    "sos",
+    "up",
+    "vs",
+    "flag-ac",
+    "flag-ad",
+    "flag-ae",
+    "flag-af",
+    "flag-ag",
+    "flag-ai",
+    "flag-al",
+    "flag-am",
+    "flag-ao",
+    "flag-aq",
+    "flag-ar",
+    "flag-as",
+    "flag-at",
+    "flag-au",
+    "flag-aw",
+    "flag-ax",
+    "flag-az",
+    "flag-ba",
+    "flag-bb",
+    "flag-bd",
+    "flag-be",
+    "flag-bf",
+    "flag-bg",
+    "flag-bh",
+    "flag-bi",
+    "flag-bj",
+    "flag-bl",
+    "flag-bm",
+    "flag-bn",
+    "flag-bo",
+    "flag-bq",
+    "flag-br",
+    "flag-bs",
+    "flag-bt",
+    "flag-bv",
+    "flag-bw",
+    "flag-by",
+    "flag-bz",
+    "flag-ca",
+    "flag-cc",
+    "flag-cd",
+    "flag-cf",
+    "flag-cg",
+    "flag-ch",
+    "flag-ci",
+    "flag-ck",
+    "flag-cl",
+    "flag-cm",
+    "cn",
+    "flag-cn",
+    "flag-co",
+    "flag-cp",
+    "flag-cr",
+    "flag-cu",
+    "flag-cv",
+    "flag-cw",
+    "flag-cx",
+    "flag-cy",
+    "flag-cz",
+    "de",
+    "flag-de",
+    "flag-dg",
+    "flag-dj",
+    "flag-dk",
+    "flag-dm",
+    "flag-do",
+    "flag-dz",
+    "flag-ea",
+    "flag-ec",
+    "flag-ee",
+    "flag-eg",
+    "flag-eh",
+    "flag-er",
+    "es",
+    "flag-es",
+    "flag-et",
+    "flag-eu",
+    "flag-fi",
+    "flag-fj",
+    "flag-fk",
+    "flag-fm",
+    "flag-fo",
+    "fr",
+    "flag-fr",
+    "flag-ga",
+    "gb",
+    "uk",
+    "flag-gb",
+    "flag-gd",
+    "flag-ge",
+    "flag-gf",
+    "flag-gg",
+    "flag-gh",
+    "flag-gi",
+    "flag-gl",
+    "flag-gm",
+    "flag-gn",
+    "flag-gp",
+    "flag-gq",
+    "flag-gr",
+    "flag-gs",
+    "flag-gt",
+    "flag-gu",
+    "flag-gw",
+    "flag-gy",
+    "flag-hk",
+    "flag-hm",
+    "flag-hn",
+    "flag-hr",
+    "flag-ht",
+    "flag-hu",
+    "flag-ic",
+    "flag-id",
+    "flag-ie",
+    "flag-il",
+    "flag-im",
+    "flag-in",
+    "flag-io",
+    "flag-iq",
+    "flag-ir",
+    "flag-is",
+    "it",
+    "flag-it",
+    "flag-je",
+    "flag-jm",
+    "flag-jo",
+    "jp",
+    "flag-jp",
+    "flag-ke",
+    "flag-kg",
+    "flag-kh",
+    "flag-ki",
+    "flag-km",
+    "flag-kn",
+    "flag-kp",
+    "kr",
+    "flag-kr",
+    "flag-kw",
+    "flag-ky",
+    "flag-kz",
+    "flag-la",
+    "flag-lb",
+    "flag-lc",
+    "flag-li",
+    "flag-lk",
+    "flag-lr",
+    "flag-ls",
+    "flag-lt",
+    "flag-lu",
+    "flag-lv",
+    "flag-ly",
+    "flag-ma",
+    "flag-mc",
+    "flag-md",
+    "flag-me",
+    "flag-mf",
+    "flag-mg",
+    "flag-mh",
+    "flag-mk",
+    "flag-ml",
+    "flag-mm",
+    "flag-mn",
+    "flag-mo",
+    "flag-mp",
+    "flag-mq",
+    "flag-mr",
+    "flag-ms",
+    "flag-mt",
+    "flag-mu",
+    "flag-mv",
+    "flag-mw",
+    "flag-mx",
+    "flag-my",
+    "flag-mz",
+    "flag-na",
+    "flag-nc",
+    "flag-ne",
+    "flag-nf",
+    "flag-ng",
+    "flag-ni",
+    "flag-nl",
+    "flag-no",
+    "flag-np",
+    "flag-nr",
+    "flag-nu",
+    "flag-nz",
+    "flag-om",
+    "flag-pa",
+    "flag-pe",
+    "flag-pf",
+    "flag-pg",
+    "flag-ph",
+    "flag-pk",
+    "flag-pl",
+    "flag-pm",
+    "flag-pn",
+    "flag-pr",
+    "flag-ps",
+    "flag-pt",
+    "flag-pw",
+    "flag-py",
+    "flag-qa",
+    "flag-re",
+    "flag-ro",
+    "flag-rs",
+    "ru",
+    "flag-ru",
+    "flag-rw",
+    "flag-sa",
+    "flag-sb",
+    "flag-sc",
+    "flag-sd",
+    "flag-se",
+    "flag-sg",
+    "flag-sh",
+    "flag-si",
+    "flag-sj",
+    "flag-sk",
+    "flag-sl",
+    "flag-sm",
+    "flag-sn",
+    "flag-so",
+    "flag-sr",
+    "flag-ss",
+    "flag-st",
+    "flag-sv",
+    "flag-sx",
+    "flag-sy",
+    "flag-sz",
+    "flag-ta",
+    "flag-tc",
+    "flag-td",
+    "flag-tf",
+    "flag-tg",
+    "flag-th",
+    "flag-tj",
+    "flag-tk",
+    "flag-tl",
+    "flag-tm",
+    "flag-tn",
+    "flag-to",
+    "flag-tr",
+    "flag-tt",
+    "flag-tv",
+    "flag-tw",
+    "flag-tz",
+    "flag-ua",
+    "flag-ug",
+    "flag-um",
+    "flag-un",
+    "us",
+    "flag-us",
+    "flag-uy",
+    "flag-uz",
+    "flag-va",
+    "flag-vc",
+    "flag-ve",
+    "flag-vg",
+    "flag-vi",
+    "flag-vn",
+    "flag-vu",
+    "flag-wf",
+    "flag-ws",
+    "flag-xk",
+    "flag-ye",
+    "flag-yt",
+    "flag-za",
+    "flag-zm",
+    "flag-zw",
+    "koko",
+    "sa",
+    "u7121",
+    "u6307",
+    "u7981",
+    "u7a7a",
+    "u5408",
+    "u6e80",
+    "u6709",
+    "u6708",
+    "u7533",
+    "u5272",
+    "u55b6",
+    "ideograph_advantage",
+    "accept",
+    "cyclone",
+    "foggy",
+    "closed_umbrella",
+    "night_with_stars",
+    "sunrise_over_mountains",
+    "sunrise",
+    "city_sunset",
+    "city_sunrise",
+    "rainbow",
+    "bridge_at_night",
+    "ocean",
+    "volcano",
+    "milky_way",
+    "earth_africa",
+    "earth_americas",
+    "earth_asia",
+    "globe_with_meridians",
+    "new_moon",
+    "waxing_crescent_moon",
+    "first_quarter_moon",
+    "moon",
+    "waxing_gibbous_moon",
+    "full_moon",
+    "waning_gibbous_moon",
+    "last_quarter_moon",
+    "waning_crescent_moon",
+    "crescent_moon",
+    "new_moon_with_face",
+    "first_quarter_moon_with_face",
+    "last_quarter_moon_with_face",
+    "full_moon_with_face",
+    "sun_with_face",
+    "star2",
+    "stars",
+    "thermometer",
+    "mostly_sunny",
+    "sun_small_cloud",
+    "barely_sunny",
+    "sun_behind_cloud",
+    "partly_sunny_rain",
+    "sun_behind_rain_cloud",
+    "rain_cloud",
+    "snow_cloud",
+    "lightning",
+    "lightning_cloud",
+    "tornado",
+    "tornado_cloud",
+    "fog",
+    "wind_blowing_face",
+    "hotdog",
+    "taco",
+    "burrito",
+    "chestnut",
+    "seedling",
+    "evergreen_tree",
+    "deciduous_tree",
+    "palm_tree",
+    "cactus",
+    "hot_pepper",
+    "tulip",
+    "cherry_blossom",
+    "rose",
+    "hibiscus",
+    "sunflower",
+    "blossom",
+    "corn",
+    "ear_of_rice",
+    "herb",
+    "four_leaf_clover",
+    "maple_leaf",
+    "fallen_leaf",
+    "leaves",
+    "mushroom",
+    "tomato",
+    "eggplant",
+    "grapes",
+    "melon",
+    "watermelon",
+    "tangerine",
+    "lemon",
+    "banana",
+    "pineapple",
+    "apple",
+    "green_apple",
+    "pear",
+    "peach",
+    "cherries",
+    "strawberry",
+    "hamburger",
+    "pizza",
+    "meat_on_bone",
+    "poultry_leg",
+    "rice_cracker",
+    "rice_ball",
+    "rice",
+    "curry",
+    "ramen",
+    "spaghetti",
+    "bread",
+    "fries",
+    "sweet_potato",
+    "dango",
+    "oden",
+    "sushi",
+    "fried_shrimp",
+    "fish_cake",
+    "icecream",
+    "shaved_ice",
+    "ice_cream",
+    "doughnut",
+    "cookie",
+    "chocolate_bar",
+    "candy",
+    "lollipop",
+    "custard",
+    "honey_pot",
+    "cake",
+    "bento",
+    "stew",
+    "fried_egg",
+    "cooking",
+    "fork_and_knife",
+    "tea",
+    "sake",
+    "wine_glass",
+    "cocktail",
+    "tropical_drink",
+    "beer",
+    "beers",
+    "baby_bottle",
+    "knife_fork_plate",
+    "champagne",
+    "popcorn",
+    "ribbon",
+    "gift",
+    "birthday",
+    "jack_o_lantern",
+    "christmas_tree",
+    "santa",
+    "santa_tone1",
+    "santa_tone2",
+    "santa_tone3",
+    "santa_tone4",
+    "santa_tone5",
+    "fireworks",
+    "sparkler",
+    "balloon",
+    "tada",
+    "confetti_ball",
+    "tanabata_tree",
+    "crossed_flags",
+    "bamboo",
+    "dolls",
+    "flags",
+    "wind_chime",
+    "rice_scene",
+    "school_satchel",
+    "mortar_board",
+    "medal",
+    "reminder_ribbon",
+    "studio_microphone",
+    "level_slider",
+    "control_knobs",
+    "film_frames",
+    "admission_tickets",
+    "carousel_horse",
+    "ferris_wheel",
+    "roller_coaster",
+    "fishing_pole_and_fish",
+    "microphone",
+    "movie_camera",
+    "cinema",
+    "headphones",
+    "art",
+    "tophat",
+    "circus_tent",
+    "ticket",
+    "clapper",
+    "performing_arts",
+    "video_game",
+    "dart",
+    "slot_machine",
+    "8ball",
+    "game_die",
+    "bowling",
+    "flower_playing_cards",
+    "musical_note",
+    "notes",
+    "saxophone",
+    "guitar",
+    "musical_keyboard",
+    "trumpet",
+    "violin",
+    "musical_score",
+    "running_shirt_with_sash",
+    "tennis",
+    "ski",
+    "basketball",
+    "checkered_flag",
+    "snowboarder",
+    "snowboarder_tone1",
+    "snowboarder_tone2",
+    "snowboarder_tone3",
+    "snowboarder_tone4",
+    "snowboarder_tone5",
+    "woman-running",
+    "woman-running_tone1",
+    "woman-running_tone2",
+    "woman-running_tone3",
+    "woman-running_tone4",
+    "woman-running_tone5",
+    "man-running",
+    "man-running_tone1",
+    "man-running_tone2",
+    "man-running_tone3",
+    "man-running_tone4",
+    "man-running_tone5",
+    "runner",
+    "running",
+    "runner_tone1",
+    "runner_tone2",
+    "runner_tone3",
+    "runner_tone4",
+    "runner_tone5",
+    "woman-surfing",
+    "woman-surfing_tone1",
+    "woman-surfing_tone2",
+    "woman-surfing_tone3",
+    "woman-surfing_tone4",
+    "woman-surfing_tone5",
+    "man-surfing",
+    "man-surfing_tone1",
+    "man-surfing_tone2",
+    "man-surfing_tone3",
+    "man-surfing_tone4",
+    "man-surfing_tone5",
+    "surfer",
+    "surfer_tone1",
+    "surfer_tone2",
+    "surfer_tone3",
+    "surfer_tone4",
+    "surfer_tone5",
+    "sports_medal",
+    "trophy",
+    "horse_racing",
+    "horse_racing_tone1",
+    "horse_racing_tone2",
+    "horse_racing_tone3",
+    "horse_racing_tone4",
+    "horse_racing_tone5",
+    "football",
+    "rugby_football",
+    "woman-swimming",
+    "woman-swimming_tone1",
+    "woman-swimming_tone2",
+    "woman-swimming_tone3",
+    "woman-swimming_tone4",
+    "woman-swimming_tone5",
+    "man-swimming",
+    "man-swimming_tone1",
+    "man-swimming_tone2",
+    "man-swimming_tone3",
+    "man-swimming_tone4",
+    "man-swimming_tone5",
+    "swimmer",
+    "swimmer_tone1",
+    "swimmer_tone2",
+    "swimmer_tone3",
+    "swimmer_tone4",
+    "swimmer_tone5",
+    "woman-lifting-weights",
+    "woman-lifting-weights_tone1",
+    "woman-lifting-weights_tone2",
+    "woman-lifting-weights_tone3",
+    "woman-lifting-weights_tone4",
+    "woman-lifting-weights_tone5",
+    "man-lifting-weights",
+    "man-lifting-weights_tone1",
+    "man-lifting-weights_tone2",
+    "man-lifting-weights_tone3",
+    "man-lifting-weights_tone4",
+    "man-lifting-weights_tone5",
+    "weight_lifter",
+    "weight_lifter_tone1",
+    "weight_lifter_tone2",
+    "weight_lifter_tone3",
+    "weight_lifter_tone4",
+    "weight_lifter_tone5",
+    "woman-golfing",
+    "woman-golfing_tone1",
+    "woman-golfing_tone2",
+    "woman-golfing_tone3",
+    "woman-golfing_tone4",
+    "woman-golfing_tone5",
+    "man-golfing",
+    "man-golfing_tone1",
+    "man-golfing_tone2",
+    "man-golfing_tone3",
+    "man-golfing_tone4",
+    "man-golfing_tone5",
+    "golfer",
+    "golfer_tone1",
+    "golfer_tone2",
+    "golfer_tone3",
+    "golfer_tone4",
+    "golfer_tone5",
+    "racing_motorcycle",
+    "racing_car",
+    "cricket_bat_and_ball",
+    "volleyball",
+    "field_hockey_stick_and_ball",
+    "ice_hockey_stick_and_puck",
+    "table_tennis_paddle_and_ball",
+    "snow_capped_mountain",
+    "camping",
+    "beach_with_umbrella",
+    "building_construction",
+    "house_buildings",
+    "cityscape",
+    "derelict_house_building",
+    "classical_building",
+    "desert",
+    "desert_island",
+    "national_park",
+    "stadium",
+    "house",
+    "house_with_garden",
+    "office",
+    "post_office",
+    "european_post_office",
+    "hospital",
+    "bank",
+    "atm",
+    "hotel",
+    "love_hotel",
+    "convenience_store",
+    "school",
+    "department_store",
+    "factory",
+    "izakaya_lantern",
+    "lantern",
+    "japanese_castle",
+    "european_castle",
+    "rainbow-flag",
+    "transgender_flag",
+    "waving_white_flag",
+    "pirate_flag",
+    "flag-england",
+    "flag-scotland",
+    "flag-wales",
+    "waving_black_flag",
+    "rosette",
+    "label",
+    "badminton_racquet_and_shuttlecock",
+    "bow_and_arrow",
+    "amphora",
+    "skin-tone-2",
+    "skin-tone-3",
+    "skin-tone-4",
+    "skin-tone-5",
+    "skin-tone-6",
+    "rat",
+    "mouse2",
+    "ox",
+    "water_buffalo",
+    "cow2",
+    "tiger2",
+    "leopard",
+    "rabbit2",
+    "black_cat",
+    "cat2",
+    "dragon",
+    "crocodile",
+    "whale2",
+    "snail",
+    "snake",
+    "racehorse",
+    "ram",
+    "goat",
+    "sheep",
+    "monkey",
+    "rooster",
+    "chicken",
+    "service_dog",
+    "dog2",
+    "pig2",
+    "boar",
+    "elephant",
+    "octopus",
+    "shell",
+    "bug",
+    "ant",
+    "bee",
+    "honeybee",
+    "ladybug",
+    "lady_beetle",
+    "fish",
+    "tropical_fish",
+    "blowfish",
+    "turtle",
+    "hatching_chick",
+    "baby_chick",
+    "hatched_chick",
+    "bird",
+    "penguin",
+    "koala",
+    "poodle",
+    "dromedary_camel",
+    "camel",
+    "dolphin",
+    "flipper",
+    "mouse",
+    "cow",
+    "tiger",
+    "rabbit",
+    "cat",
+    "dragon_face",
+    "whale",
+    "horse",
+    "monkey_face",
+    "dog",
+    "pig",
+    "frog",
+    "hamster",
+    "wolf",
+    "polar_bear",
+    "bear",
+    "panda_face",
+    "pig_nose",
+    "feet",
+    "paw_prints",
+    "chipmunk",
+    "eyes",
+    "eye-in-speech-bubble",
+    "eye",
+    "ear",
+    "ear_tone1",
+    "ear_tone2",
+    "ear_tone3",
+    "ear_tone4",
+    "ear_tone5",
+    "nose",
+    "nose_tone1",
+    "nose_tone2",
+    "nose_tone3",
+    "nose_tone4",
+    "nose_tone5",
+    "lips",
+    "tongue",
+    "point_up_2",
+    "point_up_2_tone1",
+    "point_up_2_tone2",
+    "point_up_2_tone3",
+    "point_up_2_tone4",
+    "point_up_2_tone5",
+    "point_down",
+    "point_down_tone1",
+    "point_down_tone2",
+    "point_down_tone3",
+    "point_down_tone4",
+    "point_down_tone5",
+    "point_left",
+    "point_left_tone1",
+    "point_left_tone2",
+    "point_left_tone3",
+    "point_left_tone4",
+    "point_left_tone5",
+    "point_right",
+    "point_right_tone1",
+    "point_right_tone2",
+    "point_right_tone3",
+    "point_right_tone4",
+    "point_right_tone5",
+    "facepunch",
+    "punch",
+    "facepunch_tone1",
+    "facepunch_tone2",
+    "facepunch_tone3",
+    "facepunch_tone4",
+    "facepunch_tone5",
+    "wave",
+    "wave_tone1",
+    "wave_tone2",
+    "wave_tone3",
+    "wave_tone4",
+    "wave_tone5",
+    "ok_hand",
+    "ok_hand_tone1",
+    "ok_hand_tone2",
+    "ok_hand_tone3",
+    "ok_hand_tone4",
+    "ok_hand_tone5",
+    "+1",
+    "thumbsup",
+    "+1_tone1",
+    "+1_tone2",
+    "+1_tone3",
+    "+1_tone4",
+    "+1_tone5",
+    "-1",
+    "thumbsdown",
+    "-1_tone1",
+    "-1_tone2",
+    "-1_tone3",
+    "-1_tone4",
+    "-1_tone5",
+    "clap",
+    "clap_tone1",
+    "clap_tone2",
+    "clap_tone3",
+    "clap_tone4",
+    "clap_tone5",
+    "open_hands",
+    "open_hands_tone1",
+    "open_hands_tone2",
+    "open_hands_tone3",
+    "open_hands_tone4",
+    "open_hands_tone5",
+    "crown",
+    "womans_hat",
+    "eyeglasses",
+    "necktie",
+    "shirt",
+    "tshirt",
+    "jeans",
+    "dress",
+    "kimono",
+    "bikini",
+    "womans_clothes",
+    "purse",
+    "handbag",
+    "pouch",
+    "mans_shoe",
+    "shoe",
+    "athletic_shoe",
+    "high_heel",
+    "sandal",
+    "boot",
+    "footprints",
+    "bust_in_silhouette",
+    "busts_in_silhouette",
+    "boy",
+    "boy_tone1",
+    "boy_tone2",
+    "boy_tone3",
+    "boy_tone4",
+    "boy_tone5",
+    "girl",
+    "girl_tone1",
+    "girl_tone2",
+    "girl_tone3",
+    "girl_tone4",
+    "girl_tone5",
+    "male-farmer",
+    "male-farmer_tone1",
+    "male-farmer_tone2",
+    "male-farmer_tone3",
+    "male-farmer_tone4",
+    "male-farmer_tone5",
+    "male-cook",
+    "male-cook_tone1",
+    "male-cook_tone2",
+    "male-cook_tone3",
+    "male-cook_tone4",
+    "male-cook_tone5",
+    "man_feeding_baby",
+    "man_feeding_baby_tone1",
+    "man_feeding_baby_tone2",
+    "man_feeding_baby_tone3",
+    "man_feeding_baby_tone4",
+    "man_feeding_baby_tone5",
+    "male-student",
+    "male-student_tone1",
+    "male-student_tone2",
+    "male-student_tone3",
+    "male-student_tone4",
+    "male-student_tone5",
+    "male-singer",
+    "male-singer_tone1",
+    "male-singer_tone2",
+    "male-singer_tone3",
+    "male-singer_tone4",
+    "male-singer_tone5",
+    "male-artist",
+    "male-artist_tone1",
+    "male-artist_tone2",
+    "male-artist_tone3",
+    "male-artist_tone4",
+    "male-artist_tone5",
+    "male-teacher",
+    "male-teacher_tone1",
+    "male-teacher_tone2",
+    "male-teacher_tone3",
+    "male-teacher_tone4",
+    "male-teacher_tone5",
+    "male-factory-worker",
+    "male-factory-worker_tone1",
+    "male-factory-worker_tone2",
+    "male-factory-worker_tone3",
+    "male-factory-worker_tone4",
+    "male-factory-worker_tone5",
+    "man-boy-boy",
+    "man-boy",
+    "man-girl-boy",
+    "man-girl-girl",
+    "man-girl",
+    "man-man-boy",
+    "man-man-boy-boy",
+    "man-man-girl",
+    "man-man-girl-boy",
+    "man-man-girl-girl",
+    "man-woman-boy",
+    "man-woman-boy-boy",
+    "man-woman-girl",
+    "man-woman-girl-boy",
+    "man-woman-girl-girl",
+    "male-technologist",
+    "male-technologist_tone1",
+    "male-technologist_tone2",
+    "male-technologist_tone3",
+    "male-technologist_tone4",
+    "male-technologist_tone5",
+    "male-office-worker",
+    "male-office-worker_tone1",
+    "male-office-worker_tone2",
+    "male-office-worker_tone3",
+    "male-office-worker_tone4",
+    "male-office-worker_tone5",
+    "male-mechanic",
+    "male-mechanic_tone1",
+    "male-mechanic_tone2",
+    "male-mechanic_tone3",
+    "male-mechanic_tone4",
+    "male-mechanic_tone5",
+    "male-scientist",
+    "male-scientist_tone1",
+    "male-scientist_tone2",
+    "male-scientist_tone3",
+    "male-scientist_tone4",
+    "male-scientist_tone5",
+    "male-astronaut",
+    "male-astronaut_tone1",
+    "male-astronaut_tone2",
+    "male-astronaut_tone3",
+    "male-astronaut_tone4",
+    "male-astronaut_tone5",
+    "male-firefighter",
+    "male-firefighter_tone1",
+    "male-firefighter_tone2",
+    "male-firefighter_tone3",
+    "male-firefighter_tone4",
+    "male-firefighter_tone5",
+    "man_with_probing_cane",
+    "man_with_probing_cane_tone1",
+    "man_with_probing_cane_tone2",
+    "man_with_probing_cane_tone3",
+    "man_with_probing_cane_tone4",
+    "man_with_probing_cane_tone5",
+    "red_haired_man",
+    "red_haired_man_tone1",
+    "red_haired_man_tone2",
+    "red_haired_man_tone3",
+    "red_haired_man_tone4",
+    "red_haired_man_tone5",
+    "curly_haired_man",
+    "curly_haired_man_tone1",
+    "curly_haired_man_tone2",
+    "curly_haired_man_tone3",
+    "curly_haired_man_tone4",
+    "curly_haired_man_tone5",
+    "bald_man",
+    "bald_man_tone1",
+    "bald_man_tone2",
+    "bald_man_tone3",
+    "bald_man_tone4",
+    "bald_man_tone5",
+    "white_haired_man",
+    "white_haired_man_tone1",
+    "white_haired_man_tone2",
+    "white_haired_man_tone3",
+    "white_haired_man_tone4",
+    "white_haired_man_tone5",
+    "man_in_motorized_wheelchair",
+    "man_in_motorized_wheelchair_tone1",
+    "man_in_motorized_wheelchair_tone2",
+    "man_in_motorized_wheelchair_tone3",
+    "man_in_motorized_wheelchair_tone4",
+    "man_in_motorized_wheelchair_tone5",
+    "man_in_manual_wheelchair",
+    "man_in_manual_wheelchair_tone1",
+    "man_in_manual_wheelchair_tone2",
+    "man_in_manual_wheelchair_tone3",
+    "man_in_manual_wheelchair_tone4",
+    "man_in_manual_wheelchair_tone5",
+    "male-doctor",
+    "male-doctor_tone1",
+    "male-doctor_tone2",
+    "male-doctor_tone3",
+    "male-doctor_tone4",
+    "male-doctor_tone5",
+    "male-judge",
+    "male-judge_tone1",
+    "male-judge_tone2",
+    "male-judge_tone3",
+    "male-judge_tone4",
+    "male-judge_tone5",
+    "male-pilot",
+    "male-pilot_tone1",
+    "male-pilot_tone2",
+    "male-pilot_tone3",
+    "male-pilot_tone4",
+    "male-pilot_tone5",
+    "man-heart-man",
+    "man-heart-man_tone1-tone1",
+    "man-heart-man_tone1-tone2",
+    "man-heart-man_tone1-tone3",
+    "man-heart-man_tone1-tone4",
+    "man-heart-man_tone1-tone5",
+    "man-heart-man_tone2-tone1",
+    "man-heart-man_tone2-tone2",
+    "man-heart-man_tone2-tone3",
+    "man-heart-man_tone2-tone4",
+    "man-heart-man_tone2-tone5",
+    "man-heart-man_tone3-tone1",
+    "man-heart-man_tone3-tone2",
+    "man-heart-man_tone3-tone3",
+    "man-heart-man_tone3-tone4",
+    "man-heart-man_tone3-tone5",
+    "man-heart-man_tone4-tone1",
+    "man-heart-man_tone4-tone2",
+    "man-heart-man_tone4-tone3",
+    "man-heart-man_tone4-tone4",
+    "man-heart-man_tone4-tone5",
+    "man-heart-man_tone5-tone1",
+    "man-heart-man_tone5-tone2",
+    "man-heart-man_tone5-tone3",
+    "man-heart-man_tone5-tone4",
+    "man-heart-man_tone5-tone5",
+    "man-kiss-man",
+    "man-kiss-man_tone1-tone1",
+    "man-kiss-man_tone1-tone2",
+    "man-kiss-man_tone1-tone3",
+    "man-kiss-man_tone1-tone4",
+    "man-kiss-man_tone1-tone5",
+    "man-kiss-man_tone2-tone1",
+    "man-kiss-man_tone2-tone2",
+    "man-kiss-man_tone2-tone3",
+    "man-kiss-man_tone2-tone4",
+    "man-kiss-man_tone2-tone5",
+    "man-kiss-man_tone3-tone1",
+    "man-kiss-man_tone3-tone2",
+    "man-kiss-man_tone3-tone3",
+    "man-kiss-man_tone3-tone4",
+    "man-kiss-man_tone3-tone5",
+    "man-kiss-man_tone4-tone1",
+    "man-kiss-man_tone4-tone2",
+    "man-kiss-man_tone4-tone3",
+    "man-kiss-man_tone4-tone4",
+    "man-kiss-man_tone4-tone5",
+    "man-kiss-man_tone5-tone1",
+    "man-kiss-man_tone5-tone2",
+    "man-kiss-man_tone5-tone3",
+    "man-kiss-man_tone5-tone4",
+    "man-kiss-man_tone5-tone5",
+    "man",
+    "man_tone1",
+    "man_tone2",
+    "man_tone3",
+    "man_tone4",
+    "man_tone5",
+    "female-farmer",
+    "female-farmer_tone1",
+    "female-farmer_tone2",
+    "female-farmer_tone3",
+    "female-farmer_tone4",
+    "female-farmer_tone5",
+    "female-cook",
+    "female-cook_tone1",
+    "female-cook_tone2",
+    "female-cook_tone3",
+    "female-cook_tone4",
+    "female-cook_tone5",
+    "woman_feeding_baby",
+    "woman_feeding_baby_tone1",
+    "woman_feeding_baby_tone2",
+    "woman_feeding_baby_tone3",
+    "woman_feeding_baby_tone4",
+    "woman_feeding_baby_tone5",
+    "female-student",
+    "female-student_tone1",
+    "female-student_tone2",
+    "female-student_tone3",
+    "female-student_tone4",
+    "female-student_tone5",
+    "female-singer",
+    "female-singer_tone1",
+    "female-singer_tone2",
+    "female-singer_tone3",
+    "female-singer_tone4",
+    "female-singer_tone5",
+    "female-artist",
+    "female-artist_tone1",
+    "female-artist_tone2",
+    "female-artist_tone3",
+    "female-artist_tone4",
+    "female-artist_tone5",
+    "female-teacher",
+    "female-teacher_tone1",
+    "female-teacher_tone2",
+    "female-teacher_tone3",
+    "female-teacher_tone4",
+    "female-teacher_tone5",
+    "female-factory-worker",
+    "female-factory-worker_tone1",
+    "female-factory-worker_tone2",
+    "female-factory-worker_tone3",
+    "female-factory-worker_tone4",
+    "female-factory-worker_tone5",
+    "woman-boy-boy",
+    "woman-boy",
+    "woman-girl-boy",
+    "woman-girl-girl",
+    "woman-girl",
+    "woman-woman-boy",
+    "woman-woman-boy-boy",
+    "woman-woman-girl",
+    "woman-woman-girl-boy",
+    "woman-woman-girl-girl",
+    "female-technologist",
+    "female-technologist_tone1",
+    "female-technologist_tone2",
+    "female-technologist_tone3",
+    "female-technologist_tone4",
+    "female-technologist_tone5",
+    "female-office-worker",
+    "female-office-worker_tone1",
+    "female-office-worker_tone2",
+    "female-office-worker_tone3",
+    "female-office-worker_tone4",
+    "female-office-worker_tone5",
+    "female-mechanic",
+    "female-mechanic_tone1",
+    "female-mechanic_tone2",
+    "female-mechanic_tone3",
+    "female-mechanic_tone4",
+    "female-mechanic_tone5",
+    "female-scientist",
+    "female-scientist_tone1",
+    "female-scientist_tone2",
+    "female-scientist_tone3",
+    "female-scientist_tone4",
+    "female-scientist_tone5",
+    "female-astronaut",
+    "female-astronaut_tone1",
+    "female-astronaut_tone2",
+    "female-astronaut_tone3",
+    "female-astronaut_tone4",
+    "female-astronaut_tone5",
+    "female-firefighter",
+    "female-firefighter_tone1",
+    "female-firefighter_tone2",
+    "female-firefighter_tone3",
+    "female-firefighter_tone4",
+    "female-firefighter_tone5",
+    "woman_with_probing_cane",
+    "woman_with_probing_cane_tone1",
+    "woman_with_probing_cane_tone2",
+    "woman_with_probing_cane_tone3",
+    "woman_with_probing_cane_tone4",
+    "woman_with_probing_cane_tone5",
+    "red_haired_woman",
+    "red_haired_woman_tone1",
+    "red_haired_woman_tone2",
+    "red_haired_woman_tone3",
+    "red_haired_woman_tone4",
+    "red_haired_woman_tone5",
+    "curly_haired_woman",
+    "curly_haired_woman_tone1",
+    "curly_haired_woman_tone2",
+    "curly_haired_woman_tone3",
+    "curly_haired_woman_tone4",
+    "curly_haired_woman_tone5",
+    "bald_woman",
+    "bald_woman_tone1",
+    "bald_woman_tone2",
+    "bald_woman_tone3",
+    "bald_woman_tone4",
+    "bald_woman_tone5",
+    "white_haired_woman",
+    "white_haired_woman_tone1",
+    "white_haired_woman_tone2",
+    "white_haired_woman_tone3",
+    "white_haired_woman_tone4",
+    "white_haired_woman_tone5",
+    "woman_in_motorized_wheelchair",
+    "woman_in_motorized_wheelchair_tone1",
+    "woman_in_motorized_wheelchair_tone2",
+    "woman_in_motorized_wheelchair_tone3",
+    "woman_in_motorized_wheelchair_tone4",
+    "woman_in_motorized_wheelchair_tone5",
+    "woman_in_manual_wheelchair",
+    "woman_in_manual_wheelchair_tone1",
+    "woman_in_manual_wheelchair_tone2",
+    "woman_in_manual_wheelchair_tone3",
+    "woman_in_manual_wheelchair_tone4",
+    "woman_in_manual_wheelchair_tone5",
+    "female-doctor",
+    "female-doctor_tone1",
+    "female-doctor_tone2",
+    "female-doctor_tone3",
+    "female-doctor_tone4",
+    "female-doctor_tone5",
+    "female-judge",
+    "female-judge_tone1",
+    "female-judge_tone2",
+    "female-judge_tone3",
+    "female-judge_tone4",
+    "female-judge_tone5",
+    "female-pilot",
+    "female-pilot_tone1",
+    "female-pilot_tone2",
+    "female-pilot_tone3",
+    "female-pilot_tone4",
+    "female-pilot_tone5",
+    "woman-heart-man",
+    "woman-heart-man_tone1-tone1",
+    "woman-heart-man_tone1-tone2",
+    "woman-heart-man_tone1-tone3",
+    "woman-heart-man_tone1-tone4",
+    "woman-heart-man_tone1-tone5",
+    "woman-heart-man_tone2-tone1",
+    "woman-heart-man_tone2-tone2",
+    "woman-heart-man_tone2-tone3",
+    "woman-heart-man_tone2-tone4",
+    "woman-heart-man_tone2-tone5",
+    "woman-heart-man_tone3-tone1",
+    "woman-heart-man_tone3-tone2",
+    "woman-heart-man_tone3-tone3",
+    "woman-heart-man_tone3-tone4",
+    "woman-heart-man_tone3-tone5",
+    "woman-heart-man_tone4-tone1",
+    "woman-heart-man_tone4-tone2",
+    "woman-heart-man_tone4-tone3",
+    "woman-heart-man_tone4-tone4",
+    "woman-heart-man_tone4-tone5",
+    "woman-heart-man_tone5-tone1",
+    "woman-heart-man_tone5-tone2",
+    "woman-heart-man_tone5-tone3",
+    "woman-heart-man_tone5-tone4",
+    "woman-heart-man_tone5-tone5",
+    "woman-heart-woman",
+    "woman-heart-woman_tone1-tone1",
+    "woman-heart-woman_tone1-tone2",
+    "woman-heart-woman_tone1-tone3",
+    "woman-heart-woman_tone1-tone4",
+    "woman-heart-woman_tone1-tone5",
+    "woman-heart-woman_tone2-tone1",
+    "woman-heart-woman_tone2-tone2",
+    "woman-heart-woman_tone2-tone3",
+    "woman-heart-woman_tone2-tone4",
+    "woman-heart-woman_tone2-tone5",
+    "woman-heart-woman_tone3-tone1",
+    "woman-heart-woman_tone3-tone2",
+    "woman-heart-woman_tone3-tone3",
+    "woman-heart-woman_tone3-tone4",
+    "woman-heart-woman_tone3-tone5",
+    "woman-heart-woman_tone4-tone1",
+    "woman-heart-woman_tone4-tone2",
+    "woman-heart-woman_tone4-tone3",
+    "woman-heart-woman_tone4-tone4",
+    "woman-heart-woman_tone4-tone5",
+    "woman-heart-woman_tone5-tone1",
+    "woman-heart-woman_tone5-tone2",
+    "woman-heart-woman_tone5-tone3",
+    "woman-heart-woman_tone5-tone4",
+    "woman-heart-woman_tone5-tone5",
+    "woman-kiss-man",
+    "woman-kiss-man_tone1-tone1",
+    "woman-kiss-man_tone1-tone2",
+    "woman-kiss-man_tone1-tone3",
+    "woman-kiss-man_tone1-tone4",
+    "woman-kiss-man_tone1-tone5",
+    "woman-kiss-man_tone2-tone1",
+    "woman-kiss-man_tone2-tone2",
+    "woman-kiss-man_tone2-tone3",
+    "woman-kiss-man_tone2-tone4",
+    "woman-kiss-man_tone2-tone5",
+    "woman-kiss-man_tone3-tone1",
+    "woman-kiss-man_tone3-tone2",
+    "woman-kiss-man_tone3-tone3",
+    "woman-kiss-man_tone3-tone4",
+    "woman-kiss-man_tone3-tone5",
+    "woman-kiss-man_tone4-tone1",
+    "woman-kiss-man_tone4-tone2",
+    "woman-kiss-man_tone4-tone3",
+    "woman-kiss-man_tone4-tone4",
+    "woman-kiss-man_tone4-tone5",
+    "woman-kiss-man_tone5-tone1",
+    "woman-kiss-man_tone5-tone2",
+    "woman-kiss-man_tone5-tone3",
+    "woman-kiss-man_tone5-tone4",
+    "woman-kiss-man_tone5-tone5",
+    "woman-kiss-woman",
+    "woman-kiss-woman_tone1-tone1",
+    "woman-kiss-woman_tone1-tone2",
+    "woman-kiss-woman_tone1-tone3",
+    "woman-kiss-woman_tone1-tone4",
+    "woman-kiss-woman_tone1-tone5",
+    "woman-kiss-woman_tone2-tone1",
+    "woman-kiss-woman_tone2-tone2",
+    "woman-kiss-woman_tone2-tone3",
+    "woman-kiss-woman_tone2-tone4",
+    "woman-kiss-woman_tone2-tone5",
+    "woman-kiss-woman_tone3-tone1",
+    "woman-kiss-woman_tone3-tone2",
+    "woman-kiss-woman_tone3-tone3",
+    "woman-kiss-woman_tone3-tone4",
+    "woman-kiss-woman_tone3-tone5",
+    "woman-kiss-woman_tone4-tone1",
+    "woman-kiss-woman_tone4-tone2",
+    "woman-kiss-woman_tone4-tone3",
+    "woman-kiss-woman_tone4-tone4",
+    "woman-kiss-woman_tone4-tone5",
+    "woman-kiss-woman_tone5-tone1",
+    "woman-kiss-woman_tone5-tone2",
+    "woman-kiss-woman_tone5-tone3",
+    "woman-kiss-woman_tone5-tone4",
+    "woman-kiss-woman_tone5-tone5",
+    "woman",
+    "woman_tone1",
+    "woman_tone2",
+    "woman_tone3",
+    "woman_tone4",
+    "woman_tone5",
+    "family",
+    "man_and_woman_holding_hands",
+    "woman_and_man_holding_hands",
+    "couple",
+    "man_and_woman_holding_hands_tone1",
+    "man_and_woman_holding_hands_tone2",
+    "man_and_woman_holding_hands_tone3",
+    "man_and_woman_holding_hands_tone4",
+    "man_and_woman_holding_hands_tone5",
+    "man_and_woman_holding_hands_tone1-tone2",
+    "man_and_woman_holding_hands_tone1-tone3",
+    "man_and_woman_holding_hands_tone1-tone4",
+    "man_and_woman_holding_hands_tone1-tone5",
+    "man_and_woman_holding_hands_tone2-tone1",
+    "man_and_woman_holding_hands_tone2-tone3",
+    "man_and_woman_holding_hands_tone2-tone4",
+    "man_and_woman_holding_hands_tone2-tone5",
+    "man_and_woman_holding_hands_tone3-tone1",
+    "man_and_woman_holding_hands_tone3-tone2",
+    "man_and_woman_holding_hands_tone3-tone4",
+    "man_and_woman_holding_hands_tone3-tone5",
+    "man_and_woman_holding_hands_tone4-tone1",
+    "man_and_woman_holding_hands_tone4-tone2",
+    "man_and_woman_holding_hands_tone4-tone3",
+    "man_and_woman_holding_hands_tone4-tone5",
+    "man_and_woman_holding_hands_tone5-tone1",
+    "man_and_woman_holding_hands_tone5-tone2",
+    "man_and_woman_holding_hands_tone5-tone3",
+    "man_and_woman_holding_hands_tone5-tone4",
+    "two_men_holding_hands",
+    "men_holding_hands",
+    "two_men_holding_hands_tone1",
+    "two_men_holding_hands_tone2",
+    "two_men_holding_hands_tone3",
+    "two_men_holding_hands_tone4",
+    "two_men_holding_hands_tone5",
+    "two_men_holding_hands_tone1-tone2",
+    "two_men_holding_hands_tone1-tone3",
+    "two_men_holding_hands_tone1-tone4",
+    "two_men_holding_hands_tone1-tone5",
+    "two_men_holding_hands_tone2-tone1",
+    "two_men_holding_hands_tone2-tone3",
+    "two_men_holding_hands_tone2-tone4",
+    "two_men_holding_hands_tone2-tone5",
+    "two_men_holding_hands_tone3-tone1",
+    "two_men_holding_hands_tone3-tone2",
+    "two_men_holding_hands_tone3-tone4",
+    "two_men_holding_hands_tone3-tone5",
+    "two_men_holding_hands_tone4-tone1",
+    "two_men_holding_hands_tone4-tone2",
+    "two_men_holding_hands_tone4-tone3",
+    "two_men_holding_hands_tone4-tone5",
+    "two_men_holding_hands_tone5-tone1",
+    "two_men_holding_hands_tone5-tone2",
+    "two_men_holding_hands_tone5-tone3",
+    "two_men_holding_hands_tone5-tone4",
+    "two_women_holding_hands",
+    "women_holding_hands",
+    "two_women_holding_hands_tone1",
+    "two_women_holding_hands_tone2",
+    "two_women_holding_hands_tone3",
+    "two_women_holding_hands_tone4",
+    "two_women_holding_hands_tone5",
+    "two_women_holding_hands_tone1-tone2",
+    "two_women_holding_hands_tone1-tone3",
+    "two_women_holding_hands_tone1-tone4",
+    "two_women_holding_hands_tone1-tone5",
+    "two_women_holding_hands_tone2-tone1",
+    "two_women_holding_hands_tone2-tone3",
+    "two_women_holding_hands_tone2-tone4",
+    "two_women_holding_hands_tone2-tone5",
+    "two_women_holding_hands_tone3-tone1",
+    "two_women_holding_hands_tone3-tone2",
+    "two_women_holding_hands_tone3-tone4",
+    "two_women_holding_hands_tone3-tone5",
+    "two_women_holding_hands_tone4-tone1",
+    "two_women_holding_hands_tone4-tone2",
+    "two_women_holding_hands_tone4-tone3",
+    "two_women_holding_hands_tone4-tone5",
+    "two_women_holding_hands_tone5-tone1",
+    "two_women_holding_hands_tone5-tone2",
+    "two_women_holding_hands_tone5-tone3",
+    "two_women_holding_hands_tone5-tone4",
+    "female-police-officer",
+    "female-police-officer_tone1",
+    "female-police-officer_tone2",
+    "female-police-officer_tone3",
+    "female-police-officer_tone4",
+    "female-police-officer_tone5",
+    "male-police-officer",
+    "male-police-officer_tone1",
+    "male-police-officer_tone2",
+    "male-police-officer_tone3",
+    "male-police-officer_tone4",
+    "male-police-officer_tone5",
+    "cop",
+    "cop_tone1",
+    "cop_tone2",
+    "cop_tone3",
+    "cop_tone4",
+    "cop_tone5",
+    "women-with-bunny-ears-partying",
+    "woman-with-bunny-ears-partying",
+    "men-with-bunny-ears-partying",
+    "man-with-bunny-ears-partying",
+    "dancers",
+    "woman_with_veil",
+    "woman_with_veil_tone1",
+    "woman_with_veil_tone2",
+    "woman_with_veil_tone3",
+    "woman_with_veil_tone4",
+    "woman_with_veil_tone5",
+    "man_with_veil",
+    "man_with_veil_tone1",
+    "man_with_veil_tone2",
+    "man_with_veil_tone3",
+    "man_with_veil_tone4",
+    "man_with_veil_tone5",
+    "bride_with_veil",
+    "bride_with_veil_tone1",
+    "bride_with_veil_tone2",
+    "bride_with_veil_tone3",
+    "bride_with_veil_tone4",
+    "bride_with_veil_tone5",
+    "blond-haired-woman",
+    "blond-haired-woman_tone1",
+    "blond-haired-woman_tone2",
+    "blond-haired-woman_tone3",
+    "blond-haired-woman_tone4",
+    "blond-haired-woman_tone5",
+    "blond-haired-man",
+    "blond-haired-man_tone1",
+    "blond-haired-man_tone2",
+    "blond-haired-man_tone3",
+    "blond-haired-man_tone4",
+    "blond-haired-man_tone5",
+    "person_with_blond_hair",
+    "person_with_blond_hair_tone1",
+    "person_with_blond_hair_tone2",
+    "person_with_blond_hair_tone3",
+    "person_with_blond_hair_tone4",
+    "person_with_blond_hair_tone5",
+    "man_with_gua_pi_mao",
+    "man_with_gua_pi_mao_tone1",
+    "man_with_gua_pi_mao_tone2",
+    "man_with_gua_pi_mao_tone3",
+    "man_with_gua_pi_mao_tone4",
+    "man_with_gua_pi_mao_tone5",
+    "woman-wearing-turban",
+    "woman-wearing-turban_tone1",
+    "woman-wearing-turban_tone2",
+    "woman-wearing-turban_tone3",
+    "woman-wearing-turban_tone4",
+    "woman-wearing-turban_tone5",
+    "man-wearing-turban",
+    "man-wearing-turban_tone1",
+    "man-wearing-turban_tone2",
+    "man-wearing-turban_tone3",
+    "man-wearing-turban_tone4",
+    "man-wearing-turban_tone5",
+    "man_with_turban",
+    "man_with_turban_tone1",
+    "man_with_turban_tone2",
+    "man_with_turban_tone3",
+    "man_with_turban_tone4",
+    "man_with_turban_tone5",
+    "older_man",
+    "older_man_tone1",
+    "older_man_tone2",
+    "older_man_tone3",
+    "older_man_tone4",
+    "older_man_tone5",
+    "older_woman",
+    "older_woman_tone1",
+    "older_woman_tone2",
+    "older_woman_tone3",
+    "older_woman_tone4",
+    "older_woman_tone5",
+    "baby",
+    "baby_tone1",
+    "baby_tone2",
+    "baby_tone3",
+    "baby_tone4",
+    "baby_tone5",
+    "female-construction-worker",
+    "female-construction-worker_tone1",
+    "female-construction-worker_tone2",
+    "female-construction-worker_tone3",
+    "female-construction-worker_tone4",
+    "female-construction-worker_tone5",
+    "male-construction-worker",
+    "male-construction-worker_tone1",
+    "male-construction-worker_tone2",
+    "male-construction-worker_tone3",
+    "male-construction-worker_tone4",
+    "male-construction-worker_tone5",
+    "construction_worker",
+    "construction_worker_tone1",
+    "construction_worker_tone2",
+    "construction_worker_tone3",
+    "construction_worker_tone4",
+    "construction_worker_tone5",
+    "princess",
+    "princess_tone1",
+    "princess_tone2",
+    "princess_tone3",
+    "princess_tone4",
+    "princess_tone5",
+    "japanese_ogre",
+    "japanese_goblin",
+    "ghost",
+    "angel",
+    "angel_tone1",
+    "angel_tone2",
+    "angel_tone3",
+    "angel_tone4",
+    "angel_tone5",
+    "alien",
+    "space_invader",
+    "imp",
+    "skull",
+    "woman-tipping-hand",
+    "woman-tipping-hand_tone1",
+    "woman-tipping-hand_tone2",
+    "woman-tipping-hand_tone3",
+    "woman-tipping-hand_tone4",
+    "woman-tipping-hand_tone5",
+    "man-tipping-hand",
+    "man-tipping-hand_tone1",
+    "man-tipping-hand_tone2",
+    "man-tipping-hand_tone3",
+    "man-tipping-hand_tone4",
+    "man-tipping-hand_tone5",
+    "information_desk_person",
+    "information_desk_person_tone1",
+    "information_desk_person_tone2",
+    "information_desk_person_tone3",
+    "information_desk_person_tone4",
+    "information_desk_person_tone5",
+    "female-guard",
+    "female-guard_tone1",
+    "female-guard_tone2",
+    "female-guard_tone3",
+    "female-guard_tone4",
+    "female-guard_tone5",
+    "male-guard",
+    "male-guard_tone1",
+    "male-guard_tone2",
+    "male-guard_tone3",
+    "male-guard_tone4",
+    "male-guard_tone5",
+    "guardsman",
+    "guardsman_tone1",
+    "guardsman_tone2",
+    "guardsman_tone3",
+    "guardsman_tone4",
+    "guardsman_tone5",
+    "dancer",
+    "dancer_tone1",
+    "dancer_tone2",
+    "dancer_tone3",
+    "dancer_tone4",
+    "dancer_tone5",
+    "lipstick",
+    "nail_care",
+    "nail_care_tone1",
+    "nail_care_tone2",
+    "nail_care_tone3",
+    "nail_care_tone4",
+    "nail_care_tone5",
+    "woman-getting-massage",
+    "woman-getting-massage_tone1",
+    "woman-getting-massage_tone2",
+    "woman-getting-massage_tone3",
+    "woman-getting-massage_tone4",
+    "woman-getting-massage_tone5",
+    "man-getting-massage",
+    "man-getting-massage_tone1",
+    "man-getting-massage_tone2",
+    "man-getting-massage_tone3",
+    "man-getting-massage_tone4",
+    "man-getting-massage_tone5",
+    "massage",
+    "massage_tone1",
+    "massage_tone2",
+    "massage_tone3",
+    "massage_tone4",
+    "massage_tone5",
+    "woman-getting-haircut",
+    "woman-getting-haircut_tone1",
+    "woman-getting-haircut_tone2",
+    "woman-getting-haircut_tone3",
+    "woman-getting-haircut_tone4",
+    "woman-getting-haircut_tone5",
+    "man-getting-haircut",
+    "man-getting-haircut_tone1",
+    "man-getting-haircut_tone2",
+    "man-getting-haircut_tone3",
+    "man-getting-haircut_tone4",
+    "man-getting-haircut_tone5",
+    "haircut",
+    "haircut_tone1",
+    "haircut_tone2",
+    "haircut_tone3",
+    "haircut_tone4",
+    "haircut_tone5",
+    "barber",
+    "syringe",
+    "pill",
+    "kiss",
+    "love_letter",
+    "ring",
+    "gem",
+    "couplekiss",
+    "couplekiss_tone1",
+    "couplekiss_tone2",
+    "couplekiss_tone3",
+    "couplekiss_tone4",
+    "couplekiss_tone5",
+    "couplekiss_tone1-tone2",
+    "couplekiss_tone1-tone3",
+    "couplekiss_tone1-tone4",
+    "couplekiss_tone1-tone5",
+    "couplekiss_tone2-tone1",
+    "couplekiss_tone2-tone3",
+    "couplekiss_tone2-tone4",
+    "couplekiss_tone2-tone5",
+    "couplekiss_tone3-tone1",
+    "couplekiss_tone3-tone2",
+    "couplekiss_tone3-tone4",
+    "couplekiss_tone3-tone5",
+    "couplekiss_tone4-tone1",
+    "couplekiss_tone4-tone2",
+    "couplekiss_tone4-tone3",
+    "couplekiss_tone4-tone5",
+    "couplekiss_tone5-tone1",
+    "couplekiss_tone5-tone2",
+    "couplekiss_tone5-tone3",
+    "couplekiss_tone5-tone4",
+    "bouquet",
+    "couple_with_heart",
+    "couple_with_heart_tone1",
+    "couple_with_heart_tone2",
+    "couple_with_heart_tone3",
+    "couple_with_heart_tone4",
+    "couple_with_heart_tone5",
+    "couple_with_heart_tone1-tone2",
+    "couple_with_heart_tone1-tone3",
+    "couple_with_heart_tone1-tone4",
+    "couple_with_heart_tone1-tone5",
+    "couple_with_heart_tone2-tone1",
+    "couple_with_heart_tone2-tone3",
+    "couple_with_heart_tone2-tone4",
+    "couple_with_heart_tone2-tone5",
+    "couple_with_heart_tone3-tone1",
+    "couple_with_heart_tone3-tone2",
+    "couple_with_heart_tone3-tone4",
+    "couple_with_heart_tone3-tone5",
+    "couple_with_heart_tone4-tone1",
+    "couple_with_heart_tone4-tone2",
+    "couple_with_heart_tone4-tone3",
+    "couple_with_heart_tone4-tone5",
+    "couple_with_heart_tone5-tone1",
+    "couple_with_heart_tone5-tone2",
+    "couple_with_heart_tone5-tone3",
+    "couple_with_heart_tone5-tone4",
+    "wedding",
+    "heartbeat",
+    "broken_heart",
+    "two_hearts",
+    "sparkling_heart",
+    "heartpulse",
+    "cupid",
+    "blue_heart",
+    "green_heart",
+    "yellow_heart",
+    "purple_heart",
+    "gift_heart",
+    "revolving_hearts",
+    "heart_decoration",
+    "diamond_shape_with_a_dot_inside",
+    "bulb",
+    "anger",
+    "bomb",
+    "zzz",
+    "boom",
+    "collision",
+    "sweat_drops",
+    "droplet",
+    "dash",
+    "hankey",
+    "poop",
+    "shit",
+    "muscle",
+    "muscle_tone1",
+    "muscle_tone2",
+    "muscle_tone3",
+    "muscle_tone4",
+    "muscle_tone5",
+    "dizzy",
+    "speech_balloon",
+    "thought_balloon",
+    "white_flower",
+    "100",
+    "moneybag",
+    "currency_exchange",
+    "heavy_dollar_sign",
+    "credit_card",
+    "yen",
+    "dollar",
+    "euro",
+    "pound",
+    "money_with_wings",
+    "chart",
+    "seat",
+    "computer",
+    "briefcase",
+    "minidisc",
+    "floppy_disk",
+    "cd",
+    "dvd",
+    "file_folder",
+    "open_file_folder",
+    "page_with_curl",
+    "page_facing_up",
+    "date",
+    "calendar",
+    "card_index",
+    "chart_with_upwards_trend",
+    "chart_with_downwards_trend",
+    "bar_chart",
+    "clipboard",
+    "pushpin",
+    "round_pushpin",
+    "paperclip",
+    "straight_ruler",
+    "triangular_ruler",
+    "bookmark_tabs",
+    "ledger",
+    "notebook",
+    "notebook_with_decorative_cover",
+    "closed_book",
+    "book",
+    "open_book",
+    "green_book",
+    "blue_book",
+    "orange_book",
+    "books",
+    "name_badge",
+    "scroll",
+    "memo",
+    "pencil",
+    "telephone_receiver",
+    "pager",
+    "fax",
+    "satellite_antenna",
+    "loudspeaker",
+    "mega",
+    "outbox_tray",
+    "inbox_tray",
+    "package",
+    "e-mail",
+    "incoming_envelope",
+    "envelope_with_arrow",
+    "mailbox_closed",
+    "mailbox",
+    "mailbox_with_mail",
+    "mailbox_with_no_mail",
+    "postbox",
+    "postal_horn",
+    "newspaper",
+    "iphone",
+    "calling",
+    "vibration_mode",
+    "mobile_phone_off",
+    "no_mobile_phones",
+    "signal_strength",
+    "camera",
+    "camera_with_flash",
+    "video_camera",
+    "tv",
+    "radio",
+    "vhs",
+    "film_projector",
+    "prayer_beads",
+    "twisted_rightwards_arrows",
+    "repeat",
+    "repeat_one",
+    "arrows_clockwise",
+    "arrows_counterclockwise",
+    "low_brightness",
+    "high_brightness",
+    "mute",
+    "speaker",
+    "sound",
+    "loud_sound",
+    "battery",
+    "electric_plug",
+    "mag",
+    "mag_right",
+    "lock_with_ink_pen",
+    "closed_lock_with_key",
+    "key",
+    "lock",
+    "unlock",
+    "bell",
+    "no_bell",
+    "bookmark",
+    "link",
+    "radio_button",
+    "back",
+    "end",
+    "on",
+    "soon",
+    "top",
+    "underage",
+    "keycap_ten",
+    "capital_abcd",
+    "abcd",
+    "1234",
+    "symbols",
+    "abc",
+    "fire",
+    "flashlight",
+    "wrench",
+    "hammer",
+    "nut_and_bolt",
+    "hocho",
+    "knife",
+    "gun",
+    "microscope",
+    "telescope",
+    "crystal_ball",
+    "six_pointed_star",
+    "beginner",
+    "trident",
+    "black_square_button",
+    "white_square_button",
+    "red_circle",
+    "large_blue_circle",
+    "large_orange_diamond",
+    "large_blue_diamond",
+    "small_orange_diamond",
+    "small_blue_diamond",
+    "small_red_triangle",
+    "small_red_triangle_down",
+    "arrow_up_small",
+    "arrow_down_small",
+    "om_symbol",
+    "dove_of_peace",
+    "kaaba",
+    "mosque",
+    "synagogue",
+    "menorah_with_nine_branches",
+    "clock1",
+    "clock2",
+    "clock3",
+    "clock4",
+    "clock5",
+    "clock6",
+    "clock7",
+    "clock8",
+    "clock9",
+    "clock10",
+    "clock11",
+    "clock12",
+    "clock130",
+    "clock230",
+    "clock330",
+    "clock430",
+    "clock530",
+    "clock630",
+    "clock730",
+    "clock830",
+    "clock930",
+    "clock1030",
+    "clock1130",
+    "clock1230",
+    "candle",
+    "mantelpiece_clock",
+    "hole",
+    "man_in_business_suit_levitating",
+    "man_in_business_suit_levitating_tone1",
+    "man_in_business_suit_levitating_tone2",
+    "man_in_business_suit_levitating_tone3",
+    "man_in_business_suit_levitating_tone4",
+    "man_in_business_suit_levitating_tone5",
+    "female-detective",
+    "female-detective_tone1",
+    "female-detective_tone2",
+    "female-detective_tone3",
+    "female-detective_tone4",
+    "female-detective_tone5",
+    "male-detective",
+    "male-detective_tone1",
+    "male-detective_tone2",
+    "male-detective_tone3",
+    "male-detective_tone4",
+    "male-detective_tone5",
+    "sleuth_or_spy",
+    "sleuth_or_spy_tone1",
+    "sleuth_or_spy_tone2",
+    "sleuth_or_spy_tone3",
+    "sleuth_or_spy_tone4",
+    "sleuth_or_spy_tone5",
+    "dark_sunglasses",
+    "spider",
+    "spider_web",
+    "joystick",
+    "man_dancing",
+    "man_dancing_tone1",
+    "man_dancing_tone2",
+    "man_dancing_tone3",
+    "man_dancing_tone4",
+    "man_dancing_tone5",
+    "linked_paperclips",
+    "lower_left_ballpoint_pen",
+    "lower_left_fountain_pen",
+    "lower_left_paintbrush",
+    "lower_left_crayon",
+    "raised_hand_with_fingers_splayed",
+    "raised_hand_with_fingers_splayed_tone1",
+    "raised_hand_with_fingers_splayed_tone2",
+    "raised_hand_with_fingers_splayed_tone3",
+    "raised_hand_with_fingers_splayed_tone4",
+    "raised_hand_with_fingers_splayed_tone5",
+    "middle_finger",
+    "reversed_hand_with_middle_finger_extended",
+    "middle_finger_tone1",
+    "middle_finger_tone2",
+    "middle_finger_tone3",
+    "middle_finger_tone4",
+    "middle_finger_tone5",
+    "spock-hand",
+    "spock-hand_tone1",
+    "spock-hand_tone2",
+    "spock-hand_tone3",
+    "spock-hand_tone4",
+    "spock-hand_tone5",
+    "black_heart",
+    "desktop_computer",
+    "printer",
+    "three_button_mouse",
+    "trackball",
+    "frame_with_picture",
+    "card_index_dividers",
+    "card_file_box",
+    "file_cabinet",
+    "wastebasket",
+    "spiral_note_pad",
+    "spiral_calendar_pad",
+    "compression",
+    "old_key",
+    "rolled_up_newspaper",
+    "dagger_knife",
+    "speaking_head_in_silhouette",
+    "left_speech_bubble",
+    "right_anger_bubble",
+    "ballot_box_with_ballot",
+    "world_map",
+    "mount_fuji",
+    "tokyo_tower",
+    "statue_of_liberty",
+    "japan",
+    "moyai",
+    "grinning",
+    "grin",
+    "joy",
+    "smiley",
+    "smile",
+    "sweat_smile",
+    "laughing",
+    "satisfied",
+    "innocent",
+    "smiling_imp",
+    "wink",
+    "blush",
+    "yum",
+    "relieved",
+    "heart_eyes",
+    "sunglasses",
+    "smirk",
+    "neutral_face",
+    "expressionless",
+    "unamused",
+    "sweat",
+    "pensive",
+    "confused",
+    "confounded",
+    "kissing",
+    "kissing_heart",
+    "kissing_smiling_eyes",
+    "kissing_closed_eyes",
+    "stuck_out_tongue",
+    "stuck_out_tongue_winking_eye",
+    "stuck_out_tongue_closed_eyes",
+    "disappointed",
+    "worried",
+    "angry",
+    "rage",
+    "cry",
+    "persevere",
+    "triumph",
+    "disappointed_relieved",
+    "frowning",
+    "anguished",
+    "fearful",
+    "weary",
+    "sleepy",
+    "tired_face",
+    "grimacing",
+    "sob",
+    "face_exhaling",
+    "open_mouth",
+    "hushed",
+    "cold_sweat",
+    "scream",
+    "astonished",
+    "flushed",
+    "sleeping",
+    "face_with_spiral_eyes",
+    "dizzy_face",
+    "face_in_clouds",
+    "no_mouth",
+    "mask",
+    "smile_cat",
+    "joy_cat",
+    "smiley_cat",
+    "heart_eyes_cat",
+    "smirk_cat",
+    "kissing_cat",
+    "pouting_cat",
+    "crying_cat_face",
+    "scream_cat",
+    "slightly_frowning_face",
+    "slightly_smiling_face",
+    "upside_down_face",
+    "face_with_rolling_eyes",
+    "woman-gesturing-no",
+    "woman-gesturing-no_tone1",
+    "woman-gesturing-no_tone2",
+    "woman-gesturing-no_tone3",
+    "woman-gesturing-no_tone4",
+    "woman-gesturing-no_tone5",
+    "man-gesturing-no",
+    "man-gesturing-no_tone1",
+    "man-gesturing-no_tone2",
+    "man-gesturing-no_tone3",
+    "man-gesturing-no_tone4",
+    "man-gesturing-no_tone5",
+    "no_good",
+    "no_good_tone1",
+    "no_good_tone2",
+    "no_good_tone3",
+    "no_good_tone4",
+    "no_good_tone5",
+    "woman-gesturing-ok",
+    "woman-gesturing-ok_tone1",
+    "woman-gesturing-ok_tone2",
+    "woman-gesturing-ok_tone3",
+    "woman-gesturing-ok_tone4",
+    "woman-gesturing-ok_tone5",
+    "man-gesturing-ok",
+    "man-gesturing-ok_tone1",
+    "man-gesturing-ok_tone2",
+    "man-gesturing-ok_tone3",
+    "man-gesturing-ok_tone4",
+    "man-gesturing-ok_tone5",
+    "ok_woman",
+    "ok_woman_tone1",
+    "ok_woman_tone2",
+    "ok_woman_tone3",
+    "ok_woman_tone4",
+    "ok_woman_tone5",
+    "woman-bowing",
+    "woman-bowing_tone1",
+    "woman-bowing_tone2",
+    "woman-bowing_tone3",
+    "woman-bowing_tone4",
+    "woman-bowing_tone5",
+    "man-bowing",
+    "man-bowing_tone1",
+    "man-bowing_tone2",
+    "man-bowing_tone3",
+    "man-bowing_tone4",
+    "man-bowing_tone5",
+    "bow",
+    "bow_tone1",
+    "bow_tone2",
+    "bow_tone3",
+    "bow_tone4",
+    "bow_tone5",
+    "see_no_evil",
+    "hear_no_evil",
+    "speak_no_evil",
+    "woman-raising-hand",
+    "woman-raising-hand_tone1",
+    "woman-raising-hand_tone2",
+    "woman-raising-hand_tone3",
+    "woman-raising-hand_tone4",
+    "woman-raising-hand_tone5",
+    "man-raising-hand",
+    "man-raising-hand_tone1",
+    "man-raising-hand_tone2",
+    "man-raising-hand_tone3",
+    "man-raising-hand_tone4",
+    "man-raising-hand_tone5",
+    "raising_hand",
+    "raising_hand_tone1",
+    "raising_hand_tone2",
+    "raising_hand_tone3",
+    "raising_hand_tone4",
+    "raising_hand_tone5",
+    "raised_hands",
+    "raised_hands_tone1",
+    "raised_hands_tone2",
+    "raised_hands_tone3",
+    "raised_hands_tone4",
+    "raised_hands_tone5",
+    "woman-frowning",
+    "woman-frowning_tone1",
+    "woman-frowning_tone2",
+    "woman-frowning_tone3",
+    "woman-frowning_tone4",
+    "woman-frowning_tone5",
+    "man-frowning",
+    "man-frowning_tone1",
+    "man-frowning_tone2",
+    "man-frowning_tone3",
+    "man-frowning_tone4",
+    "man-frowning_tone5",
+    "person_frowning",
+    "person_frowning_tone1",
+    "person_frowning_tone2",
+    "person_frowning_tone3",
+    "person_frowning_tone4",
+    "person_frowning_tone5",
+    "woman-pouting",
+    "woman-pouting_tone1",
+    "woman-pouting_tone2",
+    "woman-pouting_tone3",
+    "woman-pouting_tone4",
+    "woman-pouting_tone5",
+    "man-pouting",
+    "man-pouting_tone1",
+    "man-pouting_tone2",
+    "man-pouting_tone3",
+    "man-pouting_tone4",
+    "man-pouting_tone5",
+    "person_with_pouting_face",
+    "person_with_pouting_face_tone1",
+    "person_with_pouting_face_tone2",
+    "person_with_pouting_face_tone3",
+    "person_with_pouting_face_tone4",
+    "person_with_pouting_face_tone5",
+    "pray",
+    "pray_tone1",
+    "pray_tone2",
+    "pray_tone3",
+    "pray_tone4",
+    "pray_tone5",
+    "rocket",
+    "helicopter",
+    "steam_locomotive",
+    "railway_car",
+    "bullettrain_side",
+    "bullettrain_front",
+    "train2",
+    "metro",
+    "light_rail",
+    "station",
+    "tram",
+    "train",
+    "bus",
+    "oncoming_bus",
+    "trolleybus",
+    "busstop",
+    "minibus",
+    "ambulance",
+    "fire_engine",
+    "police_car",
+    "oncoming_police_car",
+    "taxi",
+    "oncoming_taxi",
+    "car",
+    "red_car",
+    "oncoming_automobile",
+    "blue_car",
+    "truck",
+    "articulated_lorry",
+    "tractor",
+    "monorail",
+    "mountain_railway",
+    "suspension_railway",
+    "mountain_cableway",
+    "aerial_tramway",
+    "ship",
+    "woman-rowing-boat",
+    "woman-rowing-boat_tone1",
+    "woman-rowing-boat_tone2",
+    "woman-rowing-boat_tone3",
+    "woman-rowing-boat_tone4",
+    "woman-rowing-boat_tone5",
+    "man-rowing-boat",
+    "man-rowing-boat_tone1",
+    "man-rowing-boat_tone2",
+    "man-rowing-boat_tone3",
+    "man-rowing-boat_tone4",
+    "man-rowing-boat_tone5",
+    "rowboat",
+    "rowboat_tone1",
+    "rowboat_tone2",
+    "rowboat_tone3",
+    "rowboat_tone4",
+    "rowboat_tone5",
+    "speedboat",
+    "traffic_light",
+    "vertical_traffic_light",
+    "construction",
+    "rotating_light",
+    "triangular_flag_on_post",
+    "door",
+    "no_entry_sign",
+    "smoking",
+    "no_smoking",
+    "put_litter_in_its_place",
+    "do_not_litter",
+    "potable_water",
+    "non-potable_water",
+    "bike",
+    "no_bicycles",
+    "woman-biking",
+    "woman-biking_tone1",
+    "woman-biking_tone2",
+    "woman-biking_tone3",
+    "woman-biking_tone4",
+    "woman-biking_tone5",
+    "man-biking",
+    "man-biking_tone1",
+    "man-biking_tone2",
+    "man-biking_tone3",
+    "man-biking_tone4",
+    "man-biking_tone5",
+    "bicyclist",
+    "bicyclist_tone1",
+    "bicyclist_tone2",
+    "bicyclist_tone3",
+    "bicyclist_tone4",
+    "bicyclist_tone5",
+    "woman-mountain-biking",
+    "woman-mountain-biking_tone1",
+    "woman-mountain-biking_tone2",
+    "woman-mountain-biking_tone3",
+    "woman-mountain-biking_tone4",
+    "woman-mountain-biking_tone5",
+    "man-mountain-biking",
+    "man-mountain-biking_tone1",
+    "man-mountain-biking_tone2",
+    "man-mountain-biking_tone3",
+    "man-mountain-biking_tone4",
+    "man-mountain-biking_tone5",
+    "mountain_bicyclist",
+    "mountain_bicyclist_tone1",
+    "mountain_bicyclist_tone2",
+    "mountain_bicyclist_tone3",
+    "mountain_bicyclist_tone4",
+    "mountain_bicyclist_tone5",
+    "woman-walking",
+    "woman-walking_tone1",
+    "woman-walking_tone2",
+    "woman-walking_tone3",
+    "woman-walking_tone4",
+    "woman-walking_tone5",
+    "man-walking",
+    "man-walking_tone1",
+    "man-walking_tone2",
+    "man-walking_tone3",
+    "man-walking_tone4",
+    "man-walking_tone5",
+    "walking",
+    "walking_tone1",
+    "walking_tone2",
+    "walking_tone3",
+    "walking_tone4",
+    "walking_tone5",
+    "no_pedestrians",
+    "children_crossing",
+    "mens",
+    "womens",
+    "restroom",
+    "baby_symbol",
+    "toilet",
+    "wc",
+    "shower",
+    "bath",
+    "bath_tone1",
+    "bath_tone2",
+    "bath_tone3",
+    "bath_tone4",
+    "bath_tone5",
+    "bathtub",
+    "passport_control",
+    "customs",
+    "baggage_claim",
+    "left_luggage",
+    "couch_and_lamp",
+    "sleeping_accommodation",
+    "sleeping_accommodation_tone1",
+    "sleeping_accommodation_tone2",
+    "sleeping_accommodation_tone3",
+    "sleeping_accommodation_tone4",
+    "sleeping_accommodation_tone5",
+    "shopping_bags",
+    "bellhop_bell",
+    "bed",
+    "place_of_worship",
+    "octagonal_sign",
+    "shopping_trolley",
+    "hindu_temple",
+    "hut",
+    "elevator",
+    "hammer_and_wrench",
+    "shield",
+    "oil_drum",
+    "motorway",
+    "railway_track",
+    "motor_boat",
+    "small_airplane",
+    "airplane_departure",
+    "airplane_arriving",
+    "satellite",
+    "passenger_ship",
+    "scooter",
+    "motor_scooter",
+    "canoe",
+    "sled",
+    "flying_saucer",
+    "skateboard",
+    "auto_rickshaw",
+    "pickup_truck",
+    "roller_skate",
+    "large_orange_circle",
+    "large_yellow_circle",
+    "large_green_circle",
+    "large_purple_circle",
+    "large_brown_circle",
+    "large_red_square",
+    "large_blue_square",
+    "large_orange_square",
+    "large_yellow_square",
+    "large_green_square",
+    "large_purple_square",
+    "large_brown_square",
+    "pinched_fingers",
+    "pinched_fingers_tone1",
+    "pinched_fingers_tone2",
+    "pinched_fingers_tone3",
+    "pinched_fingers_tone4",
+    "pinched_fingers_tone5",
+    "white_heart",
+    "brown_heart",
+    "pinching_hand",
+    "pinching_hand_tone1",
+    "pinching_hand_tone2",
+    "pinching_hand_tone3",
+    "pinching_hand_tone4",
+    "pinching_hand_tone5",
+    "zipper_mouth_face",
+    "money_mouth_face",
+    "face_with_thermometer",
+    "nerd_face",
+    "thinking_face",
+    "face_with_head_bandage",
+    "robot_face",
+    "hugging_face",
+    "the_horns",
+    "sign_of_the_horns",
+    "the_horns_tone1",
+    "the_horns_tone2",
+    "the_horns_tone3",
+    "the_horns_tone4",
+    "the_horns_tone5",
+    "call_me_hand",
+    "call_me_hand_tone1",
+    "call_me_hand_tone2",
+    "call_me_hand_tone3",
+    "call_me_hand_tone4",
+    "call_me_hand_tone5",
+    "raised_back_of_hand",
+    "raised_back_of_hand_tone1",
+    "raised_back_of_hand_tone2",
+    "raised_back_of_hand_tone3",
+    "raised_back_of_hand_tone4",
+    "raised_back_of_hand_tone5",
+    "left-facing_fist",
+    "left-facing_fist_tone1",
+    "left-facing_fist_tone2",
+    "left-facing_fist_tone3",
+    "left-facing_fist_tone4",
+    "left-facing_fist_tone5",
+    "right-facing_fist",
+    "right-facing_fist_tone1",
+    "right-facing_fist_tone2",
+    "right-facing_fist_tone3",
+    "right-facing_fist_tone4",
+    "right-facing_fist_tone5",
+    "handshake",
+    "crossed_fingers",
+    "hand_with_index_and_middle_fingers_crossed",
+    "crossed_fingers_tone1",
+    "crossed_fingers_tone2",
+    "crossed_fingers_tone3",
+    "crossed_fingers_tone4",
+    "crossed_fingers_tone5",
+    "i_love_you_hand_sign",
+    "i_love_you_hand_sign_tone1",
+    "i_love_you_hand_sign_tone2",
+    "i_love_you_hand_sign_tone3",
+    "i_love_you_hand_sign_tone4",
+    "i_love_you_hand_sign_tone5",
+    "face_with_cowboy_hat",
+    "clown_face",
+    "nauseated_face",
+    "rolling_on_the_floor_laughing",
+    "drooling_face",
+    "lying_face",
+    "woman-facepalming",
+    "woman-facepalming_tone1",
+    "woman-facepalming_tone2",
+    "woman-facepalming_tone3",
+    "woman-facepalming_tone4",
+    "woman-facepalming_tone5",
+    "man-facepalming",
+    "man-facepalming_tone1",
+    "man-facepalming_tone2",
+    "man-facepalming_tone3",
+    "man-facepalming_tone4",
+    "man-facepalming_tone5",
+    "face_palm",
+    "face_palm_tone1",
+    "face_palm_tone2",
+    "face_palm_tone3",
+    "face_palm_tone4",
+    "face_palm_tone5",
+    "sneezing_face",
+    "face_with_raised_eyebrow",
+    "face_with_one_eyebrow_raised",
+    "star-struck",
+    "grinning_face_with_star_eyes",
+    "zany_face",
+    "grinning_face_with_one_large_and_one_small_eye",
+    "shushing_face",
+    "face_with_finger_covering_closed_lips",
+    "face_with_symbols_on_mouth",
+    "serious_face_with_symbols_covering_mouth",
+    "face_with_hand_over_mouth",
+    "smiling_face_with_smiling_eyes_and_hand_covering_mouth",
+    "face_vomiting",
+    "face_with_open_mouth_vomiting",
+    "exploding_head",
+    "shocked_face_with_exploding_head",
+    "pregnant_woman",
+    "pregnant_woman_tone1",
+    "pregnant_woman_tone2",
+    "pregnant_woman_tone3",
+    "pregnant_woman_tone4",
+    "pregnant_woman_tone5",
+    "breast-feeding",
+    "breast-feeding_tone1",
+    "breast-feeding_tone2",
+    "breast-feeding_tone3",
+    "breast-feeding_tone4",
+    "breast-feeding_tone5",
+    "palms_up_together",
+    "palms_up_together_tone1",
+    "palms_up_together_tone2",
+    "palms_up_together_tone3",
+    "palms_up_together_tone4",
+    "palms_up_together_tone5",
+    "selfie",
+    "selfie_tone1",
+    "selfie_tone2",
+    "selfie_tone3",
+    "selfie_tone4",
+    "selfie_tone5",
+    "prince",
+    "prince_tone1",
+    "prince_tone2",
+    "prince_tone3",
+    "prince_tone4",
+    "prince_tone5",
+    "woman_in_tuxedo",
+    "woman_in_tuxedo_tone1",
+    "woman_in_tuxedo_tone2",
+    "woman_in_tuxedo_tone3",
+    "woman_in_tuxedo_tone4",
+    "woman_in_tuxedo_tone5",
+    "man_in_tuxedo",
+    "man_in_tuxedo_tone1",
+    "man_in_tuxedo_tone2",
+    "man_in_tuxedo_tone3",
+    "man_in_tuxedo_tone4",
+    "man_in_tuxedo_tone5",
+    "person_in_tuxedo",
+    "person_in_tuxedo_tone1",
+    "person_in_tuxedo_tone2",
+    "person_in_tuxedo_tone3",
+    "person_in_tuxedo_tone4",
+    "person_in_tuxedo_tone5",
+    "mrs_claus",
+    "mother_christmas",
+    "mrs_claus_tone1",
+    "mrs_claus_tone2",
+    "mrs_claus_tone3",
+    "mrs_claus_tone4",
+    "mrs_claus_tone5",
+    "woman-shrugging",
+    "woman-shrugging_tone1",
+    "woman-shrugging_tone2",
+    "woman-shrugging_tone3",
+    "woman-shrugging_tone4",
+    "woman-shrugging_tone5",
+    "man-shrugging",
+    "man-shrugging_tone1",
+    "man-shrugging_tone2",
+    "man-shrugging_tone3",
+    "man-shrugging_tone4",
+    "man-shrugging_tone5",
+    "shrug",
+    "shrug_tone1",
+    "shrug_tone2",
+    "shrug_tone3",
+    "shrug_tone4",
+    "shrug_tone5",
+    "woman-cartwheeling",
+    "woman-cartwheeling_tone1",
+    "woman-cartwheeling_tone2",
+    "woman-cartwheeling_tone3",
+    "woman-cartwheeling_tone4",
+    "woman-cartwheeling_tone5",
+    "man-cartwheeling",
+    "man-cartwheeling_tone1",
+    "man-cartwheeling_tone2",
+    "man-cartwheeling_tone3",
+    "man-cartwheeling_tone4",
+    "man-cartwheeling_tone5",
+    "person_doing_cartwheel",
+    "person_doing_cartwheel_tone1",
+    "person_doing_cartwheel_tone2",
+    "person_doing_cartwheel_tone3",
+    "person_doing_cartwheel_tone4",
+    "person_doing_cartwheel_tone5",
+    "woman-juggling",
+    "woman-juggling_tone1",
+    "woman-juggling_tone2",
+    "woman-juggling_tone3",
+    "woman-juggling_tone4",
+    "woman-juggling_tone5",
+    "man-juggling",
+    "man-juggling_tone1",
+    "man-juggling_tone2",
+    "man-juggling_tone3",
+    "man-juggling_tone4",
+    "man-juggling_tone5",
+    "juggling",
+    "juggling_tone1",
+    "juggling_tone2",
+    "juggling_tone3",
+    "juggling_tone4",
+    "juggling_tone5",
+    "fencer",
+    "woman-wrestling",
+    "man-wrestling",
+    "wrestlers",
+    "woman-playing-water-polo",
+    "woman-playing-water-polo_tone1",
+    "woman-playing-water-polo_tone2",
+    "woman-playing-water-polo_tone3",
+    "woman-playing-water-polo_tone4",
+    "woman-playing-water-polo_tone5",
+    "man-playing-water-polo",
+    "man-playing-water-polo_tone1",
+    "man-playing-water-polo_tone2",
+    "man-playing-water-polo_tone3",
+    "man-playing-water-polo_tone4",
+    "man-playing-water-polo_tone5",
+    "water_polo",
+    "water_polo_tone1",
+    "water_polo_tone2",
+    "water_polo_tone3",
+    "water_polo_tone4",
+    "water_polo_tone5",
+    "woman-playing-handball",
+    "woman-playing-handball_tone1",
+    "woman-playing-handball_tone2",
+    "woman-playing-handball_tone3",
+    "woman-playing-handball_tone4",
+    "woman-playing-handball_tone5",
+    "man-playing-handball",
+    "man-playing-handball_tone1",
+    "man-playing-handball_tone2",
+    "man-playing-handball_tone3",
+    "man-playing-handball_tone4",
+    "man-playing-handball_tone5",
+    "handball",
+    "handball_tone1",
+    "handball_tone2",
+    "handball_tone3",
+    "handball_tone4",
+    "handball_tone5",
+    "diving_mask",
+    "wilted_flower",
+    "drum_with_drumsticks",
+    "clinking_glasses",
+    "tumbler_glass",
+    "spoon",
+    "goal_net",
+    "first_place_medal",
+    "second_place_medal",
+    "third_place_medal",
+    "boxing_glove",
+    "martial_arts_uniform",
+    "curling_stone",
+    "lacrosse",
+    "softball",
+    "flying_disc",
+    "croissant",
+    "avocado",
+    "cucumber",
+    "bacon",
+    "potato",
+    "carrot",
+    "baguette_bread",
+    "green_salad",
+    "shallow_pan_of_food",
+    "stuffed_flatbread",
+    "egg",
+    "glass_of_milk",
+    "peanuts",
+    "kiwifruit",
+    "pancakes",
+    "dumpling",
+    "fortune_cookie",
+    "takeout_box",
+    "chopsticks",
+    "bowl_with_spoon",
+    "cup_with_straw",
+    "coconut",
+    "broccoli",
+    "pie",
+    "pretzel",
+    "cut_of_meat",
+    "sandwich",
+    "canned_food",
+    "leafy_green",
+    "mango",
+    "moon_cake",
+    "bagel",
+    "smiling_face_with_3_hearts",
+    "yawning_face",
+    "smiling_face_with_tear",
+    "partying_face",
+    "woozy_face",
+    "hot_face",
+    "cold_face",
+    "ninja",
+    "ninja_tone1",
+    "ninja_tone2",
+    "ninja_tone3",
+    "ninja_tone4",
+    "ninja_tone5",
+    "disguised_face",
+    "pleading_face",
+    "sari",
+    "lab_coat",
+    "goggles",
+    "hiking_boot",
+    "womans_flat_shoe",
+    "crab",
+    "lion_face",
+    "scorpion",
+    "turkey",
+    "unicorn_face",
+    "eagle",
+    "duck",
+    "bat",
+    "shark",
+    "owl",
+    "fox_face",
+    "butterfly",
+    "deer",
+    "gorilla",
+    "lizard",
+    "rhinoceros",
+    "shrimp",
+    "squid",
+    "giraffe_face",
+    "zebra_face",
+    "hedgehog",
+    "sauropod",
+    "t-rex",
+    "cricket",
+    "kangaroo",
+    "llama",
+    "peacock",
+    "hippopotamus",
+    "parrot",
+    "raccoon",
+    "lobster",
+    "mosquito",
+    "microbe",
+    "badger",
+    "swan",
+    "mammoth",
+    "dodo",
+    "sloth",
+    "otter",
+    "orangutan",
+    "skunk",
+    "flamingo",
+    "oyster",
+    "beaver",
+    "bison",
+    "seal",
+    "guide_dog",
+    "probing_cane",
+    "bone",
+    "leg",
+    "leg_tone1",
+    "leg_tone2",
+    "leg_tone3",
+    "leg_tone4",
+    "leg_tone5",
+    "foot",
+    "foot_tone1",
+    "foot_tone2",
+    "foot_tone3",
+    "foot_tone4",
+    "foot_tone5",
+    "tooth",
+    "female_superhero",
+    "female_superhero_tone1",
+    "female_superhero_tone2",
+    "female_superhero_tone3",
+    "female_superhero_tone4",
+    "female_superhero_tone5",
+    "male_superhero",
+    "male_superhero_tone1",
+    "male_superhero_tone2",
+    "male_superhero_tone3",
+    "male_superhero_tone4",
+    "male_superhero_tone5",
+    "superhero",
+    "superhero_tone1",
+    "superhero_tone2",
+    "superhero_tone3",
+    "superhero_tone4",
+    "superhero_tone5",
+    "female_supervillain",
+    "female_supervillain_tone1",
+    "female_supervillain_tone2",
+    "female_supervillain_tone3",
+    "female_supervillain_tone4",
+    "female_supervillain_tone5",
+    "male_supervillain",
+    "male_supervillain_tone1",
+    "male_supervillain_tone2",
+    "male_supervillain_tone3",
+    "male_supervillain_tone4",
+    "male_supervillain_tone5",
+    "supervillain",
+    "supervillain_tone1",
+    "supervillain_tone2",
+    "supervillain_tone3",
+    "supervillain_tone4",
+    "supervillain_tone5",
+    "safety_vest",
+    "ear_with_hearing_aid",
+    "ear_with_hearing_aid_tone1",
+    "ear_with_hearing_aid_tone2",
+    "ear_with_hearing_aid_tone3",
+    "ear_with_hearing_aid_tone4",
+    "ear_with_hearing_aid_tone5",
+    "motorized_wheelchair",
+    "manual_wheelchair",
+    "mechanical_arm",
+    "mechanical_leg",
+    "cheese_wedge",
+    "cupcake",
+    "salt",
+    "beverage_box",
+    "garlic",
+    "onion",
+    "falafel",
+    "waffle",
+    "butter",
+    "mate_drink",
+    "ice_cube",
+    "bubble_tea",
+    "woman_standing",
+    "woman_standing_tone1",
+    "woman_standing_tone2",
+    "woman_standing_tone3",
+    "woman_standing_tone4",
+    "woman_standing_tone5",
+    "man_standing",
+    "man_standing_tone1",
+    "man_standing_tone2",
+    "man_standing_tone3",
+    "man_standing_tone4",
+    "man_standing_tone5",
+    "standing_person",
+    "standing_person_tone1",
+    "standing_person_tone2",
+    "standing_person_tone3",
+    "standing_person_tone4",
+    "standing_person_tone5",
+    "woman_kneeling",
+    "woman_kneeling_tone1",
+    "woman_kneeling_tone2",
+    "woman_kneeling_tone3",
+    "woman_kneeling_tone4",
+    "woman_kneeling_tone5",
+    "man_kneeling",
+    "man_kneeling_tone1",
+    "man_kneeling_tone2",
+    "man_kneeling_tone3",
+    "man_kneeling_tone4",
+    "man_kneeling_tone5",
+    "kneeling_person",
+    "kneeling_person_tone1",
+    "kneeling_person_tone2",
+    "kneeling_person_tone3",
+    "kneeling_person_tone4",
+    "kneeling_person_tone5",
+    "deaf_woman",
+    "deaf_woman_tone1",
+    "deaf_woman_tone2",
+    "deaf_woman_tone3",
+    "deaf_woman_tone4",
+    "deaf_woman_tone5",
+    "deaf_man",
+    "deaf_man_tone1",
+    "deaf_man_tone2",
+    "deaf_man_tone3",
+    "deaf_man_tone4",
+    "deaf_man_tone5",
+    "deaf_person",
+    "deaf_person_tone1",
+    "deaf_person_tone2",
+    "deaf_person_tone3",
+    "deaf_person_tone4",
+    "deaf_person_tone5",
+    "face_with_monocle",
+    "farmer",
+    "farmer_tone1",
+    "farmer_tone2",
+    "farmer_tone3",
+    "farmer_tone4",
+    "farmer_tone5",
+    "cook",
+    "cook_tone1",
+    "cook_tone2",
+    "cook_tone3",
+    "cook_tone4",
+    "cook_tone5",
+    "person_feeding_baby",
+    "person_feeding_baby_tone1",
+    "person_feeding_baby_tone2",
+    "person_feeding_baby_tone3",
+    "person_feeding_baby_tone4",
+    "person_feeding_baby_tone5",
+    "mx_claus",
+    "mx_claus_tone1",
+    "mx_claus_tone2",
+    "mx_claus_tone3",
+    "mx_claus_tone4",
+    "mx_claus_tone5",
+    "student",
+    "student_tone1",
+    "student_tone2",
+    "student_tone3",
+    "student_tone4",
+    "student_tone5",
+    "singer",
+    "singer_tone1",
+    "singer_tone2",
+    "singer_tone3",
+    "singer_tone4",
+    "singer_tone5",
+    "artist",
+    "artist_tone1",
+    "artist_tone2",
+    "artist_tone3",
+    "artist_tone4",
+    "artist_tone5",
+    "teacher",
+    "teacher_tone1",
+    "teacher_tone2",
+    "teacher_tone3",
+    "teacher_tone4",
+    "teacher_tone5",
+    "factory_worker",
+    "factory_worker_tone1",
+    "factory_worker_tone2",
+    "factory_worker_tone3",
+    "factory_worker_tone4",
+    "factory_worker_tone5",
+    "technologist",
+    "technologist_tone1",
+    "technologist_tone2",
+    "technologist_tone3",
+    "technologist_tone4",
+    "technologist_tone5",
+    "office_worker",
+    "office_worker_tone1",
+    "office_worker_tone2",
+    "office_worker_tone3",
+    "office_worker_tone4",
+    "office_worker_tone5",
+    "mechanic",
+    "mechanic_tone1",
+    "mechanic_tone2",
+    "mechanic_tone3",
+    "mechanic_tone4",
+    "mechanic_tone5",
+    "scientist",
+    "scientist_tone1",
+    "scientist_tone2",
+    "scientist_tone3",
+    "scientist_tone4",
+    "scientist_tone5",
+    "astronaut",
+    "astronaut_tone1",
+    "astronaut_tone2",
+    "astronaut_tone3",
+    "astronaut_tone4",
+    "astronaut_tone5",
+    "firefighter",
+    "firefighter_tone1",
+    "firefighter_tone2",
+    "firefighter_tone3",
+    "firefighter_tone4",
+    "firefighter_tone5",
+    "people_holding_hands",
+    "people_holding_hands_tone1-tone1",
+    "people_holding_hands_tone1-tone2",
+    "people_holding_hands_tone1-tone3",
+    "people_holding_hands_tone1-tone4",
+    "people_holding_hands_tone1-tone5",
+    "people_holding_hands_tone2-tone1",
+    "people_holding_hands_tone2-tone2",
+    "people_holding_hands_tone2-tone3",
+    "people_holding_hands_tone2-tone4",
+    "people_holding_hands_tone2-tone5",
+    "people_holding_hands_tone3-tone1",
+    "people_holding_hands_tone3-tone2",
+    "people_holding_hands_tone3-tone3",
+    "people_holding_hands_tone3-tone4",
+    "people_holding_hands_tone3-tone5",
+    "people_holding_hands_tone4-tone1",
+    "people_holding_hands_tone4-tone2",
+    "people_holding_hands_tone4-tone3",
+    "people_holding_hands_tone4-tone4",
+    "people_holding_hands_tone4-tone5",
+    "people_holding_hands_tone5-tone1",
+    "people_holding_hands_tone5-tone2",
+    "people_holding_hands_tone5-tone3",
+    "people_holding_hands_tone5-tone4",
+    "people_holding_hands_tone5-tone5",
+    "person_with_probing_cane",
+    "person_with_probing_cane_tone1",
+    "person_with_probing_cane_tone2",
+    "person_with_probing_cane_tone3",
+    "person_with_probing_cane_tone4",
+    "person_with_probing_cane_tone5",
+    "red_haired_person",
+    "red_haired_person_tone1",
+    "red_haired_person_tone2",
+    "red_haired_person_tone3",
+    "red_haired_person_tone4",
+    "red_haired_person_tone5",
+    "curly_haired_person",
+    "curly_haired_person_tone1",
+    "curly_haired_person_tone2",
+    "curly_haired_person_tone3",
+    "curly_haired_person_tone4",
+    "curly_haired_person_tone5",
+    "bald_person",
+    "bald_person_tone1",
+    "bald_person_tone2",
+    "bald_person_tone3",
+    "bald_person_tone4",
+    "bald_person_tone5",
+    "white_haired_person",
+    "white_haired_person_tone1",
+    "white_haired_person_tone2",
+    "white_haired_person_tone3",
+    "white_haired_person_tone4",
+    "white_haired_person_tone5",
+    "person_in_motorized_wheelchair",
+    "person_in_motorized_wheelchair_tone1",
+    "person_in_motorized_wheelchair_tone2",
+    "person_in_motorized_wheelchair_tone3",
+    "person_in_motorized_wheelchair_tone4",
+    "person_in_motorized_wheelchair_tone5",
+    "person_in_manual_wheelchair",
+    "person_in_manual_wheelchair_tone1",
+    "person_in_manual_wheelchair_tone2",
+    "person_in_manual_wheelchair_tone3",
+    "person_in_manual_wheelchair_tone4",
+    "person_in_manual_wheelchair_tone5",
+    "health_worker",
+    "health_worker_tone1",
+    "health_worker_tone2",
+    "health_worker_tone3",
+    "health_worker_tone4",
+    "health_worker_tone5",
+    "judge",
+    "judge_tone1",
+    "judge_tone2",
+    "judge_tone3",
+    "judge_tone4",
+    "judge_tone5",
+    "pilot",
+    "pilot_tone1",
+    "pilot_tone2",
+    "pilot_tone3",
+    "pilot_tone4",
+    "pilot_tone5",
+    "adult",
+    "adult_tone1",
+    "adult_tone2",
+    "adult_tone3",
+    "adult_tone4",
+    "adult_tone5",
+    "child",
+    "child_tone1",
+    "child_tone2",
+    "child_tone3",
+    "child_tone4",
+    "child_tone5",
+    "older_adult",
+    "older_adult_tone1",
+    "older_adult_tone2",
+    "older_adult_tone3",
+    "older_adult_tone4",
+    "older_adult_tone5",
+    "woman_with_beard",
+    "woman_with_beard_tone1",
+    "woman_with_beard_tone2",
+    "woman_with_beard_tone3",
+    "woman_with_beard_tone4",
+    "woman_with_beard_tone5",
+    "man_with_beard",
+    "man_with_beard_tone1",
+    "man_with_beard_tone2",
+    "man_with_beard_tone3",
+    "man_with_beard_tone4",
+    "man_with_beard_tone5",
+    "bearded_person",
+    "bearded_person_tone1",
+    "bearded_person_tone2",
+    "bearded_person_tone3",
+    "bearded_person_tone4",
+    "bearded_person_tone5",
+    "person_with_headscarf",
+    "person_with_headscarf_tone1",
+    "person_with_headscarf_tone2",
+    "person_with_headscarf_tone3",
+    "person_with_headscarf_tone4",
+    "person_with_headscarf_tone5",
+    "woman_in_steamy_room",
+    "woman_in_steamy_room_tone1",
+    "woman_in_steamy_room_tone2",
+    "woman_in_steamy_room_tone3",
+    "woman_in_steamy_room_tone4",
+    "woman_in_steamy_room_tone5",
+    "man_in_steamy_room",
+    "man_in_steamy_room_tone1",
+    "man_in_steamy_room_tone2",
+    "man_in_steamy_room_tone3",
+    "man_in_steamy_room_tone4",
+    "man_in_steamy_room_tone5",
+    "person_in_steamy_room",
+    "person_in_steamy_room_tone1",
+    "person_in_steamy_room_tone2",
+    "person_in_steamy_room_tone3",
+    "person_in_steamy_room_tone4",
+    "person_in_steamy_room_tone5",
+    "woman_climbing",
+    "woman_climbing_tone1",
+    "woman_climbing_tone2",
+    "woman_climbing_tone3",
+    "woman_climbing_tone4",
+    "woman_climbing_tone5",
+    "man_climbing",
+    "man_climbing_tone1",
+    "man_climbing_tone2",
+    "man_climbing_tone3",
+    "man_climbing_tone4",
+    "man_climbing_tone5",
+    "person_climbing",
+    "person_climbing_tone1",
+    "person_climbing_tone2",
+    "person_climbing_tone3",
+    "person_climbing_tone4",
+    "person_climbing_tone5",
+    "woman_in_lotus_position",
+    "woman_in_lotus_position_tone1",
+    "woman_in_lotus_position_tone2",
+    "woman_in_lotus_position_tone3",
+    "woman_in_lotus_position_tone4",
+    "woman_in_lotus_position_tone5",
+    "man_in_lotus_position",
+    "man_in_lotus_position_tone1",
+    "man_in_lotus_position_tone2",
+    "man_in_lotus_position_tone3",
+    "man_in_lotus_position_tone4",
+    "man_in_lotus_position_tone5",
+    "person_in_lotus_position",
+    "person_in_lotus_position_tone1",
+    "person_in_lotus_position_tone2",
+    "person_in_lotus_position_tone3",
+    "person_in_lotus_position_tone4",
+    "person_in_lotus_position_tone5",
+    "female_mage",
+    "female_mage_tone1",
+    "female_mage_tone2",
+    "female_mage_tone3",
+    "female_mage_tone4",
+    "female_mage_tone5",
+    "male_mage",
+    "male_mage_tone1",
+    "male_mage_tone2",
+    "male_mage_tone3",
+    "male_mage_tone4",
+    "male_mage_tone5",
+    "mage",
+    "mage_tone1",
+    "mage_tone2",
+    "mage_tone3",
+    "mage_tone4",
+    "mage_tone5",
+    "female_fairy",
+    "female_fairy_tone1",
+    "female_fairy_tone2",
+    "female_fairy_tone3",
+    "female_fairy_tone4",
+    "female_fairy_tone5",
+    "male_fairy",
+    "male_fairy_tone1",
+    "male_fairy_tone2",
+    "male_fairy_tone3",
+    "male_fairy_tone4",
+    "male_fairy_tone5",
+    "fairy",
+    "fairy_tone1",
+    "fairy_tone2",
+    "fairy_tone3",
+    "fairy_tone4",
+    "fairy_tone5",
+    "female_vampire",
+    "female_vampire_tone1",
+    "female_vampire_tone2",
+    "female_vampire_tone3",
+    "female_vampire_tone4",
+    "female_vampire_tone5",
+    "male_vampire",
+    "male_vampire_tone1",
+    "male_vampire_tone2",
+    "male_vampire_tone3",
+    "male_vampire_tone4",
+    "male_vampire_tone5",
+    "vampire",
+    "vampire_tone1",
+    "vampire_tone2",
+    "vampire_tone3",
+    "vampire_tone4",
+    "vampire_tone5",
+    "mermaid",
+    "mermaid_tone1",
+    "mermaid_tone2",
+    "mermaid_tone3",
+    "mermaid_tone4",
+    "mermaid_tone5",
+    "merman",
+    "merman_tone1",
+    "merman_tone2",
+    "merman_tone3",
+    "merman_tone4",
+    "merman_tone5",
+    "merperson",
+    "merperson_tone1",
+    "merperson_tone2",
+    "merperson_tone3",
+    "merperson_tone4",
+    "merperson_tone5",
+    "female_elf",
+    "female_elf_tone1",
+    "female_elf_tone2",
+    "female_elf_tone3",
+    "female_elf_tone4",
+    "female_elf_tone5",
+    "male_elf",
+    "male_elf_tone1",
+    "male_elf_tone2",
+    "male_elf_tone3",
+    "male_elf_tone4",
+    "male_elf_tone5",
+    "elf",
+    "elf_tone1",
+    "elf_tone2",
+    "elf_tone3",
+    "elf_tone4",
+    "elf_tone5",
+    "female_genie",
+    "male_genie",
+    "genie",
+    "female_zombie",
+    "male_zombie",
+    "zombie",
+    "brain",
+    "orange_heart",
+    "billed_cap",
+    "scarf",
+    "gloves",
+    "coat",
+    "socks",
+    "red_envelope",
+    "firecracker",
+    "jigsaw",
+    "test_tube",
+    "petri_dish",
+    "dna",
+    "compass",
+    "abacus",
+    "fire_extinguisher",
+    "toolbox",
+    "bricks",
+    "magnet",
+    "luggage",
+    "lotion_bottle",
+    "thread",
+    "yarn",
+    "safety_pin",
+    "teddy_bear",
+    "broom",
+    "basket",
+    "roll_of_paper",
+    "soap",
+    "sponge",
+    "receipt",
+    "nazar_amulet",
+    "ballet_shoes",
+    "one-piece_swimsuit",
+    "briefs",
+    "shorts",
+    "thong_sandal",
+    "drop_of_blood",
+    "adhesive_bandage",
+    "stethoscope",
+    "yo-yo",
+    "kite",
+    "parachute",
+    "boomerang",
+    "magic_wand",
+    "pinata",
+    "nesting_dolls",
+    "ringed_planet",
+    "chair",
+    "razor",
+    "axe",
+    "diya_lamp",
+    "banjo",
+    "military_helmet",
+    "accordion",
+    "long_drum",
+    "coin",
+    "carpentry_saw",
+    "screwdriver",
+    "ladder",
+    "hook",
+    "mirror",
+    "window",
+    "plunger",
+    "sewing_needle",
+    "knot",
+    "bucket",
+    "mouse_trap",
+    "toothbrush",
+    "headstone",
+    "placard",
+    "rock",
+    "fly",
+    "worm",
+    "beetle",
+    "cockroach",
+    "potted_plant",
+    "wood",
+    "feather",
+    "anatomical_heart",
+    "lungs",
+    "people_hugging",
+    "blueberries",
+    "bell_pepper",
+    "olive",
+    "flatbread",
+    "tamale",
+    "fondue",
+    "teapot",
+    "bangbang",
+    "interrobang",
+    "tm",
+    "information_source",
+    "left_right_arrow",
+    "arrow_up_down",
+    "arrow_upper_left",
+    "arrow_upper_right",
+    "arrow_lower_right",
+    "arrow_lower_left",
+    "leftwards_arrow_with_hook",
+    "arrow_right_hook",
+    "watch",
+    "hourglass",
+    "keyboard",
+    "eject",
+    "fast_forward",
+    "rewind",
+    "arrow_double_up",
+    "arrow_double_down",
+    "black_right_pointing_double_triangle_with_vertical_bar",
+    "black_left_pointing_double_triangle_with_vertical_bar",
+    "black_right_pointing_triangle_with_double_vertical_bar",
+    "alarm_clock",
+    "stopwatch",
+    "timer_clock",
+    "hourglass_flowing_sand",
+    "double_vertical_bar",
+    "black_square_for_stop",
+    "black_circle_for_record",
+    "m",
+    "black_small_square",
+    "white_small_square",
+    "arrow_forward",
+    "arrow_backward",
+    "white_medium_square",
+    "black_medium_square",
+    "white_medium_small_square",
+    "black_medium_small_square",
+    "sunny",
+    "cloud",
+    "umbrella",
+    "snowman",
+    "comet",
+    "phone",
+    "telephone",
+    "ballot_box_with_check",
+    "umbrella_with_rain_drops",
+    "coffee",
+    "shamrock",
+    "point_up",
+    "point_up_tone1",
+    "point_up_tone2",
+    "point_up_tone3",
+    "point_up_tone4",
+    "point_up_tone5",
+    "skull_and_crossbones",
+    "radioactive_sign",
+    "biohazard_sign",
+    "orthodox_cross",
+    "star_and_crescent",
+    "peace_symbol",
+    "yin_yang",
+    "wheel_of_dharma",
+    "white_frowning_face",
+    "relaxed",
+    "female_sign",
+    "male_sign",
+    "aries",
+    "taurus",
+    "gemini",
+    "cancer",
+    "leo",
+    "virgo",
+    "libra",
+    "scorpius",
+    "sagittarius",
+    "capricorn",
+    "aquarius",
+    "pisces",
+    "chess_pawn",
+    "spades",
+    "clubs",
+    "hearts",
+    "diamonds",
+    "hotsprings",
+    "recycle",
+    "infinity",
+    "wheelchair",
+    "hammer_and_pick",
+    "anchor",
+    "crossed_swords",
+    "medical_symbol",
+    "staff_of_aesculapius",
+    "scales",
+    "alembic",
+    "gear",
+    "atom_symbol",
+    "fleur_de_lis",
+    "warning",
+    "zap",
+    "transgender_symbol",
+    "white_circle",
+    "black_circle",
+    "coffin",
+    "funeral_urn",
+    "soccer",
+    "baseball",
+    "snowman_without_snow",
+    "partly_sunny",
+    "thunder_cloud_and_rain",
+    "ophiuchus",
+    "pick",
+    "helmet_with_white_cross",
+    "chains",
+    "no_entry",
+    "shinto_shrine",
+    "church",
+    "mountain",
+    "umbrella_on_ground",
+    "fountain",
+    "golf",
+    "ferry",
+    "boat",
+    "sailboat",
+    "skier",
+    "ice_skate",
+    "woman-bouncing-ball",
+    "woman-bouncing-ball_tone1",
+    "woman-bouncing-ball_tone2",
+    "woman-bouncing-ball_tone3",
+    "woman-bouncing-ball_tone4",
+    "woman-bouncing-ball_tone5",
+    "man-bouncing-ball",
+    "man-bouncing-ball_tone1",
+    "man-bouncing-ball_tone2",
+    "man-bouncing-ball_tone3",
+    "man-bouncing-ball_tone4",
+    "man-bouncing-ball_tone5",
+    "person_with_ball",
+    "person_with_ball_tone1",
+    "person_with_ball_tone2",
+    "person_with_ball_tone3",
+    "person_with_ball_tone4",
+    "person_with_ball_tone5",
+    "tent",
+    "fuelpump",
+    "scissors",
+    "white_check_mark",
+    "airplane",
+    "email",
+    "envelope",
+    "fist",
+    "fist_tone1",
+    "fist_tone2",
+    "fist_tone3",
+    "fist_tone4",
+    "fist_tone5",
+    "hand",
+    "raised_hand",
+    "hand_tone1",
+    "hand_tone2",
+    "hand_tone3",
+    "hand_tone4",
+    "hand_tone5",
+    "v",
+    "v_tone1",
+    "v_tone2",
+    "v_tone3",
+    "v_tone4",
+    "v_tone5",
+    "writing_hand",
+    "writing_hand_tone1",
+    "writing_hand_tone2",
+    "writing_hand_tone3",
+    "writing_hand_tone4",
+    "writing_hand_tone5",
+    "pencil2",
+    "black_nib",
+    "heavy_check_mark",
+    "heavy_multiplication_x",
+    "latin_cross",
+    "star_of_david",
+    "sparkles",
+    "eight_spoked_asterisk",
+    "eight_pointed_black_star",
+    "snowflake",
+    "sparkle",
+    "x",
+    "negative_squared_cross_mark",
+    "question",
+    "grey_question",
+    "grey_exclamation",
+    "exclamation",
+    "heavy_exclamation_mark",
+    "heavy_heart_exclamation_mark_ornament",
+    "heart_on_fire",
+    "mending_heart",
+    "heart",
+    "heavy_plus_sign",
+    "heavy_minus_sign",
+    "heavy_division_sign",
+    "arrow_right",
+    "curly_loop",
+    "loop",
+    "arrow_heading_up",
+    "arrow_heading_down",
+    "arrow_left",
+    "arrow_up",
+    "arrow_down",
+    "black_large_square",
+    "white_large_square",
+    "star",
+    "o",
+    "wavy_dash",
+    "part_alternation_mark",
+    "congratulations",
+    "secret",
+};
+
+const EmojiTableEntry emojiTable[] = {
+    {"0023-FE0F-20E3", "0023-20E3", 0, 2, 7, 0, 1},
+    {"002A-FE0F-20E3", "002A-20E3", 2, 2, 7, 1, 1},
+    {"0030-FE0F-20E3", "0030-20E3", 4, 2, 7, 2, 1},
+    {"0031-FE0F-20E3", "0031-20E3", 6, 2, 7, 3, 1},
+    {"0032-FE0F-20E3", "0032-20E3", 8, 2, 7, 4, 1},
+    {"0033-FE0F-20E3", "0033-20E3", 10, 2, 7, 5, 1},
+    {"0034-FE0F-20E3", "0034-20E3", 12, 2, 7, 6, 1},
+    {"0035-FE0F-20E3", "0035-20E3", 14, 2, 7, 7, 1},
+    {"0036-FE0F-20E3", "0036-20E3", 16, 2, 7, 8, 1},
+    {"0037-FE0F-20E3", "0037-20E3", 18, 2, 7, 9, 1},
+    {"0038-FE0F-20E3", "0038-20E3", 20, 2, 7, 10, 1},
+    {"0039-FE0F-20E3", "0039-20E3", 22, 2, 7, 11, 1},
+    {"00A9-FE0F", "00A9", 24, 1, 7, 12, 1},
+    {"00AE-FE0F", "00AE", 25, 1, 7, 13, 1},
+    {"1F004", nullptr, 26, 1, 15, 14, 1},
+    {"1F0CF", nullptr, 27, 1, 15, 15, 1},
+    {"1F170-FE0F", "1F170", 28, 1, 15, 16, 1},
+    {"1F171-FE0F", "1F171", 29, 1, 15, 17, 1},
+    {"1F17E-FE0F", "1F17E", 30, 1, 15, 18, 1},
+    {"1F17F-FE0F", "1F17F", 31, 1, 15, 19, 1},
+    {"1F18E", nullptr, 32, 1, 15, 20, 1},
+    {"1F191", nullptr, 33, 1, 15, 21, 1},
+    {"1F192", nullptr, 34, 1, 15, 22, 1},
+    {"1F193", nullptr, 35, 1, 15, 23, 1},
+    {"1F194", nullptr, 36, 1, 15, 24, 1},
+    {"1F195", nullptr, 37, 1, 15, 25, 1},
+    {"1F196", nullptr, 38, 1, 15, 26, 1},
+    {"1F197", nullptr, 39, 1, 15, 27, 1},
+    {"1F198", nullptr, 40, 1, 15, 28, 1},
+    {"1F199", nullptr, 41, 1, 15, 29, 1},
+    {"1F19A", nullptr, 42, 1, 15, 30, 1},
+    {"1F1E6-1F1E8", nullptr, 43, 2, 15, 31, 1},
+    {"1F1E6-1F1E9", nullptr, 45, 2, 15, 32, 1},
+    {"1F1E6-1F1EA", nullptr, 47, 2, 15, 33, 1},
+    {"1F1E6-1F1EB", nullptr, 49, 2, 15, 34, 1},
+    {"1F1E6-1F1EC", nullptr, 51, 2, 15, 35, 1},
+    {"1F1E6-1F1EE", nullptr, 53, 2, 15, 36, 1},
+    {"1F1E6-1F1F1", nullptr, 55, 2, 15, 37, 1},
+    {"1F1E6-1F1F2", nullptr, 57, 2, 15, 38, 1},
+    {"1F1E6-1F1F4", nullptr, 59, 2, 15, 39, 1},
+    {"1F1E6-1F1F6", nullptr, 61, 2, 15, 40, 1},
+    {"1F1E6-1F1F7", nullptr, 63, 2, 15, 41, 1},
+    {"1F1E6-1F1F8", nullptr, 65, 2, 15, 42, 1},
+    {"1F1E6-1F1F9", nullptr, 67, 2, 15, 43, 1},
+    {"1F1E6-1F1FA", nullptr, 69, 2, 15, 44, 1},
+    {"1F1E6-1F1FC", nullptr, 71, 2, 15, 45, 1},
+    {"1F1E6-1F1FD", nullptr, 73, 2, 15, 46, 1},
+    {"1F1E6-1F1FF", nullptr, 75, 2, 15, 47, 1},
+    {"1F1E7-1F1E6", nullptr, 77, 2, 15, 48, 1},
+    {"1F1E7-1F1E7", nullptr, 79, 2, 15, 49, 1},
+    {"1F1E7-1F1E9", nullptr, 81, 2, 15, 50, 1},
+    {"1F1E7-1F1EA", nullptr, 83, 2, 15, 51, 1},
+    {"1F1E7-1F1EB", nullptr, 85, 2, 15, 52, 1},
+    {"1F1E7-1F1EC", nullptr, 87, 2, 15, 53, 1},
+    {"1F1E7-1F1ED", nullptr, 89, 2, 15, 54, 1},
+    {"1F1E7-1F1EE", nullptr, 91, 2, 15, 55, 1},
+    {"1F1E7-1F1EF", nullptr, 93, 2, 15, 56, 1},
+    {"1F1E7-1F1F1", nullptr, 95, 2, 15, 57, 1},
+    {"1F1E7-1F1F2", nullptr, 97, 2, 15, 58, 1},
+    {"1F1E7-1F1F3", nullptr, 99, 2, 15, 59, 1},
+    {"1F1E7-1F1F4", nullptr, 101, 2, 15, 60, 1},
+    {"1F1E7-1F1F6", nullptr, 103, 2, 15, 61, 1},
+    {"1F1E7-1F1F7", nullptr, 105, 2, 15, 62, 1},
+    {"1F1E7-1F1F8", nullptr, 107, 2, 15, 63, 1},
+    {"1F1E7-1F1F9", nullptr, 109, 2, 15, 64, 1},
+    {"1F1E7-1F1FB", nullptr, 111, 2, 15, 65, 1},
+    {"1F1E7-1F1FC", nullptr, 113, 2, 15, 66, 1},
+    {"1F1E7-1F1FE", nullptr, 115, 2, 15, 67, 1},
+    {"1F1E7-1F1FF", nullptr, 117, 2, 15, 68, 1},
+    {"1F1E8-1F1E6", nullptr, 119, 2, 15, 69, 1},
+    {"1F1E8-1F1E8", nullptr, 121, 2, 15, 70, 1},
+    {"1F1E8-1F1E9", nullptr, 123, 2, 15, 71, 1},
+    {"1F1E8-1F1EB", nullptr, 125, 2, 15, 72, 1},
+    {"1F1E8-1F1EC", nullptr, 127, 2, 15, 73, 1},
+    {"1F1E8-1F1ED", nullptr, 129, 2, 15, 74, 1},
+    {"1F1E8-1F1EE", nullptr, 131, 2, 15, 75, 1},
+    {"1F1E8-1F1F0", nullptr, 133, 2, 15, 76, 1},
+    {"1F1E8-1F1F1", nullptr, 135, 2, 15, 77, 1},
+    {"1F1E8-1F1F2", nullptr, 137, 2, 15, 78, 1},
+    {"1F1E8-1F1F3", nullptr, 139, 2, 15, 79, 2},
+    {"1F1E8-1F1F4", nullptr, 141, 2, 15, 81, 1},
+    {"1F1E8-1F1F5", nullptr, 143, 2, 15, 82, 1},
+    {"1F1E8-1F1F7", nullptr, 145, 2, 15, 83, 1},
+    {"1F1E8-1F1FA", nullptr, 147, 2, 15, 84, 1},
+    {"1F1E8-1F1FB", nullptr, 149, 2, 15, 85, 1},
+    {"1F1E8-1F1FC", nullptr, 151, 2, 15, 86, 1},
+    {"1F1E8-1F1FD", nullptr, 153, 2, 15, 87, 1},
+    {"1F1E8-1F1FE", nullptr, 155, 2, 15, 88, 1},
+    {"1F1E8-1F1FF", nullptr, 157, 2, 15, 89, 1},
+    {"1F1E9-1F1EA", nullptr, 159, 2, 15, 90, 2},
+    {"1F1E9-1F1EC", nullptr, 161, 2, 15, 92, 1},
+    {"1F1E9-1F1EF", nullptr, 163, 2, 15, 93, 1},
+    {"1F1E9-1F1F0", nullptr, 165, 2, 15, 94, 1},
+    {"1F1E9-1F1F2", nullptr, 167, 2, 15, 95, 1},
+    {"1F1E9-1F1F4", nullptr, 169, 2, 15, 96, 1},
+    {"1F1E9-1F1FF", nullptr, 171, 2, 15, 97, 1},
+    {"1F1EA-1F1E6", nullptr, 173, 2, 15, 98, 1},
+    {"1F1EA-1F1E8", nullptr, 175, 2, 15, 99, 1},
+    {"1F1EA-1F1EA", nullptr, 177, 2, 15, 100, 1},
+    {"1F1EA-1F1EC", nullptr, 179, 2, 15, 101, 1},
+    {"1F1EA-1F1ED", nullptr, 181, 2, 15, 102, 1},
+    {"1F1EA-1F1F7", nullptr, 183, 2, 15, 103, 1},
+    {"1F1EA-1F1F8", nullptr, 185, 2, 15, 104, 2},
+    {"1F1EA-1F1F9", nullptr, 187, 2, 15, 106, 1},
+    {"1F1EA-1F1FA", nullptr, 189, 2, 15, 107, 1},
+    {"1F1EB-1F1EE", nullptr, 191, 2, 15, 108, 1},
+    {"1F1EB-1F1EF", nullptr, 193, 2, 15, 109, 1},
+    {"1F1EB-1F1F0", nullptr, 195, 2, 15, 110, 1},
+    {"1F1EB-1F1F2", nullptr, 197, 2, 15, 111, 1},
+    {"1F1EB-1F1F4", nullptr, 199, 2, 15, 112, 1},
+    {"1F1EB-1F1F7", nullptr, 201, 2, 15, 113, 2},
+    {"1F1EC-1F1E6", nullptr, 203, 2, 15, 115, 1},
+    {"1F1EC-1F1E7", nullptr, 205, 2, 15, 116, 3},
+    {"1F1EC-1F1E9", nullptr, 207, 2, 15, 119, 1},
+    {"1F1EC-1F1EA", nullptr, 209, 2, 15, 120, 1},
+    {"1F1EC-1F1EB", nullptr, 211, 2, 15, 121, 1},
+    {"1F1EC-1F1EC", nullptr, 213, 2, 15, 122, 1},
+    {"1F1EC-1F1ED", nullptr, 215, 2, 15, 123, 1},
+    {"1F1EC-1F1EE", nullptr, 217, 2, 15, 124, 1},
+    {"1F1EC-1F1F1", nullptr, 219, 2, 15, 125, 1},
+    {"1F1EC-1F1F2", nullptr, 221, 2, 15, 126, 1},
+    {"1F1EC-1F1F3", nullptr, 223, 2, 15, 127, 1},
+    {"1F1EC-1F1F5", nullptr, 225, 2, 15, 128, 1},
+    {"1F1EC-1F1F6", nullptr, 227, 2, 15, 129, 1},
+    {"1F1EC-1F1F7", nullptr, 229, 2, 15, 130, 1},
+    {"1F1EC-1F1F8", nullptr, 231, 2, 15, 131, 1},
+    {"1F1EC-1F1F9", nullptr, 233, 2, 15, 132, 1},
+    {"1F1EC-1F1FA", nullptr, 235, 2, 15, 133, 1},
+    {"1F1EC-1F1FC", nullptr, 237, 2, 15, 134, 1},
+    {"1F1EC-1F1FE", nullptr, 239, 2, 15, 135, 1},
+    {"1F1ED-1F1F0", nullptr, 241, 2, 15, 136, 1},
+    {"1F1ED-1F1F2", nullptr, 243, 2, 15, 137, 1},
+    {"1F1ED-1F1F3", nullptr, 245, 2, 15, 138, 1},
+    {"1F1ED-1F1F7", nullptr, 247, 2, 15, 139, 1},
+    {"1F1ED-1F1F9", nullptr, 249, 2, 15, 140, 1},
+    {"1F1ED-1F1FA", nullptr, 251, 2, 15, 141, 1},
+    {"1F1EE-1F1E8", nullptr, 253, 2, 15, 142, 1},
+    {"1F1EE-1F1E9", nullptr, 255, 2, 15, 143, 1},
+    {"1F1EE-1F1EA", nullptr, 257, 2, 15, 144, 1},
+    {"1F1EE-1F1F1", nullptr, 259, 2, 15, 145, 1},
+    {"1F1EE-1F1F2", nullptr, 261, 2, 15, 146, 1},
+    {"1F1EE-1F1F3", nullptr, 263, 2, 15, 147, 1},
+    {"1F1EE-1F1F4", nullptr, 265, 2, 15, 148, 1},
+    {"1F1EE-1F1F6", nullptr, 267, 2, 15, 149, 1},
+    {"1F1EE-1F1F7", nullptr, 269, 2, 15, 150, 1},
+    {"1F1EE-1F1F8", nullptr, 271, 2, 15, 151, 1},
+    {"1F1EE-1F1F9", nullptr, 273, 2, 15, 152, 2},
+    {"1F1EF-1F1EA", nullptr, 275, 2, 15, 154, 1},
+    {"1F1EF-1F1F2", nullptr, 277, 2, 15, 155, 1},
+    {"1F1EF-1F1F4", nullptr, 279, 2, 15, 156, 1},
+    {"1F1EF-1F1F5", nullptr, 281, 2, 15, 157, 2},
+    {"1F1F0-1F1EA", nullptr, 283, 2, 15, 159, 1},
+    {"1F1F0-1F1EC", nullptr, 285, 2, 15, 160, 1},
+    {"1F1F0-1F1ED", nullptr, 287, 2, 15, 161, 1},
+    {"1F1F0-1F1EE", nullptr, 289, 2, 15, 162, 1},
+    {"1F1F0-1F1F2", nullptr, 291, 2, 15, 163, 1},
+    {"1F1F0-1F1F3", nullptr, 293, 2, 15, 164, 1},
+    {"1F1F0-1F1F5", nullptr, 295, 2, 15, 165, 1},
+    {"1F1F0-1F1F7", nullptr, 297, 2, 15, 166, 2},
+    {"1F1F0-1F1FC", nullptr, 299, 2, 15, 168, 1},
+    {"1F1F0-1F1FE", nullptr, 301, 2, 15, 169, 1},
+    {"1F1F0-1F1FF", nullptr, 303, 2, 15, 170, 1},
+    {"1F1F1-1F1E6", nullptr, 305, 2, 15, 171, 1},
+    {"1F1F1-1F1E7", nullptr, 307, 2, 15, 172, 1},
+    {"1F1F1-1F1E8", nullptr, 309, 2, 15, 173, 1},
+    {"1F1F1-1F1EE", nullptr, 311, 2, 15, 174, 1},
+    {"1F1F1-1F1F0", nullptr, 313, 2, 15, 175, 1},
+    {"1F1F1-1F1F7", nullptr, 315, 2, 15, 176, 1},
+    {"1F1F1-1F1F8", nullptr, 317, 2, 15, 177, 1},
+    {"1F1F1-1F1F9", nullptr, 319, 2, 15, 178, 1},
+    {"1F1F1-1F1FA", nullptr, 321, 2, 15, 179, 1},
+    {"1F1F1-1F1FB", nullptr, 323, 2, 15, 180, 1},
+    {"1F1F1-1F1FE", nullptr, 325, 2, 15, 181, 1},
+    {"1F1F2-1F1E6", nullptr, 327, 2, 15, 182, 1},
+    {"1F1F2-1F1E8", nullptr, 329, 2, 15, 183, 1},
+    {"1F1F2-1F1E9", nullptr, 331, 2, 15, 184, 1},
+    {"1F1F2-1F1EA", nullptr, 333, 2, 15, 185, 1},
+    {"1F1F2-1F1EB", nullptr, 335, 2, 15, 186, 1},
+    {"1F1F2-1F1EC", nullptr, 337, 2, 15, 187, 1},
+    {"1F1F2-1F1ED", nullptr, 339, 2, 15, 188, 1},
+    {"1F1F2-1F1F0", nullptr, 341, 2, 15, 189, 1},
+    {"1F1F2-1F1F1", nullptr, 343, 2, 15, 190, 1},
+    {"1F1F2-1F1F2", nullptr, 345, 2, 15, 191, 1},
+    {"1F1F2-1F1F3", nullptr, 347, 2, 15, 192, 1},
+    {"1F1F2-1F1F4", nullptr, 349, 2, 15, 193, 1},
+    {"1F1F2-1F1F5", nullptr, 351, 2, 15, 194, 1},
+    {"1F1F2-1F1F6", nullptr, 353, 2, 15, 195, 1},
+    {"1F1F2-1F1F7", nullptr, 355, 2, 15, 196, 1},
+    {"1F1F2-1F1F8", nullptr, 357, 2, 15, 197, 1},
+    {"1F1F2-1F1F9", nullptr, 359, 2, 15, 198, 1},
+    {"1F1F2-1F1FA", nullptr, 361, 2, 15, 199, 1},
+    {"1F1F2-1F1FB", nullptr, 363, 2, 15, 200, 1},
+    {"1F1F2-1F1FC", nullptr, 365, 2, 15, 201, 1},
+    {"1F1F2-1F1FD", nullptr, 367, 2, 15, 202, 1},
+    {"1F1F2-1F1FE", nullptr, 369, 2, 15, 203, 1},
+    {"1F1F2-1F1FF", nullptr, 371, 2, 15, 204, 1},
+    {"1F1F3-1F1E6", nullptr, 373, 2, 15, 205, 1},
+    {"1F1F3-1F1E8", nullptr, 375, 2, 15, 206, 1},
+    {"1F1F3-1F1EA", nullptr, 377, 2, 15, 207, 1},
+    {"1F1F3-1F1EB", nullptr, 379, 2, 15, 208, 1},
+    {"1F1F3-1F1EC", nullptr, 381, 2, 15, 209, 1},
+    {"1F1F3-1F1EE", nullptr, 383, 2, 15, 210, 1},
+    {"1F1F3-1F1F1", nullptr, 385, 2, 15, 211, 1},
+    {"1F1F3-1F1F4", nullptr, 387, 2, 15, 212, 1},
+    {"1F1F3-1F1F5", nullptr, 389, 2, 15, 213, 1},
+    {"1F1F3-1F1F7", nullptr, 391, 2, 15, 214, 1},
+    {"1F1F3-1F1FA", nullptr, 393, 2, 15, 215, 1},
+    {"1F1F3-1F1FF", nullptr, 395, 2, 15, 216, 1},
+    {"1F1F4-1F1F2", nullptr, 397, 2, 15, 217, 1},
+    {"1F1F5-1F1E6", nullptr, 399, 2, 15, 218, 1},
+    {"1F1F5-1F1EA", nullptr, 401, 2, 15, 219, 1},
+    {"1F1F5-1F1EB", nullptr, 403, 2, 15, 220, 1},
+    {"1F1F5-1F1EC", nullptr, 405, 2, 15, 221, 1},
+    {"1F1F5-1F1ED", nullptr, 407, 2, 15, 222, 1},
+    {"1F1F5-1F1F0", nullptr, 409, 2, 15, 223, 1},
+    {"1F1F5-1F1F1", nullptr, 411, 2, 15, 224, 1},
+    {"1F1F5-1F1F2", nullptr, 413, 2, 15, 225, 1},
+    {"1F1F5-1F1F3", nullptr, 415, 2, 15, 226, 1},
+    {"1F1F5-1F1F7", nullptr, 417, 2, 15, 227, 1},
+    {"1F1F5-1F1F8", nullptr, 419, 2, 15, 228, 1},
+    {"1F1F5-1F1F9", nullptr, 421, 2, 15, 229, 1},
+    {"1F1F5-1F1FC", nullptr, 423, 2, 15, 230, 1},
+    {"1F1F5-1F1FE", nullptr, 425, 2, 15, 231, 1},
+    {"1F1F6-1F1E6", nullptr, 427, 2, 15, 232, 1},
+    {"1F1F7-1F1EA", nullptr, 429, 2, 15, 233, 1},
+    {"1F1F7-1F1F4", nullptr, 431, 2, 15, 234, 1},
+    {"1F1F7-1F1F8", nullptr, 433, 2, 15, 235, 1},
+    {"1F1F7-1F1FA", nullptr, 435, 2, 15, 236, 2},
+    {"1F1F7-1F1FC", nullptr, 437, 2, 15, 238, 1},
+    {"1F1F8-1F1E6", nullptr, 439, 2, 15, 239, 1},
+    {"1F1F8-1F1E7", nullptr, 441, 2, 15, 240, 1},
+    {"1F1F8-1F1E8", nullptr, 443, 2, 15, 241, 1},
+    {"1F1F8-1F1E9", nullptr, 445, 2, 15, 242, 1},
+    {"1F1F8-1F1EA", nullptr, 447, 2, 15, 243, 1},
+    {"1F1F8-1F1EC", nullptr, 449, 2, 15, 244, 1},
+    {"1F1F8-1F1ED", nullptr, 451, 2, 15, 245, 1},
+    {"1F1F8-1F1EE", nullptr, 453, 2, 15, 246, 1},
+    {"1F1F8-1F1EF", nullptr, 455, 2, 15, 247, 1},
+    {"1F1F8-1F1F0", nullptr, 457, 2, 15, 248, 1},
+    {"1F1F8-1F1F1", nullptr, 459, 2, 15, 249, 1},
+    {"1F1F8-1F1F2", nullptr, 461, 2, 15, 250, 1},
+    {"1F1F8-1F1F3", nullptr, 463, 2, 15, 251, 1},
+    {"1F1F8-1F1F4", nullptr, 465, 2, 15, 252, 1},
+    {"1F1F8-1F1F7", nullptr, 467, 2, 15, 253, 1},
+    {"1F1F8-1F1F8", nullptr, 469, 2, 15, 254, 1},
+    {"1F1F8-1F1F9", nullptr, 471, 2, 15, 255, 1},
+    {"1F1F8-1F1FB", nullptr, 473, 2, 15, 256, 1},
+    {"1F1F8-1F1FD", nullptr, 475, 2, 15, 257, 1},
+    {"1F1F8-1F1FE", nullptr, 477, 2, 15, 258, 1},
+    {"1F1F8-1F1FF", nullptr, 479, 2, 15, 259, 1},
+    {"1F1F9-1F1E6", nullptr, 481, 2, 15, 260, 1},
+    {"1F1F9-1F1E8", nullptr, 483, 2, 15, 261, 1},
+    {"1F1F9-1F1E9", nullptr, 485, 2, 15, 262, 1},
+    {"1F1F9-1F1EB", nullptr, 487, 2, 15, 263, 1},
+    {"1F1F9-1F1EC", nullptr, 489, 2, 15, 264, 1},
+    {"1F1F9-1F1ED", nullptr, 491, 2, 15, 265, 1},
+    {"1F1F9-1F1EF", nullptr, 493, 2, 15, 266, 1},
+    {"1F1F9-1F1F0", nullptr, 495, 2, 15, 267, 1},
+    {"1F1F9-1F1F1", nullptr, 497, 2, 15, 268, 1},
+    {"1F1F9-1F1F2", nullptr, 499, 2, 15, 269, 1},
+    {"1F1F9-1F1F3", nullptr, 501, 2, 15, 270, 1},
+    {"1F1F9-1F1F4", nullptr, 503, 2, 15, 271, 1},
+    {"1F1F9-1F1F7", nullptr, 505, 2, 15, 272, 1},
+    {"1F1F9-1F1F9", nullptr, 507, 2, 15, 273, 1},
+    {"1F1F9-1F1FB", nullptr, 509, 2, 15, 274, 1},
+    {"1F1F9-1F1FC", nullptr, 511, 2, 15, 275, 1},
+    {"1F1F9-1F1FF", nullptr, 513, 2, 15, 276, 1},
+    {"1F1FA-1F1E6", nullptr, 515, 2, 15, 277, 1},
+    {"1F1FA-1F1EC", nullptr, 517, 2, 15, 278, 1},
+    {"1F1FA-1F1F2", nullptr, 519, 2, 15, 279, 1},
+    {"1F1FA-1F1F3", nullptr, 521, 2, 15, 280, 1},
+    {"1F1FA-1F1F8", nullptr, 523, 2, 15, 281, 2},
+    {"1F1FA-1F1FE", nullptr, 525, 2, 15, 283, 1},
+    {"1F1FA-1F1FF", nullptr, 527, 2, 15, 284, 1},
+    {"1F1FB-1F1E6", nullptr, 529, 2, 15, 285, 1},
+    {"1F1FB-1F1E8", nullptr, 531, 2, 15, 286, 1},
+    {"1F1FB-1F1EA", nullptr, 533, 2, 15, 287, 1},
+    {"1F1FB-1F1EC", nullptr, 535, 2, 15, 288, 1},
+    {"1F1FB-1F1EE", nullptr, 537, 2, 15, 289, 1},
+    {"1F1FB-1F1F3", nullptr, 539, 2, 15, 290, 1},
+    {"1F1FB-1F1FA", nullptr, 541, 2, 15, 291, 1},
+    {"1F1FC-1F1EB", nullptr, 543, 2, 15, 292, 1},
+    {"1F1FC-1F1F8", nullptr, 545, 2, 15, 293, 1},
+    {"1F1FD-1F1F0", nullptr, 547, 2, 15, 294, 1},
+    {"1F1FE-1F1EA", nullptr, 549, 2, 15, 295, 1},
+    {"1F1FE-1F1F9", nullptr, 551, 2, 15, 296, 1},
+    {"1F1FF-1F1E6", nullptr, 553, 2, 15, 297, 1},
+    {"1F1FF-1F1F2", nullptr, 555, 2, 15, 298, 1},
+    {"1F1FF-1F1FC", nullptr, 557, 2, 15, 299, 1},
+    {"1F201", nullptr, 559, 1, 15, 300, 1},
+    {"1F202-FE0F", "1F202", 560, 1, 15, 301, 1},
+    {"1F21A", nullptr, 561, 1, 15, 302, 1},
+    {"1F22F", nullptr, 562, 1, 15, 303, 1},
+    {"1F232", nullptr, 563, 1, 15, 304, 1},
+    {"1F233", nullptr, 564, 1, 15, 305, 1},
+    {"1F234", nullptr, 565, 1, 15, 306, 1},
+    {"1F235", nullptr, 566, 1, 15, 307, 1},
+    {"1F236", nullptr, 567, 1, 15, 308, 1},
+    {"1F237-FE0F", "1F237", 568, 1, 15, 309, 1},
+    {"1F238", nullptr, 569, 1, 15, 310, 1},
+    {"1F239", nullptr, 570, 1, 15, 311, 1},
+    {"1F23A", nullptr, 571, 1, 15, 312, 1},
+    {"1F250", nullptr, 572, 1, 15, 313, 1},
+    {"1F251", nullptr, 573, 1, 15, 314, 1},
+    {"1F300", nullptr, 574, 1, 15, 315, 1},
+    {"1F301", nullptr, 575, 1, 15, 316, 1},
+    {"1F302", nullptr, 576, 1, 15, 317, 1},
+    {"1F303", nullptr, 577, 1, 15, 318, 1},
+    {"1F304", nullptr, 578, 1, 15, 319, 1},
+    {"1F305", nullptr, 579, 1, 15, 320, 1},
+    {"1F306", nullptr, 580, 1, 15, 321, 1},
+    {"1F307", nullptr, 581, 1, 15, 322, 1},
+    {"1F308", nullptr, 582, 1, 15, 323, 1},
+    {"1F309", nullptr, 583, 1, 15, 324, 1},
+    {"1F30A", nullptr, 584, 1, 15, 325, 1},
+    {"1F30B", nullptr, 585, 1, 15, 326, 1},
+    {"1F30C", nullptr, 586, 1, 15, 327, 1},
+    {"1F30D", nullptr, 587, 1, 15, 328, 1},
+    {"1F30E", nullptr, 588, 1, 15, 329, 1},
+    {"1F30F", nullptr, 589, 1, 15, 330, 1},
+    {"1F310", nullptr, 590, 1, 15, 331, 1},
+    {"1F311", nullptr, 591, 1, 15, 332, 1},
+    {"1F312", nullptr, 592, 1, 15, 333, 1},
+    {"1F313", nullptr, 593, 1, 15, 334, 1},
+    {"1F314", nullptr, 594, 1, 15, 335, 2},
+    {"1F315", nullptr, 595, 1, 15, 337, 1},
+    {"1F316", nullptr, 596, 1, 15, 338, 1},
+    {"1F317", nullptr, 597, 1, 15, 339, 1},
+    {"1F318", nullptr, 598, 1, 15, 340, 1},
+    {"1F319", nullptr, 599, 1, 15, 341, 1},
+    {"1F31A", nullptr, 600, 1, 15, 342, 1},
+    {"1F31B", nullptr, 601, 1, 15, 343, 1},
+    {"1F31C", nullptr, 602, 1, 15, 344, 1},
+    {"1F31D", nullptr, 603, 1, 15, 345, 1},
+    {"1F31E", nullptr, 604, 1, 15, 346, 1},
+    {"1F31F", nullptr, 605, 1, 15, 347, 1},
+    {"1F320", nullptr, 606, 1, 15, 348, 1},
+    {"1F321-FE0F", "1F321", 607, 1, 15, 349, 1},
+    {"1F324-FE0F", "1F324", 608, 1, 15, 350, 2},
+    {"1F325-FE0F", "1F325", 609, 1, 15, 352, 2},
+    {"1F326-FE0F", "1F326", 610, 1, 15, 354, 2},
+    {"1F327-FE0F", "1F327", 611, 1, 15, 356, 1},
+    {"1F328-FE0F", "1F328", 612, 1, 15, 357, 1},
+    {"1F329-FE0F", "1F329", 613, 1, 15, 358, 2},
+    {"1F32A-FE0F", "1F32A", 614, 1, 15, 360, 2},
+    {"1F32B-FE0F", "1F32B", 615, 1, 15, 362, 1},
+    {"1F32C-FE0F", "1F32C", 616, 1, 15, 363, 1},
+    {"1F32D", nullptr, 617, 1, 15, 364, 1},
+    {"1F32E", nullptr, 618, 1, 15, 365, 1},
+    {"1F32F", nullptr, 619, 1, 15, 366, 1},
+    {"1F330", nullptr, 620, 1, 15, 367, 1},
+    {"1F331", nullptr, 621, 1, 15, 368, 1},
+    {"1F332", nullptr, 622, 1, 15, 369, 1},
+    {"1F333", nullptr, 623, 1, 15, 370, 1},
+    {"1F334", nullptr, 624, 1, 15, 371, 1},
+    {"1F335", nullptr, 625, 1, 15, 372, 1},
+    {"1F336-FE0F", "1F336", 626, 1, 15, 373, 1},
+    {"1F337", nullptr, 627, 1, 15, 374, 1},
+    {"1F338", nullptr, 628, 1, 15, 375, 1},
+    {"1F339", nullptr, 629, 1, 15, 376, 1},
+    {"1F33A", nullptr, 630, 1, 15, 377, 1},
+    {"1F33B", nullptr, 631, 1, 15, 378, 1},
+    {"1F33C", nullptr, 632, 1, 15, 379, 1},
+    {"1F33D", nullptr, 633, 1, 15, 380, 1},
+    {"1F33E", nullptr, 634, 1, 15, 381, 1},
+    {"1F33F", nullptr, 635, 1, 15, 382, 1},
+    {"1F340", nullptr, 636, 1, 15, 383, 1},
+    {"1F341", nullptr, 637, 1, 15, 384, 1},
+    {"1F342", nullptr, 638, 1, 15, 385, 1},
+    {"1F343", nullptr, 639, 1, 15, 386, 1},
+    {"1F344", nullptr, 640, 1, 15, 387, 1},
+    {"1F345", nullptr, 641, 1, 15, 388, 1},
+    {"1F346", nullptr, 642, 1, 15, 389, 1},
+    {"1F347", nullptr, 643, 1, 15, 390, 1},
+    {"1F348", nullptr, 644, 1, 15, 391, 1},
+    {"1F349", nullptr, 645, 1, 15, 392, 1},
+    {"1F34A", nullptr, 646, 1, 15, 393, 1},
+    {"1F34B", nullptr, 647, 1, 15, 394, 1},
+    {"1F34C", nullptr, 648, 1, 15, 395, 1},
+    {"1F34D", nullptr, 649, 1, 15, 396, 1},
+    {"1F34E", nullptr, 650, 1, 15, 397, 1},
+    {"1F34F", nullptr, 651, 1, 15, 398, 1},
+    {"1F350", nullptr, 652, 1, 15, 399, 1},
+    {"1F351", nullptr, 653, 1, 15, 400, 1},
+    {"1F352", nullptr, 654, 1, 15, 401, 1},
+    {"1F353", nullptr, 655, 1, 15, 402, 1},
+    {"1F354", nullptr, 656, 1, 15, 403, 1},
+    {"1F355", nullptr, 657, 1, 15, 404, 1},
+    {"1F356", nullptr, 658, 1, 15, 405, 1},
+    {"1F357", nullptr, 659, 1, 15, 406, 1},
+    {"1F358", nullptr, 660, 1, 15, 407, 1},
+    {"1F359", nullptr, 661, 1, 15, 408, 1},
+    {"1F35A", nullptr, 662, 1, 15, 409, 1},
+    {"1F35B", nullptr, 663, 1, 15, 410, 1},
+    {"1F35C", nullptr, 664, 1, 15, 411, 1},
+    {"1F35D", nullptr, 665, 1, 15, 412, 1},
+    {"1F35E", nullptr, 666, 1, 15, 413, 1},
+    {"1F35F", nullptr, 667, 1, 15, 414, 1},
+    {"1F360", nullptr, 668, 1, 15, 415, 1},
+    {"1F361", nullptr, 669, 1, 15, 416, 1},
+    {"1F362", nullptr, 670, 1, 15, 417, 1},
+    {"1F363", nullptr, 671, 1, 15, 418, 1},
+    {"1F364", nullptr, 672, 1, 15, 419, 1},
+    {"1F365", nullptr, 673, 1, 15, 420, 1},
+    {"1F366", nullptr, 674, 1, 15, 421, 1},
+    {"1F367", nullptr, 675, 1, 15, 422, 1},
+    {"1F368", nullptr, 676, 1, 15, 423, 1},
+    {"1F369", nullptr, 677, 1, 15, 424, 1},
+    {"1F36A", nullptr, 678, 1, 15, 425, 1},
+    {"1F36B", nullptr, 679, 1, 15, 426, 1},
+    {"1F36C", nullptr, 680, 1, 15, 427, 1},
+    {"1F36D", nullptr, 681, 1, 15, 428, 1},
+    {"1F36E", nullptr, 682, 1, 15, 429, 1},
+    {"1F36F", nullptr, 683, 1, 15, 430, 1},
+    {"1F370", nullptr, 684, 1, 15, 431, 1},
+    {"1F371", nullptr, 685, 1, 15, 432, 1},
+    {"1F372", nullptr, 686, 1, 15, 433, 1},
+    {"1F373", nullptr, 687, 1, 15, 434, 2},
+    {"1F374", nullptr, 688, 1, 15, 436, 1},
+    {"1F375", nullptr, 689, 1, 15, 437, 1},
+    {"1F376", nullptr, 690, 1, 15, 438, 1},
+    {"1F377", nullptr, 691, 1, 15, 439, 1},
+    {"1F378", nullptr, 692, 1, 15, 440, 1},
+    {"1F379", nullptr, 693, 1, 15, 441, 1},
+    {"1F37A", nullptr, 694, 1, 15, 442, 1},
+    {"1F37B", nullptr, 695, 1, 15, 443, 1},
+    {"1F37C", nullptr, 696, 1, 15, 444, 1},
+    {"1F37D-FE0F", "1F37D", 697, 1, 15, 445, 1},
+    {"1F37E", nullptr, 698, 1, 15, 446, 1},
+    {"1F37F", nullptr, 699, 1, 15, 447, 1},
+    {"1F380", nullptr, 700, 1, 15, 448, 1},
+    {"1F381", nullptr, 701, 1, 15, 449, 1},
+    {"1F382", nullptr, 702, 1, 15, 450, 1},
+    {"1F383", nullptr, 703, 1, 15, 451, 1},
+    {"1F384", nullptr, 704, 1, 15, 452, 1},
+    {"1F385", nullptr, 705, 1, 15, 453, 1},
+    {"1F385-1F3FB", nullptr, 706, 2, 15, 454, 1},
+    {"1F385-1F3FC", nullptr, 708, 2, 15, 455, 1},
+    {"1F385-1F3FD", nullptr, 710, 2, 15, 456, 1},
+    {"1F385-1F3FE", nullptr, 712, 2, 15, 457, 1},
+    {"1F385-1F3FF", nullptr, 714, 2, 15, 458, 1},
+    {"1F386", nullptr, 716, 1, 15, 459, 1},
+    {"1F387", nullptr, 717, 1, 15, 460, 1},
+    {"1F388", nullptr, 718, 1, 15, 461, 1},
+    {"1F389", nullptr, 719, 1, 15, 462, 1},
+    {"1F38A", nullptr, 720, 1, 15, 463, 1},
+    {"1F38B", nullptr, 721, 1, 15, 464, 1},
+    {"1F38C", nullptr, 722, 1, 15, 465, 1},
+    {"1F38D", nullptr, 723, 1, 15, 466, 1},
+    {"1F38E", nullptr, 724, 1, 15, 467, 1},
+    {"1F38F", nullptr, 725, 1, 15, 468, 1},
+    {"1F390", nullptr, 726, 1, 15, 469, 1},
+    {"1F391", nullptr, 727, 1, 15, 470, 1},
+    {"1F392", nullptr, 728, 1, 15, 471, 1},
+    {"1F393", nullptr, 729, 1, 15, 472, 1},
+    {"1F396-FE0F", "1F396", 730, 1, 15, 473, 1},
+    {"1F397-FE0F", "1F397", 731, 1, 15, 474, 1},
+    {"1F399-FE0F", "1F399", 732, 1, 15, 475, 1},
+    {"1F39A-FE0F", "1F39A", 733, 1, 15, 476, 1},
+    {"1F39B-FE0F", "1F39B", 734, 1, 15, 477, 1},
+    {"1F39E-FE0F", "1F39E", 735, 1, 15, 478, 1},
+    {"1F39F-FE0F", "1F39F", 736, 1, 15, 479, 1},
+    {"1F3A0", nullptr, 737, 1, 15, 480, 1},
+    {"1F3A1", nullptr, 738, 1, 15, 481, 1},
+    {"1F3A2", nullptr, 739, 1, 15, 482, 1},
+    {"1F3A3", nullptr, 740, 1, 15, 483, 1},
+    {"1F3A4", nullptr, 741, 1, 15, 484, 1},
+    {"1F3A5", nullptr, 742, 1, 15, 485, 1},
+    {"1F3A6", nullptr, 743, 1, 15, 486, 1},
+    {"1F3A7", nullptr, 744, 1, 15, 487, 1},
+    {"1F3A8", nullptr, 745, 1, 15, 488, 1},
+    {"1F3A9", nullptr, 746, 1, 15, 489, 1},
+    {"1F3AA", nullptr, 747, 1, 15, 490, 1},
+    {"1F3AB", nullptr, 748, 1, 15, 491, 1},
+    {"1F3AC", nullptr, 749, 1, 15, 492, 1},
+    {"1F3AD", nullptr, 750, 1, 15, 493, 1},
+    {"1F3AE", nullptr, 751, 1, 15, 494, 1},
+    {"1F3AF", nullptr, 752, 1, 15, 495, 1},
+    {"1F3B0", nullptr, 753, 1, 15, 496, 1},
+    {"1F3B1", nullptr, 754, 1, 15, 497, 1},
+    {"1F3B2", nullptr, 755, 1, 15, 498, 1},
+    {"1F3B3", nullptr, 756, 1, 15, 499, 1},
+    {"1F3B4", nullptr, 757, 1, 15, 500, 1},
+    {"1F3B5", nullptr, 758, 1, 15, 501, 1},
+    {"1F3B6", nullptr, 759, 1, 15, 502, 1},
+    {"1F3B7", nullptr, 760, 1, 15, 503, 1},
+    {"1F3B8", nullptr, 761, 1, 15, 504, 1},
+    {"1F3B9", nullptr, 762, 1, 15, 505, 1},
+    {"1F3BA", nullptr, 763, 1, 15, 506, 1},
+    {"1F3BB", nullptr, 764, 1, 15, 507, 1},
+    {"1F3BC", nullptr, 765, 1, 15, 508, 1},
+    {"1F3BD", nullptr, 766, 1, 15, 509, 1},
+    {"1F3BE", nullptr, 767, 1, 15, 510, 1},
+    {"1F3BF", nullptr, 768, 1, 15, 511, 1},
+    {"1F3C0", nullptr, 769, 1, 15, 512, 1},
+    {"1F3C1", nullptr, 770, 1, 15, 513, 1},
+    {"1F3C2", nullptr, 771, 1, 15, 514, 1},
+    {"1F3C2-1F3FB", nullptr, 772, 2, 15, 515, 1},
+    {"1F3C2-1F3FC", nullptr, 774, 2, 15, 516, 1},
+    {"1F3C2-1F3FD", nullptr, 776, 2, 15, 517, 1},
+    {"1F3C2-1F3FE", nullptr, 778, 2, 15, 518, 1},
+    {"1F3C2-1F3FF", nullptr, 780, 2, 15, 519, 1},
+    {"1F3C3-200D-2640-FE0F", "1F3C3-200D-2640", 782, 3, 15, 520, 1},
+    {"1F3C3-1F3FB-200D-2640-FE0F", "1F3C3-1F3FB-200D-2640", 785, 4, 15, 521, 1},
+    {"1F3C3-1F3FC-200D-2640-FE0F", "1F3C3-1F3FC-200D-2640", 789, 4, 15, 522, 1},
+    {"1F3C3-1F3FD-200D-2640-FE0F", "1F3C3-1F3FD-200D-2640", 793, 4, 15, 523, 1},
+    {"1F3C3-1F3FE-200D-2640-FE0F", "1F3C3-1F3FE-200D-2640", 797, 4, 15, 524, 1},
+    {"1F3C3-1F3FF-200D-2640-FE0F", "1F3C3-1F3FF-200D-2640", 801, 4, 15, 525, 1},
+    {"1F3C3-200D-2642-FE0F", "1F3C3-200D-2642", 805, 3, 15, 526, 1},
+    {"1F3C3-1F3FB-200D-2642-FE0F", "1F3C3-1F3FB-200D-2642", 808, 4, 15, 527, 1},
+    {"1F3C3-1F3FC-200D-2642-FE0F", "1F3C3-1F3FC-200D-2642", 812, 4, 15, 528, 1},
+    {"1F3C3-1F3FD-200D-2642-FE0F", "1F3C3-1F3FD-200D-2642", 816, 4, 15, 529, 1},
+    {"1F3C3-1F3FE-200D-2642-FE0F", "1F3C3-1F3FE-200D-2642", 820, 4, 15, 530, 1},
+    {"1F3C3-1F3FF-200D-2642-FE0F", "1F3C3-1F3FF-200D-2642", 824, 4, 15, 531, 1},
+    {"1F3C3", nullptr, 828, 1, 15, 532, 2},
+    {"1F3C3-1F3FB", nullptr, 829, 2, 15, 534, 1},
+    {"1F3C3-1F3FC", nullptr, 831, 2, 15, 535, 1},
+    {"1F3C3-1F3FD", nullptr, 833, 2, 15, 536, 1},
+    {"1F3C3-1F3FE", nullptr, 835, 2, 15, 537, 1},
+    {"1F3C3-1F3FF", nullptr, 837, 2, 15, 538, 1},
+    {"1F3C4-200D-2640-FE0F", "1F3C4-200D-2640", 839, 3, 15, 539, 1},
+    {"1F3C4-1F3FB-200D-2640-FE0F", "1F3C4-1F3FB-200D-2640", 842, 4, 15, 540, 1},
+    {"1F3C4-1F3FC-200D-2640-FE0F", "1F3C4-1F3FC-200D-2640", 846, 4, 15, 541, 1},
+    {"1F3C4-1F3FD-200D-2640-FE0F", "1F3C4-1F3FD-200D-2640", 850, 4, 15, 542, 1},
+    {"1F3C4-1F3FE-200D-2640-FE0F", "1F3C4-1F3FE-200D-2640", 854, 4, 15, 543, 1},
+    {"1F3C4-1F3FF-200D-2640-FE0F", "1F3C4-1F3FF-200D-2640", 858, 4, 15, 544, 1},
+    {"1F3C4-200D-2642-FE0F", "1F3C4-200D-2642", 862, 3, 15, 545, 1},
+    {"1F3C4-1F3FB-200D-2642-FE0F", "1F3C4-1F3FB-200D-2642", 865, 4, 15, 546, 1},
+    {"1F3C4-1F3FC-200D-2642-FE0F", "1F3C4-1F3FC-200D-2642", 869, 4, 15, 547, 1},
+    {"1F3C4-1F3FD-200D-2642-FE0F", "1F3C4-1F3FD-200D-2642", 873, 4, 15, 548, 1},
+    {"1F3C4-1F3FE-200D-2642-FE0F", "1F3C4-1F3FE-200D-2642", 877, 4, 15, 549, 1},
+    {"1F3C4-1F3FF-200D-2642-FE0F", "1F3C4-1F3FF-200D-2642", 881, 4, 15, 550, 1},
+    {"1F3C4", nullptr, 885, 1, 15, 551, 1},
+    {"1F3C4-1F3FB", nullptr, 886, 2, 15, 552, 1},
+    {"1F3C4-1F3FC", nullptr, 888, 2, 15, 553, 1},
+    {"1F3C4-1F3FD", nullptr, 890, 2, 15, 554, 1},
+    {"1F3C4-1F3FE", nullptr, 892, 2, 15, 555, 1},
+    {"1F3C4-1F3FF", nullptr, 894, 2, 15, 556, 1},
+    {"1F3C5", nullptr, 896, 1, 15, 557, 1},
+    {"1F3C6", nullptr, 897, 1, 15, 558, 1},
+    {"1F3C7", nullptr, 898, 1, 15, 559, 1},
+    {"1F3C7-1F3FB", nullptr, 899, 2, 15, 560, 1},
+    {"1F3C7-1F3FC", nullptr, 901, 2, 15, 561, 1},
+    {"1F3C7-1F3FD", nullptr, 903, 2, 15, 562, 1},
+    {"1F3C7-1F3FE", nullptr, 905, 2, 15, 563, 1},
+    {"1F3C7-1F3FF", nullptr, 907, 2, 15, 564, 1},
+    {"1F3C8", nullptr, 909, 1, 15, 565, 1},
+    {"1F3C9", nullptr, 910, 1, 15, 566, 1},
+    {"1F3CA-200D-2640-FE0F", "1F3CA-200D-2640", 911, 3, 15, 567, 1},
+    {"1F3CA-1F3FB-200D-2640-FE0F", "1F3CA-1F3FB-200D-2640", 914, 4, 15, 568, 1},
+    {"1F3CA-1F3FC-200D-2640-FE0F", "1F3CA-1F3FC-200D-2640", 918, 4, 15, 569, 1},
+    {"1F3CA-1F3FD-200D-2640-FE0F", "1F3CA-1F3FD-200D-2640", 922, 4, 15, 570, 1},
+    {"1F3CA-1F3FE-200D-2640-FE0F", "1F3CA-1F3FE-200D-2640", 926, 4, 15, 571, 1},
+    {"1F3CA-1F3FF-200D-2640-FE0F", "1F3CA-1F3FF-200D-2640", 930, 4, 15, 572, 1},
+    {"1F3CA-200D-2642-FE0F", "1F3CA-200D-2642", 934, 3, 15, 573, 1},
+    {"1F3CA-1F3FB-200D-2642-FE0F", "1F3CA-1F3FB-200D-2642", 937, 4, 15, 574, 1},
+    {"1F3CA-1F3FC-200D-2642-FE0F", "1F3CA-1F3FC-200D-2642", 941, 4, 15, 575, 1},
+    {"1F3CA-1F3FD-200D-2642-FE0F", "1F3CA-1F3FD-200D-2642", 945, 4, 15, 576, 1},
+    {"1F3CA-1F3FE-200D-2642-FE0F", "1F3CA-1F3FE-200D-2642", 949, 4, 15, 577, 1},
+    {"1F3CA-1F3FF-200D-2642-FE0F", "1F3CA-1F3FF-200D-2642", 953, 4, 15, 578, 1},
+    {"1F3CA", nullptr, 957, 1, 15, 579, 1},
+    {"1F3CA-1F3FB", nullptr, 958, 2, 15, 580, 1},
+    {"1F3CA-1F3FC", nullptr, 960, 2, 15, 581, 1},
+    {"1F3CA-1F3FD", nullptr, 962, 2, 15, 582, 1},
+    {"1F3CA-1F3FE", nullptr, 964, 2, 15, 583, 1},
+    {"1F3CA-1F3FF", nullptr, 966, 2, 15, 584, 1},
+    {"1F3CB-FE0F-200D-2640-FE0F", nullptr, 968, 5, 7, 585, 1},
+    {"1F3CB-1F3FB-200D-2640-FE0F", "1F3CB-1F3FB-200D-2640", 973, 4, 15, 586, 1},
+    {"1F3CB-1F3FC-200D-2640-FE0F", "1F3CB-1F3FC-200D-2640", 977, 4, 15, 587, 1},
+    {"1F3CB-1F3FD-200D-2640-FE0F", "1F3CB-1F3FD-200D-2640", 981, 4, 15, 588, 1},
+    {"1F3CB-1F3FE-200D-2640-FE0F", "1F3CB-1F3FE-200D-2640", 985, 4, 15, 589, 1},
+    {"1F3CB-1F3FF-200D-2640-FE0F", "1F3CB-1F3FF-200D-2640", 989, 4, 15, 590, 1},
+    {"1F3CB-FE0F-200D-2642-FE0F", nullptr, 993, 5, 7, 591, 1},
+    {"1F3CB-1F3FB-200D-2642-FE0F", "1F3CB-1F3FB-200D-2642", 998, 4, 15, 592, 1},
+    {"1F3CB-1F3FC-200D-2642-FE0F", "1F3CB-1F3FC-200D-2642", 1002, 4, 15, 593, 1},
+    {"1F3CB-1F3FD-200D-2642-FE0F", "1F3CB-1F3FD-200D-2642", 1006, 4, 15, 594, 1},
+    {"1F3CB-1F3FE-200D-2642-FE0F", "1F3CB-1F3FE-200D-2642", 1010, 4, 15, 595, 1},
+    {"1F3CB-1F3FF-200D-2642-FE0F", "1F3CB-1F3FF-200D-2642", 1014, 4, 15, 596, 1},
+    {"1F3CB-FE0F", "1F3CB", 1018, 1, 15, 597, 1},
+    {"1F3CB-1F3FB", nullptr, 1019, 2, 15, 598, 1},
+    {"1F3CB-1F3FC", nullptr, 1021, 2, 15, 599, 1},
+    {"1F3CB-1F3FD", nullptr, 1023, 2, 15, 600, 1},
+    {"1F3CB-1F3FE", nullptr, 1025, 2, 15, 601, 1},
+    {"1F3CB-1F3FF", nullptr, 1027, 2, 15, 602, 1},
+    {"1F3CC-FE0F-200D-2640-FE0F", nullptr, 1029, 5, 7, 603, 1},
+    {"1F3CC-1F3FB-200D-2640-FE0F", "1F3CC-1F3FB-200D-2640", 1034, 4, 15, 604, 1},
+    {"1F3CC-1F3FC-200D-2640-FE0F", "1F3CC-1F3FC-200D-2640", 1038, 4, 15, 605, 1},
+    {"1F3CC-1F3FD-200D-2640-FE0F", "1F3CC-1F3FD-200D-2640", 1042, 4, 15, 606, 1},
+    {"1F3CC-1F3FE-200D-2640-FE0F", "1F3CC-1F3FE-200D-2640", 1046, 4, 15, 607, 1},
+    {"1F3CC-1F3FF-200D-2640-FE0F", "1F3CC-1F3FF-200D-2640", 1050, 4, 15, 608, 1},
+    {"1F3CC-FE0F-200D-2642-FE0F", nullptr, 1054, 5, 7, 609, 1},
+    {"1F3CC-1F3FB-200D-2642-FE0F", "1F3CC-1F3FB-200D-2642", 1059, 4, 15, 610, 1},
+    {"1F3CC-1F3FC-200D-2642-FE0F", "1F3CC-1F3FC-200D-2642", 1063, 4, 15, 611, 1},
+    {"1F3CC-1F3FD-200D-2642-FE0F", "1F3CC-1F3FD-200D-2642", 1067, 4, 15, 612, 1},
+    {"1F3CC-1F3FE-200D-2642-FE0F", "1F3CC-1F3FE-200D-2642", 1071, 4, 15, 613, 1},
+    {"1F3CC-1F3FF-200D-2642-FE0F", "1F3CC-1F3FF-200D-2642", 1075, 4, 15, 614, 1},
+    {"1F3CC-FE0F", "1F3CC", 1079, 1, 15, 615, 1},
+    {"1F3CC-1F3FB", nullptr, 1080, 2, 15, 616, 1},
+    {"1F3CC-1F3FC", nullptr, 1082, 2, 15, 617, 1},
+    {"1F3CC-1F3FD", nullptr, 1084, 2, 15, 618, 1},
+    {"1F3CC-1F3FE", nullptr, 1086, 2, 15, 619, 1},
+    {"1F3CC-1F3FF", nullptr, 1088, 2, 15, 620, 1},
+    {"1F3CD-FE0F", "1F3CD", 1090, 1, 15, 621, 1},
+    {"1F3CE-FE0F", "1F3CE", 1091, 1, 15, 622, 1},
+    {"1F3CF", nullptr, 1092, 1, 15, 623, 1},
+    {"1F3D0", nullptr, 1093, 1, 15, 624, 1},
+    {"1F3D1", nullptr, 1094, 1, 15, 625, 1},
+    {"1F3D2", nullptr, 1095, 1, 15, 626, 1},
+    {"1F3D3", nullptr, 1096, 1, 15, 627, 1},
+    {"1F3D4-FE0F", "1F3D4", 1097, 1, 15, 628, 1},
+    {"1F3D5-FE0F", "1F3D5", 1098, 1, 15, 629, 1},
+    {"1F3D6-FE0F", "1F3D6", 1099, 1, 15, 630, 1},
+    {"1F3D7-FE0F", "1F3D7", 1100, 1, 15, 631, 1},
+    {"1F3D8-FE0F", "1F3D8", 1101, 1, 15, 632, 1},
+    {"1F3D9-FE0F", "1F3D9", 1102, 1, 15, 633, 1},
+    {"1F3DA-FE0F", "1F3DA", 1103, 1, 15, 634, 1},
+    {"1F3DB-FE0F", "1F3DB", 1104, 1, 15, 635, 1},
+    {"1F3DC-FE0F", "1F3DC", 1105, 1, 15, 636, 1},
+    {"1F3DD-FE0F", "1F3DD", 1106, 1, 15, 637, 1},
+    {"1F3DE-FE0F", "1F3DE", 1107, 1, 15, 638, 1},
+    {"1F3DF-FE0F", "1F3DF", 1108, 1, 15, 639, 1},
+    {"1F3E0", nullptr, 1109, 1, 15, 640, 1},
+    {"1F3E1", nullptr, 1110, 1, 15, 641, 1},
+    {"1F3E2", nullptr, 1111, 1, 15, 642, 1},
+    {"1F3E3", nullptr, 1112, 1, 15, 643, 1},
+    {"1F3E4", nullptr, 1113, 1, 15, 644, 1},
+    {"1F3E5", nullptr, 1114, 1, 15, 645, 1},
+    {"1F3E6", nullptr, 1115, 1, 15, 646, 1},
+    {"1F3E7", nullptr, 1116, 1, 15, 647, 1},
+    {"1F3E8", nullptr, 1117, 1, 15, 648, 1},
+    {"1F3E9", nullptr, 1118, 1, 15, 649, 1},
+    {"1F3EA", nullptr, 1119, 1, 15, 650, 1},
+    {"1F3EB", nullptr, 1120, 1, 15, 651, 1},
+    {"1F3EC", nullptr, 1121, 1, 15, 652, 1},
+    {"1F3ED", nullptr, 1122, 1, 15, 653, 1},
+    {"1F3EE", nullptr, 1123, 1, 15, 654, 2},
+    {"1F3EF", nullptr, 1124, 1, 15, 656, 1},
+    {"1F3F0", nullptr, 1125, 1, 15, 657, 1},
+    {"1F3F3-FE0F-200D-1F308", "1F3F3-200D-1F308", 1126, 3, 15, 658, 1},
+    {"1F3F3-FE0F-200D-26A7-FE0F", nullptr, 1129, 5, 7, 659, 1},
+    {"1F3F3-FE0F", "1F3F3", 1134, 1, 15, 660, 1},
+    {"1F3F4-200D-2620-FE0F", "1F3F4-200D-2620", 1135, 3, 15, 661, 1},
+    {"1F3F4-E0067-E0062-E0065-E006E-E0067-E007F", nullptr, 1138, 7, 15, 662, 1},
+    {"1F3F4-E0067-E0062-E0073-E0063-E0074-E007F", nullptr, 1145, 7, 15, 663, 1},
+    {"1F3F4-E0067-E0062-E0077-E006C-E0073-E007F", nullptr, 1152, 7, 15, 664, 1},
+    {"1F3F4", nullptr, 1159, 1, 15, 665, 1},
+    {"1F3F5-FE0F", "1F3F5", 1160, 1, 15, 666, 1},
+    {"1F3F7-FE0F", "1F3F7", 1161, 1, 15, 667, 1},
+    {"1F3F8", nullptr, 1162, 1, 15, 668, 1},
+    {"1F3F9", nullptr, 1163, 1, 15, 669, 1},
+    {"1F3FA", nullptr, 1164, 1, 15, 670, 1},
+    {"1F3FB", nullptr, 1165, 1, 15, 671, 1},
+    {"1F3FC", nullptr, 1166, 1, 15, 672, 1},
+    {"1F3FD", nullptr, 1167, 1, 15, 673, 1},
+    {"1F3FE", nullptr, 1168, 1, 15, 674, 1},
+    {"1F3FF", nullptr, 1169, 1, 15, 675, 1},
+    {"1F400", nullptr, 1170, 1, 15, 676, 1},
+    {"1F401", nullptr, 1171, 1, 15, 677, 1},
+    {"1F402", nullptr, 1172, 1, 15, 678, 1},
+    {"1F403", nullptr, 1173, 1, 15, 679, 1},
+    {"1F404", nullptr, 1174, 1, 15, 680, 1},
+    {"1F405", nullptr, 1175, 1, 15, 681, 1},
+    {"1F406", nullptr, 1176, 1, 15, 682, 1},
+    {"1F407", nullptr, 1177, 1, 15, 683, 1},
+    {"1F408-200D-2B1B", nullptr, 1178, 3, 15, 684, 1},
+    {"1F408", nullptr, 1181, 1, 15, 685, 1},
+    {"1F409", nullptr, 1182, 1, 15, 686, 1},
+    {"1F40A", nullptr, 1183, 1, 15, 687, 1},
+    {"1F40B", nullptr, 1184, 1, 15, 688, 1},
+    {"1F40C", nullptr, 1185, 1, 15, 689, 1},
+    {"1F40D", nullptr, 1186, 1, 15, 690, 1},
+    {"1F40E", nullptr, 1187, 1, 15, 691, 1},
+    {"1F40F", nullptr, 1188, 1, 15, 692, 1},
+    {"1F410", nullptr, 1189, 1, 15, 693, 1},
+    {"1F411", nullptr, 1190, 1, 15, 694, 1},
+    {"1F412", nullptr, 1191, 1, 15, 695, 1},
+    {"1F413", nullptr, 1192, 1, 15, 696, 1},
+    {"1F414", nullptr, 1193, 1, 15, 697, 1},
+    {"1F415-200D-1F9BA", nullptr, 1194, 3, 15, 698, 1},
+    {"1F415", nullptr, 1197, 1, 15, 699, 1},
+    {"1F416", nullptr, 1198, 1, 15, 700, 1},
+    {"1F417", nullptr, 1199, 1, 15, 701, 1},
+    {"1F418", nullptr, 1200, 1, 15, 702, 1},
+    {"1F419", nullptr, 1201, 1, 15, 703, 1},
+    {"1F41A", nullptr, 1202, 1, 15, 704, 1},
+    {"1F41B", nullptr, 1203, 1, 15, 705, 1},
+    {"1F41C", nullptr, 1204, 1, 15, 706, 1},
+    {"1F41D", nullptr, 1205, 1, 15, 707, 2},
+    {"1F41E", nullptr, 1206, 1, 15, 709, 2},
+    {"1F41F", nullptr, 1207, 1, 15, 711, 1},
+    {"1F420", nullptr, 1208, 1, 15, 712, 1},
+    {"1F421", nullptr, 1209, 1, 15, 713, 1},
+    {"1F422", nullptr, 1210, 1, 15, 714, 1},
+    {"1F423", nullptr, 1211, 1, 15, 715, 1},
+    {"1F424", nullptr, 1212, 1, 15, 716, 1},
+    {"1F425", nullptr, 1213, 1, 15, 717, 1},
+    {"1F426", nullptr, 1214, 1, 15, 718, 1},
+    {"1F427", nullptr, 1215, 1, 15, 719, 1},
+    {"1F428", nullptr, 1216, 1, 15, 720, 1},
+    {"1F429", nullptr, 1217, 1, 15, 721, 1},
+    {"1F42A", nullptr, 1218, 1, 15, 722, 1},
+    {"1F42B", nullptr, 1219, 1, 15, 723, 1},
+    {"1F42C", nullptr, 1220, 1, 15, 724, 2},
+    {"1F42D", nullptr, 1221, 1, 15, 726, 1},
+    {"1F42E", nullptr, 1222, 1, 15, 727, 1},
+    {"1F42F", nullptr, 1223, 1, 15, 728, 1},
+    {"1F430", nullptr, 1224, 1, 15, 729, 1},
+    {"1F431", nullptr, 1225, 1, 15, 730, 1},
+    {"1F432", nullptr, 1226, 1, 15, 731, 1},
+    {"1F433", nullptr, 1227, 1, 15, 732, 1},
+    {"1F434", nullptr, 1228, 1, 15, 733, 1},
+    {"1F435", nullptr, 1229, 1, 15, 734, 1},
+    {"1F436", nullptr, 1230, 1, 15, 735, 1},
+    {"1F437", nullptr, 1231, 1, 15, 736, 1},
+    {"1F438", nullptr, 1232, 1, 15, 737, 1},
+    {"1F439", nullptr, 1233, 1, 15, 738, 1},
+    {"1F43A", nullptr, 1234, 1, 15, 739, 1},
+    {"1F43B-200D-2744-FE0F", "1F43B-200D-2744", 1235, 3, 15, 740, 1},
+    {"1F43B", nullptr, 1238, 1, 15, 741, 1},
+    {"1F43C", nullptr, 1239, 1, 15, 742, 1},
+    {"1F43D", nullptr, 1240, 1, 15, 743, 1},
+    {"1F43E", nullptr, 1241, 1, 15, 744, 2},
+    {"1F43F-FE0F", "1F43F", 1242, 1, 15, 746, 1},
+    {"1F440", nullptr, 1243, 1, 15, 747, 1},
+    {"1F441-FE0F-200D-1F5E8-FE0F", nullptr, 1244, 5, 7, 748, 1},
+    {"1F441-FE0F", "1F441", 1249, 1, 15, 749, 1},
+    {"1F442", nullptr, 1250, 1, 15, 750, 1},
+    {"1F442-1F3FB", nullptr, 1251, 2, 15, 751, 1},
+    {"1F442-1F3FC", nullptr, 1253, 2, 15, 752, 1},
+    {"1F442-1F3FD", nullptr, 1255, 2, 15, 753, 1},
+    {"1F442-1F3FE", nullptr, 1257, 2, 15, 754, 1},
+    {"1F442-1F3FF", nullptr, 1259, 2, 15, 755, 1},
+    {"1F443", nullptr, 1261, 1, 15, 756, 1},
+    {"1F443-1F3FB", nullptr, 1262, 2, 15, 757, 1},
+    {"1F443-1F3FC", nullptr, 1264, 2, 15, 758, 1},
+    {"1F443-1F3FD", nullptr, 1266, 2, 15, 759, 1},
+    {"1F443-1F3FE", nullptr, 1268, 2, 15, 760, 1},
+    {"1F443-1F3FF", nullptr, 1270, 2, 15, 761, 1},
+    {"1F444", nullptr, 1272, 1, 15, 762, 1},
+    {"1F445", nullptr, 1273, 1, 15, 763, 1},
+    {"1F446", nullptr, 1274, 1, 15, 764, 1},
+    {"1F446-1F3FB", nullptr, 1275, 2, 15, 765, 1},
+    {"1F446-1F3FC", nullptr, 1277, 2, 15, 766, 1},
+    {"1F446-1F3FD", nullptr, 1279, 2, 15, 767, 1},
+    {"1F446-1F3FE", nullptr, 1281, 2, 15, 768, 1},
+    {"1F446-1F3FF", nullptr, 1283, 2, 15, 769, 1},
+    {"1F447", nullptr, 1285, 1, 15, 770, 1},
+    {"1F447-1F3FB", nullptr, 1286, 2, 15, 771, 1},
+    {"1F447-1F3FC", nullptr, 1288, 2, 15, 772, 1},
+    {"1F447-1F3FD", nullptr, 1290, 2, 15, 773, 1},
+    {"1F447-1F3FE", nullptr, 1292, 2, 15, 774, 1},
+    {"1F447-1F3FF", nullptr, 1294, 2, 15, 775, 1},
+    {"1F448", nullptr, 1296, 1, 15, 776, 1},
+    {"1F448-1F3FB", nullptr, 1297, 2, 15, 777, 1},
+    {"1F448-1F3FC", nullptr, 1299, 2, 15, 778, 1},
+    {"1F448-1F3FD", nullptr, 1301, 2, 15, 779, 1},
+    {"1F448-1F3FE", nullptr, 1303, 2, 15, 780, 1},
+    {"1F448-1F3FF", nullptr, 1305, 2, 15, 781, 1},
+    {"1F449", nullptr, 1307, 1, 15, 782, 1},
+    {"1F449-1F3FB", nullptr, 1308, 2, 15, 783, 1},
+    {"1F449-1F3FC", nullptr, 1310, 2, 15, 784, 1},
+    {"1F449-1F3FD", nullptr, 1312, 2, 15, 785, 1},
+    {"1F449-1F3FE", nullptr, 1314, 2, 15, 786, 1},
+    {"1F449-1F3FF", nullptr, 1316, 2, 15, 787, 1},
+    {"1F44A", nullptr, 1318, 1, 15, 788, 2},
+    {"1F44A-1F3FB", nullptr, 1319, 2, 15, 790, 1},
+    {"1F44A-1F3FC", nullptr, 1321, 2, 15, 791, 1},
+    {"1F44A-1F3FD", nullptr, 1323, 2, 15, 792, 1},
+    {"1F44A-1F3FE", nullptr, 1325, 2, 15, 793, 1},
+    {"1F44A-1F3FF", nullptr, 1327, 2, 15, 794, 1},
+    {"1F44B", nullptr, 1329, 1, 15, 795, 1},
+    {"1F44B-1F3FB", nullptr, 1330, 2, 15, 796, 1},
+    {"1F44B-1F3FC", nullptr, 1332, 2, 15, 797, 1},
+    {"1F44B-1F3FD", nullptr, 1334, 2, 15, 798, 1},
+    {"1F44B-1F3FE", nullptr, 1336, 2, 15, 799, 1},
+    {"1F44B-1F3FF", nullptr, 1338, 2, 15, 800, 1},
+    {"1F44C", nullptr, 1340, 1, 15, 801, 1},
+    {"1F44C-1F3FB", nullptr, 1341, 2, 15, 802, 1},
+    {"1F44C-1F3FC", nullptr, 1343, 2, 15, 803, 1},
+    {"1F44C-1F3FD", nullptr, 1345, 2, 15, 804, 1},
+    {"1F44C-1F3FE", nullptr, 1347, 2, 15, 805, 1},
+    {"1F44C-1F3FF", nullptr, 1349, 2, 15, 806, 1},
+    {"1F44D", nullptr, 1351, 1, 15, 807, 2},
+    {"1F44D-1F3FB", nullptr, 1352, 2, 15, 809, 1},
+    {"1F44D-1F3FC", nullptr, 1354, 2, 15, 810, 1},
+    {"1F44D-1F3FD", nullptr, 1356, 2, 15, 811, 1},
+    {"1F44D-1F3FE", nullptr, 1358, 2, 15, 812, 1},
+    {"1F44D-1F3FF", nullptr, 1360, 2, 15, 813, 1},
+    {"1F44E", nullptr, 1362, 1, 15, 814, 2},
+    {"1F44E-1F3FB", nullptr, 1363, 2, 15, 816, 1},
+    {"1F44E-1F3FC", nullptr, 1365, 2, 15, 817, 1},
+    {"1F44E-1F3FD", nullptr, 1367, 2, 15, 818, 1},
+    {"1F44E-1F3FE", nullptr, 1369, 2, 15, 819, 1},
+    {"1F44E-1F3FF", nullptr, 1371, 2, 15, 820, 1},
+    {"1F44F", nullptr, 1373, 1, 15, 821, 1},
+    {"1F44F-1F3FB", nullptr, 1374, 2, 15, 822, 1},
+    {"1F44F-1F3FC", nullptr, 1376, 2, 15, 823, 1},
+    {"1F44F-1F3FD", nullptr, 1378, 2, 15, 824, 1},
+    {"1F44F-1F3FE", nullptr, 1380, 2, 15, 825, 1},
+    {"1F44F-1F3FF", nullptr, 1382, 2, 15, 826, 1},
+    {"1F450", nullptr, 1384, 1, 15, 827, 1},
+    {"1F450-1F3FB", nullptr, 1385, 2, 15, 828, 1},
+    {"1F450-1F3FC", nullptr, 1387, 2, 15, 829, 1},
+    {"1F450-1F3FD", nullptr, 1389, 2, 15, 830, 1},
+    {"1F450-1F3FE", nullptr, 1391, 2, 15, 831, 1},
+    {"1F450-1F3FF", nullptr, 1393, 2, 15, 832, 1},
+    {"1F451", nullptr, 1395, 1, 15, 833, 1},
+    {"1F452", nullptr, 1396, 1, 15, 834, 1},
+    {"1F453", nullptr, 1397, 1, 15, 835, 1},
+    {"1F454", nullptr, 1398, 1, 15, 836, 1},
+    {"1F455", nullptr, 1399, 1, 15, 837, 2},
+    {"1F456", nullptr, 1400, 1, 15, 839, 1},
+    {"1F457", nullptr, 1401, 1, 15, 840, 1},
+    {"1F458", nullptr, 1402, 1, 15, 841, 1},
+    {"1F459", nullptr, 1403, 1, 15, 842, 1},
+    {"1F45A", nullptr, 1404, 1, 15, 843, 1},
+    {"1F45B", nullptr, 1405, 1, 15, 844, 1},
+    {"1F45C", nullptr, 1406, 1, 15, 845, 1},
+    {"1F45D", nullptr, 1407, 1, 15, 846, 1},
+    {"1F45E", nullptr, 1408, 1, 15, 847, 2},
+    {"1F45F", nullptr, 1409, 1, 15, 849, 1},
+    {"1F460", nullptr, 1410, 1, 15, 850, 1},
+    {"1F461", nullptr, 1411, 1, 15, 851, 1},
+    {"1F462", nullptr, 1412, 1, 15, 852, 1},
+    {"1F463", nullptr, 1413, 1, 15, 853, 1},
+    {"1F464", nullptr, 1414, 1, 15, 854, 1},
+    {"1F465", nullptr, 1415, 1, 15, 855, 1},
+    {"1F466", nullptr, 1416, 1, 15, 856, 1},
+    {"1F466-1F3FB", nullptr, 1417, 2, 15, 857, 1},
+    {"1F466-1F3FC", nullptr, 1419, 2, 15, 858, 1},
+    {"1F466-1F3FD", nullptr, 1421, 2, 15, 859, 1},
+    {"1F466-1F3FE", nullptr, 1423, 2, 15, 860, 1},
+    {"1F466-1F3FF", nullptr, 1425, 2, 15, 861, 1},
+    {"1F467", nullptr, 1427, 1, 15, 862, 1},
+    {"1F467-1F3FB", nullptr, 1428, 2, 15, 863, 1},
+    {"1F467-1F3FC", nullptr, 1430, 2, 15, 864, 1},
+    {"1F467-1F3FD", nullptr, 1432, 2, 15, 865, 1},
+    {"1F467-1F3FE", nullptr, 1434, 2, 15, 866, 1},
+    {"1F467-1F3FF", nullptr, 1436, 2, 15, 867, 1},
+    {"1F468-200D-1F33E", nullptr, 1438, 3, 15, 868, 1},
+    {"1F468-1F3FB-200D-1F33E", nullptr, 1441, 4, 15, 869, 1},
+    {"1F468-1F3FC-200D-1F33E", nullptr, 1445, 4, 15, 870, 1},
+    {"1F468-1F3FD-200D-1F33E", nullptr, 1449, 4, 15, 871, 1},
+    {"1F468-1F3FE-200D-1F33E", nullptr, 1453, 4, 15, 872, 1},
+    {"1F468-1F3FF-200D-1F33E", nullptr, 1457, 4, 15, 873, 1},
+    {"1F468-200D-1F373", nullptr, 1461, 3, 15, 874, 1},
+    {"1F468-1F3FB-200D-1F373", nullptr, 1464, 4, 15, 875, 1},
+    {"1F468-1F3FC-200D-1F373", nullptr, 1468, 4, 15, 876, 1},
+    {"1F468-1F3FD-200D-1F373", nullptr, 1472, 4, 15, 877, 1},
+    {"1F468-1F3FE-200D-1F373", nullptr, 1476, 4, 15, 878, 1},
+    {"1F468-1F3FF-200D-1F373", nullptr, 1480, 4, 15, 879, 1},
+    {"1F468-200D-1F37C", nullptr, 1484, 3, 15, 880, 1},
+    {"1F468-1F3FB-200D-1F37C", nullptr, 1487, 4, 15, 881, 1},
+    {"1F468-1F3FC-200D-1F37C", nullptr, 1491, 4, 15, 882, 1},
+    {"1F468-1F3FD-200D-1F37C", nullptr, 1495, 4, 15, 883, 1},
+    {"1F468-1F3FE-200D-1F37C", nullptr, 1499, 4, 15, 884, 1},
+    {"1F468-1F3FF-200D-1F37C", nullptr, 1503, 4, 15, 885, 1},
+    {"1F468-200D-1F393", nullptr, 1507, 3, 15, 886, 1},
+    {"1F468-1F3FB-200D-1F393", nullptr, 1510, 4, 15, 887, 1},
+    {"1F468-1F3FC-200D-1F393", nullptr, 1514, 4, 15, 888, 1},
+    {"1F468-1F3FD-200D-1F393", nullptr, 1518, 4, 15, 889, 1},
+    {"1F468-1F3FE-200D-1F393", nullptr, 1522, 4, 15, 890, 1},
+    {"1F468-1F3FF-200D-1F393", nullptr, 1526, 4, 15, 891, 1},
+    {"1F468-200D-1F3A4", nullptr, 1530, 3, 15, 892, 1},
+    {"1F468-1F3FB-200D-1F3A4", nullptr, 1533, 4, 15, 893, 1},
+    {"1F468-1F3FC-200D-1F3A4", nullptr, 1537, 4, 15, 894, 1},
+    {"1F468-1F3FD-200D-1F3A4", nullptr, 1541, 4, 15, 895, 1},
+    {"1F468-1F3FE-200D-1F3A4", nullptr, 1545, 4, 15, 896, 1},
+    {"1F468-1F3FF-200D-1F3A4", nullptr, 1549, 4, 15, 897, 1},
+    {"1F468-200D-1F3A8", nullptr, 1553, 3, 15, 898, 1},
+    {"1F468-1F3FB-200D-1F3A8", nullptr, 1556, 4, 15, 899, 1},
+    {"1F468-1F3FC-200D-1F3A8", nullptr, 1560, 4, 15, 900, 1},
+    {"1F468-1F3FD-200D-1F3A8", nullptr, 1564, 4, 15, 901, 1},
+    {"1F468-1F3FE-200D-1F3A8", nullptr, 1568, 4, 15, 902, 1},
+    {"1F468-1F3FF-200D-1F3A8", nullptr, 1572, 4, 15, 903, 1},
+    {"1F468-200D-1F3EB", nullptr, 1576, 3, 15, 904, 1},
+    {"1F468-1F3FB-200D-1F3EB", nullptr, 1579, 4, 15, 905, 1},
+    {"1F468-1F3FC-200D-1F3EB", nullptr, 1583, 4, 15, 906, 1},
+    {"1F468-1F3FD-200D-1F3EB", nullptr, 1587, 4, 15, 907, 1},
+    {"1F468-1F3FE-200D-1F3EB", nullptr, 1591, 4, 15, 908, 1},
+    {"1F468-1F3FF-200D-1F3EB", nullptr, 1595, 4, 15, 909, 1},
+    {"1F468-200D-1F3ED", nullptr, 1599, 3, 15, 910, 1},
+    {"1F468-1F3FB-200D-1F3ED", nullptr, 1602, 4, 15, 911, 1},
+    {"1F468-1F3FC-200D-1F3ED", nullptr, 1606, 4, 15, 912, 1},
+    {"1F468-1F3FD-200D-1F3ED", nullptr, 1610, 4, 15, 913, 1},
+    {"1F468-1F3FE-200D-1F3ED", nullptr, 1614, 4, 15, 914, 1},
+    {"1F468-1F3FF-200D-1F3ED", nullptr, 1618, 4, 15, 915, 1},
+    {"1F468-200D-1F466-200D-1F466", nullptr, 1622, 5, 15, 916, 1},
+    {"1F468-200D-1F466", nullptr, 1627, 3, 15, 917, 1},
+    {"1F468-200D-1F467-200D-1F466", nullptr, 1630, 5, 15, 918, 1},
+    {"1F468-200D-1F467-200D-1F467", nullptr, 1635, 5, 15, 919, 1},
+    {"1F468-200D-1F467", nullptr, 1640, 3, 15, 920, 1},
+    {"1F468-200D-1F468-200D-1F466", nullptr, 1643, 5, 15, 921, 1},
+    {"1F468-200D-1F468-200D-1F466-200D-1F466", nullptr, 1648, 7, 15, 922, 1},
+    {"1F468-200D-1F468-200D-1F467", nullptr, 1655, 5, 15, 923, 1},
+    {"1F468-200D-1F468-200D-1F467-200D-1F466", nullptr, 1660, 7, 15, 924, 1},
+    {"1F468-200D-1F468-200D-1F467-200D-1F467", nullptr, 1667, 7, 15, 925, 1},
+    {"1F468-200D-1F469-200D-1F466", nullptr, 1674, 5, 15, 926, 1},
+    {"1F468-200D-1F469-200D-1F466-200D-1F466", nullptr, 1679, 7, 15, 927, 1},
+    {"1F468-200D-1F469-200D-1F467", nullptr, 1686, 5, 15, 928, 1},
+    {"1F468-200D-1F469-200D-1F467-200D-1F466", nullptr, 1691, 7, 15, 929, 1},
+    {"1F468-200D-1F469-200D-1F467-200D-1F467", nullptr, 1698, 7, 15, 930, 1},
+    {"1F468-200D-1F4BB", nullptr, 1705, 3, 15, 931, 1},
+    {"1F468-1F3FB-200D-1F4BB", nullptr, 1708, 4, 15, 932, 1},
+    {"1F468-1F3FC-200D-1F4BB", nullptr, 1712, 4, 15, 933, 1},
+    {"1F468-1F3FD-200D-1F4BB", nullptr, 1716, 4, 15, 934, 1},
+    {"1F468-1F3FE-200D-1F4BB", nullptr, 1720, 4, 15, 935, 1},
+    {"1F468-1F3FF-200D-1F4BB", nullptr, 1724, 4, 15, 936, 1},
+    {"1F468-200D-1F4BC", nullptr, 1728, 3, 15, 937, 1},
+    {"1F468-1F3FB-200D-1F4BC", nullptr, 1731, 4, 15, 938, 1},
+    {"1F468-1F3FC-200D-1F4BC", nullptr, 1735, 4, 15, 939, 1},
+    {"1F468-1F3FD-200D-1F4BC", nullptr, 1739, 4, 15, 940, 1},
+    {"1F468-1F3FE-200D-1F4BC", nullptr, 1743, 4, 15, 941, 1},
+    {"1F468-1F3FF-200D-1F4BC", nullptr, 1747, 4, 15, 942, 1},
+    {"1F468-200D-1F527", nullptr, 1751, 3, 15, 943, 1},
+    {"1F468-1F3FB-200D-1F527", nullptr, 1754, 4, 15, 944, 1},
+    {"1F468-1F3FC-200D-1F527", nullptr, 1758, 4, 15, 945, 1},
+    {"1F468-1F3FD-200D-1F527", nullptr, 1762, 4, 15, 946, 1},
+    {"1F468-1F3FE-200D-1F527", nullptr, 1766, 4, 15, 947, 1},
+    {"1F468-1F3FF-200D-1F527", nullptr, 1770, 4, 15, 948, 1},
+    {"1F468-200D-1F52C", nullptr, 1774, 3, 15, 949, 1},
+    {"1F468-1F3FB-200D-1F52C", nullptr, 1777, 4, 15, 950, 1},
+    {"1F468-1F3FC-200D-1F52C", nullptr, 1781, 4, 15, 951, 1},
+    {"1F468-1F3FD-200D-1F52C", nullptr, 1785, 4, 15, 952, 1},
+    {"1F468-1F3FE-200D-1F52C", nullptr, 1789, 4, 15, 953, 1},
+    {"1F468-1F3FF-200D-1F52C", nullptr, 1793, 4, 15, 954, 1},
+    {"1F468-200D-1F680", nullptr, 1797, 3, 15, 955, 1},
+    {"1F468-1F3FB-200D-1F680", nullptr, 1800, 4, 15, 956, 1},
+    {"1F468-1F3FC-200D-1F680", nullptr, 1804, 4, 15, 957, 1},
+    {"1F468-1F3FD-200D-1F680", nullptr, 1808, 4, 15, 958, 1},
+    {"1F468-1F3FE-200D-1F680", nullptr, 1812, 4, 15, 959, 1},
+    {"1F468-1F3FF-200D-1F680", nullptr, 1816, 4, 15, 960, 1},
+    {"1F468-200D-1F692", nullptr, 1820, 3, 15, 961, 1},
+    {"1F468-1F3FB-200D-1F692", nullptr, 1823, 4, 15, 962, 1},
+    {"1F468-1F3FC-200D-1F692", nullptr, 1827, 4, 15, 963, 1},
+    {"1F468-1F3FD-200D-1F692", nullptr, 1831, 4, 15, 964, 1},
+    {"1F468-1F3FE-200D-1F692", nullptr, 1835, 4, 15, 965, 1},
+    {"1F468-1F3FF-200D-1F692", nullptr, 1839, 4, 15, 966, 1},
+    {"1F468-200D-1F9AF", nullptr, 1843, 3, 15, 967, 1},
+    {"1F468-1F3FB-200D-1F9AF", nullptr, 1846, 4, 15, 968, 1},
+    {"1F468-1F3FC-200D-1F9AF", nullptr, 1850, 4, 15, 969, 1},
+    {"1F468-1F3FD-200D-1F9AF", nullptr, 1854, 4, 15, 970, 1},
+    {"1F468-1F3FE-200D-1F9AF", nullptr, 1858, 4, 15, 971, 1},
+    {"1F468-1F3FF-200D-1F9AF", nullptr, 1862, 4, 15, 972, 1},
+    {"1F468-200D-1F9B0", nullptr, 1866, 3, 15, 973, 1},
+    {"1F468-1F3FB-200D-1F9B0", nullptr, 1869, 4, 15, 974, 1},
+    {"1F468-1F3FC-200D-1F9B0", nullptr, 1873, 4, 15, 975, 1},
+    {"1F468-1F3FD-200D-1F9B0", nullptr, 1877, 4, 15, 976, 1},
+    {"1F468-1F3FE-200D-1F9B0", nullptr, 1881, 4, 15, 977, 1},
+    {"1F468-1F3FF-200D-1F9B0", nullptr, 1885, 4, 15, 978, 1},
+    {"1F468-200D-1F9B1", nullptr, 1889, 3, 15, 979, 1},
+    {"1F468-1F3FB-200D-1F9B1", nullptr, 1892, 4, 15, 980, 1},
+    {"1F468-1F3FC-200D-1F9B1", nullptr, 1896, 4, 15, 981, 1},
+    {"1F468-1F3FD-200D-1F9B1", nullptr, 1900, 4, 15, 982, 1},
+    {"1F468-1F3FE-200D-1F9B1", nullptr, 1904, 4, 15, 983, 1},
+    {"1F468-1F3FF-200D-1F9B1", nullptr, 1908, 4, 15, 984, 1},
+    {"1F468-200D-1F9B2", nullptr, 1912, 3, 15, 985, 1},
+    {"1F468-1F3FB-200D-1F9B2", nullptr, 1915, 4, 15, 986, 1},
+    {"1F468-1F3FC-200D-1F9B2", nullptr, 1919, 4, 15, 987, 1},
+    {"1F468-1F3FD-200D-1F9B2", nullptr, 1923, 4, 15, 988, 1},
+    {"1F468-1F3FE-200D-1F9B2", nullptr, 1927, 4, 15, 989, 1},
+    {"1F468-1F3FF-200D-1F9B2", nullptr, 1931, 4, 15, 990, 1},
+    {"1F468-200D-1F9B3", nullptr, 1935, 3, 15, 991, 1},
+    {"1F468-1F3FB-200D-1F9B3", nullptr, 1938, 4, 15, 992, 1},
+    {"1F468-1F3FC-200D-1F9B3", nullptr, 1942, 4, 15, 993, 1},
+    {"1F468-1F3FD-200D-1F9B3", nullptr, 1946, 4, 15, 994, 1},
+    {"1F468-1F3FE-200D-1F9B3", nullptr, 1950, 4, 15, 995, 1},
+    {"1F468-1F3FF-200D-1F9B3", nullptr, 1954, 4, 15, 996, 1},
+    {"1F468-200D-1F9BC", nullptr, 1958, 3, 15, 997, 1},
+    {"1F468-1F3FB-200D-1F9BC", nullptr, 1961, 4, 15, 998, 1},
+    {"1F468-1F3FC-200D-1F9BC", nullptr, 1965, 4, 15, 999, 1},
+    {"1F468-1F3FD-200D-1F9BC", nullptr, 1969, 4, 15, 1000, 1},
+    {"1F468-1F3FE-200D-1F9BC", nullptr, 1973, 4, 15, 1001, 1},
+    {"1F468-1F3FF-200D-1F9BC", nullptr, 1977, 4, 15, 1002, 1},
+    {"1F468-200D-1F9BD", nullptr, 1981, 3, 15, 1003, 1},
+    {"1F468-1F3FB-200D-1F9BD", nullptr, 1984, 4, 15, 1004, 1},
+    {"1F468-1F3FC-200D-1F9BD", nullptr, 1988, 4, 15, 1005, 1},
+    {"1F468-1F3FD-200D-1F9BD", nullptr, 1992, 4, 15, 1006, 1},
+    {"1F468-1F3FE-200D-1F9BD", nullptr, 1996, 4, 15, 1007, 1},
+    {"1F468-1F3FF-200D-1F9BD", nullptr, 2000, 4, 15, 1008, 1},
+    {"1F468-200D-2695-FE0F", "1F468-200D-2695", 2004, 3, 15, 1009, 1},
+    {"1F468-1F3FB-200D-2695-FE0F", "1F468-1F3FB-200D-2695", 2007, 4, 15, 1010, 1},
+    {"1F468-1F3FC-200D-2695-FE0F", "1F468-1F3FC-200D-2695", 2011, 4, 15, 1011, 1},
+    {"1F468-1F3FD-200D-2695-FE0F", "1F468-1F3FD-200D-2695", 2015, 4, 15, 1012, 1},
+    {"1F468-1F3FE-200D-2695-FE0F", "1F468-1F3FE-200D-2695", 2019, 4, 15, 1013, 1},
+    {"1F468-1F3FF-200D-2695-FE0F", "1F468-1F3FF-200D-2695", 2023, 4, 15, 1014, 1},
+    {"1F468-200D-2696-FE0F", "1F468-200D-2696", 2027, 3, 15, 1015, 1},
+    {"1F468-1F3FB-200D-2696-FE0F", "1F468-1F3FB-200D-2696", 2030, 4, 15, 1016, 1},
+    {"1F468-1F3FC-200D-2696-FE0F", "1F468-1F3FC-200D-2696", 2034, 4, 15, 1017, 1},
+    {"1F468-1F3FD-200D-2696-FE0F", "1F468-1F3FD-200D-2696", 2038, 4, 15, 1018, 1},
+    {"1F468-1F3FE-200D-2696-FE0F", "1F468-1F3FE-200D-2696", 2042, 4, 15, 1019, 1},
+    {"1F468-1F3FF-200D-2696-FE0F", "1F468-1F3FF-200D-2696", 2046, 4, 15, 1020, 1},
+    {"1F468-200D-2708-FE0F", "1F468-200D-2708", 2050, 3, 15, 1021, 1},
+    {"1F468-1F3FB-200D-2708-FE0F", "1F468-1F3FB-200D-2708", 2053, 4, 15, 1022, 1},
+    {"1F468-1F3FC-200D-2708-FE0F", "1F468-1F3FC-200D-2708", 2057, 4, 15, 1023, 1},
+    {"1F468-1F3FD-200D-2708-FE0F", "1F468-1F3FD-200D-2708", 2061, 4, 15, 1024, 1},
+    {"1F468-1F3FE-200D-2708-FE0F", "1F468-1F3FE-200D-2708", 2065, 4, 15, 1025, 1},
+    {"1F468-1F3FF-200D-2708-FE0F", "1F468-1F3FF-200D-2708", 2069, 4, 15, 1026, 1},
+    {"1F468-200D-2764-FE0F-200D-1F468", "1F468-200D-2764-200D-1F468", 2073, 5, 15, 1027, 1},
+    {"1F468-1F3FB-200D-2764-FE0F-200D-1F468-1F3FB", "1F468-1F3FB-200D-2764-200D-1F468-1F3FB", 2078, 7, 7, 1028, 1},
+    {"1F468-1F3FB-200D-2764-FE0F-200D-1F468-1F3FC", "1F468-1F3FB-200D-2764-200D-1F468-1F3FC", 2085, 7, 7, 1029, 1},
+    {"1F468-1F3FB-200D-2764-FE0F-200D-1F468-1F3FD", "1F468-1F3FB-200D-2764-200D-1F468-1F3FD", 2092, 7, 7, 1030, 1},
+    {"1F468-1F3FB-200D-2764-FE0F-200D-1F468-1F3FE", "1F468-1F3FB-200D-2764-200D-1F468-1F3FE", 2099, 7, 7, 1031, 1},
+    {"1F468-1F3FB-200D-2764-FE0F-200D-1F468-1F3FF", "1F468-1F3FB-200D-2764-200D-1F468-1F3FF", 2106, 7, 7, 1032, 1},
+    {"1F468-1F3FC-200D-2764-FE0F-200D-1F468-1F3FB", "1F468-1F3FC-200D-2764-200D-1F468-1F3FB", 2113, 7, 7, 1033, 1},
+    {"1F468-1F3FC-200D-2764-FE0F-200D-1F468-1F3FC", "1F468-1F3FC-200D-2764-200D-1F468-1F3FC", 2120, 7, 7, 1034, 1},
+    {"1F468-1F3FC-200D-2764-FE0F-200D-1F468-1F3FD", "1F468-1F3FC-200D-2764-200D-1F468-1F3FD", 2127, 7, 7, 1035, 1},
+    {"1F468-1F3FC-200D-2764-FE0F-200D-1F468-1F3FE", "1F468-1F3FC-200D-2764-200D-1F468-1F3FE", 2134, 7, 7, 1036, 1},
+    {"1F468-1F3FC-200D-2764-FE0F-200D-1F468-1F3FF", "1F468-1F3FC-200D-2764-200D-1F468-1F3FF", 2141, 7, 7, 1037, 1},
+    {"1F468-1F3FD-200D-2764-FE0F-200D-1F468-1F3FB", "1F468-1F3FD-200D-2764-200D-1F468-1F3FB", 2148, 7, 7, 1038, 1},
+    {"1F468-1F3FD-200D-2764-FE0F-200D-1F468-1F3FC", "1F468-1F3FD-200D-2764-200D-1F468-1F3FC", 2155, 7, 7, 1039, 1},
+    {"1F468-1F3FD-200D-2764-FE0F-200D-1F468-1F3FD", "1F468-1F3FD-200D-2764-200D-1F468-1F3FD", 2162, 7, 7, 1040, 1},
+    {"1F468-1F3FD-200D-2764-FE0F-200D-1F468-1F3FE", "1F468-1F3FD-200D-2764-200D-1F468-1F3FE", 2169, 7, 7, 1041, 1},
+    {"1F468-1F3FD-200D-2764-FE0F-200D-1F468-1F3FF", "1F468-1F3FD-200D-2764-200D-1F468-1F3FF", 2176, 7, 7, 1042, 1},
+    {"1F468-1F3FE-200D-2764-FE0F-200D-1F468-1F3FB", "1F468-1F3FE-200D-2764-200D-1F468-1F3FB", 2183, 7, 7, 1043, 1},
+    {"1F468-1F3FE-200D-2764-FE0F-200D-1F468-1F3FC", "1F468-1F3FE-200D-2764-200D-1F468-1F3FC", 2190, 7, 7, 1044, 1},
+    {"1F468-1F3FE-200D-2764-FE0F-200D-1F468-1F3FD", "1F468-1F3FE-200D-2764-200D-1F468-1F3FD", 2197, 7, 7, 1045, 1},
+    {"1F468-1F3FE-200D-2764-FE0F-200D-1F468-1F3FE", "1F468-1F3FE-200D-2764-200D-1F468-1F3FE", 2204, 7, 7, 1046, 1},
+    {"1F468-1F3FE-200D-2764-FE0F-200D-1F468-1F3FF", "1F468-1F3FE-200D-2764-200D-1F468-1F3FF", 2211, 7, 7, 1047, 1},
+    {"1F468-1F3FF-200D-2764-FE0F-200D-1F468-1F3FB", "1F468-1F3FF-200D-2764-200D-1F468-1F3FB", 2218, 7, 7, 1048, 1},
+    {"1F468-1F3FF-200D-2764-FE0F-200D-1F468-1F3FC", "1F468-1F3FF-200D-2764-200D-1F468-1F3FC", 2225, 7, 7, 1049, 1},
+    {"1F468-1F3FF-200D-2764-FE0F-200D-1F468-1F3FD", "1F468-1F3FF-200D-2764-200D-1F468-1F3FD", 2232, 7, 7, 1050, 1},
+    {"1F468-1F3FF-200D-2764-FE0F-200D-1F468-1F3FE", "1F468-1F3FF-200D-2764-200D-1F468-1F3FE", 2239, 7, 7, 1051, 1},
+    {"1F468-1F3FF-200D-2764-FE0F-200D-1F468-1F3FF", "1F468-1F3FF-200D-2764-200D-1F468-1F3FF", 2246, 7, 7, 1052, 1},
+    {"1F468-200D-2764-FE0F-200D-1F48B-200D-1F468", "1F468-200D-2764-200D-1F48B-200D-1F468", 2253, 7, 15, 1053, 1},
+    {"1F468-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FB", "1F468-1F3FB-200D-2764-200D-1F48B-200D-1F468-1F3FB", 2260, 9, 7, 1054, 1},
+    {"1F468-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FC", "1F468-1F3FB-200D-2764-200D-1F48B-200D-1F468-1F3FC", 2269, 9, 7, 1055, 1},
+    {"1F468-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FD", "1F468-1F3FB-200D-2764-200D-1F48B-200D-1F468-1F3FD", 2278, 9, 7, 1056, 1},
+    {"1F468-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FE", "1F468-1F3FB-200D-2764-200D-1F48B-200D-1F468-1F3FE", 2287, 9, 7, 1057, 1},
+    {"1F468-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FF", "1F468-1F3FB-200D-2764-200D-1F48B-200D-1F468-1F3FF", 2296, 9, 7, 1058, 1},
+    {"1F468-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FB", "1F468-1F3FC-200D-2764-200D-1F48B-200D-1F468-1F3FB", 2305, 9, 7, 1059, 1},
+    {"1F468-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FC", "1F468-1F3FC-200D-2764-200D-1F48B-200D-1F468-1F3FC", 2314, 9, 7, 1060, 1},
+    {"1F468-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FD", "1F468-1F3FC-200D-2764-200D-1F48B-200D-1F468-1F3FD", 2323, 9, 7, 1061, 1},
+    {"1F468-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FE", "1F468-1F3FC-200D-2764-200D-1F48B-200D-1F468-1F3FE", 2332, 9, 7, 1062, 1},
+    {"1F468-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FF", "1F468-1F3FC-200D-2764-200D-1F48B-200D-1F468-1F3FF", 2341, 9, 7, 1063, 1},
+    {"1F468-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FB", "1F468-1F3FD-200D-2764-200D-1F48B-200D-1F468-1F3FB", 2350, 9, 7, 1064, 1},
+    {"1F468-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FC", "1F468-1F3FD-200D-2764-200D-1F48B-200D-1F468-1F3FC", 2359, 9, 7, 1065, 1},
+    {"1F468-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FD", "1F468-1F3FD-200D-2764-200D-1F48B-200D-1F468-1F3FD", 2368, 9, 7, 1066, 1},
+    {"1F468-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FE", "1F468-1F3FD-200D-2764-200D-1F48B-200D-1F468-1F3FE", 2377, 9, 7, 1067, 1},
+    {"1F468-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FF", "1F468-1F3FD-200D-2764-200D-1F48B-200D-1F468-1F3FF", 2386, 9, 7, 1068, 1},
+    {"1F468-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FB", "1F468-1F3FE-200D-2764-200D-1F48B-200D-1F468-1F3FB", 2395, 9, 7, 1069, 1},
+    {"1F468-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FC", "1F468-1F3FE-200D-2764-200D-1F48B-200D-1F468-1F3FC", 2404, 9, 7, 1070, 1},
+    {"1F468-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FD", "1F468-1F3FE-200D-2764-200D-1F48B-200D-1F468-1F3FD", 2413, 9, 7, 1071, 1},
+    {"1F468-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FE", "1F468-1F3FE-200D-2764-200D-1F48B-200D-1F468-1F3FE", 2422, 9, 7, 1072, 1},
+    {"1F468-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FF", "1F468-1F3FE-200D-2764-200D-1F48B-200D-1F468-1F3FF", 2431, 9, 7, 1073, 1},
+    {"1F468-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FB", "1F468-1F3FF-200D-2764-200D-1F48B-200D-1F468-1F3FB", 2440, 9, 7, 1074, 1},
+    {"1F468-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FC", "1F468-1F3FF-200D-2764-200D-1F48B-200D-1F468-1F3FC", 2449, 9, 7, 1075, 1},
+    {"1F468-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FD", "1F468-1F3FF-200D-2764-200D-1F48B-200D-1F468-1F3FD", 2458, 9, 7, 1076, 1},
+    {"1F468-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FE", "1F468-1F3FF-200D-2764-200D-1F48B-200D-1F468-1F3FE", 2467, 9, 7, 1077, 1},
+    {"1F468-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FF", "1F468-1F3FF-200D-2764-200D-1F48B-200D-1F468-1F3FF", 2476, 9, 7, 1078, 1},
+    {"1F468", nullptr, 2485, 1, 15, 1079, 1},
+    {"1F468-1F3FB", nullptr, 2486, 2, 15, 1080, 1},
+    {"1F468-1F3FC", nullptr, 2488, 2, 15, 1081, 1},
+    {"1F468-1F3FD", nullptr, 2490, 2, 15, 1082, 1},
+    {"1F468-1F3FE", nullptr, 2492, 2, 15, 1083, 1},
+    {"1F468-1F3FF", nullptr, 2494, 2, 15, 1084, 1},
+    {"1F469-200D-1F33E", nullptr, 2496, 3, 15, 1085, 1},
+    {"1F469-1F3FB-200D-1F33E", nullptr, 2499, 4, 15, 1086, 1},
+    {"1F469-1F3FC-200D-1F33E", nullptr, 2503, 4, 15, 1087, 1},
+    {"1F469-1F3FD-200D-1F33E", nullptr, 2507, 4, 15, 1088, 1},
+    {"1F469-1F3FE-200D-1F33E", nullptr, 2511, 4, 15, 1089, 1},
+    {"1F469-1F3FF-200D-1F33E", nullptr, 2515, 4, 15, 1090, 1},
+    {"1F469-200D-1F373", nullptr, 2519, 3, 15, 1091, 1},
+    {"1F469-1F3FB-200D-1F373", nullptr, 2522, 4, 15, 1092, 1},
+    {"1F469-1F3FC-200D-1F373", nullptr, 2526, 4, 15, 1093, 1},
+    {"1F469-1F3FD-200D-1F373", nullptr, 2530, 4, 15, 1094, 1},
+    {"1F469-1F3FE-200D-1F373", nullptr, 2534, 4, 15, 1095, 1},
+    {"1F469-1F3FF-200D-1F373", nullptr, 2538, 4, 15, 1096, 1},
+    {"1F469-200D-1F37C", nullptr, 2542, 3, 15, 1097, 1},
+    {"1F469-1F3FB-200D-1F37C", nullptr, 2545, 4, 15, 1098, 1},
+    {"1F469-1F3FC-200D-1F37C", nullptr, 2549, 4, 15, 1099, 1},
+    {"1F469-1F3FD-200D-1F37C", nullptr, 2553, 4, 15, 1100, 1},
+    {"1F469-1F3FE-200D-1F37C", nullptr, 2557, 4, 15, 1101, 1},
+    {"1F469-1F3FF-200D-1F37C", nullptr, 2561, 4, 15, 1102, 1},
+    {"1F469-200D-1F393", nullptr, 2565, 3, 15, 1103, 1},
+    {"1F469-1F3FB-200D-1F393", nullptr, 2568, 4, 15, 1104, 1},
+    {"1F469-1F3FC-200D-1F393", nullptr, 2572, 4, 15, 1105, 1},
+    {"1F469-1F3FD-200D-1F393", nullptr, 2576, 4, 15, 1106, 1},
+    {"1F469-1F3FE-200D-1F393", nullptr, 2580, 4, 15, 1107, 1},
+    {"1F469-1F3FF-200D-1F393", nullptr, 2584, 4, 15, 1108, 1},
+    {"1F469-200D-1F3A4", nullptr, 2588, 3, 15, 1109, 1},
+    {"1F469-1F3FB-200D-1F3A4", nullptr, 2591, 4, 15, 1110, 1},
+    {"1F469-1F3FC-200D-1F3A4", nullptr, 2595, 4, 15, 1111, 1},
+    {"1F469-1F3FD-200D-1F3A4", nullptr, 2599, 4, 15, 1112, 1},
+    {"1F469-1F3FE-200D-1F3A4", nullptr, 2603, 4, 15, 1113, 1},
+    {"1F469-1F3FF-200D-1F3A4", nullptr, 2607, 4, 15, 1114, 1},
+    {"1F469-200D-1F3A8", nullptr, 2611, 3, 15, 1115, 1},
+    {"1F469-1F3FB-200D-1F3A8", nullptr, 2614, 4, 15, 1116, 1},
+    {"1F469-1F3FC-200D-1F3A8", nullptr, 2618, 4, 15, 1117, 1},
+    {"1F469-1F3FD-200D-1F3A8", nullptr, 2622, 4, 15, 1118, 1},
+    {"1F469-1F3FE-200D-1F3A8", nullptr, 2626, 4, 15, 1119, 1},
+    {"1F469-1F3FF-200D-1F3A8", nullptr, 2630, 4, 15, 1120, 1},
+    {"1F469-200D-1F3EB", nullptr, 2634, 3, 15, 1121, 1},
+    {"1F469-1F3FB-200D-1F3EB", nullptr, 2637, 4, 15, 1122, 1},
+    {"1F469-1F3FC-200D-1F3EB", nullptr, 2641, 4, 15, 1123, 1},
+    {"1F469-1F3FD-200D-1F3EB", nullptr, 2645, 4, 15, 1124, 1},
+    {"1F469-1F3FE-200D-1F3EB", nullptr, 2649, 4, 15, 1125, 1},
+    {"1F469-1F3FF-200D-1F3EB", nullptr, 2653, 4, 15, 1126, 1},
+    {"1F469-200D-1F3ED", nullptr, 2657, 3, 15, 1127, 1},
+    {"1F469-1F3FB-200D-1F3ED", nullptr, 2660, 4, 15, 1128, 1},
+    {"1F469-1F3FC-200D-1F3ED", nullptr, 2664, 4, 15, 1129, 1},
+    {"1F469-1F3FD-200D-1F3ED", nullptr, 2668, 4, 15, 1130, 1},
+    {"1F469-1F3FE-200D-1F3ED", nullptr, 2672, 4, 15, 1131, 1},
+    {"1F469-1F3FF-200D-1F3ED", nullptr, 2676, 4, 15, 1132, 1},
+    {"1F469-200D-1F466-200D-1F466", nullptr, 2680, 5, 15, 1133, 1},
+    {"1F469-200D-1F466", nullptr, 2685, 3, 15, 1134, 1},
+    {"1F469-200D-1F467-200D-1F466", nullptr, 2688, 5, 15, 1135, 1},
+    {"1F469-200D-1F467-200D-1F467", nullptr, 2693, 5, 15, 1136, 1},
+    {"1F469-200D-1F467", nullptr, 2698, 3, 15, 1137, 1},
+    {"1F469-200D-1F469-200D-1F466", nullptr, 2701, 5, 15, 1138, 1},
+    {"1F469-200D-1F469-200D-1F466-200D-1F466", nullptr, 2706, 7, 15, 1139, 1},
+    {"1F469-200D-1F469-200D-1F467", nullptr, 2713, 5, 15, 1140, 1},
+    {"1F469-200D-1F469-200D-1F467-200D-1F466", nullptr, 2718, 7, 15, 1141, 1},
+    {"1F469-200D-1F469-200D-1F467-200D-1F467", nullptr, 2725, 7, 15, 1142, 1},
+    {"1F469-200D-1F4BB", nullptr, 2732, 3, 15, 1143, 1},
+    {"1F469-1F3FB-200D-1F4BB", nullptr, 2735, 4, 15, 1144, 1},
+    {"1F469-1F3FC-200D-1F4BB", nullptr, 2739, 4, 15, 1145, 1},
+    {"1F469-1F3FD-200D-1F4BB", nullptr, 2743, 4, 15, 1146, 1},
+    {"1F469-1F3FE-200D-1F4BB", nullptr, 2747, 4, 15, 1147, 1},
+    {"1F469-1F3FF-200D-1F4BB", nullptr, 2751, 4, 15, 1148, 1},
+    {"1F469-200D-1F4BC", nullptr, 2755, 3, 15, 1149, 1},
+    {"1F469-1F3FB-200D-1F4BC", nullptr, 2758, 4, 15, 1150, 1},
+    {"1F469-1F3FC-200D-1F4BC", nullptr, 2762, 4, 15, 1151, 1},
+    {"1F469-1F3FD-200D-1F4BC", nullptr, 2766, 4, 15, 1152, 1},
+    {"1F469-1F3FE-200D-1F4BC", nullptr, 2770, 4, 15, 1153, 1},
+    {"1F469-1F3FF-200D-1F4BC", nullptr, 2774, 4, 15, 1154, 1},
+    {"1F469-200D-1F527", nullptr, 2778, 3, 15, 1155, 1},
+    {"1F469-1F3FB-200D-1F527", nullptr, 2781, 4, 15, 1156, 1},
+    {"1F469-1F3FC-200D-1F527", nullptr, 2785, 4, 15, 1157, 1},
+    {"1F469-1F3FD-200D-1F527", nullptr, 2789, 4, 15, 1158, 1},
+    {"1F469-1F3FE-200D-1F527", nullptr, 2793, 4, 15, 1159, 1},
+    {"1F469-1F3FF-200D-1F527", nullptr, 2797, 4, 15, 1160, 1},
+    {"1F469-200D-1F52C", nullptr, 2801, 3, 15, 1161, 1},
+    {"1F469-1F3FB-200D-1F52C", nullptr, 2804, 4, 15, 1162, 1},
+    {"1F469-1F3FC-200D-1F52C", nullptr, 2808, 4, 15, 1163, 1},
+    {"1F469-1F3FD-200D-1F52C", nullptr, 2812, 4, 15, 1164, 1},
+    {"1F469-1F3FE-200D-1F52C", nullptr, 2816, 4, 15, 1165, 1},
+    {"1F469-1F3FF-200D-1F52C", nullptr, 2820, 4, 15, 1166, 1},
+    {"1F469-200D-1F680", nullptr, 2824, 3, 15, 1167, 1},
+    {"1F469-1F3FB-200D-1F680", nullptr, 2827, 4, 15, 1168, 1},
+    {"1F469-1F3FC-200D-1F680", nullptr, 2831, 4, 15, 1169, 1},
+    {"1F469-1F3FD-200D-1F680", nullptr, 2835, 4, 15, 1170, 1},
+    {"1F469-1F3FE-200D-1F680", nullptr, 2839, 4, 15, 1171, 1},
+    {"1F469-1F3FF-200D-1F680", nullptr, 2843, 4, 15, 1172, 1},
+    {"1F469-200D-1F692", nullptr, 2847, 3, 15, 1173, 1},
+    {"1F469-1F3FB-200D-1F692", nullptr, 2850, 4, 15, 1174, 1},
+    {"1F469-1F3FC-200D-1F692", nullptr, 2854, 4, 15, 1175, 1},
+    {"1F469-1F3FD-200D-1F692", nullptr, 2858, 4, 15, 1176, 1},
+    {"1F469-1F3FE-200D-1F692", nullptr, 2862, 4, 15, 1177, 1},
+    {"1F469-1F3FF-200D-1F692", nullptr, 2866, 4, 15, 1178, 1},
+    {"1F469-200D-1F9AF", nullptr, 2870, 3, 15, 1179, 1},
+    {"1F469-1F3FB-200D-1F9AF", nullptr, 2873, 4, 15, 1180, 1},
+    {"1F469-1F3FC-200D-1F9AF", nullptr, 2877, 4, 15, 1181, 1},
+    {"1F469-1F3FD-200D-1F9AF", nullptr, 2881, 4, 15, 1182, 1},
+    {"1F469-1F3FE-200D-1F9AF", nullptr, 2885, 4, 15, 1183, 1},
+    {"1F469-1F3FF-200D-1F9AF", nullptr, 2889, 4, 15, 1184, 1},
+    {"1F469-200D-1F9B0", nullptr, 2893, 3, 15, 1185, 1},
+    {"1F469-1F3FB-200D-1F9B0", nullptr, 2896, 4, 15, 1186, 1},
+    {"1F469-1F3FC-200D-1F9B0", nullptr, 2900, 4, 15, 1187, 1},
+    {"1F469-1F3FD-200D-1F9B0", nullptr, 2904, 4, 15, 1188, 1},
+    {"1F469-1F3FE-200D-1F9B0", nullptr, 2908, 4, 15, 1189, 1},
+    {"1F469-1F3FF-200D-1F9B0", nullptr, 2912, 4, 15, 1190, 1},
+    {"1F469-200D-1F9B1", nullptr, 2916, 3, 15, 1191, 1},
+    {"1F469-1F3FB-200D-1F9B1", nullptr, 2919, 4, 15, 1192, 1},
+    {"1F469-1F3FC-200D-1F9B1", nullptr, 2923, 4, 15, 1193, 1},
+    {"1F469-1F3FD-200D-1F9B1", nullptr, 2927, 4, 15, 1194, 1},
+    {"1F469-1F3FE-200D-1F9B1", nullptr, 2931, 4, 15, 1195, 1},
+    {"1F469-1F3FF-200D-1F9B1", nullptr, 2935, 4, 15, 1196, 1},
+    {"1F469-200D-1F9B2", nullptr, 2939, 3, 15, 1197, 1},
+    {"1F469-1F3FB-200D-1F9B2", nullptr, 2942, 4, 15, 1198, 1},
+    {"1F469-1F3FC-200D-1F9B2", nullptr, 2946, 4, 15, 1199, 1},
+    {"1F469-1F3FD-200D-1F9B2", nullptr, 2950, 4, 15, 1200, 1},
+    {"1F469-1F3FE-200D-1F9B2", nullptr, 2954, 4, 15, 1201, 1},
+    {"1F469-1F3FF-200D-1F9B2", nullptr, 2958, 4, 15, 1202, 1},
+    {"1F469-200D-1F9B3", nullptr, 2962, 3, 15, 1203, 1},
+    {"1F469-1F3FB-200D-1F9B3", nullptr, 2965, 4, 15, 1204, 1},
+    {"1F469-1F3FC-200D-1F9B3", nullptr, 2969, 4, 15, 1205, 1},
+    {"1F469-1F3FD-200D-1F9B3", nullptr, 2973, 4, 15, 1206, 1},
+    {"1F469-1F3FE-200D-1F9B3", nullptr, 2977, 4, 15, 1207, 1},
+    {"1F469-1F3FF-200D-1F9B3", nullptr, 2981, 4, 15, 1208, 1},
+    {"1F469-200D-1F9BC", nullptr, 2985, 3, 15, 1209, 1},
+    {"1F469-1F3FB-200D-1F9BC", nullptr, 2988, 4, 15, 1210, 1},
+    {"1F469-1F3FC-200D-1F9BC", nullptr, 2992, 4, 15, 1211, 1},
+    {"1F469-1F3FD-200D-1F9BC", nullptr, 2996, 4, 15, 1212, 1},
+    {"1F469-1F3FE-200D-1F9BC", nullptr, 3000, 4, 15, 1213, 1},
+    {"1F469-1F3FF-200D-1F9BC", nullptr, 3004, 4, 15, 1214, 1},
+    {"1F469-200D-1F9BD", nullptr, 3008, 3, 15, 1215, 1},
+    {"1F469-1F3FB-200D-1F9BD", nullptr, 3011, 4, 15, 1216, 1},
+    {"1F469-1F3FC-200D-1F9BD", nullptr, 3015, 4, 15, 1217, 1},
+    {"1F469-1F3FD-200D-1F9BD", nullptr, 3019, 4, 15, 1218, 1},
+    {"1F469-1F3FE-200D-1F9BD", nullptr, 3023, 4, 15, 1219, 1},
+    {"1F469-1F3FF-200D-1F9BD", nullptr, 3027, 4, 15, 1220, 1},
+    {"1F469-200D-2695-FE0F", "1F469-200D-2695", 3031, 3, 15, 1221, 1},
+    {"1F469-1F3FB-200D-2695-FE0F", "1F469-1F3FB-200D-2695", 3034, 4, 15, 1222, 1},
+    {"1F469-1F3FC-200D-2695-FE0F", "1F469-1F3FC-200D-2695", 3038, 4, 15, 1223, 1},
+    {"1F469-1F3FD-200D-2695-FE0F", "1F469-1F3FD-200D-2695", 3042, 4, 15, 1224, 1},
+    {"1F469-1F3FE-200D-2695-FE0F", "1F469-1F3FE-200D-2695", 3046, 4, 15, 1225, 1},
+    {"1F469-1F3FF-200D-2695-FE0F", "1F469-1F3FF-200D-2695", 3050, 4, 15, 1226, 1},
+    {"1F469-200D-2696-FE0F", "1F469-200D-2696", 3054, 3, 15, 1227, 1},
+    {"1F469-1F3FB-200D-2696-FE0F", "1F469-1F3FB-200D-2696", 3057, 4, 15, 1228, 1},
+    {"1F469-1F3FC-200D-2696-FE0F", "1F469-1F3FC-200D-2696", 3061, 4, 15, 1229, 1},
+    {"1F469-1F3FD-200D-2696-FE0F", "1F469-1F3FD-200D-2696", 3065, 4, 15, 1230, 1},
+    {"1F469-1F3FE-200D-2696-FE0F", "1F469-1F3FE-200D-2696", 3069, 4, 15, 1231, 1},
+    {"1F469-1F3FF-200D-2696-FE0F", "1F469-1F3FF-200D-2696", 3073, 4, 15, 1232, 1},
+    {"1F469-200D-2708-FE0F", "1F469-200D-2708", 3077, 3, 15, 1233, 1},
+    {"1F469-1F3FB-200D-2708-FE0F", "1F469-1F3FB-200D-2708", 3080, 4, 15, 1234, 1},
+    {"1F469-1F3FC-200D-2708-FE0F", "1F469-1F3FC-200D-2708", 3084, 4, 15, 1235, 1},
+    {"1F469-1F3FD-200D-2708-FE0F", "1F469-1F3FD-200D-2708", 3088, 4, 15, 1236, 1},
+    {"1F469-1F3FE-200D-2708-FE0F", "1F469-1F3FE-200D-2708", 3092, 4, 15, 1237, 1},
+    {"1F469-1F3FF-200D-2708-FE0F", "1F469-1F3FF-200D-2708", 3096, 4, 15, 1238, 1},
+    {"1F469-200D-2764-FE0F-200D-1F468", "1F469-200D-2764-200D-1F468", 3100, 5, 15, 1239, 1},
+    {"1F469-1F3FB-200D-2764-FE0F-200D-1F468-1F3FB", "1F469-1F3FB-200D-2764-200D-1F468-1F3FB", 3105, 7, 7, 1240, 1},
+    {"1F469-1F3FB-200D-2764-FE0F-200D-1F468-1F3FC", "1F469-1F3FB-200D-2764-200D-1F468-1F3FC", 3112, 7, 7, 1241, 1},
+    {"1F469-1F3FB-200D-2764-FE0F-200D-1F468-1F3FD", "1F469-1F3FB-200D-2764-200D-1F468-1F3FD", 3119, 7, 7, 1242, 1},
+    {"1F469-1F3FB-200D-2764-FE0F-200D-1F468-1F3FE", "1F469-1F3FB-200D-2764-200D-1F468-1F3FE", 3126, 7, 7, 1243, 1},
+    {"1F469-1F3FB-200D-2764-FE0F-200D-1F468-1F3FF", "1F469-1F3FB-200D-2764-200D-1F468-1F3FF", 3133, 7, 7, 1244, 1},
+    {"1F469-1F3FC-200D-2764-FE0F-200D-1F468-1F3FB", "1F469-1F3FC-200D-2764-200D-1F468-1F3FB", 3140, 7, 7, 1245, 1},
+    {"1F469-1F3FC-200D-2764-FE0F-200D-1F468-1F3FC", "1F469-1F3FC-200D-2764-200D-1F468-1F3FC", 3147, 7, 7, 1246, 1},
+    {"1F469-1F3FC-200D-2764-FE0F-200D-1F468-1F3FD", "1F469-1F3FC-200D-2764-200D-1F468-1F3FD", 3154, 7, 7, 1247, 1},
+    {"1F469-1F3FC-200D-2764-FE0F-200D-1F468-1F3FE", "1F469-1F3FC-200D-2764-200D-1F468-1F3FE", 3161, 7, 7, 1248, 1},
+    {"1F469-1F3FC-200D-2764-FE0F-200D-1F468-1F3FF", "1F469-1F3FC-200D-2764-200D-1F468-1F3FF", 3168, 7, 7, 1249, 1},
+    {"1F469-1F3FD-200D-2764-FE0F-200D-1F468-1F3FB", "1F469-1F3FD-200D-2764-200D-1F468-1F3FB", 3175, 7, 7, 1250, 1},
+    {"1F469-1F3FD-200D-2764-FE0F-200D-1F468-1F3FC", "1F469-1F3FD-200D-2764-200D-1F468-1F3FC", 3182, 7, 7, 1251, 1},
+    {"1F469-1F3FD-200D-2764-FE0F-200D-1F468-1F3FD", "1F469-1F3FD-200D-2764-200D-1F468-1F3FD", 3189, 7, 7, 1252, 1},
+    {"1F469-1F3FD-200D-2764-FE0F-200D-1F468-1F3FE", "1F469-1F3FD-200D-2764-200D-1F468-1F3FE", 3196, 7, 7, 1253, 1},
+    {"1F469-1F3FD-200D-2764-FE0F-200D-1F468-1F3FF", "1F469-1F3FD-200D-2764-200D-1F468-1F3FF", 3203, 7, 7, 1254, 1},
+    {"1F469-1F3FE-200D-2764-FE0F-200D-1F468-1F3FB", "1F469-1F3FE-200D-2764-200D-1F468-1F3FB", 3210, 7, 7, 1255, 1},
+    {"1F469-1F3FE-200D-2764-FE0F-200D-1F468-1F3FC", "1F469-1F3FE-200D-2764-200D-1F468-1F3FC", 3217, 7, 7, 1256, 1},
+    {"1F469-1F3FE-200D-2764-FE0F-200D-1F468-1F3FD", "1F469-1F3FE-200D-2764-200D-1F468-1F3FD", 3224, 7, 7, 1257, 1},
+    {"1F469-1F3FE-200D-2764-FE0F-200D-1F468-1F3FE", "1F469-1F3FE-200D-2764-200D-1F468-1F3FE", 3231, 7, 7, 1258, 1},
+    {"1F469-1F3FE-200D-2764-FE0F-200D-1F468-1F3FF", "1F469-1F3FE-200D-2764-200D-1F468-1F3FF", 3238, 7, 7, 1259, 1},
+    {"1F469-1F3FF-200D-2764-FE0F-200D-1F468-1F3FB", "1F469-1F3FF-200D-2764-200D-1F468-1F3FB", 3245, 7, 7, 1260, 1},
+    {"1F469-1F3FF-200D-2764-FE0F-200D-1F468-1F3FC", "1F469-1F3FF-200D-2764-200D-1F468-1F3FC", 3252, 7, 7, 1261, 1},
+    {"1F469-1F3FF-200D-2764-FE0F-200D-1F468-1F3FD", "1F469-1F3FF-200D-2764-200D-1F468-1F3FD", 3259, 7, 7, 1262, 1},
+    {"1F469-1F3FF-200D-2764-FE0F-200D-1F468-1F3FE", "1F469-1F3FF-200D-2764-200D-1F468-1F3FE", 3266, 7, 7, 1263, 1},
+    {"1F469-1F3FF-200D-2764-FE0F-200D-1F468-1F3FF", "1F469-1F3FF-200D-2764-200D-1F468-1F3FF", 3273, 7, 7, 1264, 1},
+    {"1F469-200D-2764-FE0F-200D-1F469", "1F469-200D-2764-200D-1F469", 3280, 5, 15, 1265, 1},
+    {"1F469-1F3FB-200D-2764-FE0F-200D-1F469-1F3FB", "1F469-1F3FB-200D-2764-200D-1F469-1F3FB", 3285, 7, 7, 1266, 1},
+    {"1F469-1F3FB-200D-2764-FE0F-200D-1F469-1F3FC", "1F469-1F3FB-200D-2764-200D-1F469-1F3FC", 3292, 7, 7, 1267, 1},
+    {"1F469-1F3FB-200D-2764-FE0F-200D-1F469-1F3FD", "1F469-1F3FB-200D-2764-200D-1F469-1F3FD", 3299, 7, 7, 1268, 1},
+    {"1F469-1F3FB-200D-2764-FE0F-200D-1F469-1F3FE", "1F469-1F3FB-200D-2764-200D-1F469-1F3FE", 3306, 7, 7, 1269, 1},
+    {"1F469-1F3FB-200D-2764-FE0F-200D-1F469-1F3FF", "1F469-1F3FB-200D-2764-200D-1F469-1F3FF", 3313, 7, 7, 1270, 1},
+    {"1F469-1F3FC-200D-2764-FE0F-200D-1F469-1F3FB", "1F469-1F3FC-200D-2764-200D-1F469-1F3FB", 3320, 7, 7, 1271, 1},
+    {"1F469-1F3FC-200D-2764-FE0F-200D-1F469-1F3FC", "1F469-1F3FC-200D-2764-200D-1F469-1F3FC", 3327, 7, 7, 1272, 1},
+    {"1F469-1F3FC-200D-2764-FE0F-200D-1F469-1F3FD", "1F469-1F3FC-200D-2764-200D-1F469-1F3FD", 3334, 7, 7, 1273, 1},
+    {"1F469-1F3FC-200D-2764-FE0F-200D-1F469-1F3FE", "1F469-1F3FC-200D-2764-200D-1F469-1F3FE", 3341, 7, 7, 1274, 1},
+    {"1F469-1F3FC-200D-2764-FE0F-200D-1F469-1F3FF", "1F469-1F3FC-200D-2764-200D-1F469-1F3FF", 3348, 7, 7, 1275, 1},
+    {"1F469-1F3FD-200D-2764-FE0F-200D-1F469-1F3FB", "1F469-1F3FD-200D-2764-200D-1F469-1F3FB", 3355, 7, 7, 1276, 1},
+    {"1F469-1F3FD-200D-2764-FE0F-200D-1F469-1F3FC", "1F469-1F3FD-200D-2764-200D-1F469-1F3FC", 3362, 7, 7, 1277, 1},
+    {"1F469-1F3FD-200D-2764-FE0F-200D-1F469-1F3FD", "1F469-1F3FD-200D-2764-200D-1F469-1F3FD", 3369, 7, 7, 1278, 1},
+    {"1F469-1F3FD-200D-2764-FE0F-200D-1F469-1F3FE", "1F469-1F3FD-200D-2764-200D-1F469-1F3FE", 3376, 7, 7, 1279, 1},
+    {"1F469-1F3FD-200D-2764-FE0F-200D-1F469-1F3FF", "1F469-1F3FD-200D-2764-200D-1F469-1F3FF", 3383, 7, 7, 1280, 1},
+    {"1F469-1F3FE-200D-2764-FE0F-200D-1F469-1F3FB", "1F469-1F3FE-200D-2764-200D-1F469-1F3FB", 3390, 7, 7, 1281, 1},
+    {"1F469-1F3FE-200D-2764-FE0F-200D-1F469-1F3FC", "1F469-1F3FE-200D-2764-200D-1F469-1F3FC", 3397, 7, 7, 1282, 1},
+    {"1F469-1F3FE-200D-2764-FE0F-200D-1F469-1F3FD", "1F469-1F3FE-200D-2764-200D-1F469-1F3FD", 3404, 7, 7, 1283, 1},
+    {"1F469-1F3FE-200D-2764-FE0F-200D-1F469-1F3FE", "1F469-1F3FE-200D-2764-200D-1F469-1F3FE", 3411, 7, 7, 1284, 1},
+    {"1F469-1F3FE-200D-2764-FE0F-200D-1F469-1F3FF", "1F469-1F3FE-200D-2764-200D-1F469-1F3FF", 3418, 7, 7, 1285, 1},
+    {"1F469-1F3FF-200D-2764-FE0F-200D-1F469-1F3FB", "1F469-1F3FF-200D-2764-200D-1F469-1F3FB", 3425, 7, 7, 1286, 1},
+    {"1F469-1F3FF-200D-2764-FE0F-200D-1F469-1F3FC", "1F469-1F3FF-200D-2764-200D-1F469-1F3FC", 3432, 7, 7, 1287, 1},
+    {"1F469-1F3FF-200D-2764-FE0F-200D-1F469-1F3FD", "1F469-1F3FF-200D-2764-200D-1F469-1F3FD", 3439, 7, 7, 1288, 1},
+    {"1F469-1F3FF-200D-2764-FE0F-200D-1F469-1F3FE", "1F469-1F3FF-200D-2764-200D-1F469-1F3FE", 3446, 7, 7, 1289, 1},
+    {"1F469-1F3FF-200D-2764-FE0F-200D-1F469-1F3FF", "1F469-1F3FF-200D-2764-200D-1F469-1F3FF", 3453, 7, 7, 1290, 1},
+    {"1F469-200D-2764-FE0F-200D-1F48B-200D-1F468", "1F469-200D-2764-200D-1F48B-200D-1F468", 3460, 7, 15, 1291, 1},
+    {"1F469-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FB", "1F469-1F3FB-200D-2764-200D-1F48B-200D-1F468-1F3FB", 3467, 9, 7, 1292, 1},
+    {"1F469-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FC", "1F469-1F3FB-200D-2764-200D-1F48B-200D-1F468-1F3FC", 3476, 9, 7, 1293, 1},
+    {"1F469-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FD", "1F469-1F3FB-200D-2764-200D-1F48B-200D-1F468-1F3FD", 3485, 9, 7, 1294, 1},
+    {"1F469-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FE", "1F469-1F3FB-200D-2764-200D-1F48B-200D-1F468-1F3FE", 3494, 9, 7, 1295, 1},
+    {"1F469-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FF", "1F469-1F3FB-200D-2764-200D-1F48B-200D-1F468-1F3FF", 3503, 9, 7, 1296, 1},
+    {"1F469-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FB", "1F469-1F3FC-200D-2764-200D-1F48B-200D-1F468-1F3FB", 3512, 9, 7, 1297, 1},
+    {"1F469-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FC", "1F469-1F3FC-200D-2764-200D-1F48B-200D-1F468-1F3FC", 3521, 9, 7, 1298, 1},
+    {"1F469-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FD", "1F469-1F3FC-200D-2764-200D-1F48B-200D-1F468-1F3FD", 3530, 9, 7, 1299, 1},
+    {"1F469-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FE", "1F469-1F3FC-200D-2764-200D-1F48B-200D-1F468-1F3FE", 3539, 9, 7, 1300, 1},
+    {"1F469-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FF", "1F469-1F3FC-200D-2764-200D-1F48B-200D-1F468-1F3FF", 3548, 9, 7, 1301, 1},
+    {"1F469-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FB", "1F469-1F3FD-200D-2764-200D-1F48B-200D-1F468-1F3FB", 3557, 9, 7, 1302, 1},
+    {"1F469-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FC", "1F469-1F3FD-200D-2764-200D-1F48B-200D-1F468-1F3FC", 3566, 9, 7, 1303, 1},
+    {"1F469-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FD", "1F469-1F3FD-200D-2764-200D-1F48B-200D-1F468-1F3FD", 3575, 9, 7, 1304, 1},
+    {"1F469-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FE", "1F469-1F3FD-200D-2764-200D-1F48B-200D-1F468-1F3FE", 3584, 9, 7, 1305, 1},
+    {"1F469-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FF", "1F469-1F3FD-200D-2764-200D-1F48B-200D-1F468-1F3FF", 3593, 9, 7, 1306, 1},
+    {"1F469-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FB", "1F469-1F3FE-200D-2764-200D-1F48B-200D-1F468-1F3FB", 3602, 9, 7, 1307, 1},
+    {"1F469-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FC", "1F469-1F3FE-200D-2764-200D-1F48B-200D-1F468-1F3FC", 3611, 9, 7, 1308, 1},
+    {"1F469-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FD", "1F469-1F3FE-200D-2764-200D-1F48B-200D-1F468-1F3FD", 3620, 9, 7, 1309, 1},
+    {"1F469-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FE", "1F469-1F3FE-200D-2764-200D-1F48B-200D-1F468-1F3FE", 3629, 9, 7, 1310, 1},
+    {"1F469-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FF", "1F469-1F3FE-200D-2764-200D-1F48B-200D-1F468-1F3FF", 3638, 9, 7, 1311, 1},
+    {"1F469-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FB", "1F469-1F3FF-200D-2764-200D-1F48B-200D-1F468-1F3FB", 3647, 9, 7, 1312, 1},
+    {"1F469-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FC", "1F469-1F3FF-200D-2764-200D-1F48B-200D-1F468-1F3FC", 3656, 9, 7, 1313, 1},
+    {"1F469-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FD", "1F469-1F3FF-200D-2764-200D-1F48B-200D-1F468-1F3FD", 3665, 9, 7, 1314, 1},
+    {"1F469-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FE", "1F469-1F3FF-200D-2764-200D-1F48B-200D-1F468-1F3FE", 3674, 9, 7, 1315, 1},
+    {"1F469-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FF", "1F469-1F3FF-200D-2764-200D-1F48B-200D-1F468-1F3FF", 3683, 9, 7, 1316, 1},
+    {"1F469-200D-2764-FE0F-200D-1F48B-200D-1F469", "1F469-200D-2764-200D-1F48B-200D-1F469", 3692, 7, 15, 1317, 1},
+    {"1F469-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FB", "1F469-1F3FB-200D-2764-200D-1F48B-200D-1F469-1F3FB", 3699, 9, 7, 1318, 1},
+    {"1F469-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FC", "1F469-1F3FB-200D-2764-200D-1F48B-200D-1F469-1F3FC", 3708, 9, 7, 1319, 1},
+    {"1F469-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FD", "1F469-1F3FB-200D-2764-200D-1F48B-200D-1F469-1F3FD", 3717, 9, 7, 1320, 1},
+    {"1F469-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FE", "1F469-1F3FB-200D-2764-200D-1F48B-200D-1F469-1F3FE", 3726, 9, 7, 1321, 1},
+    {"1F469-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FF", "1F469-1F3FB-200D-2764-200D-1F48B-200D-1F469-1F3FF", 3735, 9, 7, 1322, 1},
+    {"1F469-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FB", "1F469-1F3FC-200D-2764-200D-1F48B-200D-1F469-1F3FB", 3744, 9, 7, 1323, 1},
+    {"1F469-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FC", "1F469-1F3FC-200D-2764-200D-1F48B-200D-1F469-1F3FC", 3753, 9, 7, 1324, 1},
+    {"1F469-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FD", "1F469-1F3FC-200D-2764-200D-1F48B-200D-1F469-1F3FD", 3762, 9, 7, 1325, 1},
+    {"1F469-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FE", "1F469-1F3FC-200D-2764-200D-1F48B-200D-1F469-1F3FE", 3771, 9, 7, 1326, 1},
+    {"1F469-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FF", "1F469-1F3FC-200D-2764-200D-1F48B-200D-1F469-1F3FF", 3780, 9, 7, 1327, 1},
+    {"1F469-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FB", "1F469-1F3FD-200D-2764-200D-1F48B-200D-1F469-1F3FB", 3789, 9, 7, 1328, 1},
+    {"1F469-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FC", "1F469-1F3FD-200D-2764-200D-1F48B-200D-1F469-1F3FC", 3798, 9, 7, 1329, 1},
+    {"1F469-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FD", "1F469-1F3FD-200D-2764-200D-1F48B-200D-1F469-1F3FD", 3807, 9, 7, 1330, 1},
+    {"1F469-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FE", "1F469-1F3FD-200D-2764-200D-1F48B-200D-1F469-1F3FE", 3816, 9, 7, 1331, 1},
+    {"1F469-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FF", "1F469-1F3FD-200D-2764-200D-1F48B-200D-1F469-1F3FF", 3825, 9, 7, 1332, 1},
+    {"1F469-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FB", "1F469-1F3FE-200D-2764-200D-1F48B-200D-1F469-1F3FB", 3834, 9, 7, 1333, 1},
+    {"1F469-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FC", "1F469-1F3FE-200D-2764-200D-1F48B-200D-1F469-1F3FC", 3843, 9, 7, 1334, 1},
+    {"1F469-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FD", "1F469-1F3FE-200D-2764-200D-1F48B-200D-1F469-1F3FD", 3852, 9, 7, 1335, 1},
+    {"1F469-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FE", "1F469-1F3FE-200D-2764-200D-1F48B-200D-1F469-1F3FE", 3861, 9, 7, 1336, 1},
+    {"1F469-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FF", "1F469-1F3FE-200D-2764-200D-1F48B-200D-1F469-1F3FF", 3870, 9, 7, 1337, 1},
+    {"1F469-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FB", "1F469-1F3FF-200D-2764-200D-1F48B-200D-1F469-1F3FB", 3879, 9, 7, 1338, 1},
+    {"1F469-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FC", "1F469-1F3FF-200D-2764-200D-1F48B-200D-1F469-1F3FC", 3888, 9, 7, 1339, 1},
+    {"1F469-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FD", "1F469-1F3FF-200D-2764-200D-1F48B-200D-1F469-1F3FD", 3897, 9, 7, 1340, 1},
+    {"1F469-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FE", "1F469-1F3FF-200D-2764-200D-1F48B-200D-1F469-1F3FE", 3906, 9, 7, 1341, 1},
+    {"1F469-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FF", "1F469-1F3FF-200D-2764-200D-1F48B-200D-1F469-1F3FF", 3915, 9, 7, 1342, 1},
+    {"1F469", nullptr, 3924, 1, 15, 1343, 1},
+    {"1F469-1F3FB", nullptr, 3925, 2, 15, 1344, 1},
+    {"1F469-1F3FC", nullptr, 3927, 2, 15, 1345, 1},
+    {"1F469-1F3FD", nullptr, 3929, 2, 15, 1346, 1},
+    {"1F469-1F3FE", nullptr, 3931, 2, 15, 1347, 1},
+    {"1F469-1F3FF", nullptr, 3933, 2, 15, 1348, 1},
+    {"1F46A", nullptr, 3935, 1, 15, 1349, 1},
+    {"1F46B", nullptr, 3936, 1, 15, 1350, 3},
+    {"1F46B-1F3FB", nullptr, 3937, 2, 15, 1353, 1},
+    {"1F46B-1F3FC", nullptr, 3939, 2, 15, 1354, 1},
+    {"1F46B-1F3FD", nullptr, 3941, 2, 15, 1355, 1},
+    {"1F46B-1F3FE", nullptr, 3943, 2, 15, 1356, 1},
+    {"1F46B-1F3FF", nullptr, 3945, 2, 15, 1357, 1},
+    {"1F469-1F3FB-200D-1F91D-200D-1F468-1F3FC", nullptr, 3947, 7, 15, 1358, 1},
+    {"1F469-1F3FB-200D-1F91D-200D-1F468-1F3FD", nullptr, 3954, 7, 15, 1359, 1},
+    {"1F469-1F3FB-200D-1F91D-200D-1F468-1F3FE", nullptr, 3961, 7, 15, 1360, 1},
+    {"1F469-1F3FB-200D-1F91D-200D-1F468-1F3FF", nullptr, 3968, 7, 15, 1361, 1},
+    {"1F469-1F3FC-200D-1F91D-200D-1F468-1F3FB", nullptr, 3975, 7, 15, 1362, 1},
+    {"1F469-1F3FC-200D-1F91D-200D-1F468-1F3FD", nullptr, 3982, 7, 15, 1363, 1},
+    {"1F469-1F3FC-200D-1F91D-200D-1F468-1F3FE", nullptr, 3989, 7, 15, 1364, 1},
+    {"1F469-1F3FC-200D-1F91D-200D-1F468-1F3FF", nullptr, 3996, 7, 15, 1365, 1},
+    {"1F469-1F3FD-200D-1F91D-200D-1F468-1F3FB", nullptr, 4003, 7, 15, 1366, 1},
+    {"1F469-1F3FD-200D-1F91D-200D-1F468-1F3FC", nullptr, 4010, 7, 15, 1367, 1},
+    {"1F469-1F3FD-200D-1F91D-200D-1F468-1F3FE", nullptr, 4017, 7, 15, 1368, 1},
+    {"1F469-1F3FD-200D-1F91D-200D-1F468-1F3FF", nullptr, 4024, 7, 15, 1369, 1},
+    {"1F469-1F3FE-200D-1F91D-200D-1F468-1F3FB", nullptr, 4031, 7, 15, 1370, 1},
+    {"1F469-1F3FE-200D-1F91D-200D-1F468-1F3FC", nullptr, 4038, 7, 15, 1371, 1},
+    {"1F469-1F3FE-200D-1F91D-200D-1F468-1F3FD", nullptr, 4045, 7, 15, 1372, 1},
+    {"1F469-1F3FE-200D-1F91D-200D-1F468-1F3FF", nullptr, 4052, 7, 15, 1373, 1},
+    {"1F469-1F3FF-200D-1F91D-200D-1F468-1F3FB", nullptr, 4059, 7, 15, 1374, 1},
+    {"1F469-1F3FF-200D-1F91D-200D-1F468-1F3FC", nullptr, 4066, 7, 15, 1375, 1},
+    {"1F469-1F3FF-200D-1F91D-200D-1F468-1F3FD", nullptr, 4073, 7, 15, 1376, 1},
+    {"1F469-1F3FF-200D-1F91D-200D-1F468-1F3FE", nullptr, 4080, 7, 15, 1377, 1},
+    {"1F46C", nullptr, 4087, 1, 15, 1378, 2},
+    {"1F46C-1F3FB", nullptr, 4088, 2, 15, 1380, 1},
+    {"1F46C-1F3FC", nullptr, 4090, 2, 15, 1381, 1},
+    {"1F46C-1F3FD", nullptr, 4092, 2, 15, 1382, 1},
+    {"1F46C-1F3FE", nullptr, 4094, 2, 15, 1383, 1},
+    {"1F46C-1F3FF", nullptr, 4096, 2, 15, 1384, 1},
+    {"1F468-1F3FB-200D-1F91D-200D-1F468-1F3FC", nullptr, 4098, 7, 7, 1385, 1},
+    {"1F468-1F3FB-200D-1F91D-200D-1F468-1F3FD", nullptr, 4105, 7, 7, 1386, 1},
+    {"1F468-1F3FB-200D-1F91D-200D-1F468-1F3FE", nullptr, 4112, 7, 7, 1387, 1},
+    {"1F468-1F3FB-200D-1F91D-200D-1F468-1F3FF", nullptr, 4119, 7, 7, 1388, 1},
+    {"1F468-1F3FC-200D-1F91D-200D-1F468-1F3FB", nullptr, 4126, 7, 15, 1389, 1},
+    {"1F468-1F3FC-200D-1F91D-200D-1F468-1F3FD", nullptr, 4133, 7, 7, 1390, 1},
+    {"1F468-1F3FC-200D-1F91D-200D-1F468-1F3FE", nullptr, 4140, 7, 7, 1391, 1},
+    {"1F468-1F3FC-200D-1F91D-200D-1F468-1F3FF", nullptr, 4147, 7, 7, 1392, 1},
+    {"1F468-1F3FD-200D-1F91D-200D-1F468-1F3FB", nullptr, 4154, 7, 15, 1393, 1},
+    {"1F468-1F3FD-200D-1F91D-200D-1F468-1F3FC", nullptr, 4161, 7, 15, 1394, 1},
+    {"1F468-1F3FD-200D-1F91D-200D-1F468-1F3FE", nullptr, 4168, 7, 7, 1395, 1},
+    {"1F468-1F3FD-200D-1F91D-200D-1F468-1F3FF", nullptr, 4175, 7, 7, 1396, 1},
+    {"1F468-1F3FE-200D-1F91D-200D-1F468-1F3FB", nullptr, 4182, 7, 15, 1397, 1},
+    {"1F468-1F3FE-200D-1F91D-200D-1F468-1F3FC", nullptr, 4189, 7, 15, 1398, 1},
+    {"1F468-1F3FE-200D-1F91D-200D-1F468-1F3FD", nullptr, 4196, 7, 15, 1399, 1},
+    {"1F468-1F3FE-200D-1F91D-200D-1F468-1F3FF", nullptr, 4203, 7, 7, 1400, 1},
+    {"1F468-1F3FF-200D-1F91D-200D-1F468-1F3FB", nullptr, 4210, 7, 15, 1401, 1},
+    {"1F468-1F3FF-200D-1F91D-200D-1F468-1F3FC", nullptr, 4217, 7, 15, 1402, 1},
+    {"1F468-1F3FF-200D-1F91D-200D-1F468-1F3FD", nullptr, 4224, 7, 15, 1403, 1},
+    {"1F468-1F3FF-200D-1F91D-200D-1F468-1F3FE", nullptr, 4231, 7, 15, 1404, 1},
+    {"1F46D", nullptr, 4238, 1, 15, 1405, 2},
+    {"1F46D-1F3FB", nullptr, 4239, 2, 15, 1407, 1},
+    {"1F46D-1F3FC", nullptr, 4241, 2, 15, 1408, 1},
+    {"1F46D-1F3FD", nullptr, 4243, 2, 15, 1409, 1},
+    {"1F46D-1F3FE", nullptr, 4245, 2, 15, 1410, 1},
+    {"1F46D-1F3FF", nullptr, 4247, 2, 15, 1411, 1},
+    {"1F469-1F3FB-200D-1F91D-200D-1F469-1F3FC", nullptr, 4249, 7, 7, 1412, 1},
+    {"1F469-1F3FB-200D-1F91D-200D-1F469-1F3FD", nullptr, 4256, 7, 7, 1413, 1},
+    {"1F469-1F3FB-200D-1F91D-200D-1F469-1F3FE", nullptr, 4263, 7, 7, 1414, 1},
+    {"1F469-1F3FB-200D-1F91D-200D-1F469-1F3FF", nullptr, 4270, 7, 7, 1415, 1},
+    {"1F469-1F3FC-200D-1F91D-200D-1F469-1F3FB", nullptr, 4277, 7, 15, 1416, 1},
+    {"1F469-1F3FC-200D-1F91D-200D-1F469-1F3FD", nullptr, 4284, 7, 7, 1417, 1},
+    {"1F469-1F3FC-200D-1F91D-200D-1F469-1F3FE", nullptr, 4291, 7, 7, 1418, 1},
+    {"1F469-1F3FC-200D-1F91D-200D-1F469-1F3FF", nullptr, 4298, 7, 7, 1419, 1},
+    {"1F469-1F3FD-200D-1F91D-200D-1F469-1F3FB", nullptr, 4305, 7, 15, 1420, 1},
+    {"1F469-1F3FD-200D-1F91D-200D-1F469-1F3FC", nullptr, 4312, 7, 15, 1421, 1},
+    {"1F469-1F3FD-200D-1F91D-200D-1F469-1F3FE", nullptr, 4319, 7, 7, 1422, 1},
+    {"1F469-1F3FD-200D-1F91D-200D-1F469-1F3FF", nullptr, 4326, 7, 7, 1423, 1},
+    {"1F469-1F3FE-200D-1F91D-200D-1F469-1F3FB", nullptr, 4333, 7, 15, 1424, 1},
+    {"1F469-1F3FE-200D-1F91D-200D-1F469-1F3FC", nullptr, 4340, 7, 15, 1425, 1},
+    {"1F469-1F3FE-200D-1F91D-200D-1F469-1F3FD", nullptr, 4347, 7, 15, 1426, 1},
+    {"1F469-1F3FE-200D-1F91D-200D-1F469-1F3FF", nullptr, 4354, 7, 7, 1427, 1},
+    {"1F469-1F3FF-200D-1F91D-200D-1F469-1F3FB", nullptr, 4361, 7, 15, 1428, 1},
+    {"1F469-1F3FF-200D-1F91D-200D-1F469-1F3FC", nullptr, 4368, 7, 15, 1429, 1},
+    {"1F469-1F3FF-200D-1F91D-200D-1F469-1F3FD", nullptr, 4375, 7, 15, 1430, 1},
+    {"1F469-1F3FF-200D-1F91D-200D-1F469-1F3FE", nullptr, 4382, 7, 15, 1431, 1},
+    {"1F46E-200D-2640-FE0F", "1F46E-200D-2640", 4389, 3, 15, 1432, 1},
+    {"1F46E-1F3FB-200D-2640-FE0F", "1F46E-1F3FB-200D-2640", 4392, 4, 15, 1433, 1},
+    {"1F46E-1F3FC-200D-2640-FE0F", "1F46E-1F3FC-200D-2640", 4396, 4, 15, 1434, 1},
+    {"1F46E-1F3FD-200D-2640-FE0F", "1F46E-1F3FD-200D-2640", 4400, 4, 15, 1435, 1},
+    {"1F46E-1F3FE-200D-2640-FE0F", "1F46E-1F3FE-200D-2640", 4404, 4, 15, 1436, 1},
+    {"1F46E-1F3FF-200D-2640-FE0F", "1F46E-1F3FF-200D-2640", 4408, 4, 15, 1437, 1},
+    {"1F46E-200D-2642-FE0F", "1F46E-200D-2642", 4412, 3, 15, 1438, 1},
+    {"1F46E-1F3FB-200D-2642-FE0F", "1F46E-1F3FB-200D-2642", 4415, 4, 15, 1439, 1},
+    {"1F46E-1F3FC-200D-2642-FE0F", "1F46E-1F3FC-200D-2642", 4419, 4, 15, 1440, 1},
+    {"1F46E-1F3FD-200D-2642-FE0F", "1F46E-1F3FD-200D-2642", 4423, 4, 15, 1441, 1},
+    {"1F46E-1F3FE-200D-2642-FE0F", "1F46E-1F3FE-200D-2642", 4427, 4, 15, 1442, 1},
+    {"1F46E-1F3FF-200D-2642-FE0F", "1F46E-1F3FF-200D-2642", 4431, 4, 15, 1443, 1},
+    {"1F46E", nullptr, 4435, 1, 15, 1444, 1},
+    {"1F46E-1F3FB", nullptr, 4436, 2, 15, 1445, 1},
+    {"1F46E-1F3FC", nullptr, 4438, 2, 15, 1446, 1},
+    {"1F46E-1F3FD", nullptr, 4440, 2, 15, 1447, 1},
+    {"1F46E-1F3FE", nullptr, 4442, 2, 15, 1448, 1},
+    {"1F46E-1F3FF", nullptr, 4444, 2, 15, 1449, 1},
+    {"1F46F-200D-2640-FE0F", "1F46F-200D-2640", 4446, 3, 15, 1450, 2},
+    {"1F46F-200D-2642-FE0F", "1F46F-200D-2642", 4449, 3, 15, 1452, 2},
+    {"1F46F", nullptr, 4452, 1, 15, 1454, 1},
+    {"1F470-200D-2640-FE0F", "1F470-200D-2640", 4453, 3, 15, 1455, 1},
+    {"1F470-1F3FB-200D-2640-FE0F", "1F470-1F3FB-200D-2640", 4456, 4, 15, 1456, 1},
+    {"1F470-1F3FC-200D-2640-FE0F", "1F470-1F3FC-200D-2640", 4460, 4, 15, 1457, 1},
+    {"1F470-1F3FD-200D-2640-FE0F", "1F470-1F3FD-200D-2640", 4464, 4, 15, 1458, 1},
+    {"1F470-1F3FE-200D-2640-FE0F", "1F470-1F3FE-200D-2640", 4468, 4, 15, 1459, 1},
+    {"1F470-1F3FF-200D-2640-FE0F", "1F470-1F3FF-200D-2640", 4472, 4, 15, 1460, 1},
+    {"1F470-200D-2642-FE0F", "1F470-200D-2642", 4476, 3, 15, 1461, 1},
+    {"1F470-1F3FB-200D-2642-FE0F", "1F470-1F3FB-200D-2642", 4479, 4, 15, 1462, 1},
+    {"1F470-1F3FC-200D-2642-FE0F", "1F470-1F3FC-200D-2642", 4483, 4, 15, 1463, 1},
+    {"1F470-1F3FD-200D-2642-FE0F", "1F470-1F3FD-200D-2642", 4487, 4, 15, 1464, 1},
+    {"1F470-1F3FE-200D-2642-FE0F", "1F470-1F3FE-200D-2642", 4491, 4, 15, 1465, 1},
+    {"1F470-1F3FF-200D-2642-FE0F", "1F470-1F3FF-200D-2642", 4495, 4, 15, 1466, 1},
+    {"1F470", nullptr, 4499, 1, 15, 1467, 1},
+    {"1F470-1F3FB", nullptr, 4500, 2, 15, 1468, 1},
+    {"1F470-1F3FC", nullptr, 4502, 2, 15, 1469, 1},
+    {"1F470-1F3FD", nullptr, 4504, 2, 15, 1470, 1},
+    {"1F470-1F3FE", nullptr, 4506, 2, 15, 1471, 1},
+    {"1F470-1F3FF", nullptr, 4508, 2, 15, 1472, 1},
+    {"1F471-200D-2640-FE0F", "1F471-200D-2640", 4510, 3, 15, 1473, 1},
+    {"1F471-1F3FB-200D-2640-FE0F", "1F471-1F3FB-200D-2640", 4513, 4, 15, 1474, 1},
+    {"1F471-1F3FC-200D-2640-FE0F", "1F471-1F3FC-200D-2640", 4517, 4, 15, 1475, 1},
+    {"1F471-1F3FD-200D-2640-FE0F", "1F471-1F3FD-200D-2640", 4521, 4, 15, 1476, 1},
+    {"1F471-1F3FE-200D-2640-FE0F", "1F471-1F3FE-200D-2640", 4525, 4, 15, 1477, 1},
+    {"1F471-1F3FF-200D-2640-FE0F", "1F471-1F3FF-200D-2640", 4529, 4, 15, 1478, 1},
+    {"1F471-200D-2642-FE0F", "1F471-200D-2642", 4533, 3, 15, 1479, 1},
+    {"1F471-1F3FB-200D-2642-FE0F", "1F471-1F3FB-200D-2642", 4536, 4, 15, 1480, 1},
+    {"1F471-1F3FC-200D-2642-FE0F", "1F471-1F3FC-200D-2642", 4540, 4, 15, 1481, 1},
+    {"1F471-1F3FD-200D-2642-FE0F", "1F471-1F3FD-200D-2642", 4544, 4, 15, 1482, 1},
+    {"1F471-1F3FE-200D-2642-FE0F", "1F471-1F3FE-200D-2642", 4548, 4, 15, 1483, 1},
+    {"1F471-1F3FF-200D-2642-FE0F", "1F471-1F3FF-200D-2642", 4552, 4, 15, 1484, 1},
+    {"1F471", nullptr, 4556, 1, 15, 1485, 1},
+    {"1F471-1F3FB", nullptr, 4557, 2, 15, 1486, 1},
+    {"1F471-1F3FC", nullptr, 4559, 2, 15, 1487, 1},
+    {"1F471-1F3FD", nullptr, 4561, 2, 15, 1488, 1},
+    {"1F471-1F3FE", nullptr, 4563, 2, 15, 1489, 1},
+    {"1F471-1F3FF", nullptr, 4565, 2, 15, 1490, 1},
+    {"1F472", nullptr, 4567, 1, 15, 1491, 1},
+    {"1F472-1F3FB", nullptr, 4568, 2, 15, 1492, 1},
+    {"1F472-1F3FC", nullptr, 4570, 2, 15, 1493, 1},
+    {"1F472-1F3FD", nullptr, 4572, 2, 15, 1494, 1},
+    {"1F472-1F3FE", nullptr, 4574, 2, 15, 1495, 1},
+    {"1F472-1F3FF", nullptr, 4576, 2, 15, 1496, 1},
+    {"1F473-200D-2640-FE0F", "1F473-200D-2640", 4578, 3, 15, 1497, 1},
+    {"1F473-1F3FB-200D-2640-FE0F", "1F473-1F3FB-200D-2640", 4581, 4, 15, 1498, 1},
+    {"1F473-1F3FC-200D-2640-FE0F", "1F473-1F3FC-200D-2640", 4585, 4, 15, 1499, 1},
+    {"1F473-1F3FD-200D-2640-FE0F", "1F473-1F3FD-200D-2640", 4589, 4, 15, 1500, 1},
+    {"1F473-1F3FE-200D-2640-FE0F", "1F473-1F3FE-200D-2640", 4593, 4, 15, 1501, 1},
+    {"1F473-1F3FF-200D-2640-FE0F", "1F473-1F3FF-200D-2640", 4597, 4, 15, 1502, 1},
+    {"1F473-200D-2642-FE0F", "1F473-200D-2642", 4601, 3, 15, 1503, 1},
+    {"1F473-1F3FB-200D-2642-FE0F", "1F473-1F3FB-200D-2642", 4604, 4, 15, 1504, 1},
+    {"1F473-1F3FC-200D-2642-FE0F", "1F473-1F3FC-200D-2642", 4608, 4, 15, 1505, 1},
+    {"1F473-1F3FD-200D-2642-FE0F", "1F473-1F3FD-200D-2642", 4612, 4, 15, 1506, 1},
+    {"1F473-1F3FE-200D-2642-FE0F", "1F473-1F3FE-200D-2642", 4616, 4, 15, 1507, 1},
+    {"1F473-1F3FF-200D-2642-FE0F", "1F473-1F3FF-200D-2642", 4620, 4, 15, 1508, 1},
+    {"1F473", nullptr, 4624, 1, 15, 1509, 1},
+    {"1F473-1F3FB", nullptr, 4625, 2, 15, 1510, 1},
+    {"1F473-1F3FC", nullptr, 4627, 2, 15, 1511, 1},
+    {"1F473-1F3FD", nullptr, 4629, 2, 15, 1512, 1},
+    {"1F473-1F3FE", nullptr, 4631, 2, 15, 1513, 1},
+    {"1F473-1F3FF", nullptr, 4633, 2, 15, 1514, 1},
+    {"1F474", nullptr, 4635, 1, 15, 1515, 1},
+    {"1F474-1F3FB", nullptr, 4636, 2, 15, 1516, 1},
+    {"1F474-1F3FC", nullptr, 4638, 2, 15, 1517, 1},
+    {"1F474-1F3FD", nullptr, 4640, 2, 15, 1518, 1},
+    {"1F474-1F3FE", nullptr, 4642, 2, 15, 1519, 1},
+    {"1F474-1F3FF", nullptr, 4644, 2, 15, 1520, 1},
+    {"1F475", nullptr, 4646, 1, 15, 1521, 1},
+    {"1F475-1F3FB", nullptr, 4647, 2, 15, 1522, 1},
+    {"1F475-1F3FC", nullptr, 4649, 2, 15, 1523, 1},
+    {"1F475-1F3FD", nullptr, 4651, 2, 15, 1524, 1},
+    {"1F475-1F3FE", nullptr, 4653, 2, 15, 1525, 1},
+    {"1F475-1F3FF", nullptr, 4655, 2, 15, 1526, 1},
+    {"1F476", nullptr, 4657, 1, 15, 1527, 1},
+    {"1F476-1F3FB", nullptr, 4658, 2, 15, 1528, 1},
+    {"1F476-1F3FC", nullptr, 4660, 2, 15, 1529, 1},
+    {"1F476-1F3FD", nullptr, 4662, 2, 15, 1530, 1},
+    {"1F476-1F3FE", nullptr, 4664, 2, 15, 1531, 1},
+    {"1F476-1F3FF", nullptr, 4666, 2, 15, 1532, 1},
+    {"1F477-200D-2640-FE0F", "1F477-200D-2640", 4668, 3, 15, 1533, 1},
+    {"1F477-1F3FB-200D-2640-FE0F", "1F477-1F3FB-200D-2640", 4671, 4, 15, 1534, 1},
+    {"1F477-1F3FC-200D-2640-FE0F", "1F477-1F3FC-200D-2640", 4675, 4, 15, 1535, 1},
+    {"1F477-1F3FD-200D-2640-FE0F", "1F477-1F3FD-200D-2640", 4679, 4, 15, 1536, 1},
+    {"1F477-1F3FE-200D-2640-FE0F", "1F477-1F3FE-200D-2640", 4683, 4, 15, 1537, 1},
+    {"1F477-1F3FF-200D-2640-FE0F", "1F477-1F3FF-200D-2640", 4687, 4, 15, 1538, 1},
+    {"1F477-200D-2642-FE0F", "1F477-200D-2642", 4691, 3, 15, 1539, 1},
+    {"1F477-1F3FB-200D-2642-FE0F", "1F477-1F3FB-200D-2642", 4694, 4, 15, 1540, 1},
+    {"1F477-1F3FC-200D-2642-FE0F", "1F477-1F3FC-200D-2642", 4698, 4, 15, 1541, 1},
+    {"1F477-1F3FD-200D-2642-FE0F", "1F477-1F3FD-200D-2642", 4702, 4, 15, 1542, 1},
+    {"1F477-1F3FE-200D-2642-FE0F", "1F477-1F3FE-200D-2642", 4706, 4, 15, 1543, 1},
+    {"1F477-1F3FF-200D-2642-FE0F", "1F477-1F3FF-200D-2642", 4710, 4, 15, 1544, 1},
+    {"1F477", nullptr, 4714, 1, 15, 1545, 1},
+    {"1F477-1F3FB", nullptr, 4715, 2, 15, 1546, 1},
+    {"1F477-1F3FC", nullptr, 4717, 2, 15, 1547, 1},
+    {"1F477-1F3FD", nullptr, 4719, 2, 15, 1548, 1},
+    {"1F477-1F3FE", nullptr, 4721, 2, 15, 1549, 1},
+    {"1F477-1F3FF", nullptr, 4723, 2, 15, 1550, 1},
+    {"1F478", nullptr, 4725, 1, 15, 1551, 1},
+    {"1F478-1F3FB", nullptr, 4726, 2, 15, 1552, 1},
+    {"1F478-1F3FC", nullptr, 4728, 2, 15, 1553, 1},
+    {"1F478-1F3FD", nullptr, 4730, 2, 15, 1554, 1},
+    {"1F478-1F3FE", nullptr, 4732, 2, 15, 1555, 1},
+    {"1F478-1F3FF", nullptr, 4734, 2, 15, 1556, 1},
+    {"1F479", nullptr, 4736, 1, 15, 1557, 1},
+    {"1F47A", nullptr, 4737, 1, 15, 1558, 1},
+    {"1F47B", nullptr, 4738, 1, 15, 1559, 1},
+    {"1F47C", nullptr, 4739, 1, 15, 1560, 1},
+    {"1F47C-1F3FB", nullptr, 4740, 2, 15, 1561, 1},
+    {"1F47C-1F3FC", nullptr, 4742, 2, 15, 1562, 1},
+    {"1F47C-1F3FD", nullptr, 4744, 2, 15, 1563, 1},
+    {"1F47C-1F3FE", nullptr, 4746, 2, 15, 1564, 1},
+    {"1F47C-1F3FF", nullptr, 4748, 2, 15, 1565, 1},
+    {"1F47D", nullptr, 4750, 1, 15, 1566, 1},
+    {"1F47E", nullptr, 4751, 1, 15, 1567, 1},
+    {"1F47F", nullptr, 4752, 1, 15, 1568, 1},
+    {"1F480", nullptr, 4753, 1, 15, 1569, 1},
+    {"1F481-200D-2640-FE0F", "1F481-200D-2640", 4754, 3, 15, 1570, 1},
+    {"1F481-1F3FB-200D-2640-FE0F", "1F481-1F3FB-200D-2640", 4757, 4, 15, 1571, 1},
+    {"1F481-1F3FC-200D-2640-FE0F", "1F481-1F3FC-200D-2640", 4761, 4, 15, 1572, 1},
+    {"1F481-1F3FD-200D-2640-FE0F", "1F481-1F3FD-200D-2640", 4765, 4, 15, 1573, 1},
+    {"1F481-1F3FE-200D-2640-FE0F", "1F481-1F3FE-200D-2640", 4769, 4, 15, 1574, 1},
+    {"1F481-1F3FF-200D-2640-FE0F", "1F481-1F3FF-200D-2640", 4773, 4, 15, 1575, 1},
+    {"1F481-200D-2642-FE0F", "1F481-200D-2642", 4777, 3, 15, 1576, 1},
+    {"1F481-1F3FB-200D-2642-FE0F", "1F481-1F3FB-200D-2642", 4780, 4, 15, 1577, 1},
+    {"1F481-1F3FC-200D-2642-FE0F", "1F481-1F3FC-200D-2642", 4784, 4, 15, 1578, 1},
+    {"1F481-1F3FD-200D-2642-FE0F", "1F481-1F3FD-200D-2642", 4788, 4, 15, 1579, 1},
+    {"1F481-1F3FE-200D-2642-FE0F", "1F481-1F3FE-200D-2642", 4792, 4, 15, 1580, 1},
+    {"1F481-1F3FF-200D-2642-FE0F", "1F481-1F3FF-200D-2642", 4796, 4, 15, 1581, 1},
+    {"1F481", nullptr, 4800, 1, 15, 1582, 1},
+    {"1F481-1F3FB", nullptr, 4801, 2, 15, 1583, 1},
+    {"1F481-1F3FC", nullptr, 4803, 2, 15, 1584, 1},
+    {"1F481-1F3FD", nullptr, 4805, 2, 15, 1585, 1},
+    {"1F481-1F3FE", nullptr, 4807, 2, 15, 1586, 1},
+    {"1F481-1F3FF", nullptr, 4809, 2, 15, 1587, 1},
+    {"1F482-200D-2640-FE0F", "1F482-200D-2640", 4811, 3, 15, 1588, 1},
+    {"1F482-1F3FB-200D-2640-FE0F", "1F482-1F3FB-200D-2640", 4814, 4, 15, 1589, 1},
+    {"1F482-1F3FC-200D-2640-FE0F", "1F482-1F3FC-200D-2640", 4818, 4, 15, 1590, 1},
+    {"1F482-1F3FD-200D-2640-FE0F", "1F482-1F3FD-200D-2640", 4822, 4, 15, 1591, 1},
+    {"1F482-1F3FE-200D-2640-FE0F", "1F482-1F3FE-200D-2640", 4826, 4, 15, 1592, 1},
+    {"1F482-1F3FF-200D-2640-FE0F", "1F482-1F3FF-200D-2640", 4830, 4, 15, 1593, 1},
+    {"1F482-200D-2642-FE0F", "1F482-200D-2642", 4834, 3, 15, 1594, 1},
+    {"1F482-1F3FB-200D-2642-FE0F", "1F482-1F3FB-200D-2642", 4837, 4, 15, 1595, 1},
+    {"1F482-1F3FC-200D-2642-FE0F", "1F482-1F3FC-200D-2642", 4841, 4, 15, 1596, 1},
+    {"1F482-1F3FD-200D-2642-FE0F", "1F482-1F3FD-200D-2642", 4845, 4, 15, 1597, 1},
+    {"1F482-1F3FE-200D-2642-FE0F", "1F482-1F3FE-200D-2642", 4849, 4, 15, 1598, 1},
+    {"1F482-1F3FF-200D-2642-FE0F", "1F482-1F3FF-200D-2642", 4853, 4, 15, 1599, 1},
+    {"1F482", nullptr, 4857, 1, 15, 1600, 1},
+    {"1F482-1F3FB", nullptr, 4858, 2, 15, 1601, 1},
+    {"1F482-1F3FC", nullptr, 4860, 2, 15, 1602, 1},
+    {"1F482-1F3FD", nullptr, 4862, 2, 15, 1603, 1},
+    {"1F482-1F3FE", nullptr, 4864, 2, 15, 1604, 1},
+    {"1F482-1F3FF", nullptr, 4866, 2, 15, 1605, 1},
+    {"1F483", nullptr, 4868, 1, 15, 1606, 1},
+    {"1F483-1F3FB", nullptr, 4869, 2, 15, 1607, 1},
+    {"1F483-1F3FC", nullptr, 4871, 2, 15, 1608, 1},
+    {"1F483-1F3FD", nullptr, 4873, 2, 15, 1609, 1},
+    {"1F483-1F3FE", nullptr, 4875, 2, 15, 1610, 1},
+    {"1F483-1F3FF", nullptr, 4877, 2, 15, 1611, 1},
+    {"1F484", nullptr, 4879, 1, 15, 1612, 1},
+    {"1F485", nullptr, 4880, 1, 15, 1613, 1},
+    {"1F485-1F3FB", nullptr, 4881, 2, 15, 1614, 1},
+    {"1F485-1F3FC", nullptr, 4883, 2, 15, 1615, 1},
+    {"1F485-1F3FD", nullptr, 4885, 2, 15, 1616, 1},
+    {"1F485-1F3FE", nullptr, 4887, 2, 15, 1617, 1},
+    {"1F485-1F3FF", nullptr, 4889, 2, 15, 1618, 1},
+    {"1F486-200D-2640-FE0F", "1F486-200D-2640", 4891, 3, 15, 1619, 1},
+    {"1F486-1F3FB-200D-2640-FE0F", "1F486-1F3FB-200D-2640", 4894, 4, 15, 1620, 1},
+    {"1F486-1F3FC-200D-2640-FE0F", "1F486-1F3FC-200D-2640", 4898, 4, 15, 1621, 1},
+    {"1F486-1F3FD-200D-2640-FE0F", "1F486-1F3FD-200D-2640", 4902, 4, 15, 1622, 1},
+    {"1F486-1F3FE-200D-2640-FE0F", "1F486-1F3FE-200D-2640", 4906, 4, 15, 1623, 1},
+    {"1F486-1F3FF-200D-2640-FE0F", "1F486-1F3FF-200D-2640", 4910, 4, 15, 1624, 1},
+    {"1F486-200D-2642-FE0F", "1F486-200D-2642", 4914, 3, 15, 1625, 1},
+    {"1F486-1F3FB-200D-2642-FE0F", "1F486-1F3FB-200D-2642", 4917, 4, 15, 1626, 1},
+    {"1F486-1F3FC-200D-2642-FE0F", "1F486-1F3FC-200D-2642", 4921, 4, 15, 1627, 1},
+    {"1F486-1F3FD-200D-2642-FE0F", "1F486-1F3FD-200D-2642", 4925, 4, 15, 1628, 1},
+    {"1F486-1F3FE-200D-2642-FE0F", "1F486-1F3FE-200D-2642", 4929, 4, 15, 1629, 1},
+    {"1F486-1F3FF-200D-2642-FE0F", "1F486-1F3FF-200D-2642", 4933, 4, 15, 1630, 1},
+    {"1F486", nullptr, 4937, 1, 15, 1631, 1},
+    {"1F486-1F3FB", nullptr, 4938, 2, 15, 1632, 1},
+    {"1F486-1F3FC", nullptr, 4940, 2, 15, 1633, 1},
+    {"1F486-1F3FD", nullptr, 4942, 2, 15, 1634, 1},
+    {"1F486-1F3FE", nullptr, 4944, 2, 15, 1635, 1},
+    {"1F486-1F3FF", nullptr, 4946, 2, 15, 1636, 1},
+    {"1F487-200D-2640-FE0F", "1F487-200D-2640", 4948, 3, 15, 1637, 1},
+    {"1F487-1F3FB-200D-2640-FE0F", "1F487-1F3FB-200D-2640", 4951, 4, 15, 1638, 1},
+    {"1F487-1F3FC-200D-2640-FE0F", "1F487-1F3FC-200D-2640", 4955, 4, 15, 1639, 1},
+    {"1F487-1F3FD-200D-2640-FE0F", "1F487-1F3FD-200D-2640", 4959, 4, 15, 1640, 1},
+    {"1F487-1F3FE-200D-2640-FE0F", "1F487-1F3FE-200D-2640", 4963, 4, 15, 1641, 1},
+    {"1F487-1F3FF-200D-2640-FE0F", "1F487-1F3FF-200D-2640", 4967, 4, 15, 1642, 1},
+    {"1F487-200D-2642-FE0F", "1F487-200D-2642", 4971, 3, 15, 1643, 1},
+    {"1F487-1F3FB-200D-2642-FE0F", "1F487-1F3FB-200D-2642", 4974, 4, 15, 1644, 1},
+    {"1F487-1F3FC-200D-2642-FE0F", "1F487-1F3FC-200D-2642", 4978, 4, 15, 1645, 1},
+    {"1F487-1F3FD-200D-2642-FE0F", "1F487-1F3FD-200D-2642", 4982, 4, 15, 1646, 1},
+    {"1F487-1F3FE-200D-2642-FE0F", "1F487-1F3FE-200D-2642", 4986, 4, 15, 1647, 1},
+    {"1F487-1F3FF-200D-2642-FE0F", "1F487-1F3FF-200D-2642", 4990, 4, 15, 1648, 1},
+    {"1F487", nullptr, 4994, 1, 15, 1649, 1},
+    {"1F487-1F3FB", nullptr, 4995, 2, 15, 1650, 1},
+    {"1F487-1F3FC", nullptr, 4997, 2, 15, 1651, 1},
+    {"1F487-1F3FD", nullptr, 4999, 2, 15, 1652, 1},
+    {"1F487-1F3FE", nullptr, 5001, 2, 15, 1653, 1},
+    {"1F487-1F3FF", nullptr, 5003, 2, 15, 1654, 1},
+    {"1F488", nullptr, 5005, 1, 15, 1655, 1},
+    {"1F489", nullptr, 5006, 1, 15, 1656, 1},
+    {"1F48A", nullptr, 5007, 1, 15, 1657, 1},
+    {"1F48B", nullptr, 5008, 1, 15, 1658, 1},
+    {"1F48C", nullptr, 5009, 1, 15, 1659, 1},
+    {"1F48D", nullptr, 5010, 1, 15, 1660, 1},
+    {"1F48E", nullptr, 5011, 1, 15, 1661, 1},
+    {"1F48F", nullptr, 5012, 1, 15, 1662, 1},
+    {"1F48F-1F3FB", nullptr, 5013, 2, 15, 1663, 1},
+    {"1F48F-1F3FC", nullptr, 5015, 2, 15, 1664, 1},
+    {"1F48F-1F3FD", nullptr, 5017, 2, 15, 1665, 1},
+    {"1F48F-1F3FE", nullptr, 5019, 2, 15, 1666, 1},
+    {"1F48F-1F3FF", nullptr, 5021, 2, 15, 1667, 1},
+    {"1F9D1-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FC", "1F9D1-1F3FB-200D-2764-200D-1F48B-200D-1F9D1-1F3FC", 5023, 9, 7, 1668, 1},
+    {"1F9D1-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FD", "1F9D1-1F3FB-200D-2764-200D-1F48B-200D-1F9D1-1F3FD", 5032, 9, 7, 1669, 1},
+    {"1F9D1-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FE", "1F9D1-1F3FB-200D-2764-200D-1F48B-200D-1F9D1-1F3FE", 5041, 9, 7, 1670, 1},
+    {"1F9D1-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FF", "1F9D1-1F3FB-200D-2764-200D-1F48B-200D-1F9D1-1F3FF", 5050, 9, 7, 1671, 1},
+    {"1F9D1-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FB", "1F9D1-1F3FC-200D-2764-200D-1F48B-200D-1F9D1-1F3FB", 5059, 9, 7, 1672, 1},
+    {"1F9D1-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FD", "1F9D1-1F3FC-200D-2764-200D-1F48B-200D-1F9D1-1F3FD", 5068, 9, 7, 1673, 1},
+    {"1F9D1-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FE", "1F9D1-1F3FC-200D-2764-200D-1F48B-200D-1F9D1-1F3FE", 5077, 9, 7, 1674, 1},
+    {"1F9D1-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FF", "1F9D1-1F3FC-200D-2764-200D-1F48B-200D-1F9D1-1F3FF", 5086, 9, 7, 1675, 1},
+    {"1F9D1-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FB", "1F9D1-1F3FD-200D-2764-200D-1F48B-200D-1F9D1-1F3FB", 5095, 9, 7, 1676, 1},
+    {"1F9D1-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FC", "1F9D1-1F3FD-200D-2764-200D-1F48B-200D-1F9D1-1F3FC", 5104, 9, 7, 1677, 1},
+    {"1F9D1-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FE", "1F9D1-1F3FD-200D-2764-200D-1F48B-200D-1F9D1-1F3FE", 5113, 9, 7, 1678, 1},
+    {"1F9D1-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FF", "1F9D1-1F3FD-200D-2764-200D-1F48B-200D-1F9D1-1F3FF", 5122, 9, 7, 1679, 1},
+    {"1F9D1-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FB", "1F9D1-1F3FE-200D-2764-200D-1F48B-200D-1F9D1-1F3FB", 5131, 9, 7, 1680, 1},
+    {"1F9D1-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FC", "1F9D1-1F3FE-200D-2764-200D-1F48B-200D-1F9D1-1F3FC", 5140, 9, 7, 1681, 1},
+    {"1F9D1-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FD", "1F9D1-1F3FE-200D-2764-200D-1F48B-200D-1F9D1-1F3FD", 5149, 9, 7, 1682, 1},
+    {"1F9D1-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FF", "1F9D1-1F3FE-200D-2764-200D-1F48B-200D-1F9D1-1F3FF", 5158, 9, 7, 1683, 1},
+    {"1F9D1-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FB", "1F9D1-1F3FF-200D-2764-200D-1F48B-200D-1F9D1-1F3FB", 5167, 9, 7, 1684, 1},
+    {"1F9D1-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FC", "1F9D1-1F3FF-200D-2764-200D-1F48B-200D-1F9D1-1F3FC", 5176, 9, 7, 1685, 1},
+    {"1F9D1-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FD", "1F9D1-1F3FF-200D-2764-200D-1F48B-200D-1F9D1-1F3FD", 5185, 9, 7, 1686, 1},
+    {"1F9D1-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FE", "1F9D1-1F3FF-200D-2764-200D-1F48B-200D-1F9D1-1F3FE", 5194, 9, 7, 1687, 1},
+    {"1F490", nullptr, 5203, 1, 15, 1688, 1},
+    {"1F491", nullptr, 5204, 1, 15, 1689, 1},
+    {"1F491-1F3FB", nullptr, 5205, 2, 15, 1690, 1},
+    {"1F491-1F3FC", nullptr, 5207, 2, 15, 1691, 1},
+    {"1F491-1F3FD", nullptr, 5209, 2, 15, 1692, 1},
+    {"1F491-1F3FE", nullptr, 5211, 2, 15, 1693, 1},
+    {"1F491-1F3FF", nullptr, 5213, 2, 15, 1694, 1},
+    {"1F9D1-1F3FB-200D-2764-FE0F-200D-1F9D1-1F3FC", "1F9D1-1F3FB-200D-2764-200D-1F9D1-1F3FC", 5215, 7, 7, 1695, 1},
+    {"1F9D1-1F3FB-200D-2764-FE0F-200D-1F9D1-1F3FD", "1F9D1-1F3FB-200D-2764-200D-1F9D1-1F3FD", 5222, 7, 7, 1696, 1},
+    {"1F9D1-1F3FB-200D-2764-FE0F-200D-1F9D1-1F3FE", "1F9D1-1F3FB-200D-2764-200D-1F9D1-1F3FE", 5229, 7, 7, 1697, 1},
+    {"1F9D1-1F3FB-200D-2764-FE0F-200D-1F9D1-1F3FF", "1F9D1-1F3FB-200D-2764-200D-1F9D1-1F3FF", 5236, 7, 7, 1698, 1},
+    {"1F9D1-1F3FC-200D-2764-FE0F-200D-1F9D1-1F3FB", "1F9D1-1F3FC-200D-2764-200D-1F9D1-1F3FB", 5243, 7, 7, 1699, 1},
+    {"1F9D1-1F3FC-200D-2764-FE0F-200D-1F9D1-1F3FD", "1F9D1-1F3FC-200D-2764-200D-1F9D1-1F3FD", 5250, 7, 7, 1700, 1},
+    {"1F9D1-1F3FC-200D-2764-FE0F-200D-1F9D1-1F3FE", "1F9D1-1F3FC-200D-2764-200D-1F9D1-1F3FE", 5257, 7, 7, 1701, 1},
+    {"1F9D1-1F3FC-200D-2764-FE0F-200D-1F9D1-1F3FF", "1F9D1-1F3FC-200D-2764-200D-1F9D1-1F3FF", 5264, 7, 7, 1702, 1},
+    {"1F9D1-1F3FD-200D-2764-FE0F-200D-1F9D1-1F3FB", "1F9D1-1F3FD-200D-2764-200D-1F9D1-1F3FB", 5271, 7, 7, 1703, 1},
+    {"1F9D1-1F3FD-200D-2764-FE0F-200D-1F9D1-1F3FC", "1F9D1-1F3FD-200D-2764-200D-1F9D1-1F3FC", 5278, 7, 7, 1704, 1},
+    {"1F9D1-1F3FD-200D-2764-FE0F-200D-1F9D1-1F3FE", "1F9D1-1F3FD-200D-2764-200D-1F9D1-1F3FE", 5285, 7, 7, 1705, 1},
+    {"1F9D1-1F3FD-200D-2764-FE0F-200D-1F9D1-1F3FF", "1F9D1-1F3FD-200D-2764-200D-1F9D1-1F3FF", 5292, 7, 7, 1706, 1},
+    {"1F9D1-1F3FE-200D-2764-FE0F-200D-1F9D1-1F3FB", "1F9D1-1F3FE-200D-2764-200D-1F9D1-1F3FB", 5299, 7, 7, 1707, 1},
+    {"1F9D1-1F3FE-200D-2764-FE0F-200D-1F9D1-1F3FC", "1F9D1-1F3FE-200D-2764-200D-1F9D1-1F3FC", 5306, 7, 7, 1708, 1},
+    {"1F9D1-1F3FE-200D-2764-FE0F-200D-1F9D1-1F3FD", "1F9D1-1F3FE-200D-2764-200D-1F9D1-1F3FD", 5313, 7, 7, 1709, 1},
+    {"1F9D1-1F3FE-200D-2764-FE0F-200D-1F9D1-1F3FF", "1F9D1-1F3FE-200D-2764-200D-1F9D1-1F3FF", 5320, 7, 7, 1710, 1},
+    {"1F9D1-1F3FF-200D-2764-FE0F-200D-1F9D1-1F3FB", "1F9D1-1F3FF-200D-2764-200D-1F9D1-1F3FB", 5327, 7, 7, 1711, 1},
+    {"1F9D1-1F3FF-200D-2764-FE0F-200D-1F9D1-1F3FC", "1F9D1-1F3FF-200D-2764-200D-1F9D1-1F3FC", 5334, 7, 7, 1712, 1},
+    {"1F9D1-1F3FF-200D-2764-FE0F-200D-1F9D1-1F3FD", "1F9D1-1F3FF-200D-2764-200D-1F9D1-1F3FD", 5341, 7, 7, 1713, 1},
+    {"1F9D1-1F3FF-200D-2764-FE0F-200D-1F9D1-1F3FE", "1F9D1-1F3FF-200D-2764-200D-1F9D1-1F3FE", 5348, 7, 7, 1714, 1},
+    {"1F492", nullptr, 5355, 1, 15, 1715, 1},
+    {"1F493", nullptr, 5356, 1, 15, 1716, 1},
+    {"1F494", nullptr, 5357, 1, 15, 1717, 1},
+    {"1F495", nullptr, 5358, 1, 15, 1718, 1},
+    {"1F496", nullptr, 5359, 1, 15, 1719, 1},
+    {"1F497", nullptr, 5360, 1, 15, 1720, 1},
+    {"1F498", nullptr, 5361, 1, 15, 1721, 1},
+    {"1F499", nullptr, 5362, 1, 15, 1722, 1},
+    {"1F49A", nullptr, 5363, 1, 15, 1723, 1},
+    {"1F49B", nullptr, 5364, 1, 15, 1724, 1},
+    {"1F49C", nullptr, 5365, 1, 15, 1725, 1},
+    {"1F49D", nullptr, 5366, 1, 15, 1726, 1},
+    {"1F49E", nullptr, 5367, 1, 15, 1727, 1},
+    {"1F49F", nullptr, 5368, 1, 15, 1728, 1},
+    {"1F4A0", nullptr, 5369, 1, 15, 1729, 1},
+    {"1F4A1", nullptr, 5370, 1, 15, 1730, 1},
+    {"1F4A2", nullptr, 5371, 1, 15, 1731, 1},
+    {"1F4A3", nullptr, 5372, 1, 15, 1732, 1},
+    {"1F4A4", nullptr, 5373, 1, 15, 1733, 1},
+    {"1F4A5", nullptr, 5374, 1, 15, 1734, 2},
+    {"1F4A6", nullptr, 5375, 1, 15, 1736, 1},
+    {"1F4A7", nullptr, 5376, 1, 15, 1737, 1},
+    {"1F4A8", nullptr, 5377, 1, 15, 1738, 1},
+    {"1F4A9", nullptr, 5378, 1, 15, 1739, 3},
+    {"1F4AA", nullptr, 5379, 1, 15, 1742, 1},
+    {"1F4AA-1F3FB", nullptr, 5380, 2, 15, 1743, 1},
+    {"1F4AA-1F3FC", nullptr, 5382, 2, 15, 1744, 1},
+    {"1F4AA-1F3FD", nullptr, 5384, 2, 15, 1745, 1},
+    {"1F4AA-1F3FE", nullptr, 5386, 2, 15, 1746, 1},
+    {"1F4AA-1F3FF", nullptr, 5388, 2, 15, 1747, 1},
+    {"1F4AB", nullptr, 5390, 1, 15, 1748, 1},
+    {"1F4AC", nullptr, 5391, 1, 15, 1749, 1},
+    {"1F4AD", nullptr, 5392, 1, 15, 1750, 1},
+    {"1F4AE", nullptr, 5393, 1, 15, 1751, 1},
+    {"1F4AF", nullptr, 5394, 1, 15, 1752, 1},
+    {"1F4B0", nullptr, 5395, 1, 15, 1753, 1},
+    {"1F4B1", nullptr, 5396, 1, 15, 1754, 1},
+    {"1F4B2", nullptr, 5397, 1, 15, 1755, 1},
+    {"1F4B3", nullptr, 5398, 1, 15, 1756, 1},
+    {"1F4B4", nullptr, 5399, 1, 15, 1757, 1},
+    {"1F4B5", nullptr, 5400, 1, 15, 1758, 1},
+    {"1F4B6", nullptr, 5401, 1, 15, 1759, 1},
+    {"1F4B7", nullptr, 5402, 1, 15, 1760, 1},
+    {"1F4B8", nullptr, 5403, 1, 15, 1761, 1},
+    {"1F4B9", nullptr, 5404, 1, 15, 1762, 1},
+    {"1F4BA", nullptr, 5405, 1, 15, 1763, 1},
+    {"1F4BB", nullptr, 5406, 1, 15, 1764, 1},
+    {"1F4BC", nullptr, 5407, 1, 15, 1765, 1},
+    {"1F4BD", nullptr, 5408, 1, 15, 1766, 1},
+    {"1F4BE", nullptr, 5409, 1, 15, 1767, 1},
+    {"1F4BF", nullptr, 5410, 1, 15, 1768, 1},
+    {"1F4C0", nullptr, 5411, 1, 15, 1769, 1},
+    {"1F4C1", nullptr, 5412, 1, 15, 1770, 1},
+    {"1F4C2", nullptr, 5413, 1, 15, 1771, 1},
+    {"1F4C3", nullptr, 5414, 1, 15, 1772, 1},
+    {"1F4C4", nullptr, 5415, 1, 15, 1773, 1},
+    {"1F4C5", nullptr, 5416, 1, 15, 1774, 1},
+    {"1F4C6", nullptr, 5417, 1, 15, 1775, 1},
+    {"1F4C7", nullptr, 5418, 1, 15, 1776, 1},
+    {"1F4C8", nullptr, 5419, 1, 15, 1777, 1},
+    {"1F4C9", nullptr, 5420, 1, 15, 1778, 1},
+    {"1F4CA", nullptr, 5421, 1, 15, 1779, 1},
+    {"1F4CB", nullptr, 5422, 1, 15, 1780, 1},
+    {"1F4CC", nullptr, 5423, 1, 15, 1781, 1},
+    {"1F4CD", nullptr, 5424, 1, 15, 1782, 1},
+    {"1F4CE", nullptr, 5425, 1, 15, 1783, 1},
+    {"1F4CF", nullptr, 5426, 1, 15, 1784, 1},
+    {"1F4D0", nullptr, 5427, 1, 15, 1785, 1},
+    {"1F4D1", nullptr, 5428, 1, 15, 1786, 1},
+    {"1F4D2", nullptr, 5429, 1, 15, 1787, 1},
+    {"1F4D3", nullptr, 5430, 1, 15, 1788, 1},
+    {"1F4D4", nullptr, 5431, 1, 15, 1789, 1},
+    {"1F4D5", nullptr, 5432, 1, 15, 1790, 1},
+    {"1F4D6", nullptr, 5433, 1, 15, 1791, 2},
+    {"1F4D7", nullptr, 5434, 1, 15, 1793, 1},
+    {"1F4D8", nullptr, 5435, 1, 15, 1794, 1},
+    {"1F4D9", nullptr, 5436, 1, 15, 1795, 1},
+    {"1F4DA", nullptr, 5437, 1, 15, 1796, 1},
+    {"1F4DB", nullptr, 5438, 1, 15, 1797, 1},
+    {"1F4DC", nullptr, 5439, 1, 15, 1798, 1},
+    {"1F4DD", nullptr, 5440, 1, 15, 1799, 2},
+    {"1F4DE", nullptr, 5441, 1, 15, 1801, 1},
+    {"1F4DF", nullptr, 5442, 1, 15, 1802, 1},
+    {"1F4E0", nullptr, 5443, 1, 15, 1803, 1},
+    {"1F4E1", nullptr, 5444, 1, 15, 1804, 1},
+    {"1F4E2", nullptr, 5445, 1, 15, 1805, 1},
+    {"1F4E3", nullptr, 5446, 1, 15, 1806, 1},
+    {"1F4E4", nullptr, 5447, 1, 15, 1807, 1},
+    {"1F4E5", nullptr, 5448, 1, 15, 1808, 1},
+    {"1F4E6", nullptr, 5449, 1, 15, 1809, 1},
+    {"1F4E7", nullptr, 5450, 1, 15, 1810, 1},
+    {"1F4E8", nullptr, 5451, 1, 15, 1811, 1},
+    {"1F4E9", nullptr, 5452, 1, 15, 1812, 1},
+    {"1F4EA", nullptr, 5453, 1, 15, 1813, 1},
+    {"1F4EB", nullptr, 5454, 1, 15, 1814, 1},
+    {"1F4EC", nullptr, 5455, 1, 15, 1815, 1},
+    {"1F4ED", nullptr, 5456, 1, 15, 1816, 1},
+    {"1F4EE", nullptr, 5457, 1, 15, 1817, 1},
+    {"1F4EF", nullptr, 5458, 1, 15, 1818, 1},
+    {"1F4F0", nullptr, 5459, 1, 15, 1819, 1},
+    {"1F4F1", nullptr, 5460, 1, 15, 1820, 1},
+    {"1F4F2", nullptr, 5461, 1, 15, 1821, 1},
+    {"1F4F3", nullptr, 5462, 1, 15, 1822, 1},
+    {"1F4F4", nullptr, 5463, 1, 15, 1823, 1},
+    {"1F4F5", nullptr, 5464, 1, 15, 1824, 1},
+    {"1F4F6", nullptr, 5465, 1, 15, 1825, 1},
+    {"1F4F7", nullptr, 5466, 1, 15, 1826, 1},
+    {"1F4F8", nullptr, 5467, 1, 15, 1827, 1},
+    {"1F4F9", nullptr, 5468, 1, 15, 1828, 1},
+    {"1F4FA", nullptr, 5469, 1, 15, 1829, 1},
+    {"1F4FB", nullptr, 5470, 1, 15, 1830, 1},
+    {"1F4FC", nullptr, 5471, 1, 15, 1831, 1},
+    {"1F4FD-FE0F", "1F4FD", 5472, 1, 15, 1832, 1},
+    {"1F4FF", nullptr, 5473, 1, 15, 1833, 1},
+    {"1F500", nullptr, 5474, 1, 15, 1834, 1},
+    {"1F501", nullptr, 5475, 1, 15, 1835, 1},
+    {"1F502", nullptr, 5476, 1, 15, 1836, 1},
+    {"1F503", nullptr, 5477, 1, 15, 1837, 1},
+    {"1F504", nullptr, 5478, 1, 15, 1838, 1},
+    {"1F505", nullptr, 5479, 1, 15, 1839, 1},
+    {"1F506", nullptr, 5480, 1, 15, 1840, 1},
+    {"1F507", nullptr, 5481, 1, 15, 1841, 1},
+    {"1F508", nullptr, 5482, 1, 15, 1842, 1},
+    {"1F509", nullptr, 5483, 1, 15, 1843, 1},
+    {"1F50A", nullptr, 5484, 1, 15, 1844, 1},
+    {"1F50B", nullptr, 5485, 1, 15, 1845, 1},
+    {"1F50C", nullptr, 5486, 1, 15, 1846, 1},
+    {"1F50D", nullptr, 5487, 1, 15, 1847, 1},
+    {"1F50E", nullptr, 5488, 1, 15, 1848, 1},
+    {"1F50F", nullptr, 5489, 1, 15, 1849, 1},
+    {"1F510", nullptr, 5490, 1, 15, 1850, 1},
+    {"1F511", nullptr, 5491, 1, 15, 1851, 1},
+    {"1F512", nullptr, 5492, 1, 15, 1852, 1},
+    {"1F513", nullptr, 5493, 1, 15, 1853, 1},
+    {"1F514", nullptr, 5494, 1, 15, 1854, 1},
+    {"1F515", nullptr, 5495, 1, 15, 1855, 1},
+    {"1F516", nullptr, 5496, 1, 15, 1856, 1},
+    {"1F517", nullptr, 5497, 1, 15, 1857, 1},
+    {"1F518", nullptr, 5498, 1, 15, 1858, 1},
+    {"1F519", nullptr, 5499, 1, 15, 1859, 1},
+    {"1F51A", nullptr, 5500, 1, 15, 1860, 1},
+    {"1F51B", nullptr, 5501, 1, 15, 1861, 1},
+    {"1F51C", nullptr, 5502, 1, 15, 1862, 1},
+    {"1F51D", nullptr, 5503, 1, 15, 1863, 1},
+    {"1F51E", nullptr, 5504, 1, 15, 1864, 1},
+    {"1F51F", nullptr, 5505, 1, 15, 1865, 1},
+    {"1F520", nullptr, 5506, 1, 15, 1866, 1},
+    {"1F521", nullptr, 5507, 1, 15, 1867, 1},
+    {"1F522", nullptr, 5508, 1, 15, 1868, 1},
+    {"1F523", nullptr, 5509, 1, 15, 1869, 1},
+    {"1F524", nullptr, 5510, 1, 15, 1870, 1},
+    {"1F525", nullptr, 5511, 1, 15, 1871, 1},
+    {"1F526", nullptr, 5512, 1, 15, 1872, 1},
+    {"1F527", nullptr, 5513, 1, 15, 1873, 1},
+    {"1F528", nullptr, 5514, 1, 15, 1874, 1},
+    {"1F529", nullptr, 5515, 1, 15, 1875, 1},
+    {"1F52A", nullptr, 5516, 1, 15, 1876, 2},
+    {"1F52B", nullptr, 5517, 1, 15, 1878, 1},
+    {"1F52C", nullptr, 5518, 1, 15, 1879, 1},
+    {"1F52D", nullptr, 5519, 1, 15, 1880, 1},
+    {"1F52E", nullptr, 5520, 1, 15, 1881, 1},
+    {"1F52F", nullptr, 5521, 1, 15, 1882, 1},
+    {"1F530", nullptr, 5522, 1, 15, 1883, 1},
+    {"1F531", nullptr, 5523, 1, 15, 1884, 1},
+    {"1F532", nullptr, 5524, 1, 15, 1885, 1},
+    {"1F533", nullptr, 5525, 1, 15, 1886, 1},
+    {"1F534", nullptr, 5526, 1, 15, 1887, 1},
+    {"1F535", nullptr, 5527, 1, 15, 1888, 1},
+    {"1F536", nullptr, 5528, 1, 15, 1889, 1},
+    {"1F537", nullptr, 5529, 1, 15, 1890, 1},
+    {"1F538", nullptr, 5530, 1, 15, 1891, 1},
+    {"1F539", nullptr, 5531, 1, 15, 1892, 1},
+    {"1F53A", nullptr, 5532, 1, 15, 1893, 1},
+    {"1F53B", nullptr, 5533, 1, 15, 1894, 1},
+    {"1F53C", nullptr, 5534, 1, 15, 1895, 1},
+    {"1F53D", nullptr, 5535, 1, 15, 1896, 1},
+    {"1F549-FE0F", "1F549", 5536, 1, 15, 1897, 1},
+    {"1F54A-FE0F", "1F54A", 5537, 1, 15, 1898, 1},
+    {"1F54B", nullptr, 5538, 1, 15, 1899, 1},
+    {"1F54C", nullptr, 5539, 1, 15, 1900, 1},
+    {"1F54D", nullptr, 5540, 1, 15, 1901, 1},
+    {"1F54E", nullptr, 5541, 1, 15, 1902, 1},
+    {"1F550", nullptr, 5542, 1, 15, 1903, 1},
+    {"1F551", nullptr, 5543, 1, 15, 1904, 1},
+    {"1F552", nullptr, 5544, 1, 15, 1905, 1},
+    {"1F553", nullptr, 5545, 1, 15, 1906, 1},
+    {"1F554", nullptr, 5546, 1, 15, 1907, 1},
+    {"1F555", nullptr, 5547, 1, 15, 1908, 1},
+    {"1F556", nullptr, 5548, 1, 15, 1909, 1},
+    {"1F557", nullptr, 5549, 1, 15, 1910, 1},
+    {"1F558", nullptr, 5550, 1, 15, 1911, 1},
+    {"1F559", nullptr, 5551, 1, 15, 1912, 1},
+    {"1F55A", nullptr, 5552, 1, 15, 1913, 1},
+    {"1F55B", nullptr, 5553, 1, 15, 1914, 1},
+    {"1F55C", nullptr, 5554, 1, 15, 1915, 1},
+    {"1F55D", nullptr, 5555, 1, 15, 1916, 1},
+    {"1F55E", nullptr, 5556, 1, 15, 1917, 1},
+    {"1F55F", nullptr, 5557, 1, 15, 1918, 1},
+    {"1F560", nullptr, 5558, 1, 15, 1919, 1},
+    {"1F561", nullptr, 5559, 1, 15, 1920, 1},
+    {"1F562", nullptr, 5560, 1, 15, 1921, 1},
+    {"1F563", nullptr, 5561, 1, 15, 1922, 1},
+    {"1F564", nullptr, 5562, 1, 15, 1923, 1},
+    {"1F565", nullptr, 5563, 1, 15, 1924, 1},
+    {"1F566", nullptr, 5564, 1, 15, 1925, 1},
+    {"1F567", nullptr, 5565, 1, 15, 1926, 1},
+    {"1F56F-FE0F", "1F56F", 5566, 1, 15, 1927, 1},
+    {"1F570-FE0F", "1F570", 5567, 1, 15, 1928, 1},
+    {"1F573-FE0F", "1F573", 5568, 1, 15, 1929, 1},
+    {"1F574-FE0F", "1F574", 5569, 1, 15, 1930, 1},
+    {"1F574-1F3FB", nullptr, 5570, 2, 15, 1931, 1},
+    {"1F574-1F3FC", nullptr, 5572, 2, 15, 1932, 1},
+    {"1F574-1F3FD", nullptr, 5574, 2, 15, 1933, 1},
+    {"1F574-1F3FE", nullptr, 5576, 2, 15, 1934, 1},
+    {"1F574-1F3FF", nullptr, 5578, 2, 15, 1935, 1},
+    {"1F575-FE0F-200D-2640-FE0F", nullptr, 5580, 5, 7, 1936, 1},
+    {"1F575-1F3FB-200D-2640-FE0F", "1F575-1F3FB-200D-2640", 5585, 4, 15, 1937, 1},
+    {"1F575-1F3FC-200D-2640-FE0F", "1F575-1F3FC-200D-2640", 5589, 4, 15, 1938, 1},
+    {"1F575-1F3FD-200D-2640-FE0F", "1F575-1F3FD-200D-2640", 5593, 4, 15, 1939, 1},
+    {"1F575-1F3FE-200D-2640-FE0F", "1F575-1F3FE-200D-2640", 5597, 4, 15, 1940, 1},
+    {"1F575-1F3FF-200D-2640-FE0F", "1F575-1F3FF-200D-2640", 5601, 4, 15, 1941, 1},
+    {"1F575-FE0F-200D-2642-FE0F", nullptr, 5605, 5, 7, 1942, 1},
+    {"1F575-1F3FB-200D-2642-FE0F", "1F575-1F3FB-200D-2642", 5610, 4, 15, 1943, 1},
+    {"1F575-1F3FC-200D-2642-FE0F", "1F575-1F3FC-200D-2642", 5614, 4, 15, 1944, 1},
+    {"1F575-1F3FD-200D-2642-FE0F", "1F575-1F3FD-200D-2642", 5618, 4, 15, 1945, 1},
+    {"1F575-1F3FE-200D-2642-FE0F", "1F575-1F3FE-200D-2642", 5622, 4, 15, 1946, 1},
+    {"1F575-1F3FF-200D-2642-FE0F", "1F575-1F3FF-200D-2642", 5626, 4, 15, 1947, 1},
+    {"1F575-FE0F", "1F575", 5630, 1, 15, 1948, 1},
+    {"1F575-1F3FB", nullptr, 5631, 2, 15, 1949, 1},
+    {"1F575-1F3FC", nullptr, 5633, 2, 15, 1950, 1},
+    {"1F575-1F3FD", nullptr, 5635, 2, 15, 1951, 1},
+    {"1F575-1F3FE", nullptr, 5637, 2, 15, 1952, 1},
+    {"1F575-1F3FF", nullptr, 5639, 2, 15, 1953, 1},
+    {"1F576-FE0F", "1F576", 5641, 1, 15, 1954, 1},
+    {"1F577-FE0F", "1F577", 5642, 1, 15, 1955, 1},
+    {"1F578-FE0F", "1F578", 5643, 1, 15, 1956, 1},
+    {"1F579-FE0F", "1F579", 5644, 1, 15, 1957, 1},
+    {"1F57A", nullptr, 5645, 1, 15, 1958, 1},
+    {"1F57A-1F3FB", nullptr, 5646, 2, 15, 1959, 1},
+    {"1F57A-1F3FC", nullptr, 5648, 2, 15, 1960, 1},
+    {"1F57A-1F3FD", nullptr, 5650, 2, 15, 1961, 1},
+    {"1F57A-1F3FE", nullptr, 5652, 2, 15, 1962, 1},
+    {"1F57A-1F3FF", nullptr, 5654, 2, 15, 1963, 1},
+    {"1F587-FE0F", "1F587", 5656, 1, 15, 1964, 1},
+    {"1F58A-FE0F", "1F58A", 5657, 1, 15, 1965, 1},
+    {"1F58B-FE0F", "1F58B", 5658, 1, 15, 1966, 1},
+    {"1F58C-FE0F", "1F58C", 5659, 1, 15, 1967, 1},
+    {"1F58D-FE0F", "1F58D", 5660, 1, 15, 1968, 1},
+    {"1F590-FE0F", "1F590", 5661, 1, 15, 1969, 1},
+    {"1F590-1F3FB", nullptr, 5662, 2, 15, 1970, 1},
+    {"1F590-1F3FC", nullptr, 5664, 2, 15, 1971, 1},
+    {"1F590-1F3FD", nullptr, 5666, 2, 15, 1972, 1},
+    {"1F590-1F3FE", nullptr, 5668, 2, 15, 1973, 1},
+    {"1F590-1F3FF", nullptr, 5670, 2, 15, 1974, 1},
+    {"1F595", nullptr, 5672, 1, 15, 1975, 2},
+    {"1F595-1F3FB", nullptr, 5673, 2, 15, 1977, 1},
+    {"1F595-1F3FC", nullptr, 5675, 2, 15, 1978, 1},
+    {"1F595-1F3FD", nullptr, 5677, 2, 15, 1979, 1},
+    {"1F595-1F3FE", nullptr, 5679, 2, 15, 1980, 1},
+    {"1F595-1F3FF", nullptr, 5681, 2, 15, 1981, 1},
+    {"1F596", nullptr, 5683, 1, 15, 1982, 1},
+    {"1F596-1F3FB", nullptr, 5684, 2, 15, 1983, 1},
+    {"1F596-1F3FC", nullptr, 5686, 2, 15, 1984, 1},
+    {"1F596-1F3FD", nullptr, 5688, 2, 15, 1985, 1},
+    {"1F596-1F3FE", nullptr, 5690, 2, 15, 1986, 1},
+    {"1F596-1F3FF", nullptr, 5692, 2, 15, 1987, 1},
+    {"1F5A4", nullptr, 5694, 1, 15, 1988, 1},
+    {"1F5A5-FE0F", "1F5A5", 5695, 1, 15, 1989, 1},
+    {"1F5A8-FE0F", "1F5A8", 5696, 1, 15, 1990, 1},
+    {"1F5B1-FE0F", "1F5B1", 5697, 1, 15, 1991, 1},
+    {"1F5B2-FE0F", "1F5B2", 5698, 1, 15, 1992, 1},
+    {"1F5BC-FE0F", "1F5BC", 5699, 1, 15, 1993, 1},
+    {"1F5C2-FE0F", "1F5C2", 5700, 1, 15, 1994, 1},
+    {"1F5C3-FE0F", "1F5C3", 5701, 1, 15, 1995, 1},
+    {"1F5C4-FE0F", "1F5C4", 5702, 1, 15, 1996, 1},
+    {"1F5D1-FE0F", "1F5D1", 5703, 1, 15, 1997, 1},
+    {"1F5D2-FE0F", "1F5D2", 5704, 1, 15, 1998, 1},
+    {"1F5D3-FE0F", "1F5D3", 5705, 1, 15, 1999, 1},
+    {"1F5DC-FE0F", "1F5DC", 5706, 1, 15, 2000, 1},
+    {"1F5DD-FE0F", "1F5DD", 5707, 1, 15, 2001, 1},
+    {"1F5DE-FE0F", "1F5DE", 5708, 1, 15, 2002, 1},
+    {"1F5E1-FE0F", "1F5E1", 5709, 1, 15, 2003, 1},
+    {"1F5E3-FE0F", "1F5E3", 5710, 1, 15, 2004, 1},
+    {"1F5E8-FE0F", "1F5E8", 5711, 1, 15, 2005, 1},
+    {"1F5EF-FE0F", "1F5EF", 5712, 1, 15, 2006, 1},
+    {"1F5F3-FE0F", "1F5F3", 5713, 1, 15, 2007, 1},
+    {"1F5FA-FE0F", "1F5FA", 5714, 1, 15, 2008, 1},
+    {"1F5FB", nullptr, 5715, 1, 15, 2009, 1},
+    {"1F5FC", nullptr, 5716, 1, 15, 2010, 1},
+    {"1F5FD", nullptr, 5717, 1, 15, 2011, 1},
+    {"1F5FE", nullptr, 5718, 1, 15, 2012, 1},
+    {"1F5FF", nullptr, 5719, 1, 15, 2013, 1},
+    {"1F600", nullptr, 5720, 1, 15, 2014, 1},
+    {"1F601", nullptr, 5721, 1, 15, 2015, 1},
+    {"1F602", nullptr, 5722, 1, 15, 2016, 1},
+    {"1F603", nullptr, 5723, 1, 15, 2017, 1},
+    {"1F604", nullptr, 5724, 1, 15, 2018, 1},
+    {"1F605", nullptr, 5725, 1, 15, 2019, 1},
+    {"1F606", nullptr, 5726, 1, 15, 2020, 2},
+    {"1F607", nullptr, 5727, 1, 15, 2022, 1},
+    {"1F608", nullptr, 5728, 1, 15, 2023, 1},
+    {"1F609", nullptr, 5729, 1, 15, 2024, 1},
+    {"1F60A", nullptr, 5730, 1, 15, 2025, 1},
+    {"1F60B", nullptr, 5731, 1, 15, 2026, 1},
+    {"1F60C", nullptr, 5732, 1, 15, 2027, 1},
+    {"1F60D", nullptr, 5733, 1, 15, 2028, 1},
+    {"1F60E", nullptr, 5734, 1, 15, 2029, 1},
+    {"1F60F", nullptr, 5735, 1, 15, 2030, 1},
+    {"1F610", nullptr, 5736, 1, 15, 2031, 1},
+    {"1F611", nullptr, 5737, 1, 15, 2032, 1},
+    {"1F612", nullptr, 5738, 1, 15, 2033, 1},
+    {"1F613", nullptr, 5739, 1, 15, 2034, 1},
+    {"1F614", nullptr, 5740, 1, 15, 2035, 1},
+    {"1F615", nullptr, 5741, 1, 15, 2036, 1},
+    {"1F616", nullptr, 5742, 1, 15, 2037, 1},
+    {"1F617", nullptr, 5743, 1, 15, 2038, 1},
+    {"1F618", nullptr, 5744, 1, 15, 2039, 1},
+    {"1F619", nullptr, 5745, 1, 15, 2040, 1},
+    {"1F61A", nullptr, 5746, 1, 15, 2041, 1},
+    {"1F61B", nullptr, 5747, 1, 15, 2042, 1},
+    {"1F61C", nullptr, 5748, 1, 15, 2043, 1},
+    {"1F61D", nullptr, 5749, 1, 15, 2044, 1},
+    {"1F61E", nullptr, 5750, 1, 15, 2045, 1},
+    {"1F61F", nullptr, 5751, 1, 15, 2046, 1},
+    {"1F620", nullptr, 5752, 1, 15, 2047, 1},
+    {"1F621", nullptr, 5753, 1, 15, 2048, 1},
+    {"1F622", nullptr, 5754, 1, 15, 2049, 1},
+    {"1F623", nullptr, 5755, 1, 15, 2050, 1},
+    {"1F624", nullptr, 5756, 1, 15, 2051, 1},
+    {"1F625", nullptr, 5757, 1, 15, 2052, 1},
+    {"1F626", nullptr, 5758, 1, 15, 2053, 1},
+    {"1F627", nullptr, 5759, 1, 15, 2054, 1},
+    {"1F628", nullptr, 5760, 1, 15, 2055, 1},
+    {"1F629", nullptr, 5761, 1, 15, 2056, 1},
+    {"1F62A", nullptr, 5762, 1, 15, 2057, 1},
+    {"1F62B", nullptr, 5763, 1, 15, 2058, 1},
+    {"1F62C", nullptr, 5764, 1, 15, 2059, 1},
+    {"1F62D", nullptr, 5765, 1, 15, 2060, 1},
+    {"1F62E-200D-1F4A8", nullptr, 5766, 3, 7, 2061, 1},
+    {"1F62E", nullptr, 5769, 1, 15, 2062, 1},
+    {"1F62F", nullptr, 5770, 1, 15, 2063, 1},
+    {"1F630", nullptr, 5771, 1, 15, 2064, 1},
+    {"1F631", nullptr, 5772, 1, 15, 2065, 1},
+    {"1F632", nullptr, 5773, 1, 15, 2066, 1},
+    {"1F633", nullptr, 5774, 1, 15, 2067, 1},
+    {"1F634", nullptr, 5775, 1, 15, 2068, 1},
+    {"1F635-200D-1F4AB", nullptr, 5776, 3, 7, 2069, 1},
+    {"1F635", nullptr, 5779, 1, 15, 2070, 1},
+    {"1F636-200D-1F32B-FE0F", "1F636-200D-1F32B", 5780, 3, 7, 2071, 1},
+    {"1F636", nullptr, 5783, 1, 15, 2072, 1},
+    {"1F637", nullptr, 5784, 1, 15, 2073, 1},
+    {"1F638", nullptr, 5785, 1, 15, 2074, 1},
+    {"1F639", nullptr, 5786, 1, 15, 2075, 1},
+    {"1F63A", nullptr, 5787, 1, 15, 2076, 1},
+    {"1F63B", nullptr, 5788, 1, 15, 2077, 1},
+    {"1F63C", nullptr, 5789, 1, 15, 2078, 1},
+    {"1F63D", nullptr, 5790, 1, 15, 2079, 1},
+    {"1F63E", nullptr, 5791, 1, 15, 2080, 1},
+    {"1F63F", nullptr, 5792, 1, 15, 2081, 1},
+    {"1F640", nullptr, 5793, 1, 15, 2082, 1},
+    {"1F641", nullptr, 5794, 1, 15, 2083, 1},
+    {"1F642", nullptr, 5795, 1, 15, 2084, 1},
+    {"1F643", nullptr, 5796, 1, 15, 2085, 1},
+    {"1F644", nullptr, 5797, 1, 15, 2086, 1},
+    {"1F645-200D-2640-FE0F", "1F645-200D-2640", 5798, 3, 15, 2087, 1},
+    {"1F645-1F3FB-200D-2640-FE0F", "1F645-1F3FB-200D-2640", 5801, 4, 15, 2088, 1},
+    {"1F645-1F3FC-200D-2640-FE0F", "1F645-1F3FC-200D-2640", 5805, 4, 15, 2089, 1},
+    {"1F645-1F3FD-200D-2640-FE0F", "1F645-1F3FD-200D-2640", 5809, 4, 15, 2090, 1},
+    {"1F645-1F3FE-200D-2640-FE0F", "1F645-1F3FE-200D-2640", 5813, 4, 15, 2091, 1},
+    {"1F645-1F3FF-200D-2640-FE0F", "1F645-1F3FF-200D-2640", 5817, 4, 15, 2092, 1},
+    {"1F645-200D-2642-FE0F", "1F645-200D-2642", 5821, 3, 15, 2093, 1},
+    {"1F645-1F3FB-200D-2642-FE0F", "1F645-1F3FB-200D-2642", 5824, 4, 15, 2094, 1},
+    {"1F645-1F3FC-200D-2642-FE0F", "1F645-1F3FC-200D-2642", 5828, 4, 15, 2095, 1},
+    {"1F645-1F3FD-200D-2642-FE0F", "1F645-1F3FD-200D-2642", 5832, 4, 15, 2096, 1},
+    {"1F645-1F3FE-200D-2642-FE0F", "1F645-1F3FE-200D-2642", 5836, 4, 15, 2097, 1},
+    {"1F645-1F3FF-200D-2642-FE0F", "1F645-1F3FF-200D-2642", 5840, 4, 15, 2098, 1},
+    {"1F645", nullptr, 5844, 1, 15, 2099, 1},
+    {"1F645-1F3FB", nullptr, 5845, 2, 15, 2100, 1},
+    {"1F645-1F3FC", nullptr, 5847, 2, 15, 2101, 1},
+    {"1F645-1F3FD", nullptr, 5849, 2, 15, 2102, 1},
+    {"1F645-1F3FE", nullptr, 5851, 2, 15, 2103, 1},
+    {"1F645-1F3FF", nullptr, 5853, 2, 15, 2104, 1},
+    {"1F646-200D-2640-FE0F", "1F646-200D-2640", 5855, 3, 15, 2105, 1},
+    {"1F646-1F3FB-200D-2640-FE0F", "1F646-1F3FB-200D-2640", 5858, 4, 15, 2106, 1},
+    {"1F646-1F3FC-200D-2640-FE0F", "1F646-1F3FC-200D-2640", 5862, 4, 15, 2107, 1},
+    {"1F646-1F3FD-200D-2640-FE0F", "1F646-1F3FD-200D-2640", 5866, 4, 15, 2108, 1},
+    {"1F646-1F3FE-200D-2640-FE0F", "1F646-1F3FE-200D-2640", 5870, 4, 15, 2109, 1},
+    {"1F646-1F3FF-200D-2640-FE0F", "1F646-1F3FF-200D-2640", 5874, 4, 15, 2110, 1},
+    {"1F646-200D-2642-FE0F", "1F646-200D-2642", 5878, 3, 15, 2111, 1},
+    {"1F646-1F3FB-200D-2642-FE0F", "1F646-1F3FB-200D-2642", 5881, 4, 15, 2112, 1},
+    {"1F646-1F3FC-200D-2642-FE0F", "1F646-1F3FC-200D-2642", 5885, 4, 15, 2113, 1},
+    {"1F646-1F3FD-200D-2642-FE0F", "1F646-1F3FD-200D-2642", 5889, 4, 15, 2114, 1},
+    {"1F646-1F3FE-200D-2642-FE0F", "1F646-1F3FE-200D-2642", 5893, 4, 15, 2115, 1},
+    {"1F646-1F3FF-200D-2642-FE0F", "1F646-1F3FF-200D-2642", 5897, 4, 15, 2116, 1},
+    {"1F646", nullptr, 5901, 1, 15, 2117, 1},
+    {"1F646-1F3FB", nullptr, 5902, 2, 15, 2118, 1},
+    {"1F646-1F3FC", nullptr, 5904, 2, 15, 2119, 1},
+    {"1F646-1F3FD", nullptr, 5906, 2, 15, 2120, 1},
+    {"1F646-1F3FE", nullptr, 5908, 2, 15, 2121, 1},
+    {"1F646-1F3FF", nullptr, 5910, 2, 15, 2122, 1},
+    {"1F647-200D-2640-FE0F", "1F647-200D-2640", 5912, 3, 15, 2123, 1},
+    {"1F647-1F3FB-200D-2640-FE0F", "1F647-1F3FB-200D-2640", 5915, 4, 15, 2124, 1},
+    {"1F647-1F3FC-200D-2640-FE0F", "1F647-1F3FC-200D-2640", 5919, 4, 15, 2125, 1},
+    {"1F647-1F3FD-200D-2640-FE0F", "1F647-1F3FD-200D-2640", 5923, 4, 15, 2126, 1},
+    {"1F647-1F3FE-200D-2640-FE0F", "1F647-1F3FE-200D-2640", 5927, 4, 15, 2127, 1},
+    {"1F647-1F3FF-200D-2640-FE0F", "1F647-1F3FF-200D-2640", 5931, 4, 15, 2128, 1},
+    {"1F647-200D-2642-FE0F", "1F647-200D-2642", 5935, 3, 15, 2129, 1},
+    {"1F647-1F3FB-200D-2642-FE0F", "1F647-1F3FB-200D-2642", 5938, 4, 15, 2130, 1},
+    {"1F647-1F3FC-200D-2642-FE0F", "1F647-1F3FC-200D-2642", 5942, 4, 15, 2131, 1},
+    {"1F647-1F3FD-200D-2642-FE0F", "1F647-1F3FD-200D-2642", 5946, 4, 15, 2132, 1},
+    {"1F647-1F3FE-200D-2642-FE0F", "1F647-1F3FE-200D-2642", 5950, 4, 15, 2133, 1},
+    {"1F647-1F3FF-200D-2642-FE0F", "1F647-1F3FF-200D-2642", 5954, 4, 15, 2134, 1},
+    {"1F647", nullptr, 5958, 1, 15, 2135, 1},
+    {"1F647-1F3FB", nullptr, 5959, 2, 15, 2136, 1},
+    {"1F647-1F3FC", nullptr, 5961, 2, 15, 2137, 1},
+    {"1F647-1F3FD", nullptr, 5963, 2, 15, 2138, 1},
+    {"1F647-1F3FE", nullptr, 5965, 2, 15, 2139, 1},
+    {"1F647-1F3FF", nullptr, 5967, 2, 15, 2140, 1},
+    {"1F648", nullptr, 5969, 1, 15, 2141, 1},
+    {"1F649", nullptr, 5970, 1, 15, 2142, 1},
+    {"1F64A", nullptr, 5971, 1, 15, 2143, 1},
+    {"1F64B-200D-2640-FE0F", "1F64B-200D-2640", 5972, 3, 15, 2144, 1},
+    {"1F64B-1F3FB-200D-2640-FE0F", "1F64B-1F3FB-200D-2640", 5975, 4, 15, 2145, 1},
+    {"1F64B-1F3FC-200D-2640-FE0F", "1F64B-1F3FC-200D-2640", 5979, 4, 15, 2146, 1},
+    {"1F64B-1F3FD-200D-2640-FE0F", "1F64B-1F3FD-200D-2640", 5983, 4, 15, 2147, 1},
+    {"1F64B-1F3FE-200D-2640-FE0F", "1F64B-1F3FE-200D-2640", 5987, 4, 15, 2148, 1},
+    {"1F64B-1F3FF-200D-2640-FE0F", "1F64B-1F3FF-200D-2640", 5991, 4, 15, 2149, 1},
+    {"1F64B-200D-2642-FE0F", "1F64B-200D-2642", 5995, 3, 15, 2150, 1},
+    {"1F64B-1F3FB-200D-2642-FE0F", "1F64B-1F3FB-200D-2642", 5998, 4, 15, 2151, 1},
+    {"1F64B-1F3FC-200D-2642-FE0F", "1F64B-1F3FC-200D-2642", 6002, 4, 15, 2152, 1},
+    {"1F64B-1F3FD-200D-2642-FE0F", "1F64B-1F3FD-200D-2642", 6006, 4, 15, 2153, 1},
+    {"1F64B-1F3FE-200D-2642-FE0F", "1F64B-1F3FE-200D-2642", 6010, 4, 15, 2154, 1},
+    {"1F64B-1F3FF-200D-2642-FE0F", "1F64B-1F3FF-200D-2642", 6014, 4, 15, 2155, 1},
+    {"1F64B", nullptr, 6018, 1, 15, 2156, 1},
+    {"1F64B-1F3FB", nullptr, 6019, 2, 15, 2157, 1},
+    {"1F64B-1F3FC", nullptr, 6021, 2, 15, 2158, 1},
+    {"1F64B-1F3FD", nullptr, 6023, 2, 15, 2159, 1},
+    {"1F64B-1F3FE", nullptr, 6025, 2, 15, 2160, 1},
+    {"1F64B-1F3FF", nullptr, 6027, 2, 15, 2161, 1},
+    {"1F64C", nullptr, 6029, 1, 15, 2162, 1},
+    {"1F64C-1F3FB", nullptr, 6030, 2, 15, 2163, 1},
+    {"1F64C-1F3FC", nullptr, 6032, 2, 15, 2164, 1},
+    {"1F64C-1F3FD", nullptr, 6034, 2, 15, 2165, 1},
+    {"1F64C-1F3FE", nullptr, 6036, 2, 15, 2166, 1},
+    {"1F64C-1F3FF", nullptr, 6038, 2, 15, 2167, 1},
+    {"1F64D-200D-2640-FE0F", "1F64D-200D-2640", 6040, 3, 15, 2168, 1},
+    {"1F64D-1F3FB-200D-2640-FE0F", "1F64D-1F3FB-200D-2640", 6043, 4, 15, 2169, 1},
+    {"1F64D-1F3FC-200D-2640-FE0F", "1F64D-1F3FC-200D-2640", 6047, 4, 15, 2170, 1},
+    {"1F64D-1F3FD-200D-2640-FE0F", "1F64D-1F3FD-200D-2640", 6051, 4, 15, 2171, 1},
+    {"1F64D-1F3FE-200D-2640-FE0F", "1F64D-1F3FE-200D-2640", 6055, 4, 15, 2172, 1},
+    {"1F64D-1F3FF-200D-2640-FE0F", "1F64D-1F3FF-200D-2640", 6059, 4, 15, 2173, 1},
+    {"1F64D-200D-2642-FE0F", "1F64D-200D-2642", 6063, 3, 15, 2174, 1},
+    {"1F64D-1F3FB-200D-2642-FE0F", "1F64D-1F3FB-200D-2642", 6066, 4, 15, 2175, 1},
+    {"1F64D-1F3FC-200D-2642-FE0F", "1F64D-1F3FC-200D-2642", 6070, 4, 15, 2176, 1},
+    {"1F64D-1F3FD-200D-2642-FE0F", "1F64D-1F3FD-200D-2642", 6074, 4, 15, 2177, 1},
+    {"1F64D-1F3FE-200D-2642-FE0F", "1F64D-1F3FE-200D-2642", 6078, 4, 15, 2178, 1},
+    {"1F64D-1F3FF-200D-2642-FE0F", "1F64D-1F3FF-200D-2642", 6082, 4, 15, 2179, 1},
+    {"1F64D", nullptr, 6086, 1, 15, 2180, 1},
+    {"1F64D-1F3FB", nullptr, 6087, 2, 15, 2181, 1},
+    {"1F64D-1F3FC", nullptr, 6089, 2, 15, 2182, 1},
+    {"1F64D-1F3FD", nullptr, 6091, 2, 15, 2183, 1},
+    {"1F64D-1F3FE", nullptr, 6093, 2, 15, 2184, 1},
+    {"1F64D-1F3FF", nullptr, 6095, 2, 15, 2185, 1},
+    {"1F64E-200D-2640-FE0F", "1F64E-200D-2640", 6097, 3, 15, 2186, 1},
+    {"1F64E-1F3FB-200D-2640-FE0F", "1F64E-1F3FB-200D-2640", 6100, 4, 15, 2187, 1},
+    {"1F64E-1F3FC-200D-2640-FE0F", "1F64E-1F3FC-200D-2640", 6104, 4, 15, 2188, 1},
+    {"1F64E-1F3FD-200D-2640-FE0F", "1F64E-1F3FD-200D-2640", 6108, 4, 15, 2189, 1},
+    {"1F64E-1F3FE-200D-2640-FE0F", "1F64E-1F3FE-200D-2640", 6112, 4, 15, 2190, 1},
+    {"1F64E-1F3FF-200D-2640-FE0F", "1F64E-1F3FF-200D-2640", 6116, 4, 15, 2191, 1},
+    {"1F64E-200D-2642-FE0F", "1F64E-200D-2642", 6120, 3, 15, 2192, 1},
+    {"1F64E-1F3FB-200D-2642-FE0F", "1F64E-1F3FB-200D-2642", 6123, 4, 15, 2193, 1},
+    {"1F64E-1F3FC-200D-2642-FE0F", "1F64E-1F3FC-200D-2642", 6127, 4, 15, 2194, 1},
+    {"1F64E-1F3FD-200D-2642-FE0F", "1F64E-1F3FD-200D-2642", 6131, 4, 15, 2195, 1},
+    {"1F64E-1F3FE-200D-2642-FE0F", "1F64E-1F3FE-200D-2642", 6135, 4, 15, 2196, 1},
+    {"1F64E-1F3FF-200D-2642-FE0F", "1F64E-1F3FF-200D-2642", 6139, 4, 15, 2197, 1},
+    {"1F64E", nullptr, 6143, 1, 15, 2198, 1},
+    {"1F64E-1F3FB", nullptr, 6144, 2, 15, 2199, 1},
+    {"1F64E-1F3FC", nullptr, 6146, 2, 15, 2200, 1},
+    {"1F64E-1F3FD", nullptr, 6148, 2, 15, 2201, 1},
+    {"1F64E-1F3FE", nullptr, 6150, 2, 15, 2202, 1},
+    {"1F64E-1F3FF", nullptr, 6152, 2, 15, 2203, 1},
+    {"1F64F", nullptr, 6154, 1, 15, 2204, 1},
+    {"1F64F-1F3FB", nullptr, 6155, 2, 15, 2205, 1},
+    {"1F64F-1F3FC", nullptr, 6157, 2, 15, 2206, 1},
+    {"1F64F-1F3FD", nullptr, 6159, 2, 15, 2207, 1},
+    {"1F64F-1F3FE", nullptr, 6161, 2, 15, 2208, 1},
+    {"1F64F-1F3FF", nullptr, 6163, 2, 15, 2209, 1},
+    {"1F680", nullptr, 6165, 1, 15, 2210, 1},
+    {"1F681", nullptr, 6166, 1, 15, 2211, 1},
+    {"1F682", nullptr, 6167, 1, 15, 2212, 1},
+    {"1F683", nullptr, 6168, 1, 15, 2213, 1},
+    {"1F684", nullptr, 6169, 1, 15, 2214, 1},
+    {"1F685", nullptr, 6170, 1, 15, 2215, 1},
+    {"1F686", nullptr, 6171, 1, 15, 2216, 1},
+    {"1F687", nullptr, 6172, 1, 15, 2217, 1},
+    {"1F688", nullptr, 6173, 1, 15, 2218, 1},
+    {"1F689", nullptr, 6174, 1, 15, 2219, 1},
+    {"1F68A", nullptr, 6175, 1, 15, 2220, 1},
+    {"1F68B", nullptr, 6176, 1, 15, 2221, 1},
+    {"1F68C", nullptr, 6177, 1, 15, 2222, 1},
+    {"1F68D", nullptr, 6178, 1, 15, 2223, 1},
+    {"1F68E", nullptr, 6179, 1, 15, 2224, 1},
+    {"1F68F", nullptr, 6180, 1, 15, 2225, 1},
+    {"1F690", nullptr, 6181, 1, 15, 2226, 1},
+    {"1F691", nullptr, 6182, 1, 15, 2227, 1},
+    {"1F692", nullptr, 6183, 1, 15, 2228, 1},
+    {"1F693", nullptr, 6184, 1, 15, 2229, 1},
+    {"1F694", nullptr, 6185, 1, 15, 2230, 1},
+    {"1F695", nullptr, 6186, 1, 15, 2231, 1},
+    {"1F696", nullptr, 6187, 1, 15, 2232, 1},
+    {"1F697", nullptr, 6188, 1, 15, 2233, 2},
+    {"1F698", nullptr, 6189, 1, 15, 2235, 1},
+    {"1F699", nullptr, 6190, 1, 15, 2236, 1},
+    {"1F69A", nullptr, 6191, 1, 15, 2237, 1},
+    {"1F69B", nullptr, 6192, 1, 15, 2238, 1},
+    {"1F69C", nullptr, 6193, 1, 15, 2239, 1},
+    {"1F69D", nullptr, 6194, 1, 15, 2240, 1},
+    {"1F69E", nullptr, 6195, 1, 15, 2241, 1},
+    {"1F69F", nullptr, 6196, 1, 15, 2242, 1},
+    {"1F6A0", nullptr, 6197, 1, 15, 2243, 1},
+    {"1F6A1", nullptr, 6198, 1, 15, 2244, 1},
+    {"1F6A2", nullptr, 6199, 1, 15, 2245, 1},
+    {"1F6A3-200D-2640-FE0F", "1F6A3-200D-2640", 6200, 3, 15, 2246, 1},
+    {"1F6A3-1F3FB-200D-2640-FE0F", "1F6A3-1F3FB-200D-2640", 6203, 4, 15, 2247, 1},
+    {"1F6A3-1F3FC-200D-2640-FE0F", "1F6A3-1F3FC-200D-2640", 6207, 4, 15, 2248, 1},
+    {"1F6A3-1F3FD-200D-2640-FE0F", "1F6A3-1F3FD-200D-2640", 6211, 4, 15, 2249, 1},
+    {"1F6A3-1F3FE-200D-2640-FE0F", "1F6A3-1F3FE-200D-2640", 6215, 4, 15, 2250, 1},
+    {"1F6A3-1F3FF-200D-2640-FE0F", "1F6A3-1F3FF-200D-2640", 6219, 4, 15, 2251, 1},
+    {"1F6A3-200D-2642-FE0F", "1F6A3-200D-2642", 6223, 3, 15, 2252, 1},
+    {"1F6A3-1F3FB-200D-2642-FE0F", "1F6A3-1F3FB-200D-2642", 6226, 4, 15, 2253, 1},
+    {"1F6A3-1F3FC-200D-2642-FE0F", "1F6A3-1F3FC-200D-2642", 6230, 4, 15, 2254, 1},
+    {"1F6A3-1F3FD-200D-2642-FE0F", "1F6A3-1F3FD-200D-2642", 6234, 4, 15, 2255, 1},
+    {"1F6A3-1F3FE-200D-2642-FE0F", "1F6A3-1F3FE-200D-2642", 6238, 4, 15, 2256, 1},
+    {"1F6A3-1F3FF-200D-2642-FE0F", "1F6A3-1F3FF-200D-2642", 6242, 4, 15, 2257, 1},
+    {"1F6A3", nullptr, 6246, 1, 15, 2258, 1},
+    {"1F6A3-1F3FB", nullptr, 6247, 2, 15, 2259, 1},
+    {"1F6A3-1F3FC", nullptr, 6249, 2, 15, 2260, 1},
+    {"1F6A3-1F3FD", nullptr, 6251, 2, 15, 2261, 1},
+    {"1F6A3-1F3FE", nullptr, 6253, 2, 15, 2262, 1},
+    {"1F6A3-1F3FF", nullptr, 6255, 2, 15, 2263, 1},
+    {"1F6A4", nullptr, 6257, 1, 15, 2264, 1},
+    {"1F6A5", nullptr, 6258, 1, 15, 2265, 1},
+    {"1F6A6", nullptr, 6259, 1, 15, 2266, 1},
+    {"1F6A7", nullptr, 6260, 1, 15, 2267, 1},
+    {"1F6A8", nullptr, 6261, 1, 15, 2268, 1},
+    {"1F6A9", nullptr, 6262, 1, 15, 2269, 1},
+    {"1F6AA", nullptr, 6263, 1, 15, 2270, 1},
+    {"1F6AB", nullptr, 6264, 1, 15, 2271, 1},
+    {"1F6AC", nullptr, 6265, 1, 15, 2272, 1},
+    {"1F6AD", nullptr, 6266, 1, 15, 2273, 1},
+    {"1F6AE", nullptr, 6267, 1, 15, 2274, 1},
+    {"1F6AF", nullptr, 6268, 1, 15, 2275, 1},
+    {"1F6B0", nullptr, 6269, 1, 15, 2276, 1},
+    {"1F6B1", nullptr, 6270, 1, 15, 2277, 1},
+    {"1F6B2", nullptr, 6271, 1, 15, 2278, 1},
+    {"1F6B3", nullptr, 6272, 1, 15, 2279, 1},
+    {"1F6B4-200D-2640-FE0F", "1F6B4-200D-2640", 6273, 3, 15, 2280, 1},
+    {"1F6B4-1F3FB-200D-2640-FE0F", "1F6B4-1F3FB-200D-2640", 6276, 4, 15, 2281, 1},
+    {"1F6B4-1F3FC-200D-2640-FE0F", "1F6B4-1F3FC-200D-2640", 6280, 4, 15, 2282, 1},
+    {"1F6B4-1F3FD-200D-2640-FE0F", "1F6B4-1F3FD-200D-2640", 6284, 4, 15, 2283, 1},
+    {"1F6B4-1F3FE-200D-2640-FE0F", "1F6B4-1F3FE-200D-2640", 6288, 4, 15, 2284, 1},
+    {"1F6B4-1F3FF-200D-2640-FE0F", "1F6B4-1F3FF-200D-2640", 6292, 4, 15, 2285, 1},
+    {"1F6B4-200D-2642-FE0F", "1F6B4-200D-2642", 6296, 3, 15, 2286, 1},
+    {"1F6B4-1F3FB-200D-2642-FE0F", "1F6B4-1F3FB-200D-2642", 6299, 4, 15, 2287, 1},
+    {"1F6B4-1F3FC-200D-2642-FE0F", "1F6B4-1F3FC-200D-2642", 6303, 4, 15, 2288, 1},
+    {"1F6B4-1F3FD-200D-2642-FE0F", "1F6B4-1F3FD-200D-2642", 6307, 4, 15, 2289, 1},
+    {"1F6B4-1F3FE-200D-2642-FE0F", "1F6B4-1F3FE-200D-2642", 6311, 4, 15, 2290, 1},
+    {"1F6B4-1F3FF-200D-2642-FE0F", "1F6B4-1F3FF-200D-2642", 6315, 4, 15, 2291, 1},
+    {"1F6B4", nullptr, 6319, 1, 15, 2292, 1},
+    {"1F6B4-1F3FB", nullptr, 6320, 2, 15, 2293, 1},
+    {"1F6B4-1F3FC", nullptr, 6322, 2, 15, 2294, 1},
+    {"1F6B4-1F3FD", nullptr, 6324, 2, 15, 2295, 1},
+    {"1F6B4-1F3FE", nullptr, 6326, 2, 15, 2296, 1},
+    {"1F6B4-1F3FF", nullptr, 6328, 2, 15, 2297, 1},
+    {"1F6B5-200D-2640-FE0F", "1F6B5-200D-2640", 6330, 3, 15, 2298, 1},
+    {"1F6B5-1F3FB-200D-2640-FE0F", "1F6B5-1F3FB-200D-2640", 6333, 4, 15, 2299, 1},
+    {"1F6B5-1F3FC-200D-2640-FE0F", "1F6B5-1F3FC-200D-2640", 6337, 4, 15, 2300, 1},
+    {"1F6B5-1F3FD-200D-2640-FE0F", "1F6B5-1F3FD-200D-2640", 6341, 4, 15, 2301, 1},
+    {"1F6B5-1F3FE-200D-2640-FE0F", "1F6B5-1F3FE-200D-2640", 6345, 4, 15, 2302, 1},
+    {"1F6B5-1F3FF-200D-2640-FE0F", "1F6B5-1F3FF-200D-2640", 6349, 4, 15, 2303, 1},
+    {"1F6B5-200D-2642-FE0F", "1F6B5-200D-2642", 6353, 3, 15, 2304, 1},
+    {"1F6B5-1F3FB-200D-2642-FE0F", "1F6B5-1F3FB-200D-2642", 6356, 4, 15, 2305, 1},
+    {"1F6B5-1F3FC-200D-2642-FE0F", "1F6B5-1F3FC-200D-2642", 6360, 4, 15, 2306, 1},
+    {"1F6B5-1F3FD-200D-2642-FE0F", "1F6B5-1F3FD-200D-2642", 6364, 4, 15, 2307, 1},
+    {"1F6B5-1F3FE-200D-2642-FE0F", "1F6B5-1F3FE-200D-2642", 6368, 4, 15, 2308, 1},
+    {"1F6B5-1F3FF-200D-2642-FE0F", "1F6B5-1F3FF-200D-2642", 6372, 4, 15, 2309, 1},
+    {"1F6B5", nullptr, 6376, 1, 15, 2310, 1},
+    {"1F6B5-1F3FB", nullptr, 6377, 2, 15, 2311, 1},
+    {"1F6B5-1F3FC", nullptr, 6379, 2, 15, 2312, 1},
+    {"1F6B5-1F3FD", nullptr, 6381, 2, 15, 2313, 1},
+    {"1F6B5-1F3FE", nullptr, 6383, 2, 15, 2314, 1},
+    {"1F6B5-1F3FF", nullptr, 6385, 2, 15, 2315, 1},
+    {"1F6B6-200D-2640-FE0F", "1F6B6-200D-2640", 6387, 3, 15, 2316, 1},
+    {"1F6B6-1F3FB-200D-2640-FE0F", "1F6B6-1F3FB-200D-2640", 6390, 4, 15, 2317, 1},
+    {"1F6B6-1F3FC-200D-2640-FE0F", "1F6B6-1F3FC-200D-2640", 6394, 4, 15, 2318, 1},
+    {"1F6B6-1F3FD-200D-2640-FE0F", "1F6B6-1F3FD-200D-2640", 6398, 4, 15, 2319, 1},
+    {"1F6B6-1F3FE-200D-2640-FE0F", "1F6B6-1F3FE-200D-2640", 6402, 4, 15, 2320, 1},
+    {"1F6B6-1F3FF-200D-2640-FE0F", "1F6B6-1F3FF-200D-2640", 6406, 4, 15, 2321, 1},
+    {"1F6B6-200D-2642-FE0F", "1F6B6-200D-2642", 6410, 3, 15, 2322, 1},
+    {"1F6B6-1F3FB-200D-2642-FE0F", "1F6B6-1F3FB-200D-2642", 6413, 4, 15, 2323, 1},
+    {"1F6B6-1F3FC-200D-2642-FE0F", "1F6B6-1F3FC-200D-2642", 6417, 4, 15, 2324, 1},
+    {"1F6B6-1F3FD-200D-2642-FE0F", "1F6B6-1F3FD-200D-2642", 6421, 4, 15, 2325, 1},
+    {"1F6B6-1F3FE-200D-2642-FE0F", "1F6B6-1F3FE-200D-2642", 6425, 4, 15, 2326, 1},
+    {"1F6B6-1F3FF-200D-2642-FE0F", "1F6B6-1F3FF-200D-2642", 6429, 4, 15, 2327, 1},
+    {"1F6B6", nullptr, 6433, 1, 15, 2328, 1},
+    {"1F6B6-1F3FB", nullptr, 6434, 2, 15, 2329, 1},
+    {"1F6B6-1F3FC", nullptr, 6436, 2, 15, 2330, 1},
+    {"1F6B6-1F3FD", nullptr, 6438, 2, 15, 2331, 1},
+    {"1F6B6-1F3FE", nullptr, 6440, 2, 15, 2332, 1},
+    {"1F6B6-1F3FF", nullptr, 6442, 2, 15, 2333, 1},
+    {"1F6B7", nullptr, 6444, 1, 15, 2334, 1},
+    {"1F6B8", nullptr, 6445, 1, 15, 2335, 1},
+    {"1F6B9", nullptr, 6446, 1, 15, 2336, 1},
+    {"1F6BA", nullptr, 6447, 1, 15, 2337, 1},
+    {"1F6BB", nullptr, 6448, 1, 15, 2338, 1},
+    {"1F6BC", nullptr, 6449, 1, 15, 2339, 1},
+    {"1F6BD", nullptr, 6450, 1, 15, 2340, 1},
+    {"1F6BE", nullptr, 6451, 1, 15, 2341, 1},
+    {"1F6BF", nullptr, 6452, 1, 15, 2342, 1},
+    {"1F6C0", nullptr, 6453, 1, 15, 2343, 1},
+    {"1F6C0-1F3FB", nullptr, 6454, 2, 15, 2344, 1},
+    {"1F6C0-1F3FC", nullptr, 6456, 2, 15, 2345, 1},
+    {"1F6C0-1F3FD", nullptr, 6458, 2, 15, 2346, 1},
+    {"1F6C0-1F3FE", nullptr, 6460, 2, 15, 2347, 1},
+    {"1F6C0-1F3FF", nullptr, 6462, 2, 15, 2348, 1},
+    {"1F6C1", nullptr, 6464, 1, 15, 2349, 1},
+    {"1F6C2", nullptr, 6465, 1, 15, 2350, 1},
+    {"1F6C3", nullptr, 6466, 1, 15, 2351, 1},
+    {"1F6C4", nullptr, 6467, 1, 15, 2352, 1},
+    {"1F6C5", nullptr, 6468, 1, 15, 2353, 1},
+    {"1F6CB-FE0F", "1F6CB", 6469, 1, 15, 2354, 1},
+    {"1F6CC", nullptr, 6470, 1, 15, 2355, 1},
+    {"1F6CC-1F3FB", nullptr, 6471, 2, 15, 2356, 1},
+    {"1F6CC-1F3FC", nullptr, 6473, 2, 15, 2357, 1},
+    {"1F6CC-1F3FD", nullptr, 6475, 2, 15, 2358, 1},
+    {"1F6CC-1F3FE", nullptr, 6477, 2, 15, 2359, 1},
+    {"1F6CC-1F3FF", nullptr, 6479, 2, 15, 2360, 1},
+    {"1F6CD-FE0F", "1F6CD", 6481, 1, 15, 2361, 1},
+    {"1F6CE-FE0F", "1F6CE", 6482, 1, 15, 2362, 1},
+    {"1F6CF-FE0F", "1F6CF", 6483, 1, 15, 2363, 1},
+    {"1F6D0", nullptr, 6484, 1, 15, 2364, 1},
+    {"1F6D1", nullptr, 6485, 1, 15, 2365, 1},
+    {"1F6D2", nullptr, 6486, 1, 15, 2366, 1},
+    {"1F6D5", nullptr, 6487, 1, 15, 2367, 1},
+    {"1F6D6", nullptr, 6488, 1, 15, 2368, 1},
+    {"1F6D7", nullptr, 6489, 1, 15, 2369, 1},
+    {"1F6E0-FE0F", "1F6E0", 6490, 1, 15, 2370, 1},
+    {"1F6E1-FE0F", "1F6E1", 6491, 1, 15, 2371, 1},
+    {"1F6E2-FE0F", "1F6E2", 6492, 1, 15, 2372, 1},
+    {"1F6E3-FE0F", "1F6E3", 6493, 1, 15, 2373, 1},
+    {"1F6E4-FE0F", "1F6E4", 6494, 1, 15, 2374, 1},
+    {"1F6E5-FE0F", "1F6E5", 6495, 1, 15, 2375, 1},
+    {"1F6E9-FE0F", "1F6E9", 6496, 1, 15, 2376, 1},
+    {"1F6EB", nullptr, 6497, 1, 15, 2377, 1},
+    {"1F6EC", nullptr, 6498, 1, 15, 2378, 1},
+    {"1F6F0-FE0F", "1F6F0", 6499, 1, 15, 2379, 1},
+    {"1F6F3-FE0F", "1F6F3", 6500, 1, 15, 2380, 1},
+    {"1F6F4", nullptr, 6501, 1, 15, 2381, 1},
+    {"1F6F5", nullptr, 6502, 1, 15, 2382, 1},
+    {"1F6F6", nullptr, 6503, 1, 15, 2383, 1},
+    {"1F6F7", nullptr, 6504, 1, 15, 2384, 1},
+    {"1F6F8", nullptr, 6505, 1, 15, 2385, 1},
+    {"1F6F9", nullptr, 6506, 1, 15, 2386, 1},
+    {"1F6FA", nullptr, 6507, 1, 15, 2387, 1},
+    {"1F6FB", nullptr, 6508, 1, 15, 2388, 1},
+    {"1F6FC", nullptr, 6509, 1, 15, 2389, 1},
+    {"1F7E0", nullptr, 6510, 1, 15, 2390, 1},
+    {"1F7E1", nullptr, 6511, 1, 15, 2391, 1},
+    {"1F7E2", nullptr, 6512, 1, 15, 2392, 1},
+    {"1F7E3", nullptr, 6513, 1, 15, 2393, 1},
+    {"1F7E4", nullptr, 6514, 1, 15, 2394, 1},
+    {"1F7E5", nullptr, 6515, 1, 15, 2395, 1},
+    {"1F7E6", nullptr, 6516, 1, 15, 2396, 1},
+    {"1F7E7", nullptr, 6517, 1, 15, 2397, 1},
+    {"1F7E8", nullptr, 6518, 1, 15, 2398, 1},
+    {"1F7E9", nullptr, 6519, 1, 15, 2399, 1},
+    {"1F7EA", nullptr, 6520, 1, 15, 2400, 1},
+    {"1F7EB", nullptr, 6521, 1, 15, 2401, 1},
+    {"1F90C", nullptr, 6522, 1, 15, 2402, 1},
+    {"1F90C-1F3FB", nullptr, 6523, 2, 15, 2403, 1},
+    {"1F90C-1F3FC", nullptr, 6525, 2, 15, 2404, 1},
+    {"1F90C-1F3FD", nullptr, 6527, 2, 15, 2405, 1},
+    {"1F90C-1F3FE", nullptr, 6529, 2, 15, 2406, 1},
+    {"1F90C-1F3FF", nullptr, 6531, 2, 15, 2407, 1},
+    {"1F90D", nullptr, 6533, 1, 15, 2408, 1},
+    {"1F90E", nullptr, 6534, 1, 15, 2409, 1},
+    {"1F90F", nullptr, 6535, 1, 15, 2410, 1},
+    {"1F90F-1F3FB", nullptr, 6536, 2, 15, 2411, 1},
+    {"1F90F-1F3FC", nullptr, 6538, 2, 15, 2412, 1},
+    {"1F90F-1F3FD", nullptr, 6540, 2, 15, 2413, 1},
+    {"1F90F-1F3FE", nullptr, 6542, 2, 15, 2414, 1},
+    {"1F90F-1F3FF", nullptr, 6544, 2, 15, 2415, 1},
+    {"1F910", nullptr, 6546, 1, 15, 2416, 1},
+    {"1F911", nullptr, 6547, 1, 15, 2417, 1},
+    {"1F912", nullptr, 6548, 1, 15, 2418, 1},
+    {"1F913", nullptr, 6549, 1, 15, 2419, 1},
+    {"1F914", nullptr, 6550, 1, 15, 2420, 1},
+    {"1F915", nullptr, 6551, 1, 15, 2421, 1},
+    {"1F916", nullptr, 6552, 1, 15, 2422, 1},
+    {"1F917", nullptr, 6553, 1, 15, 2423, 1},
+    {"1F918", nullptr, 6554, 1, 15, 2424, 2},
+    {"1F918-1F3FB", nullptr, 6555, 2, 15, 2426, 1},
+    {"1F918-1F3FC", nullptr, 6557, 2, 15, 2427, 1},
+    {"1F918-1F3FD", nullptr, 6559, 2, 15, 2428, 1},
+    {"1F918-1F3FE", nullptr, 6561, 2, 15, 2429, 1},
+    {"1F918-1F3FF", nullptr, 6563, 2, 15, 2430, 1},
+    {"1F919", nullptr, 6565, 1, 15, 2431, 1},
+    {"1F919-1F3FB", nullptr, 6566, 2, 15, 2432, 1},
+    {"1F919-1F3FC", nullptr, 6568, 2, 15, 2433, 1},
+    {"1F919-1F3FD", nullptr, 6570, 2, 15, 2434, 1},
+    {"1F919-1F3FE", nullptr, 6572, 2, 15, 2435, 1},
+    {"1F919-1F3FF", nullptr, 6574, 2, 15, 2436, 1},
+    {"1F91A", nullptr, 6576, 1, 15, 2437, 1},
+    {"1F91A-1F3FB", nullptr, 6577, 2, 15, 2438, 1},
+    {"1F91A-1F3FC", nullptr, 6579, 2, 15, 2439, 1},
+    {"1F91A-1F3FD", nullptr, 6581, 2, 15, 2440, 1},
+    {"1F91A-1F3FE", nullptr, 6583, 2, 15, 2441, 1},
+    {"1F91A-1F3FF", nullptr, 6585, 2, 15, 2442, 1},
+    {"1F91B", nullptr, 6587, 1, 15, 2443, 1},
+    {"1F91B-1F3FB", nullptr, 6588, 2, 15, 2444, 1},
+    {"1F91B-1F3FC", nullptr, 6590, 2, 15, 2445, 1},
+    {"1F91B-1F3FD", nullptr, 6592, 2, 15, 2446, 1},
+    {"1F91B-1F3FE", nullptr, 6594, 2, 15, 2447, 1},
+    {"1F91B-1F3FF", nullptr, 6596, 2, 15, 2448, 1},
+    {"1F91C", nullptr, 6598, 1, 15, 2449, 1},
+    {"1F91C-1F3FB", nullptr, 6599, 2, 15, 2450, 1},
+    {"1F91C-1F3FC", nullptr, 6601, 2, 15, 2451, 1},
+    {"1F91C-1F3FD", nullptr, 6603, 2, 15, 2452, 1},
+    {"1F91C-1F3FE", nullptr, 6605, 2, 15, 2453, 1},
+    {"1F91C-1F3FF", nullptr, 6607, 2, 15, 2454, 1},
+    {"1F91D", nullptr, 6609, 1, 15, 2455, 1},
+    {"1F91E", nullptr, 6610, 1, 15, 2456, 2},
+    {"1F91E-1F3FB", nullptr, 6611, 2, 15, 2458, 1},
+    {"1F91E-1F3FC", nullptr, 6613, 2, 15, 2459, 1},
+    {"1F91E-1F3FD", nullptr, 6615, 2, 15, 2460, 1},
+    {"1F91E-1F3FE", nullptr, 6617, 2, 15, 2461, 1},
+    {"1F91E-1F3FF", nullptr, 6619, 2, 15, 2462, 1},
+    {"1F91F", nullptr, 6621, 1, 15, 2463, 1},
+    {"1F91F-1F3FB", nullptr, 6622, 2, 15, 2464, 1},
+    {"1F91F-1F3FC", nullptr, 6624, 2, 15, 2465, 1},
+    {"1F91F-1F3FD", nullptr, 6626, 2, 15, 2466, 1},
+    {"1F91F-1F3FE", nullptr, 6628, 2, 15, 2467, 1},
+    {"1F91F-1F3FF", nullptr, 6630, 2, 15, 2468, 1},
+    {"1F920", nullptr, 6632, 1, 15, 2469, 1},
+    {"1F921", nullptr, 6633, 1, 15, 2470, 1},
+    {"1F922", nullptr, 6634, 1, 15, 2471, 1},
+    {"1F923", nullptr, 6635, 1, 15, 2472, 1},
+    {"1F924", nullptr, 6636, 1, 15, 2473, 1},
+    {"1F925", nullptr, 6637, 1, 15, 2474, 1},
+    {"1F926-200D-2640-FE0F", "1F926-200D-2640", 6638, 3, 15, 2475, 1},
+    {"1F926-1F3FB-200D-2640-FE0F", "1F926-1F3FB-200D-2640", 6641, 4, 15, 2476, 1},
+    {"1F926-1F3FC-200D-2640-FE0F", "1F926-1F3FC-200D-2640", 6645, 4, 15, 2477, 1},
+    {"1F926-1F3FD-200D-2640-FE0F", "1F926-1F3FD-200D-2640", 6649, 4, 15, 2478, 1},
+    {"1F926-1F3FE-200D-2640-FE0F", "1F926-1F3FE-200D-2640", 6653, 4, 15, 2479, 1},
+    {"1F926-1F3FF-200D-2640-FE0F", "1F926-1F3FF-200D-2640", 6657, 4, 15, 2480, 1},
+    {"1F926-200D-2642-FE0F", "1F926-200D-2642", 6661, 3, 15, 2481, 1},
+    {"1F926-1F3FB-200D-2642-FE0F", "1F926-1F3FB-200D-2642", 6664, 4, 15, 2482, 1},
+    {"1F926-1F3FC-200D-2642-FE0F", "1F926-1F3FC-200D-2642", 6668, 4, 15, 2483, 1},
+    {"1F926-1F3FD-200D-2642-FE0F", "1F926-1F3FD-200D-2642", 6672, 4, 15, 2484, 1},
+    {"1F926-1F3FE-200D-2642-FE0F", "1F926-1F3FE-200D-2642", 6676, 4, 15, 2485, 1},
+    {"1F926-1F3FF-200D-2642-FE0F", "1F926-1F3FF-200D-2642", 6680, 4, 15, 2486, 1},
+    {"1F926", nullptr, 6684, 1, 15, 2487, 1},
+    {"1F926-1F3FB", nullptr, 6685, 2, 15, 2488, 1},
+    {"1F926-1F3FC", nullptr, 6687, 2, 15, 2489, 1},
+    {"1F926-1F3FD", nullptr, 6689, 2, 15, 2490, 1},
+    {"1F926-1F3FE", nullptr, 6691, 2, 15, 2491, 1},
+    {"1F926-1F3FF", nullptr, 6693, 2, 15, 2492, 1},
+    {"1F927", nullptr, 6695, 1, 15, 2493, 1},
+    {"1F928", nullptr, 6696, 1, 15, 2494, 2},
+    {"1F929", nullptr, 6697, 1, 15, 2496, 2},
+    {"1F92A", nullptr, 6698, 1, 15, 2498, 2},
+    {"1F92B", nullptr, 6699, 1, 15, 2500, 2},
+    {"1F92C", nullptr, 6700, 1, 15, 2502, 2},
+    {"1F92D", nullptr, 6701, 1, 15, 2504, 2},
+    {"1F92E", nullptr, 6702, 1, 15, 2506, 2},
+    {"1F92F", nullptr, 6703, 1, 15, 2508, 2},
+    {"1F930", nullptr, 6704, 1, 15, 2510, 1},
+    {"1F930-1F3FB", nullptr, 6705, 2, 15, 2511, 1},
+    {"1F930-1F3FC", nullptr, 6707, 2, 15, 2512, 1},
+    {"1F930-1F3FD", nullptr, 6709, 2, 15, 2513, 1},
+    {"1F930-1F3FE", nullptr, 6711, 2, 15, 2514, 1},
+    {"1F930-1F3FF", nullptr, 6713, 2, 15, 2515, 1},
+    {"1F931", nullptr, 6715, 1, 15, 2516, 1},
+    {"1F931-1F3FB", nullptr, 6716, 2, 15, 2517, 1},
+    {"1F931-1F3FC", nullptr, 6718, 2, 15, 2518, 1},
+    {"1F931-1F3FD", nullptr, 6720, 2, 15, 2519, 1},
+    {"1F931-1F3FE", nullptr, 6722, 2, 15, 2520, 1},
+    {"1F931-1F3FF", nullptr, 6724, 2, 15, 2521, 1},
+    {"1F932", nullptr, 6726, 1, 15, 2522, 1},
+    {"1F932-1F3FB", nullptr, 6727, 2, 15, 2523, 1},
+    {"1F932-1F3FC", nullptr, 6729, 2, 15, 2524, 1},
+    {"1F932-1F3FD", nullptr, 6731, 2, 15, 2525, 1},
+    {"1F932-1F3FE", nullptr, 6733, 2, 15, 2526, 1},
+    {"1F932-1F3FF", nullptr, 6735, 2, 15, 2527, 1},
+    {"1F933", nullptr, 6737, 1, 15, 2528, 1},
+    {"1F933-1F3FB", nullptr, 6738, 2, 15, 2529, 1},
+    {"1F933-1F3FC", nullptr, 6740, 2, 15, 2530, 1},
+    {"1F933-1F3FD", nullptr, 6742, 2, 15, 2531, 1},
+    {"1F933-1F3FE", nullptr, 6744, 2, 15, 2532, 1},
+    {"1F933-1F3FF", nullptr, 6746, 2, 15, 2533, 1},
+    {"1F934", nullptr, 6748, 1, 15, 2534, 1},
+    {"1F934-1F3FB", nullptr, 6749, 2, 15, 2535, 1},
+    {"1F934-1F3FC", nullptr, 6751, 2, 15, 2536, 1},
+    {"1F934-1F3FD", nullptr, 6753, 2, 15, 2537, 1},
+    {"1F934-1F3FE", nullptr, 6755, 2, 15, 2538, 1},
+    {"1F934-1F3FF", nullptr, 6757, 2, 15, 2539, 1},
+    {"1F935-200D-2640-FE0F", "1F935-200D-2640", 6759, 3, 15, 2540, 1},
+    {"1F935-1F3FB-200D-2640-FE0F", "1F935-1F3FB-200D-2640", 6762, 4, 15, 2541, 1},
+    {"1F935-1F3FC-200D-2640-FE0F", "1F935-1F3FC-200D-2640", 6766, 4, 15, 2542, 1},
+    {"1F935-1F3FD-200D-2640-FE0F", "1F935-1F3FD-200D-2640", 6770, 4, 15, 2543, 1},
+    {"1F935-1F3FE-200D-2640-FE0F", "1F935-1F3FE-200D-2640", 6774, 4, 15, 2544, 1},
+    {"1F935-1F3FF-200D-2640-FE0F", "1F935-1F3FF-200D-2640", 6778, 4, 15, 2545, 1},
+    {"1F935-200D-2642-FE0F", "1F935-200D-2642", 6782, 3, 15, 2546, 1},
+    {"1F935-1F3FB-200D-2642-FE0F", "1F935-1F3FB-200D-2642", 6785, 4, 15, 2547, 1},
+    {"1F935-1F3FC-200D-2642-FE0F", "1F935-1F3FC-200D-2642", 6789, 4, 15, 2548, 1},
+    {"1F935-1F3FD-200D-2642-FE0F", "1F935-1F3FD-200D-2642", 6793, 4, 15, 2549, 1},
+    {"1F935-1F3FE-200D-2642-FE0F", "1F935-1F3FE-200D-2642", 6797, 4, 15, 2550, 1},
+    {"1F935-1F3FF-200D-2642-FE0F", "1F935-1F3FF-200D-2642", 6801, 4, 15, 2551, 1},
+    {"1F935", nullptr, 6805, 1, 15, 2552, 1},
+    {"1F935-1F3FB", nullptr, 6806, 2, 15, 2553, 1},
+    {"1F935-1F3FC", nullptr, 6808, 2, 15, 2554, 1},
+    {"1F935-1F3FD", nullptr, 6810, 2, 15, 2555, 1},
+    {"1F935-1F3FE", nullptr, 6812, 2, 15, 2556, 1},
+    {"1F935-1F3FF", nullptr, 6814, 2, 15, 2557, 1},
+    {"1F936", nullptr, 6816, 1, 15, 2558, 2},
+    {"1F936-1F3FB", nullptr, 6817, 2, 15, 2560, 1},
+    {"1F936-1F3FC", nullptr, 6819, 2, 15, 2561, 1},
+    {"1F936-1F3FD", nullptr, 6821, 2, 15, 2562, 1},
+    {"1F936-1F3FE", nullptr, 6823, 2, 15, 2563, 1},
+    {"1F936-1F3FF", nullptr, 6825, 2, 15, 2564, 1},
+    {"1F937-200D-2640-FE0F", "1F937-200D-2640", 6827, 3, 15, 2565, 1},
+    {"1F937-1F3FB-200D-2640-FE0F", "1F937-1F3FB-200D-2640", 6830, 4, 15, 2566, 1},
+    {"1F937-1F3FC-200D-2640-FE0F", "1F937-1F3FC-200D-2640", 6834, 4, 15, 2567, 1},
+    {"1F937-1F3FD-200D-2640-FE0F", "1F937-1F3FD-200D-2640", 6838, 4, 15, 2568, 1},
+    {"1F937-1F3FE-200D-2640-FE0F", "1F937-1F3FE-200D-2640", 6842, 4, 15, 2569, 1},
+    {"1F937-1F3FF-200D-2640-FE0F", "1F937-1F3FF-200D-2640", 6846, 4, 15, 2570, 1},
+    {"1F937-200D-2642-FE0F", "1F937-200D-2642", 6850, 3, 15, 2571, 1},
+    {"1F937-1F3FB-200D-2642-FE0F", "1F937-1F3FB-200D-2642", 6853, 4, 15, 2572, 1},
+    {"1F937-1F3FC-200D-2642-FE0F", "1F937-1F3FC-200D-2642", 6857, 4, 15, 2573, 1},
+    {"1F937-1F3FD-200D-2642-FE0F", "1F937-1F3FD-200D-2642", 6861, 4, 15, 2574, 1},
+    {"1F937-1F3FE-200D-2642-FE0F", "1F937-1F3FE-200D-2642", 6865, 4, 15, 2575, 1},
+    {"1F937-1F3FF-200D-2642-FE0F", "1F937-1F3FF-200D-2642", 6869, 4, 15, 2576, 1},
+    {"1F937", nullptr, 6873, 1, 15, 2577, 1},
+    {"1F937-1F3FB", nullptr, 6874, 2, 15, 2578, 1},
+    {"1F937-1F3FC", nullptr, 6876, 2, 15, 2579, 1},
+    {"1F937-1F3FD", nullptr, 6878, 2, 15, 2580, 1},
+    {"1F937-1F3FE", nullptr, 6880, 2, 15, 2581, 1},
+    {"1F937-1F3FF", nullptr, 6882, 2, 15, 2582, 1},
+    {"1F938-200D-2640-FE0F", "1F938-200D-2640", 6884, 3, 15, 2583, 1},
+    {"1F938-1F3FB-200D-2640-FE0F", "1F938-1F3FB-200D-2640", 6887, 4, 15, 2584, 1},
+    {"1F938-1F3FC-200D-2640-FE0F", "1F938-1F3FC-200D-2640", 6891, 4, 15, 2585, 1},
+    {"1F938-1F3FD-200D-2640-FE0F", "1F938-1F3FD-200D-2640", 6895, 4, 15, 2586, 1},
+    {"1F938-1F3FE-200D-2640-FE0F", "1F938-1F3FE-200D-2640", 6899, 4, 15, 2587, 1},
+    {"1F938-1F3FF-200D-2640-FE0F", "1F938-1F3FF-200D-2640", 6903, 4, 15, 2588, 1},
+    {"1F938-200D-2642-FE0F", "1F938-200D-2642", 6907, 3, 15, 2589, 1},
+    {"1F938-1F3FB-200D-2642-FE0F", "1F938-1F3FB-200D-2642", 6910, 4, 15, 2590, 1},
+    {"1F938-1F3FC-200D-2642-FE0F", "1F938-1F3FC-200D-2642", 6914, 4, 15, 2591, 1},
+    {"1F938-1F3FD-200D-2642-FE0F", "1F938-1F3FD-200D-2642", 6918, 4, 15, 2592, 1},
+    {"1F938-1F3FE-200D-2642-FE0F", "1F938-1F3FE-200D-2642", 6922, 4, 15, 2593, 1},
+    {"1F938-1F3FF-200D-2642-FE0F", "1F938-1F3FF-200D-2642", 6926, 4, 15, 2594, 1},
+    {"1F938", nullptr, 6930, 1, 15, 2595, 1},
+    {"1F938-1F3FB", nullptr, 6931, 2, 15, 2596, 1},
+    {"1F938-1F3FC", nullptr, 6933, 2, 15, 2597, 1},
+    {"1F938-1F3FD", nullptr, 6935, 2, 15, 2598, 1},
+    {"1F938-1F3FE", nullptr, 6937, 2, 15, 2599, 1},
+    {"1F938-1F3FF", nullptr, 6939, 2, 15, 2600, 1},
+    {"1F939-200D-2640-FE0F", "1F939-200D-2640", 6941, 3, 15, 2601, 1},
+    {"1F939-1F3FB-200D-2640-FE0F", "1F939-1F3FB-200D-2640", 6944, 4, 15, 2602, 1},
+    {"1F939-1F3FC-200D-2640-FE0F", "1F939-1F3FC-200D-2640", 6948, 4, 15, 2603, 1},
+    {"1F939-1F3FD-200D-2640-FE0F", "1F939-1F3FD-200D-2640", 6952, 4, 15, 2604, 1},
+    {"1F939-1F3FE-200D-2640-FE0F", "1F939-1F3FE-200D-2640", 6956, 4, 15, 2605, 1},
+    {"1F939-1F3FF-200D-2640-FE0F", "1F939-1F3FF-200D-2640", 6960, 4, 15, 2606, 1},
+    {"1F939-200D-2642-FE0F", "1F939-200D-2642", 6964, 3, 15, 2607, 1},
+    {"1F939-1F3FB-200D-2642-FE0F", "1F939-1F3FB-200D-2642", 6967, 4, 15, 2608, 1},
+    {"1F939-1F3FC-200D-2642-FE0F", "1F939-1F3FC-200D-2642", 6971, 4, 15, 2609, 1},
+    {"1F939-1F3FD-200D-2642-FE0F", "1F939-1F3FD-200D-2642", 6975, 4, 15, 2610, 1},
+    {"1F939-1F3FE-200D-2642-FE0F", "1F939-1F3FE-200D-2642", 6979, 4, 15, 2611, 1},
+    {"1F939-1F3FF-200D-2642-FE0F", "1F939-1F3FF-200D-2642", 6983, 4, 15, 2612, 1},
+    {"1F939", nullptr, 6987, 1, 15, 2613, 1},
+    {"1F939-1F3FB", nullptr, 6988, 2, 15, 2614, 1},
+    {"1F939-1F3FC", nullptr, 6990, 2, 15, 2615, 1},
+    {"1F939-1F3FD", nullptr, 6992, 2, 15, 2616, 1},
+    {"1F939-1F3FE", nullptr, 6994, 2, 15, 2617, 1},
+    {"1F939-1F3FF", nullptr, 6996, 2, 15, 2618, 1},
+    {"1F93A", nullptr, 6998, 1, 15, 2619, 1},
+    {"1F93C-200D-2640-FE0F", "1F93C-200D-2640", 6999, 3, 15, 2620, 1},
+    {"1F93C-200D-2642-FE0F", "1F93C-200D-2642", 7002, 3, 15, 2621, 1},
+    {"1F93C", nullptr, 7005, 1, 15, 2622, 1},
+    {"1F93D-200D-2640-FE0F", "1F93D-200D-2640", 7006, 3, 15, 2623, 1},
+    {"1F93D-1F3FB-200D-2640-FE0F", "1F93D-1F3FB-200D-2640", 7009, 4, 15, 2624, 1},
+    {"1F93D-1F3FC-200D-2640-FE0F", "1F93D-1F3FC-200D-2640", 7013, 4, 15, 2625, 1},
+    {"1F93D-1F3FD-200D-2640-FE0F", "1F93D-1F3FD-200D-2640", 7017, 4, 15, 2626, 1},
+    {"1F93D-1F3FE-200D-2640-FE0F", "1F93D-1F3FE-200D-2640", 7021, 4, 15, 2627, 1},
+    {"1F93D-1F3FF-200D-2640-FE0F", "1F93D-1F3FF-200D-2640", 7025, 4, 15, 2628, 1},
+    {"1F93D-200D-2642-FE0F", "1F93D-200D-2642", 7029, 3, 15, 2629, 1},
+    {"1F93D-1F3FB-200D-2642-FE0F", "1F93D-1F3FB-200D-2642", 7032, 4, 15, 2630, 1},
+    {"1F93D-1F3FC-200D-2642-FE0F", "1F93D-1F3FC-200D-2642", 7036, 4, 15, 2631, 1},
+    {"1F93D-1F3FD-200D-2642-FE0F", "1F93D-1F3FD-200D-2642", 7040, 4, 15, 2632, 1},
+    {"1F93D-1F3FE-200D-2642-FE0F", "1F93D-1F3FE-200D-2642", 7044, 4, 15, 2633, 1},
+    {"1F93D-1F3FF-200D-2642-FE0F", "1F93D-1F3FF-200D-2642", 7048, 4, 15, 2634, 1},
+    {"1F93D", nullptr, 7052, 1, 15, 2635, 1},
+    {"1F93D-1F3FB", nullptr, 7053, 2, 15, 2636, 1},
+    {"1F93D-1F3FC", nullptr, 7055, 2, 15, 2637, 1},
+    {"1F93D-1F3FD", nullptr, 7057, 2, 15, 2638, 1},
+    {"1F93D-1F3FE", nullptr, 7059, 2, 15, 2639, 1},
+    {"1F93D-1F3FF", nullptr, 7061, 2, 15, 2640, 1},
+    {"1F93E-200D-2640-FE0F", "1F93E-200D-2640", 7063, 3, 15, 2641, 1},
+    {"1F93E-1F3FB-200D-2640-FE0F", "1F93E-1F3FB-200D-2640", 7066, 4, 15, 2642, 1},
+    {"1F93E-1F3FC-200D-2640-FE0F", "1F93E-1F3FC-200D-2640", 7070, 4, 15, 2643, 1},
+    {"1F93E-1F3FD-200D-2640-FE0F", "1F93E-1F3FD-200D-2640", 7074, 4, 15, 2644, 1},
+    {"1F93E-1F3FE-200D-2640-FE0F", "1F93E-1F3FE-200D-2640", 7078, 4, 15, 2645, 1},
+    {"1F93E-1F3FF-200D-2640-FE0F", "1F93E-1F3FF-200D-2640", 7082, 4, 15, 2646, 1},
+    {"1F93E-200D-2642-FE0F", "1F93E-200D-2642", 7086, 3, 15, 2647, 1},
+    {"1F93E-1F3FB-200D-2642-FE0F", "1F93E-1F3FB-200D-2642", 7089, 4, 15, 2648, 1},
+    {"1F93E-1F3FC-200D-2642-FE0F", "1F93E-1F3FC-200D-2642", 7093, 4, 15, 2649, 1},
+    {"1F93E-1F3FD-200D-2642-FE0F", "1F93E-1F3FD-200D-2642", 7097, 4, 15, 2650, 1},
+    {"1F93E-1F3FE-200D-2642-FE0F", "1F93E-1F3FE-200D-2642", 7101, 4, 15, 2651, 1},
+    {"1F93E-1F3FF-200D-2642-FE0F", "1F93E-1F3FF-200D-2642", 7105, 4, 15, 2652, 1},
+    {"1F93E", nullptr, 7109, 1, 15, 2653, 1},
+    {"1F93E-1F3FB", nullptr, 7110, 2, 15, 2654, 1},
+    {"1F93E-1F3FC", nullptr, 7112, 2, 15, 2655, 1},
+    {"1F93E-1F3FD", nullptr, 7114, 2, 15, 2656, 1},
+    {"1F93E-1F3FE", nullptr, 7116, 2, 15, 2657, 1},
+    {"1F93E-1F3FF", nullptr, 7118, 2, 15, 2658, 1},
+    {"1F93F", nullptr, 7120, 1, 15, 2659, 1},
+    {"1F940", nullptr, 7121, 1, 15, 2660, 1},
+    {"1F941", nullptr, 7122, 1, 15, 2661, 1},
+    {"1F942", nullptr, 7123, 1, 15, 2662, 1},
+    {"1F943", nullptr, 7124, 1, 15, 2663, 1},
+    {"1F944", nullptr, 7125, 1, 15, 2664, 1},
+    {"1F945", nullptr, 7126, 1, 15, 2665, 1},
+    {"1F947", nullptr, 7127, 1, 15, 2666, 1},
+    {"1F948", nullptr, 7128, 1, 15, 2667, 1},
+    {"1F949", nullptr, 7129, 1, 15, 2668, 1},
+    {"1F94A", nullptr, 7130, 1, 15, 2669, 1},
+    {"1F94B", nullptr, 7131, 1, 15, 2670, 1},
+    {"1F94C", nullptr, 7132, 1, 15, 2671, 1},
+    {"1F94D", nullptr, 7133, 1, 15, 2672, 1},
+    {"1F94E", nullptr, 7134, 1, 15, 2673, 1},
+    {"1F94F", nullptr, 7135, 1, 15, 2674, 1},
+    {"1F950", nullptr, 7136, 1, 15, 2675, 1},
+    {"1F951", nullptr, 7137, 1, 15, 2676, 1},
+    {"1F952", nullptr, 7138, 1, 15, 2677, 1},
+    {"1F953", nullptr, 7139, 1, 15, 2678, 1},
+    {"1F954", nullptr, 7140, 1, 15, 2679, 1},
+    {"1F955", nullptr, 7141, 1, 15, 2680, 1},
+    {"1F956", nullptr, 7142, 1, 15, 2681, 1},
+    {"1F957", nullptr, 7143, 1, 15, 2682, 1},
+    {"1F958", nullptr, 7144, 1, 15, 2683, 1},
+    {"1F959", nullptr, 7145, 1, 15, 2684, 1},
+    {"1F95A", nullptr, 7146, 1, 15, 2685, 1},
+    {"1F95B", nullptr, 7147, 1, 15, 2686, 1},
+    {"1F95C", nullptr, 7148, 1, 15, 2687, 1},
+    {"1F95D", nullptr, 7149, 1, 15, 2688, 1},
+    {"1F95E", nullptr, 7150, 1, 15, 2689, 1},
+    {"1F95F", nullptr, 7151, 1, 15, 2690, 1},
+    {"1F960", nullptr, 7152, 1, 15, 2691, 1},
+    {"1F961", nullptr, 7153, 1, 15, 2692, 1},
+    {"1F962", nullptr, 7154, 1, 15, 2693, 1},
+    {"1F963", nullptr, 7155, 1, 15, 2694, 1},
+    {"1F964", nullptr, 7156, 1, 15, 2695, 1},
+    {"1F965", nullptr, 7157, 1, 15, 2696, 1},
+    {"1F966", nullptr, 7158, 1, 15, 2697, 1},
+    {"1F967", nullptr, 7159, 1, 15, 2698, 1},
+    {"1F968", nullptr, 7160, 1, 15, 2699, 1},
+    {"1F969", nullptr, 7161, 1, 15, 2700, 1},
+    {"1F96A", nullptr, 7162, 1, 15, 2701, 1},
+    {"1F96B", nullptr, 7163, 1, 15, 2702, 1},
+    {"1F96C", nullptr, 7164, 1, 15, 2703, 1},
+    {"1F96D", nullptr, 7165, 1, 15, 2704, 1},
+    {"1F96E", nullptr, 7166, 1, 15, 2705, 1},
+    {"1F96F", nullptr, 7167, 1, 15, 2706, 1},
+    {"1F970", nullptr, 7168, 1, 15, 2707, 1},
+    {"1F971", nullptr, 7169, 1, 15, 2708, 1},
+    {"1F972", nullptr, 7170, 1, 15, 2709, 1},
+    {"1F973", nullptr, 7171, 1, 15, 2710, 1},
+    {"1F974", nullptr, 7172, 1, 15, 2711, 1},
+    {"1F975", nullptr, 7173, 1, 15, 2712, 1},
+    {"1F976", nullptr, 7174, 1, 15, 2713, 1},
+    {"1F977", nullptr, 7175, 1, 15, 2714, 1},
+    {"1F977-1F3FB", nullptr, 7176, 2, 15, 2715, 1},
+    {"1F977-1F3FC", nullptr, 7178, 2, 15, 2716, 1},
+    {"1F977-1F3FD", nullptr, 7180, 2, 15, 2717, 1},
+    {"1F977-1F3FE", nullptr, 7182, 2, 15, 2718, 1},
+    {"1F977-1F3FF", nullptr, 7184, 2, 15, 2719, 1},
+    {"1F978", nullptr, 7186, 1, 15, 2720, 1},
+    {"1F97A", nullptr, 7187, 1, 15, 2721, 1},
+    {"1F97B", nullptr, 7188, 1, 15, 2722, 1},
+    {"1F97C", nullptr, 7189, 1, 15, 2723, 1},
+    {"1F97D", nullptr, 7190, 1, 15, 2724, 1},
+    {"1F97E", nullptr, 7191, 1, 15, 2725, 1},
+    {"1F97F", nullptr, 7192, 1, 15, 2726, 1},
+    {"1F980", nullptr, 7193, 1, 15, 2727, 1},
+    {"1F981", nullptr, 7194, 1, 15, 2728, 1},
+    {"1F982", nullptr, 7195, 1, 15, 2729, 1},
+    {"1F983", nullptr, 7196, 1, 15, 2730, 1},
+    {"1F984", nullptr, 7197, 1, 15, 2731, 1},
+    {"1F985", nullptr, 7198, 1, 15, 2732, 1},
+    {"1F986", nullptr, 7199, 1, 15, 2733, 1},
+    {"1F987", nullptr, 7200, 1, 15, 2734, 1},
+    {"1F988", nullptr, 7201, 1, 15, 2735, 1},
+    {"1F989", nullptr, 7202, 1, 15, 2736, 1},
+    {"1F98A", nullptr, 7203, 1, 15, 2737, 1},
+    {"1F98B", nullptr, 7204, 1, 15, 2738, 1},
+    {"1F98C", nullptr, 7205, 1, 15, 2739, 1},
+    {"1F98D", nullptr, 7206, 1, 15, 2740, 1},
+    {"1F98E", nullptr, 7207, 1, 15, 2741, 1},
+    {"1F98F", nullptr, 7208, 1, 15, 2742, 1},
+    {"1F990", nullptr, 7209, 1, 15, 2743, 1},
+    {"1F991", nullptr, 7210, 1, 15, 2744, 1},
+    {"1F992", nullptr, 7211, 1, 15, 2745, 1},
+    {"1F993", nullptr, 7212, 1, 15, 2746, 1},
+    {"1F994", nullptr, 7213, 1, 15, 2747, 1},
+    {"1F995", nullptr, 7214, 1, 15, 2748, 1},
+    {"1F996", nullptr, 7215, 1, 15, 2749, 1},
+    {"1F997", nullptr, 7216, 1, 15, 2750, 1},
+    {"1F998", nullptr, 7217, 1, 15, 2751, 1},
+    {"1F999", nullptr, 7218, 1, 15, 2752, 1},
+    {"1F99A", nullptr, 7219, 1, 15, 2753, 1},
+    {"1F99B", nullptr, 7220, 1, 15, 2754, 1},
+    {"1F99C", nullptr, 7221, 1, 15, 2755, 1},
+    {"1F99D", nullptr, 7222, 1, 15, 2756, 1},
+    {"1F99E", nullptr, 7223, 1, 15, 2757, 1},
+    {"1F99F", nullptr, 7224, 1, 15, 2758, 1},
+    {"1F9A0", nullptr, 7225, 1, 15, 2759, 1},
+    {"1F9A1", nullptr, 7226, 1, 15, 2760, 1},
+    {"1F9A2", nullptr, 7227, 1, 15, 2761, 1},
+    {"1F9A3", nullptr, 7228, 1, 15, 2762, 1},
+    {"1F9A4", nullptr, 7229, 1, 15, 2763, 1},
+    {"1F9A5", nullptr, 7230, 1, 15, 2764, 1},
+    {"1F9A6", nullptr, 7231, 1, 15, 2765, 1},
+    {"1F9A7", nullptr, 7232, 1, 15, 2766, 1},
+    {"1F9A8", nullptr, 7233, 1, 15, 2767, 1},
+    {"1F9A9", nullptr, 7234, 1, 15, 2768, 1},
+    {"1F9AA", nullptr, 7235, 1, 15, 2769, 1},
+    {"1F9AB", nullptr, 7236, 1, 15, 2770, 1},
+    {"1F9AC", nullptr, 7237, 1, 15, 2771, 1},
+    {"1F9AD", nullptr, 7238, 1, 15, 2772, 1},
+    {"1F9AE", nullptr, 7239, 1, 15, 2773, 1},
+    {"1F9AF", nullptr, 7240, 1, 15, 2774, 1},
+    {"1F9B4", nullptr, 7241, 1, 15, 2775, 1},
+    {"1F9B5", nullptr, 7242, 1, 15, 2776, 1},
+    {"1F9B5-1F3FB", nullptr, 7243, 2, 15, 2777, 1},
+    {"1F9B5-1F3FC", nullptr, 7245, 2, 15, 2778, 1},
+    {"1F9B5-1F3FD", nullptr, 7247, 2, 15, 2779, 1},
+    {"1F9B5-1F3FE", nullptr, 7249, 2, 15, 2780, 1},
+    {"1F9B5-1F3FF", nullptr, 7251, 2, 15, 2781, 1},
+    {"1F9B6", nullptr, 7253, 1, 15, 2782, 1},
+    {"1F9B6-1F3FB", nullptr, 7254, 2, 15, 2783, 1},
+    {"1F9B6-1F3FC", nullptr, 7256, 2, 15, 2784, 1},
+    {"1F9B6-1F3FD", nullptr, 7258, 2, 15, 2785, 1},
+    {"1F9B6-1F3FE", nullptr, 7260, 2, 15, 2786, 1},
+    {"1F9B6-1F3FF", nullptr, 7262, 2, 15, 2787, 1},
+    {"1F9B7", nullptr, 7264, 1, 15, 2788, 1},
+    {"1F9B8-200D-2640-FE0F", "1F9B8-200D-2640", 7265, 3, 15, 2789, 1},
+    {"1F9B8-1F3FB-200D-2640-FE0F", "1F9B8-1F3FB-200D-2640", 7268, 4, 15, 2790, 1},
+    {"1F9B8-1F3FC-200D-2640-FE0F", "1F9B8-1F3FC-200D-2640", 7272, 4, 15, 2791, 1},
+    {"1F9B8-1F3FD-200D-2640-FE0F", "1F9B8-1F3FD-200D-2640", 7276, 4, 15, 2792, 1},
+    {"1F9B8-1F3FE-200D-2640-FE0F", "1F9B8-1F3FE-200D-2640", 7280, 4, 15, 2793, 1},
+    {"1F9B8-1F3FF-200D-2640-FE0F", "1F9B8-1F3FF-200D-2640", 7284, 4, 15, 2794, 1},
+    {"1F9B8-200D-2642-FE0F", "1F9B8-200D-2642", 7288, 3, 15, 2795, 1},
+    {"1F9B8-1F3FB-200D-2642-FE0F", "1F9B8-1F3FB-200D-2642", 7291, 4, 15, 2796, 1},
+    {"1F9B8-1F3FC-200D-2642-FE0F", "1F9B8-1F3FC-200D-2642", 7295, 4, 15, 2797, 1},
+    {"1F9B8-1F3FD-200D-2642-FE0F", "1F9B8-1F3FD-200D-2642", 7299, 4, 15, 2798, 1},
+    {"1F9B8-1F3FE-200D-2642-FE0F", "1F9B8-1F3FE-200D-2642", 7303, 4, 15, 2799, 1},
+    {"1F9B8-1F3FF-200D-2642-FE0F", "1F9B8-1F3FF-200D-2642", 7307, 4, 15, 2800, 1},
+    {"1F9B8", nullptr, 7311, 1, 15, 2801, 1},
+    {"1F9B8-1F3FB", nullptr, 7312, 2, 15, 2802, 1},
+    {"1F9B8-1F3FC", nullptr, 7314, 2, 15, 2803, 1},
+    {"1F9B8-1F3FD", nullptr, 7316, 2, 15, 2804, 1},
+    {"1F9B8-1F3FE", nullptr, 7318, 2, 15, 2805, 1},
+    {"1F9B8-1F3FF", nullptr, 7320, 2, 15, 2806, 1},
+    {"1F9B9-200D-2640-FE0F", "1F9B9-200D-2640", 7322, 3, 15, 2807, 1},
+    {"1F9B9-1F3FB-200D-2640-FE0F", "1F9B9-1F3FB-200D-2640", 7325, 4, 15, 2808, 1},
+    {"1F9B9-1F3FC-200D-2640-FE0F", "1F9B9-1F3FC-200D-2640", 7329, 4, 15, 2809, 1},
+    {"1F9B9-1F3FD-200D-2640-FE0F", "1F9B9-1F3FD-200D-2640", 7333, 4, 15, 2810, 1},
+    {"1F9B9-1F3FE-200D-2640-FE0F", "1F9B9-1F3FE-200D-2640", 7337, 4, 15, 2811, 1},
+    {"1F9B9-1F3FF-200D-2640-FE0F", "1F9B9-1F3FF-200D-2640", 7341, 4, 15, 2812, 1},
+    {"1F9B9-200D-2642-FE0F", "1F9B9-200D-2642", 7345, 3, 15, 2813, 1},
+    {"1F9B9-1F3FB-200D-2642-FE0F", "1F9B9-1F3FB-200D-2642", 7348, 4, 15, 2814, 1},
+    {"1F9B9-1F3FC-200D-2642-FE0F", "1F9B9-1F3FC-200D-2642", 7352, 4, 15, 2815, 1},
+    {"1F9B9-1F3FD-200D-2642-FE0F", "1F9B9-1F3FD-200D-2642", 7356, 4, 15, 2816, 1},
+    {"1F9B9-1F3FE-200D-2642-FE0F", "1F9B9-1F3FE-200D-2642", 7360, 4, 15, 2817, 1},
+    {"1F9B9-1F3FF-200D-2642-FE0F", "1F9B9-1F3FF-200D-2642", 7364, 4, 15, 2818, 1},
+    {"1F9B9", nullptr, 7368, 1, 15, 2819, 1},
+    {"1F9B9-1F3FB", nullptr, 7369, 2, 15, 2820, 1},
+    {"1F9B9-1F3FC", nullptr, 7371, 2, 15, 2821, 1},
+    {"1F9B9-1F3FD", nullptr, 7373, 2, 15, 2822, 1},
+    {"1F9B9-1F3FE", nullptr, 7375, 2, 15, 2823, 1},
+    {"1F9B9-1F3FF", nullptr, 7377, 2, 15, 2824, 1},
+    {"1F9BA", nullptr, 7379, 1, 15, 2825, 1},
+    {"1F9BB", nullptr, 7380, 1, 15, 2826, 1},
+    {"1F9BB-1F3FB", nullptr, 7381, 2, 15, 2827, 1},
+    {"1F9BB-1F3FC", nullptr, 7383, 2, 15, 2828, 1},
+    {"1F9BB-1F3FD", nullptr, 7385, 2, 15, 2829, 1},
+    {"1F9BB-1F3FE", nullptr, 7387, 2, 15, 2830, 1},
+    {"1F9BB-1F3FF", nullptr, 7389, 2, 15, 2831, 1},
+    {"1F9BC", nullptr, 7391, 1, 15, 2832, 1},
+    {"1F9BD", nullptr, 7392, 1, 15, 2833, 1},
+    {"1F9BE", nullptr, 7393, 1, 15, 2834, 1},
+    {"1F9BF", nullptr, 7394, 1, 15, 2835, 1},
+    {"1F9C0", nullptr, 7395, 1, 15, 2836, 1},
+    {"1F9C1", nullptr, 7396, 1, 15, 2837, 1},
+    {"1F9C2", nullptr, 7397, 1, 15, 2838, 1},
+    {"1F9C3", nullptr, 7398, 1, 15, 2839, 1},
+    {"1F9C4", nullptr, 7399, 1, 15, 2840, 1},
+    {"1F9C5", nullptr, 7400, 1, 15, 2841, 1},
+    {"1F9C6", nullptr, 7401, 1, 15, 2842, 1},
+    {"1F9C7", nullptr, 7402, 1, 15, 2843, 1},
+    {"1F9C8", nullptr, 7403, 1, 15, 2844, 1},
+    {"1F9C9", nullptr, 7404, 1, 15, 2845, 1},
+    {"1F9CA", nullptr, 7405, 1, 15, 2846, 1},
+    {"1F9CB", nullptr, 7406, 1, 15, 2847, 1},
+    {"1F9CD-200D-2640-FE0F", "1F9CD-200D-2640", 7407, 3, 15, 2848, 1},
+    {"1F9CD-1F3FB-200D-2640-FE0F", "1F9CD-1F3FB-200D-2640", 7410, 4, 15, 2849, 1},
+    {"1F9CD-1F3FC-200D-2640-FE0F", "1F9CD-1F3FC-200D-2640", 7414, 4, 15, 2850, 1},
+    {"1F9CD-1F3FD-200D-2640-FE0F", "1F9CD-1F3FD-200D-2640", 7418, 4, 15, 2851, 1},
+    {"1F9CD-1F3FE-200D-2640-FE0F", "1F9CD-1F3FE-200D-2640", 7422, 4, 15, 2852, 1},
+    {"1F9CD-1F3FF-200D-2640-FE0F", "1F9CD-1F3FF-200D-2640", 7426, 4, 15, 2853, 1},
+    {"1F9CD-200D-2642-FE0F", "1F9CD-200D-2642", 7430, 3, 15, 2854, 1},
+    {"1F9CD-1F3FB-200D-2642-FE0F", "1F9CD-1F3FB-200D-2642", 7433, 4, 15, 2855, 1},
+    {"1F9CD-1F3FC-200D-2642-FE0F", "1F9CD-1F3FC-200D-2642", 7437, 4, 15, 2856, 1},
+    {"1F9CD-1F3FD-200D-2642-FE0F", "1F9CD-1F3FD-200D-2642", 7441, 4, 15, 2857, 1},
+    {"1F9CD-1F3FE-200D-2642-FE0F", "1F9CD-1F3FE-200D-2642", 7445, 4, 15, 2858, 1},
+    {"1F9CD-1F3FF-200D-2642-FE0F", "1F9CD-1F3FF-200D-2642", 7449, 4, 15, 2859, 1},
+    {"1F9CD", nullptr, 7453, 1, 15, 2860, 1},
+    {"1F9CD-1F3FB", nullptr, 7454, 2, 15, 2861, 1},
+    {"1F9CD-1F3FC", nullptr, 7456, 2, 15, 2862, 1},
+    {"1F9CD-1F3FD", nullptr, 7458, 2, 15, 2863, 1},
+    {"1F9CD-1F3FE", nullptr, 7460, 2, 15, 2864, 1},
+    {"1F9CD-1F3FF", nullptr, 7462, 2, 15, 2865, 1},
+    {"1F9CE-200D-2640-FE0F", "1F9CE-200D-2640", 7464, 3, 15, 2866, 1},
+    {"1F9CE-1F3FB-200D-2640-FE0F", "1F9CE-1F3FB-200D-2640", 7467, 4, 15, 2867, 1},
+    {"1F9CE-1F3FC-200D-2640-FE0F", "1F9CE-1F3FC-200D-2640", 7471, 4, 15, 2868, 1},
+    {"1F9CE-1F3FD-200D-2640-FE0F", "1F9CE-1F3FD-200D-2640", 7475, 4, 15, 2869, 1},
+    {"1F9CE-1F3FE-200D-2640-FE0F", "1F9CE-1F3FE-200D-2640", 7479, 4, 15, 2870, 1},
+    {"1F9CE-1F3FF-200D-2640-FE0F", "1F9CE-1F3FF-200D-2640", 7483, 4, 15, 2871, 1},
+    {"1F9CE-200D-2642-FE0F", "1F9CE-200D-2642", 7487, 3, 15, 2872, 1},
+    {"1F9CE-1F3FB-200D-2642-FE0F", "1F9CE-1F3FB-200D-2642", 7490, 4, 15, 2873, 1},
+    {"1F9CE-1F3FC-200D-2642-FE0F", "1F9CE-1F3FC-200D-2642", 7494, 4, 15, 2874, 1},
+    {"1F9CE-1F3FD-200D-2642-FE0F", "1F9CE-1F3FD-200D-2642", 7498, 4, 15, 2875, 1},
+    {"1F9CE-1F3FE-200D-2642-FE0F", "1F9CE-1F3FE-200D-2642", 7502, 4, 15, 2876, 1},
+    {"1F9CE-1F3FF-200D-2642-FE0F", "1F9CE-1F3FF-200D-2642", 7506, 4, 15, 2877, 1},
+    {"1F9CE", nullptr, 7510, 1, 15, 2878, 1},
+    {"1F9CE-1F3FB", nullptr, 7511, 2, 15, 2879, 1},
+    {"1F9CE-1F3FC", nullptr, 7513, 2, 15, 2880, 1},
+    {"1F9CE-1F3FD", nullptr, 7515, 2, 15, 2881, 1},
+    {"1F9CE-1F3FE", nullptr, 7517, 2, 15, 2882, 1},
+    {"1F9CE-1F3FF", nullptr, 7519, 2, 15, 2883, 1},
+    {"1F9CF-200D-2640-FE0F", "1F9CF-200D-2640", 7521, 3, 15, 2884, 1},
+    {"1F9CF-1F3FB-200D-2640-FE0F", "1F9CF-1F3FB-200D-2640", 7524, 4, 15, 2885, 1},
+    {"1F9CF-1F3FC-200D-2640-FE0F", "1F9CF-1F3FC-200D-2640", 7528, 4, 15, 2886, 1},
+    {"1F9CF-1F3FD-200D-2640-FE0F", "1F9CF-1F3FD-200D-2640", 7532, 4, 15, 2887, 1},
+    {"1F9CF-1F3FE-200D-2640-FE0F", "1F9CF-1F3FE-200D-2640", 7536, 4, 15, 2888, 1},
+    {"1F9CF-1F3FF-200D-2640-FE0F", "1F9CF-1F3FF-200D-2640", 7540, 4, 15, 2889, 1},
+    {"1F9CF-200D-2642-FE0F", "1F9CF-200D-2642", 7544, 3, 15, 2890, 1},
+    {"1F9CF-1F3FB-200D-2642-FE0F", "1F9CF-1F3FB-200D-2642", 7547, 4, 15, 2891, 1},
+    {"1F9CF-1F3FC-200D-2642-FE0F", "1F9CF-1F3FC-200D-2642", 7551, 4, 15, 2892, 1},
+    {"1F9CF-1F3FD-200D-2642-FE0F", "1F9CF-1F3FD-200D-2642", 7555, 4, 15, 2893, 1},
+    {"1F9CF-1F3FE-200D-2642-FE0F", "1F9CF-1F3FE-200D-2642", 7559, 4, 15, 2894, 1},
+    {"1F9CF-1F3FF-200D-2642-FE0F", "1F9CF-1F3FF-200D-2642", 7563, 4, 15, 2895, 1},
+    {"1F9CF", nullptr, 7567, 1, 15, 2896, 1},
+    {"1F9CF-1F3FB", nullptr, 7568, 2, 15, 2897, 1},
+    {"1F9CF-1F3FC", nullptr, 7570, 2, 15, 2898, 1},
+    {"1F9CF-1F3FD", nullptr, 7572, 2, 15, 2899, 1},
+    {"1F9CF-1F3FE", nullptr, 7574, 2, 15, 2900, 1},
+    {"1F9CF-1F3FF", nullptr, 7576, 2, 15, 2901, 1},
+    {"1F9D0", nullptr, 7578, 1, 15, 2902, 1},
+    {"1F9D1-200D-1F33E", nullptr, 7579, 3, 15, 2903, 1},
+    {"1F9D1-1F3FB-200D-1F33E", nullptr, 7582, 4, 15, 2904, 1},
+    {"1F9D1-1F3FC-200D-1F33E", nullptr, 7586, 4, 15, 2905, 1},
+    {"1F9D1-1F3FD-200D-1F33E", nullptr, 7590, 4, 15, 2906, 1},
+    {"1F9D1-1F3FE-200D-1F33E", nullptr, 7594, 4, 15, 2907, 1},
+    {"1F9D1-1F3FF-200D-1F33E", nullptr, 7598, 4, 15, 2908, 1},
+    {"1F9D1-200D-1F373", nullptr, 7602, 3, 15, 2909, 1},
+    {"1F9D1-1F3FB-200D-1F373", nullptr, 7605, 4, 15, 2910, 1},
+    {"1F9D1-1F3FC-200D-1F373", nullptr, 7609, 4, 15, 2911, 1},
+    {"1F9D1-1F3FD-200D-1F373", nullptr, 7613, 4, 15, 2912, 1},
+    {"1F9D1-1F3FE-200D-1F373", nullptr, 7617, 4, 15, 2913, 1},
+    {"1F9D1-1F3FF-200D-1F373", nullptr, 7621, 4, 15, 2914, 1},
+    {"1F9D1-200D-1F37C", nullptr, 7625, 3, 15, 2915, 1},
+    {"1F9D1-1F3FB-200D-1F37C", nullptr, 7628, 4, 15, 2916, 1},
+    {"1F9D1-1F3FC-200D-1F37C", nullptr, 7632, 4, 15, 2917, 1},
+    {"1F9D1-1F3FD-200D-1F37C", nullptr, 7636, 4, 15, 2918, 1},
+    {"1F9D1-1F3FE-200D-1F37C", nullptr, 7640, 4, 15, 2919, 1},
+    {"1F9D1-1F3FF-200D-1F37C", nullptr, 7644, 4, 15, 2920, 1},
+    {"1F9D1-200D-1F384", nullptr, 7648, 3, 15, 2921, 1},
+    {"1F9D1-1F3FB-200D-1F384", nullptr, 7651, 4, 15, 2922, 1},
+    {"1F9D1-1F3FC-200D-1F384", nullptr, 7655, 4, 15, 2923, 1},
+    {"1F9D1-1F3FD-200D-1F384", nullptr, 7659, 4, 15, 2924, 1},
+    {"1F9D1-1F3FE-200D-1F384", nullptr, 7663, 4, 15, 2925, 1},
+    {"1F9D1-1F3FF-200D-1F384", nullptr, 7667, 4, 15, 2926, 1},
+    {"1F9D1-200D-1F393", nullptr, 7671, 3, 15, 2927, 1},
+    {"1F9D1-1F3FB-200D-1F393", nullptr, 7674, 4, 15, 2928, 1},
+    {"1F9D1-1F3FC-200D-1F393", nullptr, 7678, 4, 15, 2929, 1},
+    {"1F9D1-1F3FD-200D-1F393", nullptr, 7682, 4, 15, 2930, 1},
+    {"1F9D1-1F3FE-200D-1F393", nullptr, 7686, 4, 15, 2931, 1},
+    {"1F9D1-1F3FF-200D-1F393", nullptr, 7690, 4, 15, 2932, 1},
+    {"1F9D1-200D-1F3A4", nullptr, 7694, 3, 15, 2933, 1},
+    {"1F9D1-1F3FB-200D-1F3A4", nullptr, 7697, 4, 15, 2934, 1},
+    {"1F9D1-1F3FC-200D-1F3A4", nullptr, 7701, 4, 15, 2935, 1},
+    {"1F9D1-1F3FD-200D-1F3A4", nullptr, 7705, 4, 15, 2936, 1},
+    {"1F9D1-1F3FE-200D-1F3A4", nullptr, 7709, 4, 15, 2937, 1},
+    {"1F9D1-1F3FF-200D-1F3A4", nullptr, 7713, 4, 15, 2938, 1},
+    {"1F9D1-200D-1F3A8", nullptr, 7717, 3, 15, 2939, 1},
+    {"1F9D1-1F3FB-200D-1F3A8", nullptr, 7720, 4, 15, 2940, 1},
+    {"1F9D1-1F3FC-200D-1F3A8", nullptr, 7724, 4, 15, 2941, 1},
+    {"1F9D1-1F3FD-200D-1F3A8", nullptr, 7728, 4, 15, 2942, 1},
+    {"1F9D1-1F3FE-200D-1F3A8", nullptr, 7732, 4, 15, 2943, 1},
+    {"1F9D1-1F3FF-200D-1F3A8", nullptr, 7736, 4, 15, 2944, 1},
+    {"1F9D1-200D-1F3EB", nullptr, 7740, 3, 15, 2945, 1},
+    {"1F9D1-1F3FB-200D-1F3EB", nullptr, 7743, 4, 15, 2946, 1},
+    {"1F9D1-1F3FC-200D-1F3EB", nullptr, 7747, 4, 15, 2947, 1},
+    {"1F9D1-1F3FD-200D-1F3EB", nullptr, 7751, 4, 15, 2948, 1},
+    {"1F9D1-1F3FE-200D-1F3EB", nullptr, 7755, 4, 15, 2949, 1},
+    {"1F9D1-1F3FF-200D-1F3EB", nullptr, 7759, 4, 15, 2950, 1},
+    {"1F9D1-200D-1F3ED", nullptr, 7763, 3, 15, 2951, 1},
+    {"1F9D1-1F3FB-200D-1F3ED", nullptr, 7766, 4, 15, 2952, 1},
+    {"1F9D1-1F3FC-200D-1F3ED", nullptr, 7770, 4, 15, 2953, 1},
+    {"1F9D1-1F3FD-200D-1F3ED", nullptr, 7774, 4, 15, 2954, 1},
+    {"1F9D1-1F3FE-200D-1F3ED", nullptr, 7778, 4, 15, 2955, 1},
+    {"1F9D1-1F3FF-200D-1F3ED", nullptr, 7782, 4, 15, 2956, 1},
+    {"1F9D1-200D-1F4BB", nullptr, 7786, 3, 15, 2957, 1},
+    {"1F9D1-1F3FB-200D-1F4BB", nullptr, 7789, 4, 15, 2958, 1},
+    {"1F9D1-1F3FC-200D-1F4BB", nullptr, 7793, 4, 15, 2959, 1},
+    {"1F9D1-1F3FD-200D-1F4BB", nullptr, 7797, 4, 15, 2960, 1},
+    {"1F9D1-1F3FE-200D-1F4BB", nullptr, 7801, 4, 15, 2961, 1},
+    {"1F9D1-1F3FF-200D-1F4BB", nullptr, 7805, 4, 15, 2962, 1},
+    {"1F9D1-200D-1F4BC", nullptr, 7809, 3, 15, 2963, 1},
+    {"1F9D1-1F3FB-200D-1F4BC", nullptr, 7812, 4, 15, 2964, 1},
+    {"1F9D1-1F3FC-200D-1F4BC", nullptr, 7816, 4, 15, 2965, 1},
+    {"1F9D1-1F3FD-200D-1F4BC", nullptr, 7820, 4, 15, 2966, 1},
+    {"1F9D1-1F3FE-200D-1F4BC", nullptr, 7824, 4, 15, 2967, 1},
+    {"1F9D1-1F3FF-200D-1F4BC", nullptr, 7828, 4, 15, 2968, 1},
+    {"1F9D1-200D-1F527", nullptr, 7832, 3, 15, 2969, 1},
+    {"1F9D1-1F3FB-200D-1F527", nullptr, 7835, 4, 15, 2970, 1},
+    {"1F9D1-1F3FC-200D-1F527", nullptr, 7839, 4, 15, 2971, 1},
+    {"1F9D1-1F3FD-200D-1F527", nullptr, 7843, 4, 15, 2972, 1},
+    {"1F9D1-1F3FE-200D-1F527", nullptr, 7847, 4, 15, 2973, 1},
+    {"1F9D1-1F3FF-200D-1F527", nullptr, 7851, 4, 15, 2974, 1},
+    {"1F9D1-200D-1F52C", nullptr, 7855, 3, 15, 2975, 1},
+    {"1F9D1-1F3FB-200D-1F52C", nullptr, 7858, 4, 15, 2976, 1},
+    {"1F9D1-1F3FC-200D-1F52C", nullptr, 7862, 4, 15, 2977, 1},
+    {"1F9D1-1F3FD-200D-1F52C", nullptr, 7866, 4, 15, 2978, 1},
+    {"1F9D1-1F3FE-200D-1F52C", nullptr, 7870, 4, 15, 2979, 1},
+    {"1F9D1-1F3FF-200D-1F52C", nullptr, 7874, 4, 15, 2980, 1},
+    {"1F9D1-200D-1F680", nullptr, 7878, 3, 15, 2981, 1},
+    {"1F9D1-1F3FB-200D-1F680", nullptr, 7881, 4, 15, 2982, 1},
+    {"1F9D1-1F3FC-200D-1F680", nullptr, 7885, 4, 15, 2983, 1},
+    {"1F9D1-1F3FD-200D-1F680", nullptr, 7889, 4, 15, 2984, 1},
+    {"1F9D1-1F3FE-200D-1F680", nullptr, 7893, 4, 15, 2985, 1},
+    {"1F9D1-1F3FF-200D-1F680", nullptr, 7897, 4, 15, 2986, 1},
+    {"1F9D1-200D-1F692", nullptr, 7901, 3, 15, 2987, 1},
+    {"1F9D1-1F3FB-200D-1F692", nullptr, 7904, 4, 15, 2988, 1},
+    {"1F9D1-1F3FC-200D-1F692", nullptr, 7908, 4, 15, 2989, 1},
+    {"1F9D1-1F3FD-200D-1F692", nullptr, 7912, 4, 15, 2990, 1},
+    {"1F9D1-1F3FE-200D-1F692", nullptr, 7916, 4, 15, 2991, 1},
+    {"1F9D1-1F3FF-200D-1F692", nullptr, 7920, 4, 15, 2992, 1},
+    {"1F9D1-200D-1F91D-200D-1F9D1", nullptr, 7924, 5, 15, 2993, 1},
+    {"1F9D1-1F3FB-200D-1F91D-200D-1F9D1-1F3FB", nullptr, 7929, 7, 15, 2994, 1},
+    {"1F9D1-1F3FB-200D-1F91D-200D-1F9D1-1F3FC", nullptr, 7936, 7, 7, 2995, 1},
+    {"1F9D1-1F3FB-200D-1F91D-200D-1F9D1-1F3FD", nullptr, 7943, 7, 7, 2996, 1},
+    {"1F9D1-1F3FB-200D-1F91D-200D-1F9D1-1F3FE", nullptr, 7950, 7, 7, 2997, 1},
+    {"1F9D1-1F3FB-200D-1F91D-200D-1F9D1-1F3FF", nullptr, 7957, 7, 7, 2998, 1},
+    {"1F9D1-1F3FC-200D-1F91D-200D-1F9D1-1F3FB", nullptr, 7964, 7, 15, 2999, 1},
+    {"1F9D1-1F3FC-200D-1F91D-200D-1F9D1-1F3FC", nullptr, 7971, 7, 15, 3000, 1},
+    {"1F9D1-1F3FC-200D-1F91D-200D-1F9D1-1F3FD", nullptr, 7978, 7, 7, 3001, 1},
+    {"1F9D1-1F3FC-200D-1F91D-200D-1F9D1-1F3FE", nullptr, 7985, 7, 7, 3002, 1},
+    {"1F9D1-1F3FC-200D-1F91D-200D-1F9D1-1F3FF", nullptr, 7992, 7, 7, 3003, 1},
+    {"1F9D1-1F3FD-200D-1F91D-200D-1F9D1-1F3FB", nullptr, 7999, 7, 15, 3004, 1},
+    {"1F9D1-1F3FD-200D-1F91D-200D-1F9D1-1F3FC", nullptr, 8006, 7, 15, 3005, 1},
+    {"1F9D1-1F3FD-200D-1F91D-200D-1F9D1-1F3FD", nullptr, 8013, 7, 15, 3006, 1},
+    {"1F9D1-1F3FD-200D-1F91D-200D-1F9D1-1F3FE", nullptr, 8020, 7, 7, 3007, 1},
+    {"1F9D1-1F3FD-200D-1F91D-200D-1F9D1-1F3FF", nullptr, 8027, 7, 7, 3008, 1},
+    {"1F9D1-1F3FE-200D-1F91D-200D-1F9D1-1F3FB", nullptr, 8034, 7, 15, 3009, 1},
+    {"1F9D1-1F3FE-200D-1F91D-200D-1F9D1-1F3FC", nullptr, 8041, 7, 15, 3010, 1},
+    {"1F9D1-1F3FE-200D-1F91D-200D-1F9D1-1F3FD", nullptr, 8048, 7, 15, 3011, 1},
+    {"1F9D1-1F3FE-200D-1F91D-200D-1F9D1-1F3FE", nullptr, 8055, 7, 15, 3012, 1},
+    {"1F9D1-1F3FE-200D-1F91D-200D-1F9D1-1F3FF", nullptr, 8062, 7, 7, 3013, 1},
+    {"1F9D1-1F3FF-200D-1F91D-200D-1F9D1-1F3FB", nullptr, 8069, 7, 15, 3014, 1},
+    {"1F9D1-1F3FF-200D-1F91D-200D-1F9D1-1F3FC", nullptr, 8076, 7, 15, 3015, 1},
+    {"1F9D1-1F3FF-200D-1F91D-200D-1F9D1-1F3FD", nullptr, 8083, 7, 15, 3016, 1},
+    {"1F9D1-1F3FF-200D-1F91D-200D-1F9D1-1F3FE", nullptr, 8090, 7, 15, 3017, 1},
+    {"1F9D1-1F3FF-200D-1F91D-200D-1F9D1-1F3FF", nullptr, 8097, 7, 15, 3018, 1},
+    {"1F9D1-200D-1F9AF", nullptr, 8104, 3, 15, 3019, 1},
+    {"1F9D1-1F3FB-200D-1F9AF", nullptr, 8107, 4, 15, 3020, 1},
+    {"1F9D1-1F3FC-200D-1F9AF", nullptr, 8111, 4, 15, 3021, 1},
+    {"1F9D1-1F3FD-200D-1F9AF", nullptr, 8115, 4, 15, 3022, 1},
+    {"1F9D1-1F3FE-200D-1F9AF", nullptr, 8119, 4, 15, 3023, 1},
+    {"1F9D1-1F3FF-200D-1F9AF", nullptr, 8123, 4, 15, 3024, 1},
+    {"1F9D1-200D-1F9B0", nullptr, 8127, 3, 15, 3025, 1},
+    {"1F9D1-1F3FB-200D-1F9B0", nullptr, 8130, 4, 15, 3026, 1},
+    {"1F9D1-1F3FC-200D-1F9B0", nullptr, 8134, 4, 15, 3027, 1},
+    {"1F9D1-1F3FD-200D-1F9B0", nullptr, 8138, 4, 15, 3028, 1},
+    {"1F9D1-1F3FE-200D-1F9B0", nullptr, 8142, 4, 15, 3029, 1},
+    {"1F9D1-1F3FF-200D-1F9B0", nullptr, 8146, 4, 15, 3030, 1},
+    {"1F9D1-200D-1F9B1", nullptr, 8150, 3, 15, 3031, 1},
+    {"1F9D1-1F3FB-200D-1F9B1", nullptr, 8153, 4, 15, 3032, 1},
+    {"1F9D1-1F3FC-200D-1F9B1", nullptr, 8157, 4, 15, 3033, 1},
+    {"1F9D1-1F3FD-200D-1F9B1", nullptr, 8161, 4, 15, 3034, 1},
+    {"1F9D1-1F3FE-200D-1F9B1", nullptr, 8165, 4, 15, 3035, 1},
+    {"1F9D1-1F3FF-200D-1F9B1", nullptr, 8169, 4, 15, 3036, 1},
+    {"1F9D1-200D-1F9B2", nullptr, 8173, 3, 7, 3037, 1},
+    {"1F9D1-1F3FB-200D-1F9B2", nullptr, 8176, 4, 7, 3038, 1},
+    {"1F9D1-1F3FC-200D-1F9B2", nullptr, 8180, 4, 7, 3039, 1},
+    {"1F9D1-1F3FD-200D-1F9B2", nullptr, 8184, 4, 7, 3040, 1},
+    {"1F9D1-1F3FE-200D-1F9B2", nullptr, 8188, 4, 7, 3041, 1},
+    {"1F9D1-1F3FF-200D-1F9B2", nullptr, 8192, 4, 7, 3042, 1},
+    {"1F9D1-200D-1F9B3", nullptr, 8196, 3, 7, 3043, 1},
+    {"1F9D1-1F3FB-200D-1F9B3", nullptr, 8199, 4, 7, 3044, 1},
+    {"1F9D1-1F3FC-200D-1F9B3", nullptr, 8203, 4, 7, 3045, 1},
+    {"1F9D1-1F3FD-200D-1F9B3", nullptr, 8207, 4, 7, 3046, 1},
+    {"1F9D1-1F3FE-200D-1F9B3", nullptr, 8211, 4, 7, 3047, 1},
+    {"1F9D1-1F3FF-200D-1F9B3", nullptr, 8215, 4, 7, 3048, 1},
+    {"1F9D1-200D-1F9BC", nullptr, 8219, 3, 15, 3049, 1},
+    {"1F9D1-1F3FB-200D-1F9BC", nullptr, 8222, 4, 15, 3050, 1},
+    {"1F9D1-1F3FC-200D-1F9BC", nullptr, 8226, 4, 15, 3051, 1},
+    {"1F9D1-1F3FD-200D-1F9BC", nullptr, 8230, 4, 15, 3052, 1},
+    {"1F9D1-1F3FE-200D-1F9BC", nullptr, 8234, 4, 15, 3053, 1},
+    {"1F9D1-1F3FF-200D-1F9BC", nullptr, 8238, 4, 15, 3054, 1},
+    {"1F9D1-200D-1F9BD", nullptr, 8242, 3, 15, 3055, 1},
+    {"1F9D1-1F3FB-200D-1F9BD", nullptr, 8245, 4, 15, 3056, 1},
+    {"1F9D1-1F3FC-200D-1F9BD", nullptr, 8249, 4, 15, 3057, 1},
+    {"1F9D1-1F3FD-200D-1F9BD", nullptr, 8253, 4, 15, 3058, 1},
+    {"1F9D1-1F3FE-200D-1F9BD", nullptr, 8257, 4, 15, 3059, 1},
+    {"1F9D1-1F3FF-200D-1F9BD", nullptr, 8261, 4, 15, 3060, 1},
+    {"1F9D1-200D-2695-FE0F", "1F9D1-200D-2695", 8265, 3, 15, 3061, 1},
+    {"1F9D1-1F3FB-200D-2695-FE0F", "1F9D1-1F3FB-200D-2695", 8268, 4, 15, 3062, 1},
+    {"1F9D1-1F3FC-200D-2695-FE0F", "1F9D1-1F3FC-200D-2695", 8272, 4, 15, 3063, 1},
+    {"1F9D1-1F3FD-200D-2695-FE0F", "1F9D1-1F3FD-200D-2695", 8276, 4, 15, 3064, 1},
+    {"1F9D1-1F3FE-200D-2695-FE0F", "1F9D1-1F3FE-200D-2695", 8280, 4, 15, 3065, 1},
+    {"1F9D1-1F3FF-200D-2695-FE0F", "1F9D1-1F3FF-200D-2695", 8284, 4, 15, 3066, 1},
+    {"1F9D1-200D-2696-FE0F", "1F9D1-200D-2696", 8288, 3, 15, 3067, 1},
+    {"1F9D1-1F3FB-200D-2696-FE0F", "1F9D1-1F3FB-200D-2696", 8291, 4, 15, 3068, 1},
+    {"1F9D1-1F3FC-200D-2696-FE0F", "1F9D1-1F3FC-200D-2696", 8295, 4, 15, 3069, 1},
+    {"1F9D1-1F3FD-200D-2696-FE0F", "1F9D1-1F3FD-200D-2696", 8299, 4, 15, 3070, 1},
+    {"1F9D1-1F3FE-200D-2696-FE0F", "1F9D1-1F3FE-200D-2696", 8303, 4, 15, 3071, 1},
+    {"1F9D1-1F3FF-200D-2696-FE0F", "1F9D1-1F3FF-200D-2696", 8307, 4, 15, 3072, 1},
+    {"1F9D1-200D-2708-FE0F", "1F9D1-200D-2708", 8311, 3, 15, 3073, 1},
+    {"1F9D1-1F3FB-200D-2708-FE0F", "1F9D1-1F3FB-200D-2708", 8314, 4, 15, 3074, 1},
+    {"1F9D1-1F3FC-200D-2708-FE0F", "1F9D1-1F3FC-200D-2708", 8318, 4, 15, 3075, 1},
+    {"1F9D1-1F3FD-200D-2708-FE0F", "1F9D1-1F3FD-200D-2708", 8322, 4, 15, 3076, 1},
+    {"1F9D1-1F3FE-200D-2708-FE0F", "1F9D1-1F3FE-200D-2708", 8326, 4, 15, 3077, 1},
+    {"1F9D1-1F3FF-200D-2708-FE0F", "1F9D1-1F3FF-200D-2708", 8330, 4, 15, 3078, 1},
+    {"1F9D1", nullptr, 8334, 1, 15, 3079, 1},
+    {"1F9D1-1F3FB", nullptr, 8335, 2, 15, 3080, 1},
+    {"1F9D1-1F3FC", nullptr, 8337, 2, 15, 3081, 1},
+    {"1F9D1-1F3FD", nullptr, 8339, 2, 15, 3082, 1},
+    {"1F9D1-1F3FE", nullptr, 8341, 2, 15, 3083, 1},
+    {"1F9D1-1F3FF", nullptr, 8343, 2, 15, 3084, 1},
+    {"1F9D2", nullptr, 8345, 1, 15, 3085, 1},
+    {"1F9D2-1F3FB", nullptr, 8346, 2, 15, 3086, 1},
+    {"1F9D2-1F3FC", nullptr, 8348, 2, 15, 3087, 1},
+    {"1F9D2-1F3FD", nullptr, 8350, 2, 15, 3088, 1},
+    {"1F9D2-1F3FE", nullptr, 8352, 2, 15, 3089, 1},
+    {"1F9D2-1F3FF", nullptr, 8354, 2, 15, 3090, 1},
+    {"1F9D3", nullptr, 8356, 1, 15, 3091, 1},
+    {"1F9D3-1F3FB", nullptr, 8357, 2, 15, 3092, 1},
+    {"1F9D3-1F3FC", nullptr, 8359, 2, 15, 3093, 1},
+    {"1F9D3-1F3FD", nullptr, 8361, 2, 15, 3094, 1},
+    {"1F9D3-1F3FE", nullptr, 8363, 2, 15, 3095, 1},
+    {"1F9D3-1F3FF", nullptr, 8365, 2, 15, 3096, 1},
+    {"1F9D4-200D-2640-FE0F", "1F9D4-200D-2640", 8367, 3, 7, 3097, 1},
+    {"1F9D4-1F3FB-200D-2640-FE0F", "1F9D4-1F3FB-200D-2640", 8370, 4, 7, 3098, 1},
+    {"1F9D4-1F3FC-200D-2640-FE0F", "1F9D4-1F3FC-200D-2640", 8374, 4, 7, 3099, 1},
+    {"1F9D4-1F3FD-200D-2640-FE0F", "1F9D4-1F3FD-200D-2640", 8378, 4, 7, 3100, 1},
+    {"1F9D4-1F3FE-200D-2640-FE0F", "1F9D4-1F3FE-200D-2640", 8382, 4, 7, 3101, 1},
+    {"1F9D4-1F3FF-200D-2640-FE0F", "1F9D4-1F3FF-200D-2640", 8386, 4, 7, 3102, 1},
+    {"1F9D4-200D-2642-FE0F", "1F9D4-200D-2642", 8390, 3, 7, 3103, 1},
+    {"1F9D4-1F3FB-200D-2642-FE0F", "1F9D4-1F3FB-200D-2642", 8393, 4, 7, 3104, 1},
+    {"1F9D4-1F3FC-200D-2642-FE0F", "1F9D4-1F3FC-200D-2642", 8397, 4, 7, 3105, 1},
+    {"1F9D4-1F3FD-200D-2642-FE0F", "1F9D4-1F3FD-200D-2642", 8401, 4, 7, 3106, 1},
+    {"1F9D4-1F3FE-200D-2642-FE0F", "1F9D4-1F3FE-200D-2642", 8405, 4, 7, 3107, 1},
+    {"1F9D4-1F3FF-200D-2642-FE0F", "1F9D4-1F3FF-200D-2642", 8409, 4, 7, 3108, 1},
+    {"1F9D4", nullptr, 8413, 1, 15, 3109, 1},
+    {"1F9D4-1F3FB", nullptr, 8414, 2, 15, 3110, 1},
+    {"1F9D4-1F3FC", nullptr, 8416, 2, 15, 3111, 1},
+    {"1F9D4-1F3FD", nullptr, 8418, 2, 15, 3112, 1},
+    {"1F9D4-1F3FE", nullptr, 8420, 2, 15, 3113, 1},
+    {"1F9D4-1F3FF", nullptr, 8422, 2, 15, 3114, 1},
+    {"1F9D5", nullptr, 8424, 1, 15, 3115, 1},
+    {"1F9D5-1F3FB", nullptr, 8425, 2, 15, 3116, 1},
+    {"1F9D5-1F3FC", nullptr, 8427, 2, 15, 3117, 1},
+    {"1F9D5-1F3FD", nullptr, 8429, 2, 15, 3118, 1},
+    {"1F9D5-1F3FE", nullptr, 8431, 2, 15, 3119, 1},
+    {"1F9D5-1F3FF", nullptr, 8433, 2, 15, 3120, 1},
+    {"1F9D6-200D-2640-FE0F", "1F9D6-200D-2640", 8435, 3, 15, 3121, 1},
+    {"1F9D6-1F3FB-200D-2640-FE0F", "1F9D6-1F3FB-200D-2640", 8438, 4, 15, 3122, 1},
+    {"1F9D6-1F3FC-200D-2640-FE0F", "1F9D6-1F3FC-200D-2640", 8442, 4, 15, 3123, 1},
+    {"1F9D6-1F3FD-200D-2640-FE0F", "1F9D6-1F3FD-200D-2640", 8446, 4, 15, 3124, 1},
+    {"1F9D6-1F3FE-200D-2640-FE0F", "1F9D6-1F3FE-200D-2640", 8450, 4, 15, 3125, 1},
+    {"1F9D6-1F3FF-200D-2640-FE0F", "1F9D6-1F3FF-200D-2640", 8454, 4, 15, 3126, 1},
+    {"1F9D6-200D-2642-FE0F", "1F9D6-200D-2642", 8458, 3, 15, 3127, 1},
+    {"1F9D6-1F3FB-200D-2642-FE0F", "1F9D6-1F3FB-200D-2642", 8461, 4, 15, 3128, 1},
+    {"1F9D6-1F3FC-200D-2642-FE0F", "1F9D6-1F3FC-200D-2642", 8465, 4, 15, 3129, 1},
+    {"1F9D6-1F3FD-200D-2642-FE0F", "1F9D6-1F3FD-200D-2642", 8469, 4, 15, 3130, 1},
+    {"1F9D6-1F3FE-200D-2642-FE0F", "1F9D6-1F3FE-200D-2642", 8473, 4, 15, 3131, 1},
+    {"1F9D6-1F3FF-200D-2642-FE0F", "1F9D6-1F3FF-200D-2642", 8477, 4, 15, 3132, 1},
+    {"1F9D6", nullptr, 8481, 1, 15, 3133, 1},
+    {"1F9D6-1F3FB", nullptr, 8482, 2, 15, 3134, 1},
+    {"1F9D6-1F3FC", nullptr, 8484, 2, 15, 3135, 1},
+    {"1F9D6-1F3FD", nullptr, 8486, 2, 15, 3136, 1},
+    {"1F9D6-1F3FE", nullptr, 8488, 2, 15, 3137, 1},
+    {"1F9D6-1F3FF", nullptr, 8490, 2, 15, 3138, 1},
+    {"1F9D7-200D-2640-FE0F", "1F9D7-200D-2640", 8492, 3, 15, 3139, 1},
+    {"1F9D7-1F3FB-200D-2640-FE0F", "1F9D7-1F3FB-200D-2640", 8495, 4, 15, 3140, 1},
+    {"1F9D7-1F3FC-200D-2640-FE0F", "1F9D7-1F3FC-200D-2640", 8499, 4, 15, 3141, 1},
+    {"1F9D7-1F3FD-200D-2640-FE0F", "1F9D7-1F3FD-200D-2640", 8503, 4, 15, 3142, 1},
+    {"1F9D7-1F3FE-200D-2640-FE0F", "1F9D7-1F3FE-200D-2640", 8507, 4, 15, 3143, 1},
+    {"1F9D7-1F3FF-200D-2640-FE0F", "1F9D7-1F3FF-200D-2640", 8511, 4, 15, 3144, 1},
+    {"1F9D7-200D-2642-FE0F", "1F9D7-200D-2642", 8515, 3, 15, 3145, 1},
+    {"1F9D7-1F3FB-200D-2642-FE0F", "1F9D7-1F3FB-200D-2642", 8518, 4, 15, 3146, 1},
+    {"1F9D7-1F3FC-200D-2642-FE0F", "1F9D7-1F3FC-200D-2642", 8522, 4, 15, 3147, 1},
+    {"1F9D7-1F3FD-200D-2642-FE0F", "1F9D7-1F3FD-200D-2642", 8526, 4, 15, 3148, 1},
+    {"1F9D7-1F3FE-200D-2642-FE0F", "1F9D7-1F3FE-200D-2642", 8530, 4, 15, 3149, 1},
+    {"1F9D7-1F3FF-200D-2642-FE0F", "1F9D7-1F3FF-200D-2642", 8534, 4, 15, 3150, 1},
+    {"1F9D7", nullptr, 8538, 1, 15, 3151, 1},
+    {"1F9D7-1F3FB", nullptr, 8539, 2, 15, 3152, 1},
+    {"1F9D7-1F3FC", nullptr, 8541, 2, 15, 3153, 1},
+    {"1F9D7-1F3FD", nullptr, 8543, 2, 15, 3154, 1},
+    {"1F9D7-1F3FE", nullptr, 8545, 2, 15, 3155, 1},
+    {"1F9D7-1F3FF", nullptr, 8547, 2, 15, 3156, 1},
+    {"1F9D8-200D-2640-FE0F", "1F9D8-200D-2640", 8549, 3, 15, 3157, 1},
+    {"1F9D8-1F3FB-200D-2640-FE0F", "1F9D8-1F3FB-200D-2640", 8552, 4, 15, 3158, 1},
+    {"1F9D8-1F3FC-200D-2640-FE0F", "1F9D8-1F3FC-200D-2640", 8556, 4, 15, 3159, 1},
+    {"1F9D8-1F3FD-200D-2640-FE0F", "1F9D8-1F3FD-200D-2640", 8560, 4, 15, 3160, 1},
+    {"1F9D8-1F3FE-200D-2640-FE0F", "1F9D8-1F3FE-200D-2640", 8564, 4, 15, 3161, 1},
+    {"1F9D8-1F3FF-200D-2640-FE0F", "1F9D8-1F3FF-200D-2640", 8568, 4, 15, 3162, 1},
+    {"1F9D8-200D-2642-FE0F", "1F9D8-200D-2642", 8572, 3, 15, 3163, 1},
+    {"1F9D8-1F3FB-200D-2642-FE0F", "1F9D8-1F3FB-200D-2642", 8575, 4, 15, 3164, 1},
+    {"1F9D8-1F3FC-200D-2642-FE0F", "1F9D8-1F3FC-200D-2642", 8579, 4, 15, 3165, 1},
+    {"1F9D8-1F3FD-200D-2642-FE0F", "1F9D8-1F3FD-200D-2642", 8583, 4, 15, 3166, 1},
+    {"1F9D8-1F3FE-200D-2642-FE0F", "1F9D8-1F3FE-200D-2642", 8587, 4, 15, 3167, 1},
+    {"1F9D8-1F3FF-200D-2642-FE0F", "1F9D8-1F3FF-200D-2642", 8591, 4, 15, 3168, 1},
+    {"1F9D8", nullptr, 8595, 1, 15, 3169, 1},
+    {"1F9D8-1F3FB", nullptr, 8596, 2, 15, 3170, 1},
+    {"1F9D8-1F3FC", nullptr, 8598, 2, 15, 3171, 1},
+    {"1F9D8-1F3FD", nullptr, 8600, 2, 15, 3172, 1},
+    {"1F9D8-1F3FE", nullptr, 8602, 2, 15, 3173, 1},
+    {"1F9D8-1F3FF", nullptr, 8604, 2, 15, 3174, 1},
+    {"1F9D9-200D-2640-FE0F", "1F9D9-200D-2640", 8606, 3, 15, 3175, 1},
+    {"1F9D9-1F3FB-200D-2640-FE0F", "1F9D9-1F3FB-200D-2640", 8609, 4, 15, 3176, 1},
+    {"1F9D9-1F3FC-200D-2640-FE0F", "1F9D9-1F3FC-200D-2640", 8613, 4, 15, 3177, 1},
+    {"1F9D9-1F3FD-200D-2640-FE0F", "1F9D9-1F3FD-200D-2640", 8617, 4, 15, 3178, 1},
+    {"1F9D9-1F3FE-200D-2640-FE0F", "1F9D9-1F3FE-200D-2640", 8621, 4, 15, 3179, 1},
+    {"1F9D9-1F3FF-200D-2640-FE0F", "1F9D9-1F3FF-200D-2640", 8625, 4, 15, 3180, 1},
+    {"1F9D9-200D-2642-FE0F", "1F9D9-200D-2642", 8629, 3, 15, 3181, 1},
+    {"1F9D9-1F3FB-200D-2642-FE0F", "1F9D9-1F3FB-200D-2642", 8632, 4, 15, 3182, 1},
+    {"1F9D9-1F3FC-200D-2642-FE0F", "1F9D9-1F3FC-200D-2642", 8636, 4, 15, 3183, 1},
+    {"1F9D9-1F3FD-200D-2642-FE0F", "1F9D9-1F3FD-200D-2642", 8640, 4, 15, 3184, 1},
+    {"1F9D9-1F3FE-200D-2642-FE0F", "1F9D9-1F3FE-200D-2642", 8644, 4, 15, 3185, 1},
+    {"1F9D9-1F3FF-200D-2642-FE0F", "1F9D9-1F3FF-200D-2642", 8648, 4, 15, 3186, 1},
+    {"1F9D9", nullptr, 8652, 1, 15, 3187, 1},
+    {"1F9D9-1F3FB", nullptr, 8653, 2, 15, 3188, 1},
+    {"1F9D9-1F3FC", nullptr, 8655, 2, 15, 3189, 1},
+    {"1F9D9-1F3FD", nullptr, 8657, 2, 15, 3190, 1},
+    {"1F9D9-1F3FE", nullptr, 8659, 2, 15, 3191, 1},
+    {"1F9D9-1F3FF", nullptr, 8661, 2, 15, 3192, 1},
+    {"1F9DA-200D-2640-FE0F", "1F9DA-200D-2640", 8663, 3, 15, 3193, 1},
+    {"1F9DA-1F3FB-200D-2640-FE0F", "1F9DA-1F3FB-200D-2640", 8666, 4, 15, 3194, 1},
+    {"1F9DA-1F3FC-200D-2640-FE0F", "1F9DA-1F3FC-200D-2640", 8670, 4, 15, 3195, 1},
+    {"1F9DA-1F3FD-200D-2640-FE0F", "1F9DA-1F3FD-200D-2640", 8674, 4, 15, 3196, 1},
+    {"1F9DA-1F3FE-200D-2640-FE0F", "1F9DA-1F3FE-200D-2640", 8678, 4, 15, 3197, 1},
+    {"1F9DA-1F3FF-200D-2640-FE0F", "1F9DA-1F3FF-200D-2640", 8682, 4, 15, 3198, 1},
+    {"1F9DA-200D-2642-FE0F", "1F9DA-200D-2642", 8686, 3, 15, 3199, 1},
+    {"1F9DA-1F3FB-200D-2642-FE0F", "1F9DA-1F3FB-200D-2642", 8689, 4, 15, 3200, 1},
+    {"1F9DA-1F3FC-200D-2642-FE0F", "1F9DA-1F3FC-200D-2642", 8693, 4, 15, 3201, 1},
+    {"1F9DA-1F3FD-200D-2642-FE0F", "1F9DA-1F3FD-200D-2642", 8697, 4, 15, 3202, 1},
+    {"1F9DA-1F3FE-200D-2642-FE0F", "1F9DA-1F3FE-200D-2642", 8701, 4, 15, 3203, 1},
+    {"1F9DA-1F3FF-200D-2642-FE0F", "1F9DA-1F3FF-200D-2642", 8705, 4, 15, 3204, 1},
+    {"1F9DA", nullptr, 8709, 1, 15, 3205, 1},
+    {"1F9DA-1F3FB", nullptr, 8710, 2, 15, 3206, 1},
+    {"1F9DA-1F3FC", nullptr, 8712, 2, 15, 3207, 1},
+    {"1F9DA-1F3FD", nullptr, 8714, 2, 15, 3208, 1},
+    {"1F9DA-1F3FE", nullptr, 8716, 2, 15, 3209, 1},
+    {"1F9DA-1F3FF", nullptr, 8718, 2, 15, 3210, 1},
+    {"1F9DB-200D-2640-FE0F", "1F9DB-200D-2640", 8720, 3, 15, 3211, 1},
+    {"1F9DB-1F3FB-200D-2640-FE0F", "1F9DB-1F3FB-200D-2640", 8723, 4, 15, 3212, 1},
+    {"1F9DB-1F3FC-200D-2640-FE0F", "1F9DB-1F3FC-200D-2640", 8727, 4, 15, 3213, 1},
+    {"1F9DB-1F3FD-200D-2640-FE0F", "1F9DB-1F3FD-200D-2640", 8731, 4, 15, 3214, 1},
+    {"1F9DB-1F3FE-200D-2640-FE0F", "1F9DB-1F3FE-200D-2640", 8735, 4, 15, 3215, 1},
+    {"1F9DB-1F3FF-200D-2640-FE0F", "1F9DB-1F3FF-200D-2640", 8739, 4, 15, 3216, 1},
+    {"1F9DB-200D-2642-FE0F", "1F9DB-200D-2642", 8743, 3, 15, 3217, 1},
+    {"1F9DB-1F3FB-200D-2642-FE0F", "1F9DB-1F3FB-200D-2642", 8746, 4, 15, 3218, 1},
+    {"1F9DB-1F3FC-200D-2642-FE0F", "1F9DB-1F3FC-200D-2642", 8750, 4, 15, 3219, 1},
+    {"1F9DB-1F3FD-200D-2642-FE0F", "1F9DB-1F3FD-200D-2642", 8754, 4, 15, 3220, 1},
+    {"1F9DB-1F3FE-200D-2642-FE0F", "1F9DB-1F3FE-200D-2642", 8758, 4, 15, 3221, 1},
+    {"1F9DB-1F3FF-200D-2642-FE0F", "1F9DB-1F3FF-200D-2642", 8762, 4, 15, 3222, 1},
+    {"1F9DB", nullptr, 8766, 1, 15, 3223, 1},
+    {"1F9DB-1F3FB", nullptr, 8767, 2, 15, 3224, 1},
+    {"1F9DB-1F3FC", nullptr, 8769, 2, 15, 3225, 1},
+    {"1F9DB-1F3FD", nullptr, 8771, 2, 15, 3226, 1},
+    {"1F9DB-1F3FE", nullptr, 8773, 2, 15, 3227, 1},
+    {"1F9DB-1F3FF", nullptr, 8775, 2, 15, 3228, 1},
+    {"1F9DC-200D-2640-FE0F", "1F9DC-200D-2640", 8777, 3, 15, 3229, 1},
+    {"1F9DC-1F3FB-200D-2640-FE0F", "1F9DC-1F3FB-200D-2640", 8780, 4, 15, 3230, 1},
+    {"1F9DC-1F3FC-200D-2640-FE0F", "1F9DC-1F3FC-200D-2640", 8784, 4, 15, 3231, 1},
+    {"1F9DC-1F3FD-200D-2640-FE0F", "1F9DC-1F3FD-200D-2640", 8788, 4, 15, 3232, 1},
+    {"1F9DC-1F3FE-200D-2640-FE0F", "1F9DC-1F3FE-200D-2640", 8792, 4, 15, 3233, 1},
+    {"1F9DC-1F3FF-200D-2640-FE0F", "1F9DC-1F3FF-200D-2640", 8796, 4, 15, 3234, 1},
+    {"1F9DC-200D-2642-FE0F", "1F9DC-200D-2642", 8800, 3, 15, 3235, 1},
+    {"1F9DC-1F3FB-200D-2642-FE0F", "1F9DC-1F3FB-200D-2642", 8803, 4, 15, 3236, 1},
+    {"1F9DC-1F3FC-200D-2642-FE0F", "1F9DC-1F3FC-200D-2642", 8807, 4, 15, 3237, 1},
+    {"1F9DC-1F3FD-200D-2642-FE0F", "1F9DC-1F3FD-200D-2642", 8811, 4, 15, 3238, 1},
+    {"1F9DC-1F3FE-200D-2642-FE0F", "1F9DC-1F3FE-200D-2642", 8815, 4, 15, 3239, 1},
+    {"1F9DC-1F3FF-200D-2642-FE0F", "1F9DC-1F3FF-200D-2642", 8819, 4, 15, 3240, 1},
+    {"1F9DC", nullptr, 8823, 1, 15, 3241, 1},
+    {"1F9DC-1F3FB", nullptr, 8824, 2, 15, 3242, 1},
+    {"1F9DC-1F3FC", nullptr, 8826, 2, 15, 3243, 1},
+    {"1F9DC-1F3FD", nullptr, 8828, 2, 15, 3244, 1},
+    {"1F9DC-1F3FE", nullptr, 8830, 2, 15, 3245, 1},
+    {"1F9DC-1F3FF", nullptr, 8832, 2, 15, 3246, 1},
+    {"1F9DD-200D-2640-FE0F", "1F9DD-200D-2640", 8834, 3, 15, 3247, 1},
+    {"1F9DD-1F3FB-200D-2640-FE0F", "1F9DD-1F3FB-200D-2640", 8837, 4, 15, 3248, 1},
+    {"1F9DD-1F3FC-200D-2640-FE0F", "1F9DD-1F3FC-200D-2640", 8841, 4, 15, 3249, 1},
+    {"1F9DD-1F3FD-200D-2640-FE0F", "1F9DD-1F3FD-200D-2640", 8845, 4, 15, 3250, 1},
+    {"1F9DD-1F3FE-200D-2640-FE0F", "1F9DD-1F3FE-200D-2640", 8849, 4, 15, 3251, 1},
+    {"1F9DD-1F3FF-200D-2640-FE0F", "1F9DD-1F3FF-200D-2640", 8853, 4, 15, 3252, 1},
+    {"1F9DD-200D-2642-FE0F", "1F9DD-200D-2642", 8857, 3, 15, 3253, 1},
+    {"1F9DD-1F3FB-200D-2642-FE0F", "1F9DD-1F3FB-200D-2642", 8860, 4, 15, 3254, 1},
+    {"1F9DD-1F3FC-200D-2642-FE0F", "1F9DD-1F3FC-200D-2642", 8864, 4, 15, 3255, 1},
+    {"1F9DD-1F3FD-200D-2642-FE0F", "1F9DD-1F3FD-200D-2642", 8868, 4, 15, 3256, 1},
+    {"1F9DD-1F3FE-200D-2642-FE0F", "1F9DD-1F3FE-200D-2642", 8872, 4, 15, 3257, 1},
+    {"1F9DD-1F3FF-200D-2642-FE0F", "1F9DD-1F3FF-200D-2642", 8876, 4, 15, 3258, 1},
+    {"1F9DD", nullptr, 8880, 1, 15, 3259, 1},
+    {"1F9DD-1F3FB", nullptr, 8881, 2, 15, 3260, 1},
+    {"1F9DD-1F3FC", nullptr, 8883, 2, 15, 3261, 1},
+    {"1F9DD-1F3FD", nullptr, 8885, 2, 15, 3262, 1},
+    {"1F9DD-1F3FE", nullptr, 8887, 2, 15, 3263, 1},
+    {"1F9DD-1F3FF", nullptr, 8889, 2, 15, 3264, 1},
+    {"1F9DE-200D-2640-FE0F", "1F9DE-200D-2640", 8891, 3, 15, 3265, 1},
+    {"1F9DE-200D-2642-FE0F", "1F9DE-200D-2642", 8894, 3, 15, 3266, 1},
+    {"1F9DE", nullptr, 8897, 1, 15, 3267, 1},
+    {"1F9DF-200D-2640-FE0F", "1F9DF-200D-2640", 8898, 3, 15, 3268, 1},
+    {"1F9DF-200D-2642-FE0F", "1F9DF-200D-2642", 8901, 3, 15, 3269, 1},
+    {"1F9DF", nullptr, 8904, 1, 15, 3270, 1},
+    {"1F9E0", nullptr, 8905, 1, 15, 3271, 1},
+    {"1F9E1", nullptr, 8906, 1, 15, 3272, 1},
+    {"1F9E2", nullptr, 8907, 1, 15, 3273, 1},
+    {"1F9E3", nullptr, 8908, 1, 15, 3274, 1},
+    {"1F9E4", nullptr, 8909, 1, 15, 3275, 1},
+    {"1F9E5", nullptr, 8910, 1, 15, 3276, 1},
+    {"1F9E6", nullptr, 8911, 1, 15, 3277, 1},
+    {"1F9E7", nullptr, 8912, 1, 15, 3278, 1},
+    {"1F9E8", nullptr, 8913, 1, 15, 3279, 1},
+    {"1F9E9", nullptr, 8914, 1, 15, 3280, 1},
+    {"1F9EA", nullptr, 8915, 1, 15, 3281, 1},
+    {"1F9EB", nullptr, 8916, 1, 15, 3282, 1},
+    {"1F9EC", nullptr, 8917, 1, 15, 3283, 1},
+    {"1F9ED", nullptr, 8918, 1, 15, 3284, 1},
+    {"1F9EE", nullptr, 8919, 1, 15, 3285, 1},
+    {"1F9EF", nullptr, 8920, 1, 15, 3286, 1},
+    {"1F9F0", nullptr, 8921, 1, 15, 3287, 1},
+    {"1F9F1", nullptr, 8922, 1, 15, 3288, 1},
+    {"1F9F2", nullptr, 8923, 1, 15, 3289, 1},
+    {"1F9F3", nullptr, 8924, 1, 15, 3290, 1},
+    {"1F9F4", nullptr, 8925, 1, 15, 3291, 1},
+    {"1F9F5", nullptr, 8926, 1, 15, 3292, 1},
+    {"1F9F6", nullptr, 8927, 1, 15, 3293, 1},
+    {"1F9F7", nullptr, 8928, 1, 15, 3294, 1},
+    {"1F9F8", nullptr, 8929, 1, 15, 3295, 1},
+    {"1F9F9", nullptr, 8930, 1, 15, 3296, 1},
+    {"1F9FA", nullptr, 8931, 1, 15, 3297, 1},
+    {"1F9FB", nullptr, 8932, 1, 15, 3298, 1},
+    {"1F9FC", nullptr, 8933, 1, 15, 3299, 1},
+    {"1F9FD", nullptr, 8934, 1, 15, 3300, 1},
+    {"1F9FE", nullptr, 8935, 1, 15, 3301, 1},
+    {"1F9FF", nullptr, 8936, 1, 15, 3302, 1},
+    {"1FA70", nullptr, 8937, 1, 15, 3303, 1},
+    {"1FA71", nullptr, 8938, 1, 15, 3304, 1},
+    {"1FA72", nullptr, 8939, 1, 15, 3305, 1},
+    {"1FA73", nullptr, 8940, 1, 15, 3306, 1},
+    {"1FA74", nullptr, 8941, 1, 15, 3307, 1},
+    {"1FA78", nullptr, 8942, 1, 15, 3308, 1},
+    {"1FA79", nullptr, 8943, 1, 15, 3309, 1},
+    {"1FA7A", nullptr, 8944, 1, 15, 3310, 1},
+    {"1FA80", nullptr, 8945, 1, 15, 3311, 1},
+    {"1FA81", nullptr, 8946, 1, 15, 3312, 1},
+    {"1FA82", nullptr, 8947, 1, 15, 3313, 1},
+    {"1FA83", nullptr, 8948, 1, 15, 3314, 1},
+    {"1FA84", nullptr, 8949, 1, 15, 3315, 1},
+    {"1FA85", nullptr, 8950, 1, 15, 3316, 1},
+    {"1FA86", nullptr, 8951, 1, 15, 3317, 1},
+    {"1FA90", nullptr, 8952, 1, 15, 3318, 1},
+    {"1FA91", nullptr, 8953, 1, 15, 3319, 1},
+    {"1FA92", nullptr, 8954, 1, 15, 3320, 1},
+    {"1FA93", nullptr, 8955, 1, 15, 3321, 1},
+    {"1FA94", nullptr, 8956, 1, 15, 3322, 1},
+    {"1FA95", nullptr, 8957, 1, 15, 3323, 1},
+    {"1FA96", nullptr, 8958, 1, 15, 3324, 1},
+    {"1FA97", nullptr, 8959, 1, 15, 3325, 1},
+    {"1FA98", nullptr, 8960, 1, 15, 3326, 1},
+    {"1FA99", nullptr, 8961, 1, 15, 3327, 1},
+    {"1FA9A", nullptr, 8962, 1, 15, 3328, 1},
+    {"1FA9B", nullptr, 8963, 1, 15, 3329, 1},
+    {"1FA9C", nullptr, 8964, 1, 15, 3330, 1},
+    {"1FA9D", nullptr, 8965, 1, 15, 3331, 1},
+    {"1FA9E", nullptr, 8966, 1, 15, 3332, 1},
+    {"1FA9F", nullptr, 8967, 1, 15, 3333, 1},
+    {"1FAA0", nullptr, 8968, 1, 15, 3334, 1},
+    {"1FAA1", nullptr, 8969, 1, 15, 3335, 1},
+    {"1FAA2", nullptr, 8970, 1, 15, 3336, 1},
+    {"1FAA3", nullptr, 8971, 1, 15, 3337, 1},
+    {"1FAA4", nullptr, 8972, 1, 15, 3338, 1},
+    {"1FAA5", nullptr, 8973, 1, 15, 3339, 1},
+    {"1FAA6", nullptr, 8974, 1, 15, 3340, 1},
+    {"1FAA7", nullptr, 8975, 1, 15, 3341, 1},
+    {"1FAA8", nullptr, 8976, 1, 15, 3342, 1},
+    {"1FAB0", nullptr, 8977, 1, 15, 3343, 1},
+    {"1FAB1", nullptr, 8978, 1, 15, 3344, 1},
+    {"1FAB2", nullptr, 8979, 1, 15, 3345, 1},
+    {"1FAB3", nullptr, 8980, 1, 15, 3346, 1},
+    {"1FAB4", nullptr, 8981, 1, 15, 3347, 1},
+    {"1FAB5", nullptr, 8982, 1, 15, 3348, 1},
+    {"1FAB6", nullptr, 8983, 1, 15, 3349, 1},
+    {"1FAC0", nullptr, 8984, 1, 15, 3350, 1},
+    {"1FAC1", nullptr, 8985, 1, 15, 3351, 1},
+    {"1FAC2", nullptr, 8986, 1, 15, 3352, 1},
+    {"1FAD0", nullptr, 8987, 1, 15, 3353, 1},
+    {"1FAD1", nullptr, 8988, 1, 15, 3354, 1},
+    {"1FAD2", nullptr, 8989, 1, 15, 3355, 1},
+    {"1FAD3", nullptr, 8990, 1, 15, 3356, 1},
+    {"1FAD4", nullptr, 8991, 1, 15, 3357, 1},
+    {"1FAD5", nullptr, 8992, 1, 15, 3358, 1},
+    {"1FAD6", nullptr, 8993, 1, 15, 3359, 1},
+    {"203C-FE0F", "203C", 8994, 1, 15, 3360, 1},
+    {"2049-FE0F", "2049", 8995, 1, 15, 3361, 1},
+    {"2122-FE0F", "2122", 8996, 1, 15, 3362, 1},
+    {"2139-FE0F", "2139", 8997, 1, 15, 3363, 1},
+    {"2194-FE0F", "2194", 8998, 1, 15, 3364, 1},
+    {"2195-FE0F", "2195", 8999, 1, 15, 3365, 1},
+    {"2196-FE0F", "2196", 9000, 1, 15, 3366, 1},
+    {"2197-FE0F", "2197", 9001, 1, 15, 3367, 1},
+    {"2198-FE0F", "2198", 9002, 1, 15, 3368, 1},
+    {"2199-FE0F", "2199", 9003, 1, 15, 3369, 1},
+    {"21A9-FE0F", "21A9", 9004, 1, 15, 3370, 1},
+    {"21AA-FE0F", "21AA", 9005, 1, 15, 3371, 1},
+    {"231A", nullptr, 9006, 1, 15, 3372, 1},
+    {"231B", nullptr, 9007, 1, 15, 3373, 1},
+    {"2328-FE0F", "2328", 9008, 1, 15, 3374, 1},
+    {"23CF-FE0F", "23CF", 9009, 1, 15, 3375, 1},
+    {"23E9", nullptr, 9010, 1, 15, 3376, 1},
+    {"23EA", nullptr, 9011, 1, 15, 3377, 1},
+    {"23EB", nullptr, 9012, 1, 15, 3378, 1},
+    {"23EC", nullptr, 9013, 1, 15, 3379, 1},
+    {"23ED-FE0F", "23ED", 9014, 1, 15, 3380, 1},
+    {"23EE-FE0F", "23EE", 9015, 1, 15, 3381, 1},
+    {"23EF-FE0F", "23EF", 9016, 1, 15, 3382, 1},
+    {"23F0", nullptr, 9017, 1, 15, 3383, 1},
+    {"23F1-FE0F", "23F1", 9018, 1, 15, 3384, 1},
+    {"23F2-FE0F", "23F2", 9019, 1, 15, 3385, 1},
+    {"23F3", nullptr, 9020, 1, 15, 3386, 1},
+    {"23F8-FE0F", "23F8", 9021, 1, 15, 3387, 1},
+    {"23F9-FE0F", "23F9", 9022, 1, 15, 3388, 1},
+    {"23FA-FE0F", "23FA", 9023, 1, 15, 3389, 1},
+    {"24C2-FE0F", "24C2", 9024, 1, 15, 3390, 1},
+    {"25AA-FE0F", "25AA", 9025, 1, 15, 3391, 1},
+    {"25AB-FE0F", "25AB", 9026, 1, 15, 3392, 1},
+    {"25B6-FE0F", "25B6", 9027, 1, 15, 3393, 1},
+    {"25C0-FE0F", "25C0", 9028, 1, 15, 3394, 1},
+    {"25FB-FE0F", "25FB", 9029, 1, 15, 3395, 1},
+    {"25FC-FE0F", "25FC", 9030, 1, 15, 3396, 1},
+    {"25FD", nullptr, 9031, 1, 15, 3397, 1},
+    {"25FE", nullptr, 9032, 1, 15, 3398, 1},
+    {"2600-FE0F", "2600", 9033, 1, 15, 3399, 1},
+    {"2601-FE0F", "2601", 9034, 1, 15, 3400, 1},
+    {"2602-FE0F", "2602", 9035, 1, 15, 3401, 1},
+    {"2603-FE0F", "2603", 9036, 1, 15, 3402, 1},
+    {"2604-FE0F", "2604", 9037, 1, 15, 3403, 1},
+    {"260E-FE0F", "260E", 9038, 1, 15, 3404, 2},
+    {"2611-FE0F", "2611", 9039, 1, 15, 3406, 1},
+    {"2614", nullptr, 9040, 1, 15, 3407, 1},
+    {"2615", nullptr, 9041, 1, 15, 3408, 1},
+    {"2618-FE0F", "2618", 9042, 1, 15, 3409, 1},
+    {"261D-FE0F", "261D", 9043, 1, 15, 3410, 1},
+    {"261D-1F3FB", nullptr, 9044, 2, 15, 3411, 1},
+    {"261D-1F3FC", nullptr, 9046, 2, 15, 3412, 1},
+    {"261D-1F3FD", nullptr, 9048, 2, 15, 3413, 1},
+    {"261D-1F3FE", nullptr, 9050, 2, 15, 3414, 1},
+    {"261D-1F3FF", nullptr, 9052, 2, 15, 3415, 1},
+    {"2620-FE0F", "2620", 9054, 1, 15, 3416, 1},
+    {"2622-FE0F", "2622", 9055, 1, 15, 3417, 1},
+    {"2623-FE0F", "2623", 9056, 1, 15, 3418, 1},
+    {"2626-FE0F", "2626", 9057, 1, 15, 3419, 1},
+    {"262A-FE0F", "262A", 9058, 1, 15, 3420, 1},
+    {"262E-FE0F", "262E", 9059, 1, 15, 3421, 1},
+    {"262F-FE0F", "262F", 9060, 1, 15, 3422, 1},
+    {"2638-FE0F", "2638", 9061, 1, 15, 3423, 1},
+    {"2639-FE0F", "2639", 9062, 1, 15, 3424, 1},
+    {"263A-FE0F", "263A", 9063, 1, 15, 3425, 1},
+    {"2640-FE0F", "2640", 9064, 1, 14, 3426, 1},
+    {"2642-FE0F", "2642", 9065, 1, 14, 3427, 1},
+    {"2648", nullptr, 9066, 1, 15, 3428, 1},
+    {"2649", nullptr, 9067, 1, 15, 3429, 1},
+    {"264A", nullptr, 9068, 1, 15, 3430, 1},
+    {"264B", nullptr, 9069, 1, 15, 3431, 1},
+    {"264C", nullptr, 9070, 1, 15, 3432, 1},
+    {"264D", nullptr, 9071, 1, 15, 3433, 1},
+    {"264E", nullptr, 9072, 1, 15, 3434, 1},
+    {"264F", nullptr, 9073, 1, 15, 3435, 1},
+    {"2650", nullptr, 9074, 1, 15, 3436, 1},
+    {"2651", nullptr, 9075, 1, 15, 3437, 1},
+    {"2652", nullptr, 9076, 1, 15, 3438, 1},
+    {"2653", nullptr, 9077, 1, 15, 3439, 1},
+    {"265F-FE0F", "265F", 9078, 1, 15, 3440, 1},
+    {"2660-FE0F", "2660", 9079, 1, 15, 3441, 1},
+    {"2663-FE0F", "2663", 9080, 1, 15, 3442, 1},
+    {"2665-FE0F", "2665", 9081, 1, 15, 3443, 1},
+    {"2666-FE0F", "2666", 9082, 1, 15, 3444, 1},
+    {"2668-FE0F", "2668", 9083, 1, 15, 3445, 1},
+    {"267B-FE0F", "267B", 9084, 1, 15, 3446, 1},
+    {"267E-FE0F", "267E", 9085, 1, 15, 3447, 1},
+    {"267F", nullptr, 9086, 1, 15, 3448, 1},
+    {"2692-FE0F", "2692", 9087, 1, 15, 3449, 1},
+    {"2693", nullptr, 9088, 1, 15, 3450, 1},
+    {"2694-FE0F", "2694", 9089, 1, 15, 3451, 1},
+    {"2695-FE0F", "2695", 9090, 1, 14, 3452, 2},
+    {"2696-FE0F", "2696", 9091, 1, 15, 3454, 1},
+    {"2697-FE0F", "2697", 9092, 1, 15, 3455, 1},
+    {"2699-FE0F", "2699", 9093, 1, 15, 3456, 1},
+    {"269B-FE0F", "269B", 9094, 1, 15, 3457, 1},
+    {"269C-FE0F", "269C", 9095, 1, 15, 3458, 1},
+    {"26A0-FE0F", "26A0", 9096, 1, 15, 3459, 1},
+    {"26A1", nullptr, 9097, 1, 15, 3460, 1},
+    {"26A7-FE0F", "26A7", 9098, 1, 15, 3461, 1},
+    {"26AA", nullptr, 9099, 1, 15, 3462, 1},
+    {"26AB", nullptr, 9100, 1, 15, 3463, 1},
+    {"26B0-FE0F", "26B0", 9101, 1, 15, 3464, 1},
+    {"26B1-FE0F", "26B1", 9102, 1, 15, 3465, 1},
+    {"26BD", nullptr, 9103, 1, 15, 3466, 1},
+    {"26BE", nullptr, 9104, 1, 15, 3467, 1},
+    {"26C4", nullptr, 9105, 1, 15, 3468, 1},
+    {"26C5", nullptr, 9106, 1, 15, 3469, 1},
+    {"26C8-FE0F", "26C8", 9107, 1, 15, 3470, 1},
+    {"26CE", nullptr, 9108, 1, 15, 3471, 1},
+    {"26CF-FE0F", "26CF", 9109, 1, 15, 3472, 1},
+    {"26D1-FE0F", "26D1", 9110, 1, 15, 3473, 1},
+    {"26D3-FE0F", "26D3", 9111, 1, 15, 3474, 1},
+    {"26D4", nullptr, 9112, 1, 15, 3475, 1},
+    {"26E9-FE0F", "26E9", 9113, 1, 15, 3476, 1},
+    {"26EA", nullptr, 9114, 1, 15, 3477, 1},
+    {"26F0-FE0F", "26F0", 9115, 1, 15, 3478, 1},
+    {"26F1-FE0F", "26F1", 9116, 1, 15, 3479, 1},
+    {"26F2", nullptr, 9117, 1, 15, 3480, 1},
+    {"26F3", nullptr, 9118, 1, 15, 3481, 1},
+    {"26F4-FE0F", "26F4", 9119, 1, 15, 3482, 1},
+    {"26F5", nullptr, 9120, 1, 15, 3483, 2},
+    {"26F7-FE0F", "26F7", 9121, 1, 15, 3485, 1},
+    {"26F8-FE0F", "26F8", 9122, 1, 15, 3486, 1},
+    {"26F9-FE0F-200D-2640-FE0F", nullptr, 9123, 5, 7, 3487, 1},
+    {"26F9-1F3FB-200D-2640-FE0F", "26F9-1F3FB-200D-2640", 9128, 4, 15, 3488, 1},
+    {"26F9-1F3FC-200D-2640-FE0F", "26F9-1F3FC-200D-2640", 9132, 4, 15, 3489, 1},
+    {"26F9-1F3FD-200D-2640-FE0F", "26F9-1F3FD-200D-2640", 9136, 4, 15, 3490, 1},
+    {"26F9-1F3FE-200D-2640-FE0F", "26F9-1F3FE-200D-2640", 9140, 4, 15, 3491, 1},
+    {"26F9-1F3FF-200D-2640-FE0F", "26F9-1F3FF-200D-2640", 9144, 4, 15, 3492, 1},
+    {"26F9-FE0F-200D-2642-FE0F", nullptr, 9148, 5, 7, 3493, 1},
+    {"26F9-1F3FB-200D-2642-FE0F", "26F9-1F3FB-200D-2642", 9153, 4, 15, 3494, 1},
+    {"26F9-1F3FC-200D-2642-FE0F", "26F9-1F3FC-200D-2642", 9157, 4, 15, 3495, 1},
+    {"26F9-1F3FD-200D-2642-FE0F", "26F9-1F3FD-200D-2642", 9161, 4, 15, 3496, 1},
+    {"26F9-1F3FE-200D-2642-FE0F", "26F9-1F3FE-200D-2642", 9165, 4, 15, 3497, 1},
+    {"26F9-1F3FF-200D-2642-FE0F", "26F9-1F3FF-200D-2642", 9169, 4, 15, 3498, 1},
+    {"26F9-FE0F", "26F9", 9173, 1, 15, 3499, 1},
+    {"26F9-1F3FB", nullptr, 9174, 2, 15, 3500, 1},
+    {"26F9-1F3FC", nullptr, 9176, 2, 15, 3501, 1},
+    {"26F9-1F3FD", nullptr, 9178, 2, 15, 3502, 1},
+    {"26F9-1F3FE", nullptr, 9180, 2, 15, 3503, 1},
+    {"26F9-1F3FF", nullptr, 9182, 2, 15, 3504, 1},
+    {"26FA", nullptr, 9184, 1, 15, 3505, 1},
+    {"26FD", nullptr, 9185, 1, 15, 3506, 1},
+    {"2702-FE0F", "2702", 9186, 1, 15, 3507, 1},
+    {"2705", nullptr, 9187, 1, 15, 3508, 1},
+    {"2708-FE0F", "2708", 9188, 1, 15, 3509, 1},
+    {"2709-FE0F", "2709", 9189, 1, 15, 3510, 2},
+    {"270A", nullptr, 9190, 1, 15, 3512, 1},
+    {"270A-1F3FB", nullptr, 9191, 2, 15, 3513, 1},
+    {"270A-1F3FC", nullptr, 9193, 2, 15, 3514, 1},
+    {"270A-1F3FD", nullptr, 9195, 2, 15, 3515, 1},
+    {"270A-1F3FE", nullptr, 9197, 2, 15, 3516, 1},
+    {"270A-1F3FF", nullptr, 9199, 2, 15, 3517, 1},
+    {"270B", nullptr, 9201, 1, 15, 3518, 2},
+    {"270B-1F3FB", nullptr, 9202, 2, 15, 3520, 1},
+    {"270B-1F3FC", nullptr, 9204, 2, 15, 3521, 1},
+    {"270B-1F3FD", nullptr, 9206, 2, 15, 3522, 1},
+    {"270B-1F3FE", nullptr, 9208, 2, 15, 3523, 1},
+    {"270B-1F3FF", nullptr, 9210, 2, 15, 3524, 1},
+    {"270C-FE0F", "270C", 9212, 1, 15, 3525, 1},
+    {"270C-1F3FB", nullptr, 9213, 2, 15, 3526, 1},
+    {"270C-1F3FC", nullptr, 9215, 2, 15, 3527, 1},
+    {"270C-1F3FD", nullptr, 9217, 2, 15, 3528, 1},
+    {"270C-1F3FE", nullptr, 9219, 2, 15, 3529, 1},
+    {"270C-1F3FF", nullptr, 9221, 2, 15, 3530, 1},
+    {"270D-FE0F", "270D", 9223, 1, 15, 3531, 1},
+    {"270D-1F3FB", nullptr, 9224, 2, 15, 3532, 1},
+    {"270D-1F3FC", nullptr, 9226, 2, 15, 3533, 1},
+    {"270D-1F3FD", nullptr, 9228, 2, 15, 3534, 1},
+    {"270D-1F3FE", nullptr, 9230, 2, 15, 3535, 1},
+    {"270D-1F3FF", nullptr, 9232, 2, 15, 3536, 1},
+    {"270F-FE0F", "270F", 9234, 1, 15, 3537, 1},
+    {"2712-FE0F", "2712", 9235, 1, 15, 3538, 1},
+    {"2714-FE0F", "2714", 9236, 1, 15, 3539, 1},
+    {"2716-FE0F", "2716", 9237, 1, 15, 3540, 1},
+    {"271D-FE0F", "271D", 9238, 1, 15, 3541, 1},
+    {"2721-FE0F", "2721", 9239, 1, 15, 3542, 1},
+    {"2728", nullptr, 9240, 1, 15, 3543, 1},
+    {"2733-FE0F", "2733", 9241, 1, 15, 3544, 1},
+    {"2734-FE0F", "2734", 9242, 1, 15, 3545, 1},
+    {"2744-FE0F", "2744", 9243, 1, 15, 3546, 1},
+    {"2747-FE0F", "2747", 9244, 1, 15, 3547, 1},
+    {"274C", nullptr, 9245, 1, 15, 3548, 1},
+    {"274E", nullptr, 9246, 1, 15, 3549, 1},
+    {"2753", nullptr, 9247, 1, 15, 3550, 1},
+    {"2754", nullptr, 9248, 1, 15, 3551, 1},
+    {"2755", nullptr, 9249, 1, 15, 3552, 1},
+    {"2757", nullptr, 9250, 1, 15, 3553, 2},
+    {"2763-FE0F", "2763", 9251, 1, 15, 3555, 1},
+    {"2764-FE0F-200D-1F525", "2764-200D-1F525", 9252, 3, 7, 3556, 1},
+    {"2764-FE0F-200D-1FA79", "2764-200D-1FA79", 9255, 3, 7, 3557, 1},
+    {"2764-FE0F", "2764", 9258, 1, 15, 3558, 1},
+    {"2795", nullptr, 9259, 1, 15, 3559, 1},
+    {"2796", nullptr, 9260, 1, 15, 3560, 1},
+    {"2797", nullptr, 9261, 1, 15, 3561, 1},
+    {"27A1-FE0F", "27A1", 9262, 1, 15, 3562, 1},
+    {"27B0", nullptr, 9263, 1, 15, 3563, 1},
+    {"27BF", nullptr, 9264, 1, 15, 3564, 1},
+    {"2934-FE0F", "2934", 9265, 1, 15, 3565, 1},
+    {"2935-FE0F", "2935", 9266, 1, 15, 3566, 1},
+    {"2B05-FE0F", "2B05", 9267, 1, 15, 3567, 1},
+    {"2B06-FE0F", "2B06", 9268, 1, 15, 3568, 1},
+    {"2B07-FE0F", "2B07", 9269, 1, 15, 3569, 1},
+    {"2B1B", nullptr, 9270, 1, 15, 3570, 1},
+    {"2B1C", nullptr, 9271, 1, 15, 3571, 1},
+    {"2B50", nullptr, 9272, 1, 15, 3572, 1},
+    {"2B55", nullptr, 9273, 1, 15, 3573, 1},
+    {"3030-FE0F", "3030", 9274, 1, 15, 3574, 1},
+    {"303D-FE0F", "303D", 9275, 1, 15, 3575, 1},
+    {"3297-FE0F", "3297", 9276, 1, 15, 3576, 1},
+    {"3299-FE0F", "3299", 9277, 1, 15, 3577, 1},
+};
+
+const size_t emojiTableSize =
+    sizeof(emojiTable) / sizeof(emojiTable[0]);
+
+}  // namespace chatterino
@@ -0,0 +1,40 @@
+#pragma once
+
+// This file is generated by resources/generate_emoji_table.py, do not edit
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chatterino {
+
+enum class EmojiCapability : uint8_t {
+    Apple = (1 << 0),
+    Google = (1 << 1),
+    Twitter = (1 << 2),
+    Facebook = (1 << 3),
+};
+
+struct EmojiTableEntry {
+    // i.e. 1F468-200D-2695-FE0F
+    const char *unifiedCode;
+    // nullptr if the emoji has no non-qualified form
+    const char *nonQualifiedCode;
+
+    // range in emojiTableCodepoints making up the emojis value
+    uint16_t valueOffset;
+    uint8_t valueLength;
+
+    // combination of EmojiCapability flags
+    uint8_t capabilities;
+
+    // range in emojiTableShortCodes
+    uint16_t shortCodesOffset;
+    uint8_t shortCodesCount;
+};
+
+extern const char32_t emojiTableCodepoints[];
+extern const char *const emojiTableShortCodes[];
+extern const EmojiTableEntry emojiTable[];
+extern const size_t emojiTableSize;
+
+}  // namespace chatterino
@@ -51,6 +51,20 @@ Args::Args(const QApplication &app)
         "specify platform. Only twitch channels are supported at the moment.\n"
         "If platform isn't specified, default is Twitch.",
         "t:channel1;t:channel2;..."));
+    parser.addOption(QCommandLineOption(
+        "replay",
+        "Replays a capture of IRC and PubSub traffic without connecting to "
+        "Twitch, then prints a performance report.",
+        "file"));
+    parser.addOption(QCommandLineOption(
+        "replay-realtime",
+        "Replays the capture with its original timing instead of as fast as "
+        "possible."));
+    parser.addOption(QCommandLineOption(
+        "trace",
+        "Records where time is spent and writes it to the file on exit. The "
+        "file can be opened in chrome://tracing or ui.perfetto.dev.",
+        "file"));
 
     if (!parser.parse(app.arguments()))
     {
@@ -88,6 +102,19 @@ Args::Args(const QApplication &app)
 
         this->parentWindowId = parser.value(parentWindowIdOption).toULongLong();
     }
+
+    if (parser.isSet("trace"))
+    {
+        this->traceFile = parser.value("trace");
+    }
+
+    if (parser.isSet("replay"))
+    {
+        this->replayFile = parser.value("replay");
+        this->replayRealtime = parser.isSet("replay-realtime");
+        this->dontSaveSettings = true;
+        this->dontLoadMainWindow = true;
+    }
 }
 
 void Args::applyCustomChannelLayout(const QString &argValue)
@@ -18,6 +18,14 @@ public:
     // Shows a single chat. Used on windows to embed in another application.
     bool isFramelessEmbed{};
     boost::optional<unsigned long long> parentWindowId{};
+    // Replays a capture without connecting to Twitch and prints a
+    // performance report.
+    boost::optional<QString> replayFile{};
+    // Keeps the timing of the capture instead of replaying at full speed
+    bool replayRealtime{};
+    // Records trace spans from the start and writes them to this file on
+    // exit
+    boost::optional<QString> traceFile{};
 
     // Not settings directly
     bool dontSaveSettings{};
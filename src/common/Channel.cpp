@@ -1,6 +1,7 @@
 #include "common/Channel.hpp"
 
 #include "Application.hpp"
+#include "messages/MemoryUsage.hpp"
 #include "messages/Message.hpp"
 #include "messages/MessageBuilder.hpp"
 #include "providers/twitch/IrcMessageHandler.hpp"
@@ -17,7 +18,48 @@
 #include <QNetworkReply>
 #include <QNetworkRequest>
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
 namespace chatterino {
+namespace {
+
+    // channels keep at least this many messages, even if they're over their
+    // memory budget
+    constexpr size_t MIN_MESSAGES_IN_BUDGET = 50;
+    // part of the total budget that's split evenly, the rest is split by
+    // activity, so quiet channels still keep some scrollback
+    constexpr double EVEN_BUDGET_SHARE = 0.5;
+
+    // false while scrollbackMemoryBudget is 0, the messages aren't counted
+    // then
+    std::atomic<bool> budgetsEnabled{false};
+
+    // channels that count the memory of their messages
+    struct BudgetRegistry {
+        std::mutex mutex;
+        std::vector<std::weak_ptr<Channel>> channels;
+    };
+
+    BudgetRegistry &budgetRegistry()
+    {
+        static BudgetRegistry instance;
+        return instance;
+    }
+
+    int64_t estimateMemory(const Message &message)
+    {
+        MemoryUsage usage;
+        // images are shared between channels, they don't count towards the
+        // budget
+        usage.countImages = false;
+        message.addMemoryUsage(usage);
+
+        return usage.messages + usage.elements;
+    }
+
+}  // namespace
 
 //
 // Channel
@@ -75,12 +117,182 @@ LimitedQueueSnapshot<MessagePtr> Channel::getMessageSnapshot()
     return this->messages_.getSnapshot();
 }
 
+MemoryUsage Channel::getMemoryUsage()
+{
+    MemoryUsage usage;
+
+    auto snapshot = this->getMessageSnapshot();
+    for (size_t i = 0; i < snapshot.size(); i++)
+    {
+        snapshot[i]->addMemoryUsage(usage);
+    }
+
+    return usage;
+}
+
+int64_t Channel::getMessagesMemory() const
+{
+    return this->messagesMemory_;
+}
+
+void Channel::setMemoryBudget(int64_t bytes)
+{
+    this->memoryBudget_ = bytes;
+    this->trimToMemoryBudget();
+}
+
+void Channel::updateMemoryBudgets(int64_t totalBytes)
+{
+    budgetsEnabled = totalBytes > 0;
+
+    std::vector<ChannelPtr> channels;
+    {
+        auto &registry = budgetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        auto &weak = registry.channels;
+        weak.erase(std::remove_if(weak.begin(), weak.end(),
+                                  [&](const std::weak_ptr<Channel> &channel) {
+                                      auto shared = channel.lock();
+                                      if (shared)
+                                      {
+                                          channels.push_back(shared);
+                                      }
+                                      return !shared;
+                                  }),
+                   weak.end());
+    }
+
+    if (totalBytes <= 0)
+    {
+        // the counts would go stale, they're counted again once a budget
+        // is set
+        {
+            auto &registry = budgetRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            registry.channels.clear();
+        }
+
+        for (auto &&channel : channels)
+        {
+            channel->setMemoryBudget(0);
+            channel->hasMemoryBudget_ = false;
+            channel->messagesMemory_ = 0;
+            channel->addedMemory_ = 0;
+            channel->memoryActivity_ = 0;
+        }
+        return;
+    }
+
+    if (channels.empty())
+    {
+        return;
+    }
+
+    double totalActivity = 0;
+    for (auto &&channel : channels)
+    {
+        channel->memoryActivity_ =
+            channel->memoryActivity_ / 2 + double(channel->addedMemory_);
+        channel->addedMemory_ = 0;
+        totalActivity += channel->memoryActivity_;
+    }
+
+    auto count = double(channels.size());
+    for (auto &&channel : channels)
+    {
+        auto activityShare = totalActivity > 0
+                                 ? channel->memoryActivity_ / totalActivity
+                                 : 1 / count;
+        auto share = EVEN_BUDGET_SHARE / count +
+                     (1 - EVEN_BUDGET_SHARE) * activityShare;
+
+        channel->setMemoryBudget(int64_t(double(totalBytes) * share));
+    }
+}
+
+void Channel::startCountingMemory()
+{
+    if (this->hasMemoryBudget_ || !budgetsEnabled)
+    {
+        return;
+    }
+
+    // not owned by a shared_ptr if this is empty
+    auto weak = this->weak_from_this();
+    if (weak.expired())
+    {
+        return;
+    }
+
+    // the messages from before the budget was set are counted once, later
+    // changes update the count
+    this->messagesMemory_ = 0;
+    auto snapshot = this->getMessageSnapshot();
+    for (size_t i = 0; i < snapshot.size(); i++)
+    {
+        this->messagesMemory_ += estimateMemory(*snapshot[i]);
+    }
+
+    {
+        auto &registry = budgetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.channels.push_back(std::move(weak));
+    }
+    this->hasMemoryBudget_ = true;
+}
+
+void Channel::addMessagesMemory(const MessagePtr &message)
+{
+    if (!this->hasMemoryBudget_)
+    {
+        return;
+    }
+
+    auto bytes = estimateMemory(*message);
+    this->messagesMemory_ += bytes;
+    this->addedMemory_ += bytes;
+}
+
+void Channel::removeMessagesMemory(const MessagePtr &message)
+{
+    if (!this->hasMemoryBudget_)
+    {
+        return;
+    }
+
+    // elements can change a little after they were added (e.g. the
+    // timestamp format), so the estimate might be off by a few bytes
+    this->messagesMemory_ =
+        std::max<int64_t>(0, this->messagesMemory_ - estimateMemory(*message));
+}
+
+void Channel::trimToMemoryBudget()
+{
+    if (this->memoryBudget_ <= 0)
+    {
+        return;
+    }
+
+    MessagePtr deleted;
+    while (this->messagesMemory_ > this->memoryBudget_ &&
+           this->messages_.getSnapshot().size() > MIN_MESSAGES_IN_BUDGET &&
+           this->messages_.popFront(deleted))
+    {
+        this->removeMessagesMemory(deleted);
+        this->userMessages_.removeFirst(deleted);
+        this->messageRemovedFromStart.invoke(deleted);
+    }
+}
+
 void Channel::addMessage(MessagePtr message,
                          boost::optional<MessageFlags> overridingFlags)
 {
     auto app = getApp();
     MessagePtr deleted;
 
+    this->startCountingMemory();
+
     // FOURTF: change this when adding more providers
     if (this->isTwitchChannel() &&
         (!overridingFlags || !overridingFlags->has(MessageFlag::DoNotLog)))
@@ -90,10 +302,16 @@ void Channel::addMessage(MessagePtr message,
 
     if (this->messages_.pushBack(message, deleted))
     {
+        this->removeMessagesMemory(deleted);
+        this->userMessages_.removeFirst(deleted);
         this->messageRemovedFromStart.invoke(deleted);
     }
+    this->userMessages_.append(message);
+    this->addMessagesMemory(message);
 
     this->messageAppended.invoke(message, overridingFlags);
+
+    this->trimToMemoryBudget();
 }
 
 void Channel::addOrReplaceTimeout(MessagePtr message)
@@ -169,9 +387,9 @@ void Channel::addOrReplaceTimeout(MessagePtr message)
     }
 
     // disable the messages from the user
-    for (int i = 0; i < snapshotLength; i++)
+    std::vector<MessagePtr> disabled;
+    for (auto &s : this->findUserMessages(message->timeoutUser))
     {
-        auto &s = snapshot[i];
         if (s->loginName == message->timeoutUser &&
             s->flags.hasNone({MessageFlag::Timeout, MessageFlag::Untimeout,
                               MessageFlag::Whisper}))
@@ -179,22 +397,26 @@ void Channel::addOrReplaceTimeout(MessagePtr message)
             // FOURTF: disabled for now
             // PAJLADA: Shitty solution described in Message.hpp
             s->flags.set(MessageFlag::Disabled);
+            disabled.push_back(s);
         }
     }
 
+    if (!disabled.empty())
+    {
+        getApp()->windows->layoutMessages(disabled);
+    }
+
     if (addMessage)
     {
         this->addMessage(message);
     }
-
-    // XXX: Might need the following line
-    // WindowManager::instance().repaintVisibleChatWidgets(this);
 }
 
 void Channel::disableAllMessages()
 {
     LimitedQueueSnapshot<MessagePtr> snapshot = this->getMessageSnapshot();
     int snapshotLength = snapshot.size();
+    std::vector<MessagePtr> disabled;
     for (int i = 0; i < snapshotLength; i++)
     {
         auto &message = snapshot[i];
@@ -206,34 +428,64 @@ void Channel::disableAllMessages()
 
         // FOURTF: disabled for now
         const_cast<Message *>(message.get())->flags.set(MessageFlag::Disabled);
+        disabled.push_back(message);
+    }
+
+    if (!disabled.empty())
+    {
+        getApp()->windows->layoutMessages(disabled);
     }
 }
 
 void Channel::addMessagesAtStart(std::vector<MessagePtr> &_messages)
 {
+    this->startCountingMemory();
+
     std::vector<MessagePtr> addedMessages =
         this->messages_.pushFront(_messages);
 
     if (addedMessages.size() != 0)
     {
+        for (auto &&message : addedMessages)
+        {
+            this->addMessagesMemory(message);
+        }
+        this->userMessages_.prepend(addedMessages);
         this->messagesAddedAtStart.invoke(addedMessages);
     }
 }
 
 void Channel::replaceMessage(MessagePtr message, MessagePtr replacement)
 {
+    this->startCountingMemory();
+
     int index = this->messages_.replaceItem(message, replacement);
 
     if (index >= 0)
     {
+        this->removeMessagesMemory(message);
+        this->addMessagesMemory(replacement);
+        this->userMessages_.replace(size_t(index), message, replacement);
         this->messageReplaced.invoke((size_t)index, replacement);
     }
 }
 
 void Channel::replaceMessage(size_t index, MessagePtr replacement)
 {
+    auto snapshot = this->getMessageSnapshot();
+    if (index >= snapshot.size())
+    {
+        return;
+    }
+    auto message = snapshot[index];
+
+    this->startCountingMemory();
+
     if (this->messages_.replaceItem(index, replacement))
     {
+        this->removeMessagesMemory(message);
+        this->addMessagesMemory(replacement);
+        this->userMessages_.replace(index, message, replacement);
         this->messageReplaced.invoke(index, replacement);
     }
 }
@@ -265,6 +517,12 @@ MessagePtr Channel::findMessage(QString messageID)
     return nullptr;
 }
 
+std::vector<MessagePtr> Channel::findUserMessages(
+    const QString &loginName) const
+{
+    return this->userMessages_.find(loginName);
+}
+
 bool Channel::canSendMessage() const
 {
     return false;
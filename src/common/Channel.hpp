@@ -3,6 +3,7 @@
 #include "common/CompletionModel.hpp"
 #include "common/FlagsEnum.hpp"
 #include "messages/LimitedQueue.hpp"
+#include "messages/UserMessageIndex.hpp"
 
 #include <QDate>
 #include <QString>
@@ -16,6 +17,7 @@ namespace chatterino {
 
 struct Message;
 using MessagePtr = std::shared_ptr<const Message>;
+struct MemoryUsage;
 enum class MessageFlag : uint32_t;
 using MessageFlags = FlagsEnum<MessageFlag>;
 
@@ -64,6 +66,21 @@ public:
     bool isTwitchChannel() const;
     virtual bool isEmpty() const;
     LimitedQueueSnapshot<MessagePtr> getMessageSnapshot();
+    // Estimated memory used by the messages and the images they reference.
+    // Has to be called from the GUI thread.
+    MemoryUsage getMemoryUsage();
+    // Estimated bytes used by the messages without their images, kept up to
+    // date while messages are added and removed. Only counted while the
+    // budgets are on.
+    int64_t getMessagesMemory() const;
+    // Old messages are removed once the messages use more than bytes, 0 only
+    // keeps the limit on the number of messages
+    void setMemoryBudget(int64_t bytes);
+
+    // Splits totalBytes between the channels that have messages, the more
+    // messages a channel got recently the bigger its share. 0 turns the
+    // budgets off.
+    static void updateMemoryBudgets(int64_t totalBytes);
 
     // MESSAGES
     // overridingFlags can be filled in with flags that should be used instead
@@ -79,6 +96,8 @@ public:
     void replaceMessage(size_t index, MessagePtr replacement);
     void deleteMessage(QString messageID);
     MessagePtr findMessage(QString messageID);
+    // returns the messages from and about the user, oldest first
+    std::vector<MessagePtr> findUserMessages(const QString &loginName) const;
 
     bool hasMessages() const;
 
@@ -105,10 +124,27 @@ protected:
     virtual void onConnected();
 
 private:
+    // Counts the messages that are already there once the budgets are on
+    void startCountingMemory();
+    void addMessagesMemory(const MessagePtr &message);
+    void removeMessagesMemory(const MessagePtr &message);
+    void trimToMemoryBudget();
+
     const QString name_;
     LimitedQueue<MessagePtr> messages_;
+    UserMessageIndex userMessages_;
     Type type_;
     QTimer clearCompletionModelTimer_;
+
+    // see getMessagesMemory
+    int64_t messagesMemory_ = 0;
+    int64_t memoryBudget_ = 0;
+    // bytes of the messages added since the budgets were last updated
+    int64_t addedMemory_ = 0;
+    // decaying sum of addedMemory_, decides the share of the budget
+    double memoryActivity_ = 0;
+    // the channel is registered for a budget and counts its messages
+    bool hasMemoryBudget_ = false;
 };
 
 using ChannelPtr = std::shared_ptr<Channel>;
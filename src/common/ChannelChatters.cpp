@@ -67,11 +67,22 @@ void ChannelChatters::addPartedUser(const QString &user)
     }
 }
 
-void ChannelChatters::updateOnlineChatters(
-    const std::unordered_set<QString> &chatters)
+void ChannelChatters::updateOnlineChatters(std::vector<QString> chatters)
 {
+    ChatterDiff diff;
+    {
+        auto onlineChatters = this->onlineChatters_.access();
+        diff = ChatterDiff::between(*onlineChatters, chatters);
+        *onlineChatters = std::move(chatters);
+    }
+
+    if (diff.joined.empty() && diff.parted.empty())
+    {
+        return;
+    }
+
     auto chatters_ = this->chatters_.access();
-    chatters_->updateOnlineChatters(chatters);
+    chatters_->updateOnlineChatters(diff);
 }
 
 const QColor ChannelChatters::getUserColor(const QString &user)
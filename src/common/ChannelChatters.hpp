@@ -23,7 +23,9 @@ public:
     void addPartedUser(const QString &user);
     const QColor getUserColor(const QString &user);
     void setUserColor(const QString &user, const QColor &color);
-    void updateOnlineChatters(const std::unordered_set<QString> &chatters);
+    // chatters has to be sorted and in lower case. Only the difference to
+    // the previous list is applied to the chatter set.
+    void updateOnlineChatters(std::vector<QString> chatters);
 
 private:
     static constexpr int maxChatterColorCount = 5000;
@@ -32,6 +34,8 @@ private:
 
     // maps 2 char prefix to set of names
     UniqueAccess<ChatterSet> chatters_;
+    // the last list passed to updateOnlineChatters
+    UniqueAccess<std::vector<QString>> onlineChatters_;
     UniqueAccess<cache::lru_cache<QString, QRgb>> chatterColors_;
 
     // combines multiple joins/parts into one message
@@ -1,10 +1,36 @@
 #include "common/ChatterSet.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <tuple>
 #include "debug/Benchmark.hpp"
 
 namespace chatterino {
 
+ChatterDiff ChatterDiff::between(const std::vector<QString> &before,
+                                 const std::vector<QString> &after)
+{
+    ChatterDiff diff;
+
+    // Joined chatters weren't added while there were too many, so everyone
+    // online joins once the list is below the limit again.
+    if (before.size() >= ChatterSet::chatterLimit &&
+        after.size() < ChatterSet::chatterLimit)
+    {
+        diff.joined = after;
+    }
+    else
+    {
+        std::set_difference(after.begin(), after.end(), before.begin(),
+                            before.end(), std::back_inserter(diff.joined));
+    }
+    std::set_difference(before.begin(), before.end(), after.begin(),
+                        after.end(), std::back_inserter(diff.parted));
+    diff.onlineCount = after.size();
+
+    return diff;
+}
+
 ChatterSet::ChatterSet()
     : items(chatterLimit)
 {
@@ -15,25 +41,25 @@ void ChatterSet::addRecentChatter(const QString &userName)
     this->items.put(userName.toLower(), userName);
 }
 
-void ChatterSet::updateOnlineChatters(
-    const std::unordered_set<QString> &lowerCaseUsernames)
+void ChatterSet::updateOnlineChatters(const ChatterDiff &diff)
 {
     BenchmarkGuard bench("update online chatters");
 
-    // Create a new lru cache without the users that are not present anymore.
-    cache::lru_cache<QString, QString> tmp(chatterLimit);
-
-    for (auto &&chatter : lowerCaseUsernames)
+    for (auto &&chatter : diff.parted)
     {
-        if (this->items.exists(chatter))
-            tmp.put(chatter, this->items.get(chatter));
-
-        // Less chatters than the limit => try to preserve as many as possible.
-        else if (lowerCaseUsernames.size() < chatterLimit)
-            tmp.put(chatter, chatter);
+        this->items.erase(chatter);
     }
 
-    this->items = std::move(tmp);
+    // Less chatters than the limit => try to preserve as many as possible.
+    if (diff.onlineCount < chatterLimit)
+    {
+        for (auto &&chatter : diff.joined)
+        {
+            // keep the casing of users that already chatted
+            if (!this->items.exists(chatter))
+                this->items.put(chatter, chatter);
+        }
+    }
 }
 
 bool ChatterSet::contains(const QString &userName) const
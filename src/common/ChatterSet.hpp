@@ -5,11 +5,25 @@
 #include <set>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 #include "lrucache/lrucache.hpp"
 #include "util/QStringHash.hpp"
 
 namespace chatterino {
 
+/// Users that joined and parted between two chatter lists.
+struct ChatterDiff {
+    std::vector<QString> joined;
+    std::vector<QString> parted;
+    /// Number of chatters in the newer list.
+    size_t onlineCount = 0;
+
+    /// Compares two sorted lists of lower case user names. All chatters of
+    /// the newer list joined if the older one was at the chatter limit.
+    static ChatterDiff between(const std::vector<QString> &before,
+                               const std::vector<QString> &after);
+};
+
 /// ChatterSet is a limited container that contains a list of recent chatters
 /// that can be referenced by name.
 class ChatterSet
@@ -24,10 +38,9 @@ public:
     /// if the casing hasn't changed.
     void addRecentChatter(const QString &userName);
 
-    /// Removes chatters that aren't online anymore. Adds chatters that aren't
-    /// in the list yet.
-    void updateOnlineChatters(
-        const std::unordered_set<QString> &lowerCaseUsernames);
+    /// Removes chatters that parted. Adds chatters that joined if all online
+    /// chatters fit into the set.
+    void updateOnlineChatters(const ChatterDiff &diff);
 
     /// Checks if a username is in the list.
     bool contains(const QString &userName) const;
@@ -2,6 +2,8 @@
 
 #include <QVariant>
 
+#include <algorithm>
+
 namespace chatterino {
 
 namespace {
@@ -33,6 +35,22 @@ namespace {
         return defaultValue;
     }
 
+    int readIntEnv(const char *envName, int defaultValue)
+    {
+        auto envString = std::getenv(envName);
+        if (envString != nullptr)
+        {
+            bool ok;
+            auto val = QString(envString).toInt(&ok);
+            if (ok)
+            {
+                return val;
+            }
+        }
+
+        return defaultValue;
+    }
+
     uint16_t readBoolEnv(const char *envName, bool defaultValue)
     {
         auto envString = std::getenv(envName);
@@ -61,6 +79,11 @@ Env::Env()
           readStringEnv("CHATTERINO2_TWITCH_SERVER_HOST", "irc.chat.twitch.tv"))
     , twitchServerPort(readPortEnv("CHATTERINO2_TWITCH_SERVER_PORT", 443))
     , twitchServerSecure(readBoolEnv("CHATTERINO2_TWITCH_SERVER_SECURE", true))
+    , twitchPubsubUrl(readStringEnv("CHATTERINO2_TWITCH_PUBSUB_URL",
+                                    "wss://pubsub-edge.twitch.tv"))
+    , statsFile(readStringEnv("CHATTERINO2_STATS_FILE", ""))
+    , networkThreads(
+          std::max(1, readIntEnv("CHATTERINO2_NETWORK_THREADS", 1)))
 {
 }
 
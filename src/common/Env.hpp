@@ -17,6 +17,11 @@ public:
     const QString twitchServerHost;
     const uint16_t twitchServerPort;
     const bool twitchServerSecure;
+    const QString twitchPubsubUrl;
+    // If set, the debug counters are written to this file every second
+    const QString statsFile;
+    // Number of threads the network requests are spread over
+    const int networkThreads;
 };
 
 }  // namespace chatterino
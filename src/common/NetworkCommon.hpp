@@ -25,6 +25,17 @@ enum class NetworkRequestType {
     Patch,
 };
 
+// Requests of a more urgent class always start before requests of a less
+// urgent class that are waiting for the same host
+enum class NetworkRequestPriority {
+    // the user is waiting for the result, e.g. user cards or link tooltips
+    Interactive,
+    // api data like emotes, badges and stream status
+    Metadata,
+    // there are lots of these when a channel is opened
+    Image,
+};
+
 // parseHeaderList takes a list of headers in string form,
 // where each header pair is separated by semicolons (;) and the header name and value is divided by a colon (:)
 //
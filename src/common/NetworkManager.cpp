@@ -1,8 +1,203 @@
 #include "common/NetworkManager.hpp"
 
+#include "common/Env.hpp"
+#include "common/NetworkPrivate.hpp"
+#include "util/DebugCount.hpp"
+#include "util/PostToThread.hpp"
+#include "util/QStringHash.hpp"
+
+#include <QElapsedTimer>
 #include <QNetworkAccessManager>
+#include <QNetworkReply>
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace chatterino {
+namespace {
+    // Same as the connection limit of QNetworkAccessManager. Requests above
+    // it would wait inside of it, where they can't be reordered anymore.
+    constexpr int MAX_REQUESTS_PER_HOST = 6;
+    // per worker thread
+    constexpr int MAX_RUNNING_REQUESTS = 24;
+    // images can't use the last slots, so other requests don't have to wait
+    // for images to finish
+    constexpr int RESERVED_REQUESTS = 4;
+    constexpr int PRIORITY_COUNT = 3;
+
+    std::atomic<bool> offline{false};
+
+    using StartFunction =
+        std::function<QNetworkReply *(QNetworkAccessManager &)>;
+
+    struct Job {
+        std::shared_ptr<NetworkData> data;
+        StartFunction start;
+        std::function<void()> cancelled;
+        QElapsedTimer waiting;
+    };
+
+    struct Host {
+        int running = 0;
+        // one queue per priority
+        std::deque<Job> queues[PRIORITY_COUNT];
+    };
+
+    struct Worker {
+        QThread *thread;
+        QNetworkAccessManager *manager;
+        // the jobs are posted to this, it lives on the thread
+        QObject *context;
+        int running = 0;
+    };
+
+    struct Scheduler {
+        std::mutex mutex;
+        std::vector<Worker> workers;
+        std::unordered_map<QString, Host> hosts;
+        int running = 0;
+        NetworkQueueStats stats[PRIORITY_COUNT];
+    };
+
+    Scheduler &scheduler()
+    {
+        static Scheduler instance;
+        return instance;
+    }
+
+    const char *priorityName(int priority)
+    {
+        switch (NetworkRequestPriority(priority))
+        {
+            case NetworkRequestPriority::Interactive:
+                return "interactive";
+            case NetworkRequestPriority::Metadata:
+                return "metadata";
+            case NetworkRequestPriority::Image:
+                return "image";
+        }
+        return "";
+    }
+
+    void updateDebugCounts(const Scheduler &s, int priority)
+    {
+        auto &stats = s.stats[priority];
+        auto name = QString(priorityName(priority));
+
+        DebugCount::set("network queued " + name, stats.queued);
+        DebugCount::set("network running " + name, stats.running);
+        DebugCount::set("network cancelled " + name, stats.cancelled);
+        DebugCount::set(
+            "network avg wait ms " + name,
+            stats.started == 0 ? 0 : stats.totalWaitMs / stats.started);
+        DebugCount::set("network max wait ms " + name, stats.maxWaitMs);
+    }
+
+    void finished(const QString &host, size_t worker, int priority);
+
+    // Starts as many of the waiting jobs as the limits allow, has to be
+    // called with the mutex locked
+    void dispatch(Scheduler &s)
+    {
+        auto maxRunning = MAX_RUNNING_REQUESTS * int(s.workers.size());
+
+        for (int priority = 0; priority < PRIORITY_COUNT; priority++)
+        {
+            auto limit = maxRunning;
+            if (NetworkRequestPriority(priority) ==
+                NetworkRequestPriority::Image)
+            {
+                limit -= RESERVED_REQUESTS;
+            }
+
+            auto &stats = s.stats[priority];
+
+            for (auto &&[name, host] : s.hosts)
+            {
+                auto &queue = host.queues[priority];
+
+                while (!queue.empty() && s.running < limit &&
+                       host.running < MAX_REQUESTS_PER_HOST)
+                {
+                    auto job = std::move(queue.front());
+                    queue.pop_front();
+                    stats.queued--;
+
+                    if (job.data->hasCaller_ && !job.data->caller_.get())
+                    {
+                        // nobody would get the result
+                        stats.cancelled++;
+                        if (job.cancelled)
+                        {
+                            postToThread(std::move(job.cancelled),
+                                         s.workers.front().context);
+                        }
+                        continue;
+                    }
+
+                    auto worker = size_t(
+                        std::min_element(s.workers.begin(), s.workers.end(),
+                                         [](auto &&a, auto &&b) {
+                                             return a.running < b.running;
+                                         }) -
+                        s.workers.begin());
+
+                    s.running++;
+                    host.running++;
+                    s.workers[worker].running++;
+
+                    int64_t waited = job.waiting.elapsed();
+                    stats.running++;
+                    stats.started++;
+                    stats.totalWaitMs += waited;
+                    stats.maxWaitMs = std::max(stats.maxWaitMs, waited);
+
+                    auto &manager = *s.workers[worker].manager;
+                    postToThread(
+                        [start = std::move(job.start), &manager,
+                         hostName = name, worker, priority] {
+                            auto reply = start(manager);
+                            if (reply == nullptr)
+                            {
+                                finished(hostName, worker, priority);
+                                return;
+                            }
+
+                            QObject::connect(
+                                reply, &QNetworkReply::finished, [=] {
+                                    finished(hostName, worker, priority);
+                                });
+                        },
+                        s.workers[worker].context);
+                }
+            }
+
+            updateDebugCounts(s, priority);
+        }
+    }
+
+    void finished(const QString &host, size_t worker, int priority)
+    {
+        auto &s = scheduler();
+        std::lock_guard<std::mutex> lock(s.mutex);
+
+        s.running--;
+        s.hosts[host].running--;
+        s.stats[priority].running--;
+        // the workers are gone after deinit
+        if (worker < s.workers.size())
+        {
+            s.workers[worker].running--;
+        }
+
+        dispatch(s);
+    }
+
+}  // namespace
 
 QThread NetworkManager::workerThread;
 QNetworkAccessManager NetworkManager::accessManager;
@@ -11,12 +206,88 @@ void NetworkManager::init()
 {
     NetworkManager::accessManager.moveToThread(&NetworkManager::workerThread);
     NetworkManager::workerThread.start();
+
+    auto &s = scheduler();
+    std::lock_guard<std::mutex> lock(s.mutex);
+
+    auto context = new QObject;
+    context->moveToThread(&NetworkManager::workerThread);
+    s.workers.push_back({&NetworkManager::workerThread,
+                         &NetworkManager::accessManager, context});
+
+    for (int i = 1; i < Env::get().networkThreads; i++)
+    {
+        auto thread = new QThread;
+        auto manager = new QNetworkAccessManager;
+        context = new QObject;
+
+        manager->moveToThread(thread);
+        context->moveToThread(thread);
+        thread->start();
+
+        s.workers.push_back({thread, manager, context});
+    }
+
+    // requests might have been scheduled before
+    dispatch(s);
 }
 
 void NetworkManager::deinit()
 {
-    NetworkManager::workerThread.quit();
-    NetworkManager::workerThread.wait();
+    auto &s = scheduler();
+
+    std::vector<Worker> workers;
+    {
+        std::lock_guard<std::mutex> lock(s.mutex);
+        workers = std::move(s.workers);
+        s.workers.clear();
+    }
+
+    // The threads might still be finishing requests, which needs the lock.
+    // The workers are not deleted, since that would run the requests that
+    // were posted to them.
+    for (auto &&worker : workers)
+    {
+        worker.thread->quit();
+        worker.thread->wait();
+    }
+}
+
+void NetworkManager::schedule(
+    std::shared_ptr<NetworkData> data,
+    std::function<QNetworkReply *(QNetworkAccessManager &)> start,
+    std::function<void()> cancelled)
+{
+    auto &s = scheduler();
+    std::lock_guard<std::mutex> lock(s.mutex);
+
+    auto priority = int(data->priority_);
+    auto &host = s.hosts[data->request_.url().host()];
+
+    Job job{std::move(data), std::move(start), std::move(cancelled), {}};
+    job.waiting.start();
+    host.queues[priority].push_back(std::move(job));
+    s.stats[priority].queued++;
+
+    dispatch(s);
+}
+
+NetworkQueueStats NetworkManager::stats(NetworkRequestPriority priority)
+{
+    auto &s = scheduler();
+    std::lock_guard<std::mutex> lock(s.mutex);
+
+    return s.stats[int(priority)];
+}
+
+void NetworkManager::setOffline(bool value)
+{
+    offline = value;
+}
+
+bool NetworkManager::isOffline()
+{
+    return offline;
 }
 
 }  // namespace chatterino
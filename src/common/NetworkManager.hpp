@@ -1,20 +1,61 @@
 #pragma once
 
+#include "common/NetworkCommon.hpp"
+
 #include <QNetworkAccessManager>
 #include <QThread>
 
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+class QNetworkReply;
+
 namespace chatterino {
 
+struct NetworkData;
+
+struct NetworkQueueStats {
+    // waiting for a free slot
+    int64_t queued = 0;
+    int64_t running = 0;
+    int64_t started = 0;
+    // dropped before they started because their caller was destroyed
+    int64_t cancelled = 0;
+    // time the started requests spent in the queue
+    int64_t totalWaitMs = 0;
+    int64_t maxWaitMs = 0;
+};
+
 class NetworkManager : public QObject
 {
     Q_OBJECT
 
 public:
+    // The first worker. CHATTERINO2_NETWORK_THREADS starts more workers, each
+    // with its own access manager.
     static QThread workerThread;
     static QNetworkAccessManager accessManager;
 
     static void init();
     static void deinit();
+
+    // Calls start on a worker thread, with the access manager of that thread,
+    // once no more urgent request is waiting for the host and there is a free
+    // slot. The request counts as running until the returned reply finished.
+    // If the caller of the request is gone by then, cancelled is called on a
+    // worker thread instead.
+    static void schedule(
+        std::shared_ptr<NetworkData> data,
+        std::function<QNetworkReply *(QNetworkAccessManager &)> start,
+        std::function<void()> cancelled = nullptr);
+
+    static NetworkQueueStats stats(NetworkRequestPriority priority);
+
+    // While offline, nothing is sent: requests are answered from the cache
+    // if possible and fail otherwise
+    static void setOffline(bool offline);
+    static bool isOffline();
 };
 
 }  // namespace chatterino
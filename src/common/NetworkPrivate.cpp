@@ -4,9 +4,11 @@
 #include "common/NetworkResult.hpp"
 #include "common/Outcome.hpp"
 #include "debug/AssertInGuiThread.hpp"
+#include "debug/Trace.hpp"
 #include "singletons/Paths.hpp"
 #include "util/DebugCount.hpp"
 #include "util/PostToThread.hpp"
+#include "util/QStringHash.hpp"
 
 #include <QCryptographicHash>
 #include <QFile>
@@ -14,6 +16,10 @@
 #include <QtConcurrent>
 #include "common/QLogging.hpp"
 
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 namespace chatterino {
 
 NetworkData::NetworkData()
@@ -55,18 +61,187 @@ QString NetworkData::getHash()
     return this->hash_;
 }
 
+namespace {
+
+    QString cachePath(const std::shared_ptr<NetworkData> &data)
+    {
+        return getPaths()->cacheDirectory() + "/" + data->getHash();
+    }
+
+    // The validators of a cached response are stored next to it as the
+    // headers to send when revalidating it
+    QString validatorsPath(const std::shared_ptr<NetworkData> &data)
+    {
+        return cachePath(data) + ".validators";
+    }
+
+    QByteArray getValidators(const QNetworkReply *reply)
+    {
+        QByteArray validators;
+
+        if (reply->hasRawHeader("ETag"))
+        {
+            validators += "If-None-Match: " + reply->rawHeader("ETag") + "\n";
+        }
+        if (reply->hasRawHeader("Last-Modified"))
+        {
+            validators += "If-Modified-Since: " +
+                          reply->rawHeader("Last-Modified") + "\n";
+        }
+
+        return validators;
+    }
+
+    // Adds the stored validators to the request, returns false if there are
+    // none
+    bool addValidators(const std::shared_ptr<NetworkData> &data)
+    {
+        QFile file(validatorsPath(data));
+        if (!file.open(QIODevice::ReadOnly))
+        {
+            return false;
+        }
+
+        bool added = false;
+        for (auto &&line : file.readAll().split('\n'))
+        {
+            auto separator = line.indexOf(": ");
+            if (separator > 0)
+            {
+                data->request_.setRawHeader(line.left(separator),
+                                            line.mid(separator + 2));
+                added = true;
+            }
+        }
+
+        return added;
+    }
+
+    // Identical GET requests that are in flight share one reply. The first
+    // request sends it, the others wait for its result as its followers.
+    struct InFlight {
+        std::mutex mutex;
+        std::unordered_map<QString, std::vector<std::shared_ptr<NetworkData>>>
+            followers;
+    };
+
+    InFlight &inFlight()
+    {
+        static InFlight instance;
+        return instance;
+    }
+
+    // Everything that can change the reply or how it's handled, the
+    // callbacks and the caller aren't part of it
+    QString coalescingKey(const NetworkData &data)
+    {
+        QString key = data.request_.url().toString();
+
+        for (auto &&header : data.request_.rawHeaderList())
+        {
+            key += QString::fromUtf8('\n' + header + ": " +
+                                     data.request_.rawHeader(header));
+        }
+
+        // cached requests write the response to the cache
+        key += QString("\n%1 %2 %3 %4 %5")
+                   .arg(int(data.executeConcurrently_))
+                   .arg(data.hasTimeout_ ? data.timeoutMS_ : -1)
+                   .arg(int(data.priority_))
+                   .arg(int(data.cache_))
+                   .arg(int(data.revalidate_));
+
+        return key;
+    }
+
+    // Returns true if an identical request is in flight, data is then
+    // notified with its result. Otherwise identical requests will wait for
+    // data.
+    bool joinInFlight(const std::shared_ptr<NetworkData> &data)
+    {
+        // the reply is needed by onReplyCreated
+        if (data->requestType_ != NetworkRequestType::Get ||
+            data->onReplyCreated_)
+        {
+            return false;
+        }
+
+        auto key = coalescingKey(*data);
+
+        auto &state = inFlight();
+        std::lock_guard<std::mutex> lock(state.mutex);
+
+        auto it = state.followers.find(key);
+        if (it != state.followers.end())
+        {
+            it->second.push_back(data);
+            return true;
+        }
+
+        state.followers[key];
+        data->coalescingKey_ = key;
+        return false;
+    }
+
+    // Returns the requests waiting for data, later identical requests are
+    // sent again
+    std::vector<std::shared_ptr<NetworkData>> takeFollowers(
+        const std::shared_ptr<NetworkData> &data)
+    {
+        auto &state = inFlight();
+        std::lock_guard<std::mutex> lock(state.mutex);
+
+        if (data->coalescingKey_.isEmpty())
+        {
+            return {};
+        }
+
+        auto it = state.followers.find(data->coalescingKey_);
+        data->coalescingKey_.clear();
+        if (it == state.followers.end())
+        {
+            return {};
+        }
+
+        auto followers = std::move(it->second);
+        state.followers.erase(it);
+        return followers;
+    }
+
+    // data and the requests waiting for it
+    std::vector<std::shared_ptr<NetworkData>> withFollowers(
+        const std::shared_ptr<NetworkData> &data)
+    {
+        auto requests = takeFollowers(data);
+        requests.insert(requests.begin(), data);
+        return requests;
+    }
+
+}  // namespace
+
 void writeToCache(const std::shared_ptr<NetworkData> &data,
-                  const QByteArray &bytes)
+                  const QByteArray &bytes, const QByteArray &validators)
 {
     if (data->cache_)
     {
-        QtConcurrent::run([data, bytes] {
-            QFile cachedFile(getPaths()->cacheDirectory() + "/" +
-                             data->getHash());
+        QtConcurrent::run([data, bytes, validators] {
+            QFile cachedFile(cachePath(data));
+
+            bool written = cachedFile.open(QIODevice::WriteOnly) &&
+                           cachedFile.write(bytes) == bytes.size();
 
-            if (cachedFile.open(QIODevice::WriteOnly))
+            if (data->revalidate_)
             {
-                cachedFile.write(bytes);
+                // stale validators would make us use the wrong response
+                QFile validatorsFile(validatorsPath(data));
+                if (!written || validators.isEmpty())
+                {
+                    validatorsFile.remove();
+                }
+                else if (validatorsFile.open(QIODevice::WriteOnly))
+                {
+                    validatorsFile.write(validators);
+                }
             }
         });
     }
@@ -74,14 +249,44 @@ void writeToCache(const std::shared_ptr<NetworkData> &data,
 
 void loadUncached(const std::shared_ptr<NetworkData> &data)
 {
-    DebugCount::increase("http request started");
+    if (NetworkManager::isOffline())
+    {
+        DebugCount::increase("http request offline");
+
+        if (data->onError_)
+        {
+            postToThread([data] {
+                if (data->hasCaller_ && !data->caller_.get())
+                {
+                    return;
+                }
 
-    NetworkRequester requester;
-    NetworkWorker *worker = new NetworkWorker;
+                data->onError_(NetworkResult({}, 0));
+            });
+        }
+
+        if (data->finally_)
+        {
+            postToThread([data] {
+                data->finally_();
+            });
+        }
+        return;
+    }
 
-    worker->moveToThread(&NetworkManager::workerThread);
+    if (joinInFlight(data))
+    {
+        // the result of the identical request is used
+        DebugCount::increase("http request coalesced");
+        return;
+    }
+
+    DebugCount::increase("http request started");
+
+    auto start = [data](QNetworkAccessManager &manager) -> QNetworkReply * {
+        // runs on the thread of the manager
+        NetworkWorker *worker = new NetworkWorker;
 
-    auto onUrlRequested = [data, worker]() mutable {
         if (data->hasTimeout_)
         {
             data->timer_ = new QTimer();
@@ -93,40 +298,37 @@ void loadUncached(const std::shared_ptr<NetworkData> &data)
             switch (data->requestType_)
             {
                 case NetworkRequestType::Get:
-                    return NetworkManager::accessManager.get(data->request_);
+                    return manager.get(data->request_);
 
                 case NetworkRequestType::Put:
-                    return NetworkManager::accessManager.put(data->request_,
-                                                             data->payload_);
+                    return manager.put(data->request_, data->payload_);
 
                 case NetworkRequestType::Delete:
-                    return NetworkManager::accessManager.deleteResource(
-                        data->request_);
+                    return manager.deleteResource(data->request_);
 
                 case NetworkRequestType::Post:
                     if (data->multiPartPayload_)
                     {
                         assert(data->payload_.isNull());
 
-                        return NetworkManager::accessManager.post(
-                            data->request_, data->multiPartPayload_);
+                        return manager.post(data->request_,
+                                            data->multiPartPayload_);
                     }
                     else
                     {
-                        return NetworkManager::accessManager.post(
-                            data->request_, data->payload_);
+                        return manager.post(data->request_, data->payload_);
                     }
                 case NetworkRequestType::Patch:
                     if (data->multiPartPayload_)
                     {
                         assert(data->payload_.isNull());
 
-                        return NetworkManager::accessManager.sendCustomRequest(
+                        return manager.sendCustomRequest(
                             data->request_, "PATCH", data->multiPartPayload_);
                     }
                     else
                     {
-                        return NetworkManager::accessManager.sendCustomRequest(
+                        return manager.sendCustomRequest(
                             data->request_, "PATCH", data->payload_);
                     }
             }
@@ -136,7 +338,8 @@ void loadUncached(const std::shared_ptr<NetworkData> &data)
         if (reply == nullptr)
         {
             qCDebug(chatterinoCommon) << "Unhandled request type";
-            return;
+            delete worker;
+            return nullptr;
         }
 
         if (data->timer_ != nullptr && data->timer_->isActive())
@@ -144,22 +347,28 @@ void loadUncached(const std::shared_ptr<NetworkData> &data)
             QObject::connect(
                 data->timer_, &QTimer::timeout, worker, [reply, data]() {
                     qCDebug(chatterinoCommon) << "Aborted!";
-                    reply->abort();
 
-                    if (data->onError_)
+                    // the waiting requests are notified before the reply is
+                    // aborted, which can finish it right away
+                    for (auto &&request : withFollowers(data))
                     {
-                        postToThread([data] {
-                            data->onError_(NetworkResult(
-                                {}, NetworkResult::timedoutStatus));
-                        });
+                        if (request->onError_)
+                        {
+                            postToThread([request] {
+                                request->onError_(NetworkResult(
+                                    {}, NetworkResult::timedoutStatus));
+                            });
+                        }
+
+                        if (request->finally_)
+                        {
+                            postToThread([request] {
+                                request->finally_();
+                            });
+                        }
                     }
 
-                    if (data->finally_)
-                    {
-                        postToThread([data] {
-                            data->finally_();
-                        });
-                    }
+                    reply->abort();
                 });
         }
 
@@ -169,73 +378,117 @@ void loadUncached(const std::shared_ptr<NetworkData> &data)
         }
 
         auto handleReply = [data, reply]() mutable {
-            if (data->hasCaller_ && !data->caller_.get())
-            {
-                return;
-            }
-
             // TODO(pajlada): A reply was received, kill the timeout timer
             if (reply->error() != QNetworkReply::NetworkError::NoError)
             {
                 if (reply->error() ==
                     QNetworkReply::NetworkError::OperationCanceledError)
                 {
-                    // Operation cancelled, most likely timed out
+                    // Operation cancelled, most likely timed out. The timeout
+                    // already notified the waiting requests, if it wasn't the
+                    // cause they have to be sent on their own.
+                    for (auto &&follower : takeFollowers(data))
+                    {
+                        loadUncached(follower);
+                    }
                     return;
                 }
 
-                if (data->onError_)
-                {
-                    auto status = reply->attribute(
-                        QNetworkRequest::HttpStatusCodeAttribute);
-                    // TODO: Should this always be run on the GUI thread?
-                    postToThread([data, code = status.toInt()] {
-                        data->onError_(NetworkResult({}, code));
-                    });
-                }
+                auto status =
+                    reply->attribute(QNetworkRequest::HttpStatusCodeAttribute);
 
-                if (data->finally_)
+                for (auto &&request : withFollowers(data))
                 {
-                    postToThread([data] {
-                        data->finally_();
-                    });
+                    if (request->hasCaller_ && !request->caller_.get())
+                    {
+                        continue;
+                    }
+
+                    if (request->onError_)
+                    {
+                        // TODO: Should this always be run on the GUI thread?
+                        postToThread([request, code = status.toInt()] {
+                            TraceSpan span("NetworkRequest::onError",
+                                           "network");
+                            span.setDetail(request->request_.url().toString());
+                            request->onError_(NetworkResult({}, code));
+                        });
+                    }
+
+                    if (request->finally_)
+                    {
+                        postToThread([request] {
+                            request->finally_();
+                        });
+                    }
                 }
                 return;
             }
 
-            QByteArray bytes = reply->readAll();
-            writeToCache(data, bytes);
-
             auto status =
                 reply->attribute(QNetworkRequest::HttpStatusCodeAttribute);
 
-            NetworkResult result(bytes, status.toInt());
+            NetworkResult result = [&] {
+                if (status.toInt() == 304 && !data->cachedBytes_.isNull())
+                {
+                    // The cached response is still up to date
+                    DebugCount::increase("http request not modified");
+                    return NetworkResult(data->cachedBytes_, 200, true);
+                }
+
+                QByteArray bytes = reply->readAll();
+                writeToCache(data, bytes, getValidators(reply));
+
+                return NetworkResult(bytes, status.toInt());
+            }();
 
             DebugCount::increase("http request success");
-            // log("starting {}", data->request_.url().toString());
-            if (data->onSuccess_)
+
+            for (auto &&request : withFollowers(data))
             {
-                if (data->executeConcurrently_)
-                    QtConcurrent::run([onSuccess = std::move(data->onSuccess_),
-                                       result = std::move(result)] {
-                        onSuccess(result);
-                    });
-                else
-                    data->onSuccess_(result);
-            }
-            // log("finished {}", data->request_.url().toString());
+                if (request->hasCaller_ && !request->caller_.get())
+                {
+                    continue;
+                }
 
-            reply->deleteLater();
+                if (request->onSuccess_)
+                {
+                    auto url = Trace::isEnabled()
+                                   ? request->request_.url().toString()
+                                   : QString();
 
-            if (data->finally_)
-            {
-                if (data->executeConcurrently_)
-                    QtConcurrent::run([finally = std::move(data->finally_)] {
-                        finally();
-                    });
-                else
-                    data->finally_();
+                    if (request->executeConcurrently_)
+                    {
+                        QtConcurrent::run(
+                            [onSuccess = std::move(request->onSuccess_),
+                             result, url] {
+                                TraceSpan span("NetworkRequest::onSuccess",
+                                               "network");
+                                span.setDetail(url);
+                                onSuccess(result);
+                            });
+                    }
+                    else
+                    {
+                        TraceSpan span("NetworkRequest::onSuccess", "network");
+                        span.setDetail(url);
+                        request->onSuccess_(result);
+                    }
+                }
+
+                if (request->finally_)
+                {
+                    if (request->executeConcurrently_)
+                        QtConcurrent::run(
+                            [finally = std::move(request->finally_)] {
+                                finally();
+                            });
+                    else
+                        request->finally_();
+                }
             }
+
+            reply->deleteLater();
         };
 
         if (data->timer_ != nullptr)
@@ -261,18 +514,25 @@ void loadUncached(const std::shared_ptr<NetworkData> &data)
                         });
                 }
             });
+
+        return reply;
     };
 
-    QObject::connect(&requester, &NetworkRequester::requestUrl, worker,
-                     onUrlRequested);
+    // the waiting requests have to be sent on their own then
+    auto cancelled = [data] {
+        for (auto &&follower : takeFollowers(data))
+        {
+            loadUncached(follower);
+        }
+    };
 
-    emit requester.requestUrl();
+    NetworkManager::schedule(data, std::move(start), std::move(cancelled));
 }
 
 // First tried to load cached, then uncached.
 void loadCached(const std::shared_ptr<NetworkData> &data)
 {
-    QFile cachedFile(getPaths()->cacheDirectory() + "/" + data->getHash());
+    QFile cachedFile(cachePath(data));
 
     if (!cachedFile.exists() || !cachedFile.open(QIODevice::ReadOnly))
     {
@@ -280,11 +540,22 @@ void loadCached(const std::shared_ptr<NetworkData> &data)
         loadUncached(data);
         return;
     }
+    else if (data->revalidate_ && !NetworkManager::isOffline())
+    {
+        // Ask the server if the cached response is still up to date, without
+        // validators that has to be a full download
+        if (addValidators(data))
+        {
+            data->cachedBytes_ = cachedFile.readAll();
+        }
+        loadUncached(data);
+        return;
+    }
     else
     {
         // XXX: check if bytes is empty?
         QByteArray bytes = cachedFile.readAll();
-        NetworkResult result(bytes, 200);
+        NetworkResult result(bytes, 200, true);
 
         if (data->onSuccess_)
         {
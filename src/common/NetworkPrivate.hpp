@@ -15,14 +15,6 @@ namespace chatterino {
 
 class NetworkResult;
 
-class NetworkRequester : public QObject
-{
-    Q_OBJECT
-
-signals:
-    void requestUrl();
-};
-
 class NetworkWorker : public QObject
 {
     Q_OBJECT
@@ -39,6 +31,11 @@ struct NetworkData {
     bool hasCaller_{};
     QObjectRef<QObject> caller_;
     bool cache_{};
+    // Revalidates the cached response with If-None-Match/If-Modified-Since
+    // instead of using it as is
+    bool revalidate_{};
+    // Body of the cached response, used if the server answers with 304
+    QByteArray cachedBytes_;
     bool executeConcurrently_{};
 
     NetworkReplyCreatedCallback onReplyCreated_;
@@ -47,6 +44,7 @@ struct NetworkData {
     NetworkFinallyCallback finally_;
 
     NetworkRequestType requestType_ = NetworkRequestType::Get;
+    NetworkRequestPriority priority_ = NetworkRequestPriority::Metadata;
 
     QByteArray payload_;
     // lifetime secured by lifetimeManager_
@@ -63,6 +61,9 @@ struct NetworkData {
 
     QString getHash();
 
+    // Set while identical requests can wait for this one
+    QString coalescingKey_;
+
 private:
     QString hash_;
 };
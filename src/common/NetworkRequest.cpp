@@ -48,6 +48,12 @@ NetworkRequest NetworkRequest::type(NetworkRequestType newRequestType) &&
     return std::move(*this);
 }
 
+NetworkRequest NetworkRequest::priority(NetworkRequestPriority priority) &&
+{
+    this->data->priority_ = priority;
+    return std::move(*this);
+}
+
 NetworkRequest NetworkRequest::caller(const QObject *caller) &&
 {
     if (caller)
@@ -162,6 +168,13 @@ NetworkRequest NetworkRequest::cache() &&
     return std::move(*this);
 }
 
+NetworkRequest NetworkRequest::revalidate() &&
+{
+    this->data->cache_ = true;
+    this->data->revalidate_ = true;
+    return std::move(*this);
+}
+
 void NetworkRequest::execute()
 {
     this->executed_ = true;
@@ -172,6 +185,7 @@ void NetworkRequest::execute()
     {
         qCDebug(chatterinoCommon) << "Can only cache GET requests!";
         this->data->cache_ = false;
+        this->data->revalidate_ = false;
     }
 
     // Can not have a caller and be concurrent at the same time.
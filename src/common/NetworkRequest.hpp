@@ -38,6 +38,8 @@ public:
     ~NetworkRequest();
 
     NetworkRequest type(NetworkRequestType newRequestType) &&;
+    /// Defaults to NetworkRequestPriority::Metadata
+    NetworkRequest priority(NetworkRequestPriority priority) &&;
 
     NetworkRequest onReplyCreated(NetworkReplyCreatedCallback cb) &&;
     NetworkRequest onError(NetworkErrorCallback cb) &&;
@@ -46,6 +48,10 @@ public:
 
     NetworkRequest payload(const QByteArray &payload) &&;
     NetworkRequest cache() &&;
+    /// Like cache(), but the cached response is only used after the server
+    /// confirmed it's up to date (ETag/Last-Modified). Meant for API
+    /// responses that rarely change.
+    NetworkRequest revalidate() &&;
     /// NetworkRequest makes sure that the `caller` object still exists when the
     /// callbacks are executed. Cannot be used with concurrent() since we can't
     /// make sure that the object doesn't get deleted while the callback is
@@ -7,9 +7,11 @@
 
 namespace chatterino {
 
-NetworkResult::NetworkResult(const QByteArray &data, int status)
+NetworkResult::NetworkResult(const QByteArray &data, int status,
+                             bool fromCache)
     : data_(data)
     , status_(status)
+    , fromCache_(fromCache)
 {
 }
 
@@ -63,4 +65,9 @@ int NetworkResult::status() const
     return this->status_;
 }
 
+bool NetworkResult::fromCache() const
+{
+    return this->fromCache_;
+}
+
 }  // namespace chatterino
@@ -9,7 +9,7 @@ namespace chatterino {
 class NetworkResult
 {
 public:
-    NetworkResult(const QByteArray &data, int status);
+    NetworkResult(const QByteArray &data, int status, bool fromCache = false);
 
     /// Parses the result as json and returns the root as an object.
     /// Returns empty object if parsing failed.
@@ -21,12 +21,16 @@ public:
     rapidjson::Document parseRapidJson() const;
     const QByteArray &getData() const;
     int status() const;
+    /// Whether the data was read from the cache, either directly or because
+    /// the server said it didn't change.
+    bool fromCache() const;
 
     static constexpr int timedoutStatus = -2;
 
 private:
     QByteArray data_;
     int status_;
+    bool fromCache_;
 };
 
 }  // namespace chatterino
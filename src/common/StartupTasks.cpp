@@ -0,0 +1,193 @@
+#include "common/StartupTasks.hpp"
+
+#include "debug/Trace.hpp"
+#include "util/PostToThread.hpp"
+
+#include <QThreadPool>
+
+#include <algorithm>
+#include <cassert>
+
+namespace chatterino {
+
+StartupTasks::StartupTasks()
+{
+    this->timer_.start();
+}
+
+StartupTasks::TaskId StartupTasks::add(QString name, Thread thread,
+                                       std::vector<TaskId> dependencies,
+                                       std::function<void()> run)
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+
+    for (auto dependency : dependencies)
+    {
+        // tasks can only depend on tasks that were added before them, so
+        // there can't be any cycles
+        assert(dependency < this->tasks_.size());
+        (void)dependency;
+    }
+
+    this->tasks_.push_back(
+        {std::move(name), thread, std::move(dependencies), std::move(run)});
+
+    return this->tasks_.size() - 1;
+}
+
+void StartupTasks::start()
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+
+    this->startBackgroundTasks();
+}
+
+void StartupTasks::runAll()
+{
+    std::unique_lock<std::mutex> lock(this->mutex_);
+
+    this->startBackgroundTasks();
+
+    while (true)
+    {
+        bool waiting = false;
+        auto next = this->tasks_.size();
+
+        for (TaskId id = 0; id < this->tasks_.size(); id++)
+        {
+            auto &task = this->tasks_[id];
+            if (task.state == State::Done)
+            {
+                continue;
+            }
+
+            waiting = true;
+            if (task.thread == Thread::Gui && task.state == State::Waiting &&
+                this->isReady(task))
+            {
+                next = id;
+                break;
+            }
+        }
+
+        if (!waiting)
+        {
+            return;
+        }
+
+        if (next == this->tasks_.size())
+        {
+            // every GUI task that's left waits for a background task
+            this->finished_.wait(lock);
+            continue;
+        }
+
+        this->tasks_[next].state = State::Running;
+
+        lock.unlock();
+        this->runTask(next);
+        lock.lock();
+    }
+}
+
+void StartupTasks::addTiming(QString name, int64_t start, int64_t duration)
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+
+    this->timings_.push_back({std::move(name), Thread::Gui, start, duration});
+}
+
+int64_t StartupTasks::elapsed() const
+{
+    return this->timer_.elapsed();
+}
+
+std::vector<StartupTasks::Timing> StartupTasks::timings() const
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+
+    auto timings = this->timings_;
+    std::stable_sort(timings.begin(), timings.end(),
+                     [](const Timing &a, const Timing &b) {
+                         return a.start < b.start;
+                     });
+
+    return timings;
+}
+
+QString StartupTasks::report() const
+{
+    QString report;
+
+    for (auto &&timing : this->timings())
+    {
+        report += QString("%1 ms +%2 ms %3 %4\n")
+                      .arg(timing.start, 6)
+                      .arg(timing.duration, 5)
+                      .arg(timing.thread == Thread::Gui ? "gui" : "background",
+                           -10)
+                      .arg(timing.name);
+    }
+
+    return report;
+}
+
+bool StartupTasks::isReady(const Task &task) const
+{
+    return std::all_of(task.dependencies.begin(), task.dependencies.end(),
+                       [this](TaskId dependency) {
+                           return this->tasks_[dependency].state ==
+                                  State::Done;
+                       });
+}
+
+void StartupTasks::startBackgroundTasks()
+{
+    for (TaskId id = 0; id < this->tasks_.size(); id++)
+    {
+        auto &task = this->tasks_[id];
+        if (task.thread == Thread::Background &&
+            task.state == State::Waiting && this->isReady(task))
+        {
+            task.state = State::Running;
+            QThreadPool::globalInstance()->start(new LambdaRunnable([this, id] {
+                this->runTask(id);
+            }));
+        }
+    }
+}
+
+void StartupTasks::runTask(TaskId id)
+{
+    QString name;
+    Thread thread;
+    std::function<void()> run;
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+
+        auto &task = this->tasks_[id];
+        name = task.name;
+        thread = task.thread;
+        run = std::move(task.run);
+    }
+
+    auto start = this->elapsed();
+    {
+        TraceSpan span("startup task", "startup");
+        span.setDetail(name);
+
+        run();
+    }
+    auto duration = this->elapsed() - start;
+
+    std::lock_guard<std::mutex> lock(this->mutex_);
+
+    this->tasks_[id].state = State::Done;
+    this->timings_.push_back({std::move(name), thread, start, duration});
+
+    // tasks depending on this one might be able to start now
+    this->startBackgroundTasks();
+    this->finished_.notify_all();
+}
+
+}  // namespace chatterino
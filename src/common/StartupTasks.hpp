@@ -0,0 +1,81 @@
+#pragma once
+
+#include <QElapsedTimer>
+#include <QString>
+#include <boost/noncopyable.hpp>
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace chatterino {
+
+/// Runs the startup work of the application and times every step. A task
+/// starts once the tasks it depends on finished: background tasks on the
+/// global thread pool, the other tasks on the thread calling runAll.
+class StartupTasks : boost::noncopyable
+{
+public:
+    using TaskId = size_t;
+
+    enum class Thread { Gui, Background };
+
+    struct Timing {
+        QString name;
+        Thread thread;
+        // milliseconds since the StartupTasks were created
+        int64_t start;
+        int64_t duration;
+    };
+
+    StartupTasks();
+
+    TaskId add(QString name, Thread thread, std::vector<TaskId> dependencies,
+               std::function<void()> run);
+
+    /// Starts the background tasks that can run already, so they can work
+    /// while the calling thread does something else before runAll.
+    void start();
+
+    /// Runs the GUI tasks in the order they were added, skipping the ones
+    /// that still wait for a dependency. Returns once all tasks finished.
+    void runAll();
+
+    /// Records work that didn't run as a task, e.g. constructors.
+    void addTiming(QString name, int64_t start, int64_t duration);
+
+    /// Milliseconds since the StartupTasks were created
+    int64_t elapsed() const;
+
+    std::vector<Timing> timings() const;
+
+    /// One line per timing, in the order they started
+    QString report() const;
+
+private:
+    enum class State { Waiting, Running, Done };
+
+    struct Task {
+        QString name;
+        Thread thread;
+        std::vector<TaskId> dependencies;
+        std::function<void()> run;
+        State state = State::Waiting;
+    };
+
+    bool isReady(const Task &task) const;
+    void startBackgroundTasks();
+    void runTask(TaskId id);
+
+    QElapsedTimer timer_;
+
+    mutable std::mutex mutex_;
+    // notified whenever a task finished
+    std::condition_variable finished_;
+    std::vector<Task> tasks_;
+    std::vector<Timing> timings_;
+};
+
+}  // namespace chatterino
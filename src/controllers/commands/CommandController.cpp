@@ -305,7 +305,8 @@ void CommandController::initialize(Settings &, Paths &paths)
                     makeSystemMessage(QString("User %1 couldn't be blocked, no "
                                               "user with that name found!")
                                           .arg(target)));
-            });
+            },
+            NetworkRequestPriority::Interactive);
 
         return "";
     };
@@ -350,7 +351,8 @@ void CommandController::initialize(Settings &, Paths &paths)
                     makeSystemMessage(QString("User %1 couldn't be unblocked, "
                                               "no user with that name found!")
                                           .arg(target)));
-            });
+            },
+            NetworkRequestPriority::Interactive);
 
         return "";
     };
@@ -446,7 +448,8 @@ void CommandController::initialize(Settings &, Paths &paths)
                     makeSystemMessage(QString("User %1 could not be followed, "
                                               "no user with that name found!")
                                           .arg(target)));
-            });
+            },
+            NetworkRequestPriority::Interactive);
 
         return "";
     });
@@ -486,7 +489,8 @@ void CommandController::initialize(Settings &, Paths &paths)
             [channel, target] {
                 channel->addMessage(makeSystemMessage(
                     QString("User %1 could not be followed!").arg(target)));
-            });
+            },
+            NetworkRequestPriority::Interactive);
 
         return "";
     });
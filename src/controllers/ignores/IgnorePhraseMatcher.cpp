@@ -0,0 +1,262 @@
+#include "controllers/ignores/IgnorePhraseMatcher.hpp"
+
+#include "controllers/ignores/IgnorePhrase.hpp"
+#include "singletons/Settings.hpp"
+
+#include <mutex>
+
+namespace chatterino {
+namespace {
+
+    // Backreferences, recursion and subroutine calls refer to groups by
+    // number, which changes once the phrases are joined together
+    const QRegularExpression &groupReferenceRegex()
+    {
+        static QRegularExpression regex(
+            R"(\\[1-9gk]|\(\?(P[=>]|[0-9+\-&R]))");
+        return regex;
+    }
+
+    QRegularExpression makePhraseRegex(const IgnorePhrase &phrase)
+    {
+        auto options = QRegularExpression::UseUnicodePropertiesOption;
+        if (!phrase.isCaseSensitive())
+        {
+            options |= QRegularExpression::CaseInsensitiveOption;
+        }
+
+        if (phrase.isRegex())
+        {
+            return QRegularExpression(phrase.getPattern(), options);
+        }
+
+        return QRegularExpression(
+            QRegularExpression::escape(phrase.getPattern()), options);
+    }
+
+}  // namespace
+
+IgnorePhraseMatcher::IgnorePhraseMatcher(
+    std::shared_ptr<const std::vector<IgnorePhrase>> phrases)
+    : phrases_(std::move(phrases))
+{
+    for (const auto &phrase : *this->phrases_)
+    {
+        if (phrase.getPattern().isEmpty() ||
+            (phrase.isRegex() && !phrase.isRegexValid()))
+        {
+            continue;
+        }
+
+        auto &group = phrase.isBlock() ? this->block_ : this->replace_;
+
+        group.phrases.push_back(&phrase);
+        group.regexes.push_back(makePhraseRegex(phrase));
+    }
+
+    compile(this->block_);
+    compile(this->replace_);
+}
+
+std::shared_ptr<const IgnorePhraseMatcher> IgnorePhraseMatcher::current()
+{
+    static std::mutex mutex;
+    static std::shared_ptr<const IgnorePhraseMatcher> matcher;
+
+    auto phrases = getCSettings().ignoredMessages.readOnly();
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // readOnly() returns a new vector every time the phrases change
+    if (!matcher || matcher->phrases() != phrases)
+    {
+        matcher = std::make_shared<const IgnorePhraseMatcher>(phrases);
+    }
+
+    return matcher;
+}
+
+void IgnorePhraseMatcher::compile(Group &group)
+{
+    if (group.regexes.size() < 2)
+    {
+        return;
+    }
+
+    QStringList alternatives;
+    for (size_t i = 0; i < group.regexes.size(); i++)
+    {
+        const auto *phrase = group.phrases[i];
+        const auto &pattern = group.regexes[i].pattern();
+
+        if (phrase->isRegex() && pattern.contains(groupReferenceRegex()))
+        {
+            // fall back to matching the phrases one by one
+            return;
+        }
+
+        alternatives.append(
+            (phrase->isCaseSensitive() ? "(?-i:" : "(?i:") + pattern + ")");
+    }
+
+    QRegularExpression combined(
+        alternatives.join('|'),
+        QRegularExpression::UseUnicodePropertiesOption);
+
+    if (combined.isValid())
+    {
+        combined.optimize();
+        group.combined = std::move(combined);
+    }
+}
+
+const IgnorePhrase *IgnorePhraseMatcher::findBlock(const QString &text) const
+{
+    const auto &group = this->block_;
+
+    if (group.phrases.empty())
+    {
+        return nullptr;
+    }
+
+    if (!group.combined.pattern().isEmpty() &&
+        !group.combined.match(text).hasMatch())
+    {
+        return nullptr;
+    }
+
+    // the combined regex matched (or isn't available), find out which phrase
+    // it was
+    for (size_t i = 0; i < group.phrases.size(); i++)
+    {
+        if (group.regexes[i].match(text).hasMatch())
+        {
+            return group.phrases[i];
+        }
+    }
+
+    return nullptr;
+}
+
+std::vector<IgnorePhraseMatcher::Replacement>
+    IgnorePhraseMatcher::findReplacements(const QString &text) const
+{
+    std::vector<Replacement> replacements;
+
+    if (this->replace_.phrases.empty())
+    {
+        return replacements;
+    }
+
+    int from = 0;
+    Replacement replacement;
+    while (from < text.length() &&
+           this->findNextReplacement(text, from, replacement))
+    {
+        from = replacement.start + replacement.length;
+        replacements.push_back(std::move(replacement));
+    }
+
+    return replacements;
+}
+
+bool IgnorePhraseMatcher::findNextReplacement(const QString &text, int from,
+                                              Replacement &out) const
+{
+    const auto &group = this->replace_;
+
+    if (!group.combined.pattern().isEmpty())
+    {
+        while (from < text.length())
+        {
+            auto match = group.combined.match(text, from);
+            if (!match.hasMatch())
+            {
+                return false;
+            }
+
+            if (this->matchAt(text, match.capturedStart(), out))
+            {
+                return true;
+            }
+
+            // only empty matches at this position
+            from = match.capturedStart() + 1;
+        }
+
+        return false;
+    }
+
+    // no combined regex, look for the earliest match of every phrase
+    int earliest = -1;
+    for (size_t i = 0; i < group.phrases.size(); i++)
+    {
+        int start = from;
+        while (start < text.length())
+        {
+            auto match = group.regexes[i].match(text, start);
+            if (!match.hasMatch())
+            {
+                break;
+            }
+            if (match.capturedLength() > 0)
+            {
+                if (earliest == -1 || match.capturedStart() < earliest)
+                {
+                    earliest = match.capturedStart();
+                }
+                break;
+            }
+            start = match.capturedStart() + 1;
+        }
+    }
+
+    return earliest != -1 && this->matchAt(text, earliest, out);
+}
+
+bool IgnorePhraseMatcher::matchAt(const QString &text, int start,
+                                  Replacement &out) const
+{
+    const auto &group = this->replace_;
+
+    for (size_t i = 0; i < group.phrases.size(); i++)
+    {
+        auto match = group.regexes[i].match(
+            text, start, QRegularExpression::NormalMatch,
+            QRegularExpression::AnchoredMatchOption);
+
+        if (!match.hasMatch() || match.capturedLength() == 0)
+        {
+            continue;
+        }
+
+        const auto *phrase = group.phrases[i];
+
+        out.start = start;
+        out.length = match.capturedLength();
+        out.phrase = phrase;
+
+        if (phrase->isRegex())
+        {
+            // allows references to captures in the replacement
+            out.text = match.captured();
+            out.text.replace(group.regexes[i], phrase->getReplace());
+        }
+        else
+        {
+            out.text = phrase->getReplace();
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+const std::shared_ptr<const std::vector<IgnorePhrase>>
+    &IgnorePhraseMatcher::phrases() const
+{
+    return this->phrases_;
+}
+
+}  // namespace chatterino
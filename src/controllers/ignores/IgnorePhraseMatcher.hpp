@@ -0,0 +1,67 @@
+#pragma once
+
+#include <QRegularExpression>
+#include <QString>
+
+#include <memory>
+#include <vector>
+
+namespace chatterino {
+
+class IgnorePhrase;
+
+// IgnorePhraseMatcher compiles the ignored phrases into a single regular
+// expression, so blocking and replacing only needs one scan over a message
+// no matter how many phrases there are.
+//
+// Replacements are found in a single left-to-right scan of the original
+// text. Where several phrases match at the same position, the phrase listed
+// first wins. Replaced text is not scanned again by other phrases.
+class IgnorePhraseMatcher
+{
+public:
+    struct Replacement {
+        // position and length of the replaced text in the original text
+        int start;
+        int length;
+        QString text;
+        const IgnorePhrase *phrase;
+    };
+
+    explicit IgnorePhraseMatcher(
+        std::shared_ptr<const std::vector<IgnorePhrase>> phrases);
+
+    // Returns the matcher for the current ignored phrases. It's only
+    // recompiled after the phrases have changed.
+    static std::shared_ptr<const IgnorePhraseMatcher> current();
+
+    // Returns the first blocking phrase that matches text, or nullptr
+    const IgnorePhrase *findBlock(const QString &text) const;
+
+    // Returns all replacements in text, sorted and non-overlapping
+    std::vector<Replacement> findReplacements(const QString &text) const;
+
+    const std::shared_ptr<const std::vector<IgnorePhrase>> &phrases() const;
+
+private:
+    struct Group {
+        std::vector<const IgnorePhrase *> phrases;
+        // one expression per phrase, non-regex phrases are escaped
+        std::vector<QRegularExpression> regexes;
+        // all regexes joined together, invalid if they couldn't be combined
+        QRegularExpression combined;
+    };
+
+    static void compile(Group &group);
+
+    // Finds the earliest non-empty match at or after from
+    bool findNextReplacement(const QString &text, int from,
+                             Replacement &out) const;
+    bool matchAt(const QString &text, int start, Replacement &out) const;
+
+    std::shared_ptr<const std::vector<IgnorePhrase>> phrases_;
+    Group block_;
+    Group replace_;
+};
+
+}  // namespace chatterino
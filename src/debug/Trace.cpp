@@ -0,0 +1,237 @@
+#include "debug/Trace.hpp"
+
+#include "common/QLogging.hpp"
+
+#include <QCoreApplication>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QThread>
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace chatterino {
+
+namespace {
+
+    struct Event {
+        const char *name;
+        const char *category;
+        // microseconds since the start of the process
+        int64_t begin;
+        int64_t end;
+        QString detail;
+    };
+
+    struct ThreadBuffer {
+        // only contended while exporting
+        std::mutex mutex;
+        std::vector<Event> events;
+        // where the next event is written, wraps around
+        size_t next = 0;
+        int id;
+        QString name;
+    };
+
+    struct Registry {
+        std::mutex mutex;
+        // kept after their threads finished, so their spans can still be
+        // exported
+        std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+        // buffers of finished threads, new threads write into these before
+        // a buffer is added, so thread pools that keep replacing their
+        // threads don't grow the registry
+        std::vector<std::shared_ptr<ThreadBuffer>> unused;
+    };
+
+    Registry &registry()
+    {
+        static Registry instance;
+        return instance;
+    }
+
+    // Hands the buffer back to the registry once its thread finished
+    struct ThreadBufferHolder {
+        std::shared_ptr<ThreadBuffer> buffer;
+
+        ~ThreadBufferHolder()
+        {
+            auto &reg = registry();
+            std::lock_guard<std::mutex> lock(reg.mutex);
+            reg.unused.push_back(std::move(this->buffer));
+        }
+    };
+
+    ThreadBuffer &threadBuffer()
+    {
+        thread_local ThreadBufferHolder holder{[] {
+            QString name;
+            auto *app = QCoreApplication::instance();
+            auto *thread = QThread::currentThread();
+            if (app && thread == app->thread())
+            {
+                name = "GUI";
+            }
+            else
+            {
+                name = thread->objectName();
+            }
+
+            auto &reg = registry();
+            std::lock_guard<std::mutex> lock(reg.mutex);
+
+            std::shared_ptr<ThreadBuffer> buffer;
+            if (!reg.unused.empty())
+            {
+                // the spans of the finished thread stay in the buffer until
+                // they're overwritten
+                buffer = std::move(reg.unused.back());
+                reg.unused.pop_back();
+            }
+            else
+            {
+                buffer = std::make_shared<ThreadBuffer>();
+                buffer->id = int(reg.buffers.size()) + 1;
+                reg.buffers.push_back(buffer);
+            }
+
+            std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+            buffer->name =
+                name.isEmpty() ? QString("Thread %1").arg(buffer->id) : name;
+
+            return buffer;
+        }()};
+
+        return *holder.buffer;
+    }
+
+    QByteArray quote(const QString &string)
+    {
+        // QJsonDocument takes care of escaping
+        auto json = QJsonDocument(QJsonObject{{"", string}})
+                        .toJson(QJsonDocument::Compact);
+        // {"":"..."}
+        return json.mid(4, json.size() - 5);
+    }
+
+}  // namespace
+
+std::atomic<bool> Trace::enabled_{false};
+
+void Trace::setEnabled(bool enabled)
+{
+    enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+int64_t Trace::now()
+{
+    using namespace std::chrono;
+
+    static const auto start = steady_clock::now();
+
+    return duration_cast<microseconds>(steady_clock::now() - start).count();
+}
+
+void Trace::record(const char *name, const char *category, int64_t begin,
+                   int64_t end, const QString &detail)
+{
+    auto &buffer = threadBuffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+
+    Event event{name, category, begin, end, detail};
+
+    if (buffer.events.size() < Trace::bufferSize)
+    {
+        buffer.events.push_back(std::move(event));
+    }
+    else
+    {
+        buffer.events[buffer.next] = std::move(event);
+    }
+    buffer.next = (buffer.next + 1) % Trace::bufferSize;
+}
+
+bool Trace::exportJson(const QString &path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qCWarning(chatterinoApp) << "Unable to write trace to" << path;
+        return false;
+    }
+
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    {
+        auto &reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        buffers = reg.buffers;
+    }
+
+    // Complete ("X") events, see the "Trace Event Format" document
+    file.write("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+    bool first = true;
+    auto write = [&](const QByteArray &event) {
+        if (!first)
+        {
+            file.write(",\n");
+        }
+        first = false;
+        file.write(event);
+    };
+
+    for (auto &&buffer : buffers)
+    {
+        std::lock_guard<std::mutex> lock(buffer->mutex);
+
+        write(QString("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,"
+                      "\"tid\":%1,\"args\":{\"name\":")
+                  .arg(buffer->id)
+                  .toUtf8() +
+              quote(buffer->name) + "}}");
+
+        // oldest first
+        auto size = buffer->events.size();
+        auto start = size < Trace::bufferSize ? 0 : buffer->next;
+        for (size_t i = 0; i < size; i++)
+        {
+            auto &event = buffer->events[(start + i) % size];
+
+            auto json = QString("{\"name\":\"%1\",\"cat\":\"%2\",\"ph\":\"X\","
+                                "\"pid\":1,\"tid\":%3,\"ts\":%4,\"dur\":%5")
+                            .arg(QString::fromLatin1(event.name),
+                                 QString::fromLatin1(event.category))
+                            .arg(buffer->id)
+                            .arg(event.begin)
+                            .arg(event.end - event.begin)
+                            .toUtf8();
+            if (!event.detail.isEmpty())
+            {
+                json += ",\"args\":{\"detail\":" + quote(event.detail) + "}";
+            }
+            write(json + "}");
+        }
+    }
+
+    file.write("]}\n");
+
+    return file.error() == QFileDevice::NoError;
+}
+
+void Trace::clear()
+{
+    auto &reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    for (auto &&buffer : reg.buffers)
+    {
+        std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+        buffer->events.clear();
+        buffer->next = 0;
+    }
+}
+
+}  // namespace chatterino
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <QString>
+#include <boost/noncopyable.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace chatterino {
+
+/// Records spans into a ring buffer per thread while tracing is enabled. The
+/// last spans of every thread can be exported as Chrome trace event JSON,
+/// which chrome://tracing and ui.perfetto.dev can open.
+class Trace
+{
+public:
+    static void setEnabled(bool enabled);
+    static bool isEnabled()
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    /// Writes the recorded spans of all threads to path.
+    static bool exportJson(const QString &path);
+    static void clear();
+
+    /// Number of spans kept per thread, older ones are overwritten
+    static constexpr size_t bufferSize = 1 << 16;
+
+private:
+    friend class TraceSpan;
+
+    static int64_t now();
+    static void record(const char *name, const char *category,
+                       int64_t begin, int64_t end, const QString &detail);
+
+    static std::atomic<bool> enabled_;
+};
+
+/// Records the time between its construction and destruction as a span.
+/// Costs a single atomic load while tracing is disabled.
+class TraceSpan : boost::noncopyable
+{
+public:
+    /// name and category have to be string literals, only the pointers are
+    /// kept.
+    explicit TraceSpan(const char *name, const char *category = "chatterino")
+        : name_(name)
+        , category_(category)
+        , begin_(Trace::isEnabled() ? Trace::now() : -1)
+    {
+    }
+
+    ~TraceSpan()
+    {
+        if (this->begin_ >= 0)
+        {
+            Trace::record(this->name_, this->category_, this->begin_,
+                          Trace::now(), this->detail_);
+        }
+    }
+
+    /// Shown as the argument of the span, e.g. the url of a request
+    void setDetail(const QString &detail)
+    {
+        if (this->begin_ >= 0)
+        {
+            this->detail_ = detail;
+        }
+    }
+
+private:
+    const char *name_;
+    const char *category_;
+    int64_t begin_;
+    QString detail_;
+};
+
+}  // namespace chatterino
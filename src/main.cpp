@@ -6,10 +6,12 @@
 
 #include "BrowserExtension.hpp"
 #include "RunGui.hpp"
+#include "RunReplay.hpp"
 #include "common/Args.hpp"
 #include "common/Modes.hpp"
 #include "common/QLogging.hpp"
 #include "common/Version.hpp"
+#include "debug/Trace.hpp"
 #include "providers/IvrApi.hpp"
 #include "providers/twitch/api/Helix.hpp"
 #include "providers/twitch/api/Kraken.hpp"
@@ -57,6 +59,11 @@ int main(int argc, char **argv)
 
     initArgs(a);
 
+    if (getArgs().traceFile)
+    {
+        Trace::setEnabled(true);
+    }
+
     // run in gui mode or browser extension host mode
     if (getArgs().shouldRunBrowserExtensionHost)
     {
@@ -76,7 +83,7 @@ int main(int argc, char **argv)
     }
     else
     {
-        if (getArgs().verbose)
+        if (getArgs().verbose || getArgs().replayFile)
         {
             attachToConsole();
         }
@@ -87,7 +94,14 @@ int main(int argc, char **argv)
 
         Settings settings(paths->settingsDirectory);
 
-        runGui(a, *paths, settings);
+        if (getArgs().replayFile)
+        {
+            runReplay(a, *paths, settings);
+        }
+        else
+        {
+            runGui(a, *paths, settings);
+        }
     }
     return 0;
 }
@@ -2,12 +2,18 @@
 
 #include <QBuffer>
 #include <QImageReader>
+#include <QMap>
 #include <QNetworkAccessManager>
 #include <QNetworkReply>
 #include <QNetworkRequest>
+#include <QThreadPool>
 #include <QTimer>
+#include <array>
+#include <chrono>
 #include <functional>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include "Application.hpp"
 #include "common/Common.hpp"
@@ -15,18 +21,207 @@
 #include "common/QLogging.hpp"
 #include "debug/AssertInGuiThread.hpp"
 #include "debug/Benchmark.hpp"
+#include "debug/Trace.hpp"
+#include "messages/MemoryUsage.hpp"
 #ifndef CHATTERINO_TEST
 #    include "singletons/Emotes.hpp"
 #endif
+#include "singletons/Settings.hpp"
 #include "singletons/WindowManager.hpp"
 #include "singletons/helper/GifTimer.hpp"
 #include "util/DebugCount.hpp"
 #include "util/PostToThread.hpp"
 
-#include <queue>
+// Images that were painted within this time count as being on screen
+#define IMAGE_ON_SCREEN_MS 2000
+#define IMAGE_DECODE_MAX_THREADS 4
 
 namespace chatterino {
 namespace detail {
+    QThreadPool *decodePool();
+
+    // Decodes the frames of an animated image while it's playing. Frames can
+    // only be read in order, so a few upcoming frames are decoded at once on
+    // the decode pool. The last frame stays on screen until the next one is
+    // ready, nothing is decoded on the GUI thread.
+    class Frames::Decoder
+    {
+    public:
+        Decoder(const QByteArray &data, int frameCount,
+                const Frame<QPixmap> &first)
+            : reader_(std::make_shared<Reader>(data))
+            , durations_(frameCount, first.duration)
+            , first_(first.image)
+            , last_(first.image)
+        {
+            this->reader_->owner = this;
+        }
+
+        ~Decoder()
+        {
+            // frames that are still being decoded are thrown away
+            this->reader_->owner = nullptr;
+        }
+
+        // the durations of frames that weren't read yet are guessed
+        const QVector<int> &durations() const
+        {
+            return this->durations_;
+        }
+
+        const QPixmap &first() const
+        {
+            return this->first_;
+        }
+
+        int64_t memoryUsage() const
+        {
+            auto bytes = int64_t(this->reader_->data.size()) +
+                         MemoryUsage::pixmapSize(this->first_);
+            for (auto &&frame : this->window_)
+            {
+                bytes += MemoryUsage::pixmapSize(frame);
+            }
+            return bytes;
+        }
+
+        QPixmap frame(int index)
+        {
+            if (index == 0)
+            {
+                this->last_ = this->first_;
+            }
+            else
+            {
+                auto it = this->window_.find(index);
+                if (it == this->window_.end())
+                {
+                    this->request(index);
+                    return this->last_;
+                }
+
+                this->last_ = it.value();
+            }
+
+            // decode the following frames before they're shown
+            if (index + 1 < this->durations_.size() &&
+                !this->window_.contains(index + 1))
+            {
+                this->request(index + 1);
+            }
+
+            return this->last_;
+        }
+
+    private:
+        struct Decoded {
+            int index;
+            int duration;
+            // null for frames that were only read to get to the next ones
+            QImage image;
+        };
+
+        // Only used by one decode job at a time. owner belongs to the GUI
+        // thread.
+        struct Reader {
+            explicit Reader(const QByteArray &_data)
+                : data(_data)
+            {
+            }
+
+            std::vector<Decoded> read(int index, int count)
+            {
+                if (!this->reader || index < this->nextIndex)
+                {
+                    this->reader.reset();
+                    this->buffer.close();
+                    this->buffer.setData(this->data);
+                    this->buffer.open(QIODevice::ReadOnly);
+                    this->reader =
+                        std::make_unique<QImageReader>(&this->buffer);
+                    this->nextIndex = 0;
+                }
+
+                std::vector<Decoded> decoded;
+                QImage image;
+                while (this->nextIndex < index + count &&
+                       this->reader->read(&image))
+                {
+                    Decoded frame{this->nextIndex,
+                                  std::max(20, this->reader->nextImageDelay()),
+                                  {}};
+                    if (this->nextIndex >= index)
+                    {
+                        frame.image = image;
+                    }
+
+                    decoded.push_back(std::move(frame));
+                    this->nextIndex++;
+                }
+
+                return decoded;
+            }
+
+            const QByteArray data;
+            QBuffer buffer;
+            std::unique_ptr<QImageReader> reader;
+            // index of the frame reader reads next
+            int nextIndex{0};
+            Decoder *owner{nullptr};
+        };
+
+        void request(int index)
+        {
+            if (this->pending_)
+            {
+                return;
+            }
+            this->pending_ = true;
+
+            decodePool()->start(new LambdaRunnable(
+                [reader = this->reader_, index]() mutable {
+                    auto decoded = reader->read(index, windowSize);
+
+                    // the reader is released on the GUI thread, which owns
+                    // its buffer
+                    postToThread([reader = std::move(reader),
+                                  decoded = std::move(decoded)]() mutable {
+                        if (reader->owner)
+                        {
+                            reader->owner->insert(std::move(decoded));
+                        }
+                    });
+                }));
+        }
+
+        void insert(std::vector<Decoded> decoded)
+        {
+            this->pending_ = false;
+            this->window_.clear();
+
+            for (auto &frame : decoded)
+            {
+                this->durations_[frame.index] = frame.duration;
+                if (!frame.image.isNull())
+                {
+                    this->window_.insert(frame.index,
+                                         QPixmap::fromImage(frame.image));
+                }
+            }
+        }
+
+        static constexpr int windowSize = 4;
+
+        const std::shared_ptr<Reader> reader_;
+        QVector<int> durations_;
+        const QPixmap first_;
+        // the frame that was shown last
+        QPixmap last_;
+        QMap<int, QPixmap> window_;
+        // whether a decode job is running
+        bool pending_{false};
+    };
+
     // Frames
     Frames::Frames()
     {
@@ -35,6 +230,20 @@ namespace detail {
 
     Frames::Frames(const QVector<Frame<QPixmap>> &frames)
         : items_(frames)
+    {
+        this->initialize();
+    }
+
+    Frames::Frames(const QByteArray &data, int frameCount,
+                   const Frame<QPixmap> &first)
+        : decoder_(std::make_unique<Decoder>(data, frameCount, first))
+    {
+        DebugCount::increase("animated images (decoded on demand)");
+
+        this->initialize();
+    }
+
+    void Frames::initialize()
     {
         assertInGuiThread();
         DebugCount::increase("images");
@@ -51,11 +260,11 @@ namespace detail {
 #endif
         }
 
-        auto totalLength =
-            std::accumulate(this->items_.begin(), this->items_.end(), 0UL,
-                            [](auto init, auto &&frame) {
-                                return init + frame.duration;
-                            });
+        auto totalLength = 0UL;
+        for (int i = 0; i < this->frameCount(); i++)
+        {
+            totalLength += this->frameDuration(i);
+        }
 
         if (totalLength == 0)
         {
@@ -82,6 +291,11 @@ namespace detail {
             DebugCount::decrease("animated images");
         }
 
+        if (this->decoder_)
+        {
+            DebugCount::decrease("animated images (decoded on demand)");
+        }
+
         this->gifTimerConnection_.disconnect();
     }
 
@@ -93,19 +307,19 @@ namespace detail {
 
     void Frames::processOffset()
     {
-        if (this->items_.isEmpty())
+        if (this->frameCount() == 0)
         {
             return;
         }
 
         while (true)
         {
-            this->index_ %= this->items_.size();
+            this->index_ %= this->frameCount();
 
-            if (this->durationOffset_ > this->items_[this->index_].duration)
+            if (this->durationOffset_ > this->frameDuration(this->index_))
             {
-                this->durationOffset_ -= this->items_[this->index_].duration;
-                this->index_ = (this->index_ + 1) % this->items_.size();
+                this->durationOffset_ -= this->frameDuration(this->index_);
+                this->index_ = (this->index_ + 1) % this->frameCount();
             }
             else
             {
@@ -114,13 +328,29 @@ namespace detail {
         }
     }
 
+    int Frames::frameCount() const
+    {
+        if (this->decoder_)
+            return this->decoder_->durations().size();
+        return this->items_.size();
+    }
+
+    int Frames::frameDuration(int index) const
+    {
+        if (this->decoder_)
+            return this->decoder_->durations()[index];
+        return this->items_[index].duration;
+    }
+
     bool Frames::animated() const
     {
-        return this->items_.size() > 1;
+        return this->frameCount() > 1;
     }
 
     boost::optional<QPixmap> Frames::current() const
     {
+        if (this->decoder_)
+            return this->decoder_->frame(this->index_);
         if (this->items_.size() == 0)
             return boost::none;
         return this->items_[this->index_].image;
@@ -128,13 +358,31 @@ namespace detail {
 
     boost::optional<QPixmap> Frames::first() const
     {
+        if (this->decoder_)
+            return this->decoder_->first();
         if (this->items_.size() == 0)
             return boost::none;
         return this->items_.front().image;
     }
 
+    int64_t Frames::memoryUsage() const
+    {
+        if (this->decoder_)
+        {
+            return this->decoder_->memoryUsage();
+        }
+
+        int64_t bytes = 0;
+        for (auto &&frame : this->items_)
+        {
+            bytes += MemoryUsage::pixmapSize(frame.image);
+        }
+        return bytes;
+    }
+
     // functions
-    QVector<Frame<QImage>> readFrames(QImageReader &reader, const Url &url)
+    QVector<Frame<QImage>> readFrames(QImageReader &reader, const Url &url,
+                                      bool firstOnly)
     {
         QVector<Frame<QImage>> frames;
 
@@ -155,6 +403,11 @@ namespace detail {
 
                 int duration = std::max(20, reader.nextImageDelay());
                 frames.push_back(Frame<QImage>{image, duration});
+
+                if (firstOnly)
+                {
+                    break;
+                }
             }
         }
 
@@ -168,68 +421,160 @@ namespace detail {
         return frames;
     }
 
-    // parsed
-    template <typename Assign>
-    void assignDelayed(
-        std::queue<std::pair<Assign, QVector<Frame<QPixmap>>>> &queued,
-        std::mutex &mutex, std::atomic_bool &loadedEventQueued)
+    QVector<Frame<QPixmap>> convertFrames(const QVector<Frame<QImage>> &parsed)
     {
-        std::lock_guard<std::mutex> lock(mutex);
-        int i = 0;
+        assertInGuiThread();
 
-        while (!queued.empty())
+        QVector<Frame<QPixmap>> frames;
+        frames.reserve(parsed.size());
+        for (const auto &frame : parsed)
         {
-            queued.front().first(queued.front().second);
-            queued.pop();
+            frames.push_back(Frame<QPixmap>{QPixmap::fromImage(frame.image),
+                                            frame.duration});
+        }
 
-            if (++i > 50)
-            {
-                QTimer::singleShot(3, [&] {
-                    assignDelayed(queued, mutex, loadedEventQueued);
-                });
-                return;
-            }
+        return frames;
+    }
+
+    // Animations of which only the first frame was read are decoded while
+    // they're shown
+    std::unique_ptr<Frames> makeFrames(const QByteArray &data, int frameCount,
+                                       const QVector<Frame<QImage>> &parsed)
+    {
+        if (parsed.size() == 1 && frameCount > 1)
+        {
+            return std::make_unique<Frames>(
+                data, frameCount,
+                Frame<QPixmap>{QPixmap::fromImage(parsed.front().image),
+                               parsed.front().duration});
         }
 
-#ifndef CHATTERINO_TEST
-        getApp()->windows->forceLayoutChannelViews();
-#endif
-        loadedEventQueued = false;
+        return std::make_unique<Frames>(convertFrames(parsed));
+    }
+
+    // Images are decoded on their own pool, so a channel full of animated
+    // emotes can't hog the global thread pool
+    QThreadPool *decodePool()
+    {
+        static QThreadPool *pool = [] {
+            auto *pool = new QThreadPool(qApp);
+            pool->setMaxThreadCount(
+                std::max(1, std::min(IMAGE_DECODE_MAX_THREADS,
+                                     QThread::idealThreadCount() / 2)));
+            return pool;
+        }();
+
+        return pool;
+    }
+
+    int64_t currentMs()
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    // Notifies the views once for all images that finished loading in the
+    // meantime
+    void queueLayoutForLoadedImages()
+    {
+        assertInGuiThread();
+
+        static bool queued = false;
+
+        if (queued)
+        {
+            return;
+        }
+        queued = true;
+
+        QTimer::singleShot(20, [] {
+            queued = false;
+            Image::imagesLoaded().invoke();
+        });
     }
 
-    template <typename Assign>
-    auto makeConvertCallback(const QVector<Frame<QImage>> &parsed,
-                             Assign assign)
+    // Keeps track of the images created by Image::fromUrl. Images are looked
+    // up from many threads, so the urls are split into shards that each have
+    // their own lock. An image removes its entry once it's destroyed.
+    class ImageRegistry
     {
-        return [parsed, assign] {
-            // convert to pixmap
-            auto frames = QVector<Frame<QPixmap>>();
-            std::transform(parsed.begin(), parsed.end(),
-                           std::back_inserter(frames), [](auto &frame) {
-                               return Frame<QPixmap>{
-                                   QPixmap::fromImage(frame.image),
-                                   frame.duration};
-                           });
-
-            // put into stack
-            static std::queue<std::pair<Assign, QVector<Frame<QPixmap>>>>
-                queued;
-            static std::mutex mutex;
-
-            std::lock_guard<std::mutex> lock(mutex);
-            queued.emplace(assign, frames);
-
-            static std::atomic_bool loadedEventQueued{false};
-
-            if (!loadedEventQueued)
+    public:
+        template <typename Create>
+        ImagePtr getOrCreate(const Url &url, Create create)
+        {
+            auto &shard = this->shardOf(url);
+
+            std::lock_guard<std::mutex> lock(shard.mutex);
+
+            auto &entry = shard.images[url];
+            if (auto shared = entry.lock())
             {
-                loadedEventQueued = true;
+                this->hits_++;
+                return shared;
+            }
 
-                QTimer::singleShot(100, [=] {
-                    assignDelayed(queued, mutex, loadedEventQueued);
-                });
+            this->misses_++;
+
+            auto shared = ImagePtr(create(), [this](Image *image) {
+                this->remove(image->url());
+                delete image;
+            });
+            entry = shared;
+
+            return shared;
+        }
+
+        Image::RegistryStats stats()
+        {
+            size_t size = 0;
+            for (auto &shard : this->shards_)
+            {
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                size += shard.images.size();
             }
+
+            return {size, this->hits_.load(), this->misses_.load()};
+        }
+
+    private:
+        struct Shard {
+            std::mutex mutex;
+            std::unordered_map<Url, std::weak_ptr<Image>> images;
         };
+
+        Shard &shardOf(const Url &url)
+        {
+            return this->shards_[std::hash<Url>()(url) % shardCount];
+        }
+
+        void remove(const Url &url)
+        {
+            auto &shard = this->shardOf(url);
+
+            std::lock_guard<std::mutex> lock(shard.mutex);
+
+            // the url might already point to a new image
+            auto it = shard.images.find(url);
+            if (it != shard.images.end() && it->second.expired())
+            {
+                shard.images.erase(it);
+            }
+        }
+
+        static constexpr size_t shardCount = 16;
+
+        std::array<Shard, shardCount> shards_;
+        std::atomic<uint64_t> hits_{0};
+        std::atomic<uint64_t> misses_{0};
+    };
+
+    ImageRegistry &imageRegistry()
+    {
+        // never destroyed, images can still be released after static
+        // destructors ran
+        static auto *registry = new ImageRegistry;
+        return *registry;
     }
 }  // namespace detail
 
@@ -254,19 +599,9 @@ Image::~Image()
 
 ImagePtr Image::fromUrl(const Url &url, qreal scale)
 {
-    static std::unordered_map<Url, std::weak_ptr<Image>> cache;
-    static std::mutex mutex;
-
-    std::lock_guard<std::mutex> lock(mutex);
-
-    auto shared = cache[url].lock();
-
-    if (!shared)
-    {
-        cache[url] = shared = ImagePtr(new Image(url, scale));
-    }
-
-    return shared;
+    return detail::imageRegistry().getOrCreate(url, [&] {
+        return new Image(url, scale);
+    });
 }
 
 ImagePtr Image::fromPixmap(const QPixmap &pixmap, qreal scale)
@@ -284,6 +619,11 @@ ImagePtr Image::getEmpty()
     return empty;
 }
 
+Image::RegistryStats Image::registryStats()
+{
+    return detail::imageRegistry().stats();
+}
+
 Image::Image()
     : empty_(true)
 {
@@ -345,6 +685,8 @@ void Image::load() const
 {
     assertInGuiThread();
 
+    this->lastRequested_ = detail::currentMs();
+
     if (this->shouldLoad_)
     {
         const_cast<Image *>(this)->shouldLoad_ = false;
@@ -369,6 +711,13 @@ bool Image::animated() const
     return this->frames_->animated();
 }
 
+int64_t Image::memoryUsage() const
+{
+    assertInGuiThread();
+
+    return this->frames_->memoryUsage();
+}
+
 int Image::width() const
 {
     assertInGuiThread();
@@ -391,37 +740,22 @@ int Image::height() const
 
 void Image::actuallyLoad()
 {
+#ifndef CHATTERINO_TEST
+    // settings can only be read from the GUI thread
+    this->decodeOnDemand_ =
+        getSettings()->decodeAnimatedEmotesOnDemand.getValue();
+#endif
+
     NetworkRequest(this->url().string)
         .concurrent()
         .cache()
+        .priority(NetworkRequestPriority::Image)
         .onSuccess([weak = weakOf(this)](auto result) -> Outcome {
             auto shared = weak.lock();
             if (!shared)
                 return Failure;
 
-            auto data = result.getData();
-
-            // const cast since we are only reading from it
-            QBuffer buffer(const_cast<QByteArray *>(&data));
-            buffer.open(QIODevice::ReadOnly);
-            QImageReader reader(&buffer);
-
-            // use "double" to prevent int overflows
-            if (double(reader.size().width()) * double(reader.size().height()) *
-                    double(reader.imageCount()) * 4.0 >
-                double(Image::maxBytesRam))
-            {
-                qCDebug(chatterinoImage) << "image too large in RAM";
-
-                return Failure;
-            }
-
-            auto parsed = detail::readFrames(reader, shared->url());
-
-            postToThread(makeConvertCallback(parsed, [weak](auto frames) {
-                if (auto shared = weak.lock())
-                    shared->frames_ = std::make_unique<detail::Frames>(frames);
-            }));
+            shared->scheduleDecode(result.getData());
 
             return Success;
         })
@@ -438,6 +772,79 @@ void Image::actuallyLoad()
         .execute();
 }
 
+void Image::scheduleDecode(QByteArray data, bool yielded)
+{
+    auto priority = yielded ? -1 : this->requestedRecently() ? 1 : 0;
+
+    detail::decodePool()->start(
+        new LambdaRunnable([weak = weakOf(this), data, yielded] {
+            auto shared = weak.lock();
+            if (!shared)
+            {
+                // nothing shows the image anymore
+                return;
+            }
+
+            if (!yielded && !shared->requestedRecently())
+            {
+                // scrolled away while waiting, let images that are on screen
+                // go first
+                shared->scheduleDecode(data, true);
+                return;
+            }
+
+            shared->decode(data);
+        }),
+        priority);
+}
+
+void Image::decode(const QByteArray &data)
+{
+    TraceSpan span("Image::decode", "image");
+    span.setDetail(this->url().string);
+
+    QBuffer buffer;
+    buffer.setData(data);
+    buffer.open(QIODevice::ReadOnly);
+    QImageReader reader(&buffer);
+
+    // use "double" to prevent int overflows
+    if (double(reader.size().width()) * double(reader.size().height()) *
+            double(reader.imageCount()) * 4.0 >
+        double(Image::maxBytesRam))
+    {
+        qCDebug(chatterinoImage) << "image too large in RAM";
+
+        return;
+    }
+
+    // animations that are decoded while they're shown only need their first
+    // frame for now
+    auto frameCount = reader.imageCount();
+    auto parsed = detail::readFrames(reader, this->url(),
+                                     this->decodeOnDemand_ && frameCount > 1);
+
+    postToThread([weak = weakOf(this), data, frameCount, parsed] {
+        if (auto shared = weak.lock())
+        {
+            shared->frames_ = detail::makeFrames(data, frameCount, parsed);
+
+            detail::queueLayoutForLoadedImages();
+        }
+    });
+}
+
+pajlada::Signals::NoArgSignal &Image::imagesLoaded()
+{
+    static pajlada::Signals::NoArgSignal signal;
+    return signal;
+}
+
+bool Image::requestedRecently() const
+{
+    return detail::currentMs() - this->lastRequested_ < IMAGE_ON_SCREEN_MS;
+}
+
 bool Image::operator==(const Image &other) const
 {
     if (this->isEmpty() && other.isEmpty())
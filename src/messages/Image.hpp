@@ -15,6 +15,8 @@
 #include "common/Aliases.hpp"
 #include "common/Common.hpp"
 
+class QImageReader;
+
 namespace chatterino {
 namespace detail {
     template <typename Image>
@@ -27,20 +29,39 @@ namespace detail {
     public:
         Frames();
         Frames(const QVector<Frame<QPixmap>> &frames);
+        // Keeps the encoded image around and only decodes a few frames at a
+        // time while they're shown
+        Frames(const QByteArray &data, int frameCount,
+               const Frame<QPixmap> &first);
         ~Frames();
 
         bool animated() const;
         void advance();
         boost::optional<QPixmap> current() const;
         boost::optional<QPixmap> first() const;
+        // bytes used by the decoded frames (and the encoded data of
+        // animations that are decoded while they're shown)
+        int64_t memoryUsage() const;
 
     private:
+        class Decoder;
+
+        void initialize();
         void processOffset();
+        int frameCount() const;
+        int frameDuration(int index) const;
+
         QVector<Frame<QPixmap>> items_;
+        std::unique_ptr<Decoder> decoder_;
         int index_{0};
         int durationOffset_{0};
         pajlada::Signals::Connection gifTimerConnection_;
     };
+
+    // Only reads the first frame if firstOnly is set, the others are decoded
+    // while the image is shown then
+    QVector<Frame<QImage>> readFrames(QImageReader &reader, const Url &url,
+                                      bool firstOnly);
 }  // namespace detail
 
 class Image;
@@ -53,11 +74,24 @@ public:
     // Maximum amount of RAM used by the image in bytes.
     static constexpr int maxBytesRam = 20 * 1024 * 1024;
 
+    struct RegistryStats {
+        // number of images that are currently alive
+        size_t size;
+        uint64_t hits;
+        uint64_t misses;
+    };
+
     ~Image();
 
+    /// Returns the image for url. Images are shared as long as they're
+    /// alive, so requesting the same url again doesn't load it again.
     static ImagePtr fromUrl(const Url &url, qreal scale = 1);
     static ImagePtr fromPixmap(const QPixmap &pixmap, qreal scale = 1);
     static ImagePtr getEmpty();
+    static RegistryStats registryStats();
+    /// Invoked on the GUI thread after images finished loading, at most
+    /// every 20 ms
+    static pajlada::Signals::NoArgSignal &imagesLoaded();
 
     const Url &url() const;
     bool loaded() const;
@@ -69,6 +103,8 @@ public:
     int width() const;
     int height() const;
     bool animated() const;
+    // estimated bytes used by the frames, 0 while not loaded
+    int64_t memoryUsage() const;
 
     bool operator==(const Image &image) const;
     bool operator!=(const Image &image) const;
@@ -80,10 +116,20 @@ private:
 
     void setPixmap(const QPixmap &pixmap);
     void actuallyLoad();
+    // Decodes data on the decode pool. Images that were requested recently
+    // (i.e. are on screen) are decoded first.
+    void scheduleDecode(QByteArray data, bool yielded = false);
+    void decode(const QByteArray &data);
+    bool requestedRecently() const;
 
     const Url url_{};
     const qreal scale_{1};
     std::atomic_bool empty_{false};
+    // last time the image was painted or laid out, in ms of a steady clock
+    mutable std::atomic<int64_t> lastRequested_{0};
+
+    // set on the GUI thread before the image is loaded
+    bool decodeOnDemand_{false};
 
     // gui thread only
     bool shouldLoad_{false};
@@ -212,6 +212,40 @@ public:
         return false;
     }
 
+    // removes the first item before the limit is reached, returns false if
+    // the queue is empty
+    bool popFront(T &deleted)
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+
+        if (this->limit_ - this->space() == 0)
+        {
+            return false;
+        }
+
+        if (this->chunks_->size() > 1)
+        {
+            deleted = this->chunks_->front()->at(this->firstChunkOffset_);
+            this->removeFirstItem();
+            return true;
+        }
+
+        // A single chunk always starts at the beginning, so the remaining
+        // items are moved into a new chunk. Snapshots still use the old one.
+        auto &chunk = *this->chunks_->front();
+        deleted = chunk.at(0);
+
+        auto newChunk = std::make_shared<Chunk>(
+            chunk.begin() + 1, chunk.begin() + this->lastChunkEnd_);
+        newChunk->resize(chunk.size());
+
+        this->chunks_ = std::make_shared<ChunkVector>();
+        this->chunks_->push_back(newChunk);
+        this->lastChunkEnd_--;
+
+        return true;
+    }
+
     //    void insertAfter(const std::vector<T> &items, const T &index)
 
     LimitedQueueSnapshot<T> getSnapshot()
@@ -256,6 +290,14 @@ private:
 
         deleted = this->chunks_->front()->at(this->firstChunkOffset_);
 
+        this->removeFirstItem();
+
+        return true;
+    }
+
+    // has to be called with more than one chunk
+    void removeFirstItem()
+    {
         // need to delete the first chunk
         if (this->firstChunkOffset_ == this->chunks_->front()->size() - 1)
         {
@@ -280,8 +322,6 @@ private:
         {
             this->firstChunkOffset_++;
         }
-
-        return true;
     }
 
     std::shared_ptr<ChunkVector> chunks_;
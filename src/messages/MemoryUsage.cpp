@@ -0,0 +1,46 @@
+#include "messages/MemoryUsage.hpp"
+
+#include "messages/Image.hpp"
+
+namespace chatterino {
+
+int64_t MemoryUsage::total() const
+{
+    return this->messages + this->elements + this->layouts + this->buffers +
+           this->images;
+}
+
+void MemoryUsage::addImage(const ImagePtr &image)
+{
+    if (this->countImages && image &&
+        this->countedImages_.insert(image.get()).second)
+    {
+        this->images += image->memoryUsage();
+    }
+}
+
+QJsonObject MemoryUsage::toJson() const
+{
+    return {
+        {"messageCount", double(this->messageCount)},
+        {"messages", double(this->messages)},
+        {"elements", double(this->elements)},
+        {"layouts", double(this->layouts)},
+        {"buffers", double(this->buffers)},
+        {"images", double(this->images)},
+        {"total", double(this->total())},
+    };
+}
+
+int64_t MemoryUsage::stringSize(const QString &string)
+{
+    // strings are implicitly shared, so this counts shared data every time
+    return string.capacity() * int64_t(sizeof(QChar));
+}
+
+int64_t MemoryUsage::pixmapSize(const QPixmap &pixmap)
+{
+    return int64_t(pixmap.width()) * pixmap.height() * pixmap.depth() / 8;
+}
+
+}  // namespace chatterino
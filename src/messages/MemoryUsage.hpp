@@ -0,0 +1,50 @@
+#pragma once
+
+#include <QJsonObject>
+#include <QPixmap>
+#include <QString>
+
+#include <cstdint>
+#include <memory>
+#include <unordered_set>
+
+namespace chatterino {
+
+class Image;
+using ImagePtr = std::shared_ptr<Image>;
+
+/// Estimated number of bytes used by messages and what's made from them. Only
+/// meant to find the channels and splits that use the most memory, allocator
+/// overhead and memory shared with Qt aren't known.
+struct MemoryUsage {
+    int64_t messageCount = 0;
+    // Message objects and their strings
+    int64_t messages = 0;
+    // MessageElements and their words
+    int64_t elements = 0;
+    // MessageLayouts, their containers and layout elements
+    int64_t layouts = 0;
+    // pixmaps the layouts are painted into
+    int64_t buffers = 0;
+    // decoded frames of the referenced images, every image is counted once
+    int64_t images = 0;
+    // images can only be looked at from the GUI thread
+    bool countImages = true;
+
+    int64_t total() const;
+
+    /// Adds the image unless it was added already. Has to be called from the
+    /// GUI thread.
+    void addImage(const ImagePtr &image);
+
+    QJsonObject toJson() const;
+
+    // only the heap memory of the string, not the QString itself
+    static int64_t stringSize(const QString &string);
+    static int64_t pixmapSize(const QPixmap &pixmap);
+
+private:
+    std::unordered_set<const Image *> countedImages_;
+};
+
+}  // namespace chatterino
@@ -2,6 +2,7 @@
 
 #include "Application.hpp"
 #include "MessageElement.hpp"
+#include "messages/MemoryUsage.hpp"
 #include "providers/twitch/PubsubActions.hpp"
 #include "singletons/Theme.hpp"
 #include "util/DebugCount.hpp"
@@ -50,4 +51,32 @@ namespace {
 
 }  // namespace
 
+void Message::addMemoryUsage(MemoryUsage &usage) const
+{
+    usage.messageCount++;
+    usage.messages += sizeof(Message) + MemoryUsage::stringSize(this->id) +
+                      MemoryUsage::stringSize(this->searchText) +
+                      MemoryUsage::stringSize(this->messageText) +
+                      MemoryUsage::stringSize(this->loginName) +
+                      MemoryUsage::stringSize(this->displayName) +
+                      MemoryUsage::stringSize(this->localizedName) +
+                      MemoryUsage::stringSize(this->timeoutUser) +
+                      MemoryUsage::stringSize(this->channelName) +
+                      this->badges.capacity() * sizeof(Badge) +
+                      this->elements.capacity() * sizeof(this->elements[0]);
+
+    for (auto &&[key, value] : this->badgeInfos)
+    {
+        // the map node holds the pair and three pointers
+        usage.messages += sizeof(std::pair<const QString, QString>) +
+                          3 * sizeof(void *) + MemoryUsage::stringSize(key) +
+                          MemoryUsage::stringSize(value);
+    }
+
+    for (auto &&element : this->elements)
+    {
+        element->addMemoryUsage(usage);
+    }
+}
+
 }  // namespace chatterino
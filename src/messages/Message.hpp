@@ -12,6 +12,7 @@
 
 namespace chatterino {
 class MessageElement;
+struct MemoryUsage;
 
 enum class MessageFlag : uint32_t {
     None = 0,
@@ -69,6 +70,8 @@ struct Message : boost::noncopyable {
     std::vector<std::unique_ptr<MessageElement>> elements;
 
     ScrollbarHighlight getScrollBarHighlight() const;
+    // Adds the estimated size of the message and its elements
+    void addMemoryUsage(MemoryUsage &usage) const;
 };
 
 using MessagePtr = std::shared_ptr<const Message>;
@@ -4,6 +4,7 @@
 #include "common/IrcColors.hpp"
 #include "debug/Benchmark.hpp"
 #include "messages/Emote.hpp"
+#include "messages/MemoryUsage.hpp"
 #include "messages/layouts/MessageLayoutContainer.hpp"
 #include "messages/layouts/MessageLayoutElement.hpp"
 #include "singletons/Settings.hpp"
@@ -14,6 +15,13 @@ namespace chatterino {
 
 namespace {
 
+    void addImages(MemoryUsage &usage, const ImageSet &images)
+    {
+        usage.addImage(images.getImage1());
+        usage.addImage(images.getImage2());
+        usage.addImage(images.getImage3());
+    }
+
     QRegularExpression IRC_COLOR_PARSE_REGEX(
         "(\u0003(\\d{1,2})?(,(\\d{1,2}))?|\u000f)",
         QRegularExpression::UseUnicodePropertiesOption);
@@ -103,6 +111,15 @@ MessageElement *MessageElement::updateLink()
     return this;
 }
 
+void MessageElement::addMemoryUsage(MemoryUsage &usage) const
+{
+    usage.elements += sizeof(MessageElement) +
+                      MemoryUsage::stringSize(this->text_) +
+                      MemoryUsage::stringSize(this->link_.value) +
+                      MemoryUsage::stringSize(this->tooltip_);
+    usage.addImage(this->thumbnail_);
+}
+
 // Empty
 EmptyElement::EmptyElement()
     : MessageElement(MessageElementFlag::None)
@@ -141,6 +158,13 @@ void ImageElement::addToContainer(MessageLayoutContainer &container,
     }
 }
 
+void ImageElement::addMemoryUsage(MemoryUsage &usage) const
+{
+    MessageElement::addMemoryUsage(usage);
+    usage.elements += sizeof(ImageElement) - sizeof(MessageElement);
+    usage.addImage(this->image_);
+}
+
 // EMOTE
 EmoteElement::EmoteElement(const EmotePtr &emote, MessageElementFlags flags)
     : MessageElement(flags)
@@ -189,6 +213,17 @@ void EmoteElement::addToContainer(MessageLayoutContainer &container,
     }
 }
 
+void EmoteElement::addMemoryUsage(MemoryUsage &usage) const
+{
+    MessageElement::addMemoryUsage(usage);
+    usage.elements += sizeof(EmoteElement) - sizeof(MessageElement);
+    if (this->textElement_)
+    {
+        this->textElement_->addMemoryUsage(usage);
+    }
+    addImages(usage, this->emote_->images);
+}
+
 MessageLayoutElement *EmoteElement::makeImageLayoutElement(
     const ImagePtr &image, const QSize &size)
 {
@@ -225,6 +260,13 @@ EmotePtr BadgeElement::getEmote() const
     return this->emote_;
 }
 
+void BadgeElement::addMemoryUsage(MemoryUsage &usage) const
+{
+    MessageElement::addMemoryUsage(usage);
+    usage.elements += sizeof(BadgeElement) - sizeof(MessageElement);
+    addImages(usage, this->emote_->images);
+}
+
 MessageLayoutElement *BadgeElement::makeImageLayoutElement(
     const ImagePtr &image, const QSize &size)
 {
@@ -310,27 +352,18 @@ void TextElement::addToContainer(MessageLayoutContainer &container,
     {
         QFontMetrics metrics =
             app->fonts->getFontMetrics(this->style_, container.getScale());
+        auto color = app->themes->getNormalizedColor(
+            this->color_.getColor(*app->themes));
 
         for (Word &word : this->words_)
         {
-            auto getTextLayoutElement = [&](QString text, int width,
+            auto getTextLayoutElement = [&](const QString &text, int width,
                                             bool hasTrailingSpace) {
-                auto color = this->color_.getColor(*app->themes);
-                app->themes->normalizeColor(color);
-
-                auto e = (new TextLayoutElement(
-                              *this, text, QSize(width, metrics.height()),
-                              color, this->style_, container.getScale()))
-                             ->setLink(this->getLink());
+                auto e = container.createElement<TextLayoutElement>(
+                    *this, text, QSize(width, metrics.height()), color,
+                    this->style_, container.getScale());
                 e->setTrailingSpace(hasTrailingSpace);
-                e->setText(text);
 
-                // If URL link was changed,
-                // Should update it in MessageLayoutElement too!
-                if (this->getLink().type == Link::Url)
-                {
-                    static_cast<TextLayoutElement *>(e)->listenToLinkChanges();
-                }
                 return e;
             };
 
@@ -403,6 +436,17 @@ void TextElement::addToContainer(MessageLayoutContainer &container,
     }
 }
 
+void TextElement::addMemoryUsage(MemoryUsage &usage) const
+{
+    MessageElement::addMemoryUsage(usage);
+    usage.elements += sizeof(TextElement) - sizeof(MessageElement) +
+                      this->words_.capacity() * sizeof(Word);
+    for (auto &&word : this->words_)
+    {
+        usage.elements += MemoryUsage::stringSize(word.text);
+    }
+}
+
 // TIMESTAMP
 TimestampElement::TimestampElement(QTime time)
     : MessageElement(MessageElementFlag::Timestamp)
@@ -437,6 +481,14 @@ TextElement *TimestampElement::formatTime(const QTime &time)
                            MessageColor::System, FontStyle::ChatMedium);
 }
 
+void TimestampElement::addMemoryUsage(MemoryUsage &usage) const
+{
+    MessageElement::addMemoryUsage(usage);
+    usage.elements += sizeof(TimestampElement) - sizeof(MessageElement) +
+                      MemoryUsage::stringSize(this->format_);
+    this->element_->addMemoryUsage(usage);
+}
+
 // TWITCH MODERATION
 TwitchModerationElement::TwitchModerationElement()
     : MessageElement(MessageElementFlag::ModeratorTools)
@@ -568,10 +620,11 @@ void IrcTextElement::addToContainer(MessageLayoutContainer &container,
 
         for (auto &word : this->words_)
         {
-            auto getTextLayoutElement = [&](QString text,
-                                            std::vector<Segment> segments,
-                                            int width, bool hasTrailingSpace) {
-                std::vector<PajSegment> xd{};
+            auto getTextLayoutElement = [&](const QString &text,
+                                            const auto &segments, int width,
+                                            bool hasTrailingSpace) {
+                std::vector<PajSegment> xd;
+                xd.reserve(segments.size());
 
                 for (const auto &segment : segments)
                 {
@@ -580,23 +633,15 @@ void IrcTextElement::addToContainer(MessageLayoutContainer &container,
                     {
                         color = IRC_COLORS[segment.fg];
                     }
-                    app->themes->normalizeColor(color);
-                    xd.emplace_back(PajSegment{segment.text, color});
+                    xd.emplace_back(PajSegment{
+                        segment.text, app->themes->getNormalizedColor(color)});
                 }
 
-                auto e = (new MultiColorTextLayoutElement(
-                              *this, text, QSize(width, metrics.height()), xd,
-                              this->style_, container.getScale()))
-                             ->setLink(this->getLink());
+                auto e = container.createElement<MultiColorTextLayoutElement>(
+                    *this, text, QSize(width, metrics.height()), std::move(xd),
+                    this->style_, container.getScale());
                 e->setTrailingSpace(true);
-                e->setText(text);
 
-                // If URL link was changed,
-                // Should update it in MessageLayoutElement too!
-                if (this->getLink().type == Link::Url)
-                {
-                    static_cast<TextLayoutElement *>(e)->listenToLinkChanges();
-                }
                 return e;
             };
 
@@ -717,6 +762,22 @@ void IrcTextElement::addToContainer(MessageLayoutContainer &container,
     }
 }
 
+void IrcTextElement::addMemoryUsage(MemoryUsage &usage) const
+{
+    MessageElement::addMemoryUsage(usage);
+    usage.elements += sizeof(IrcTextElement) - sizeof(MessageElement) +
+                      this->words_.capacity() * sizeof(Word);
+    for (auto &&word : this->words_)
+    {
+        usage.elements += MemoryUsage::stringSize(word.text) +
+                          word.segments.capacity() * sizeof(Segment);
+        for (auto &&segment : word.segments)
+        {
+            usage.elements += MemoryUsage::stringSize(segment.text);
+        }
+    }
+}
+
 LinebreakElement::LinebreakElement(MessageElementFlags flags)
     : MessageElement(flags)
 {
@@ -756,4 +817,11 @@ void ScalingImageElement::addToContainer(MessageLayoutContainer &container,
     }
 }
 
+void ScalingImageElement::addMemoryUsage(MemoryUsage &usage) const
+{
+    MessageElement::addMemoryUsage(usage);
+    usage.elements += sizeof(ScalingImageElement) - sizeof(MessageElement);
+    addImages(usage, this->images_);
+}
+
 }  // namespace chatterino
@@ -17,6 +17,7 @@
 
 namespace chatterino {
 class Channel;
+struct MemoryUsage;
 struct MessageLayoutContainer;
 class MessageLayoutElement;
 
@@ -166,6 +167,9 @@ public:
     virtual void addToContainer(MessageLayoutContainer &container,
                                 MessageElementFlags flags) = 0;
 
+    // Adds the estimated size of the element and the images it references
+    virtual void addMemoryUsage(MemoryUsage &usage) const;
+
     pajlada::Signals::NoArgSignal linkChanged;
 
 protected:
@@ -204,6 +208,7 @@ public:
 
     void addToContainer(MessageLayoutContainer &container,
                         MessageElementFlags flags) override;
+    void addMemoryUsage(MemoryUsage &usage) const override;
 
 private:
     ImagePtr image_;
@@ -220,6 +225,7 @@ public:
 
     void addToContainer(MessageLayoutContainer &container,
                         MessageElementFlags flags) override;
+    void addMemoryUsage(MemoryUsage &usage) const override;
 
 private:
     MessageColor color_;
@@ -242,6 +248,7 @@ public:
 
     void addToContainer(MessageLayoutContainer &container,
                         MessageElementFlags flags_) override;
+    void addMemoryUsage(MemoryUsage &usage) const override;
     EmotePtr getEmote() const;
 
 protected:
@@ -260,6 +267,7 @@ public:
 
     void addToContainer(MessageLayoutContainer &container,
                         MessageElementFlags flags_) override;
+    void addMemoryUsage(MemoryUsage &usage) const override;
 
     EmotePtr getEmote() const;
 
@@ -312,6 +320,7 @@ public:
 
     void addToContainer(MessageLayoutContainer &container,
                         MessageElementFlags flags) override;
+    void addMemoryUsage(MemoryUsage &usage) const override;
 
     TextElement *formatTime(const QTime &time);
 
@@ -343,6 +352,7 @@ public:
 
     void addToContainer(MessageLayoutContainer &container,
                         MessageElementFlags flags) override;
+    void addMemoryUsage(MemoryUsage &usage) const override;
 
 private:
     FontStyle style_;
@@ -380,6 +390,7 @@ public:
 
     void addToContainer(MessageLayoutContainer &container,
                         MessageElementFlags flags) override;
+    void addMemoryUsage(MemoryUsage &usage) const override;
 
 private:
     ImageSet images_;
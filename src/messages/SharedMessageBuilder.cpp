@@ -3,6 +3,7 @@
 #include "Application.hpp"
 #include "common/QLogging.hpp"
 #include "controllers/ignores/IgnorePhrase.hpp"
+#include "controllers/ignores/IgnorePhraseMatcher.hpp"
 #include "messages/Message.hpp"
 #include "messages/MessageElement.hpp"
 #include "singletons/Settings.hpp"
@@ -104,17 +105,13 @@ void SharedMessageBuilder::parse()
 
 bool SharedMessageBuilder::isIgnored() const
 {
-    // TODO(pajlada): Do we need to check if the phrase is valid first?
-    auto phrases = getCSettings().ignoredMessages.readOnly();
-    for (const auto &phrase : *phrases)
+    auto matcher = IgnorePhraseMatcher::current();
+    if (const auto *phrase = matcher->findBlock(this->originalMessage_))
     {
-        if (phrase.isBlock() && phrase.isMatch(this->originalMessage_))
-        {
-            qCDebug(chatterinoMessage)
-                << "Blocking message because it contains ignored phrase"
-                << phrase.getPattern();
-            return true;
-        }
+        qCDebug(chatterinoMessage)
+            << "Blocking message because it contains ignored phrase"
+            << phrase->getPattern();
+        return true;
     }
 
     return false;
@@ -0,0 +1,155 @@
+#include "messages/UserMessageIndex.hpp"
+
+#include "messages/Message.hpp"
+
+#include <algorithm>
+
+namespace chatterino {
+
+void UserMessageIndex::append(const MessagePtr &message)
+{
+    auto keys = keysOf(*message);
+
+    std::lock_guard<std::mutex> lock(this->mutex_);
+
+    auto order = this->back_++;
+    for (auto &key : keys)
+    {
+        this->entries_[key].push_back({order, message});
+    }
+}
+
+void UserMessageIndex::prepend(const std::vector<MessagePtr> &messages)
+{
+    std::lock_guard<std::mutex> lock(this->mutex_);
+
+    for (auto it = messages.rbegin(); it != messages.rend(); ++it)
+    {
+        auto order = --this->front_;
+        for (auto &key : keysOf(**it))
+        {
+            this->entries_[key].push_front({order, *it});
+        }
+    }
+}
+
+void UserMessageIndex::removeFirst(const MessagePtr &message)
+{
+    auto keys = keysOf(*message);
+
+    std::lock_guard<std::mutex> lock(this->mutex_);
+
+    auto order = this->front_++;
+    for (auto &key : keys)
+    {
+        this->erase(key, order);
+    }
+}
+
+void UserMessageIndex::replace(size_t index, const MessagePtr &message,
+                               const MessagePtr &replacement)
+{
+    auto keys = keysOf(*message);
+    auto newKeys = keysOf(*replacement);
+
+    std::lock_guard<std::mutex> lock(this->mutex_);
+
+    auto order = this->front_ + int64_t(index);
+    for (auto &key : keys)
+    {
+        this->erase(key, order);
+    }
+    for (auto &key : newKeys)
+    {
+        this->insert(key, {order, replacement});
+    }
+}
+
+std::vector<MessagePtr> UserMessageIndex::find(const QString &loginName) const
+{
+    std::vector<MessagePtr> messages;
+
+    std::lock_guard<std::mutex> lock(this->mutex_);
+
+    auto it = this->entries_.find(loginName.toLower());
+    if (it != this->entries_.end())
+    {
+        messages.reserve(it->second.size());
+        for (auto &entry : it->second)
+        {
+            messages.push_back(entry.message);
+        }
+    }
+
+    return messages;
+}
+
+QStringList UserMessageIndex::keysOf(const Message &message)
+{
+    QStringList keys;
+
+    auto add = [&keys](const QString &name) {
+        if (!name.isEmpty())
+        {
+            auto key = name.toLower();
+            if (!keys.contains(key))
+            {
+                keys.append(key);
+            }
+        }
+    };
+
+    add(message.loginName);
+
+    // deleted messages use "msg:<id>" instead of a user
+    if (!message.timeoutUser.startsWith("msg:"))
+    {
+        add(message.timeoutUser);
+    }
+
+    // subscription notices name the user in the first word
+    if (message.flags.has(MessageFlag::Subscription) &&
+        message.loginName.isEmpty())
+    {
+        add(message.messageText.section(' ', 0, 0));
+    }
+
+    return keys;
+}
+
+void UserMessageIndex::insert(const QString &key, Entry entry)
+{
+    auto &entries = this->entries_[key];
+
+    auto it = std::lower_bound(entries.begin(), entries.end(), entry.order,
+                               [](const Entry &candidate, int64_t order) {
+                                   return candidate.order < order;
+                               });
+    entries.insert(it, std::move(entry));
+}
+
+void UserMessageIndex::erase(const QString &key, int64_t order)
+{
+    auto it = this->entries_.find(key);
+    if (it == this->entries_.end())
+    {
+        return;
+    }
+
+    auto &entries = it->second;
+    auto entry = std::lower_bound(entries.begin(), entries.end(), order,
+                                  [](const Entry &candidate, int64_t order) {
+                                      return candidate.order < order;
+                                  });
+    if (entry != entries.end() && entry->order == order)
+    {
+        entries.erase(entry);
+    }
+
+    if (entries.empty())
+    {
+        this->entries_.erase(it);
+    }
+}
+
+}  // namespace chatterino
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <QString>
+#include <QStringList>
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace chatterino {
+
+struct Message;
+using MessagePtr = std::shared_ptr<const Message>;
+
+/// Maps login names to the messages of a channel that are about that user:
+/// their own messages, timeouts and bans of them and their subscription
+/// notices. Kept in sync with the message queue of the channel so looking up
+/// a user only costs as much as the user has messages.
+class UserMessageIndex
+{
+public:
+    // The calls mirror the changes to the message queue of the channel:
+    // message was added after all other messages
+    void append(const MessagePtr &message);
+    // messages (oldest first) were added before all other messages
+    void prepend(const std::vector<MessagePtr> &messages);
+    // the oldest message was trimmed
+    void removeFirst(const MessagePtr &message);
+    // the message at index was replaced
+    void replace(size_t index, const MessagePtr &message,
+                 const MessagePtr &replacement);
+
+    // returns the messages about the user, oldest first
+    std::vector<MessagePtr> find(const QString &loginName) const;
+
+    // lowercase login names a message is indexed under
+    static QStringList keysOf(const Message &message);
+
+private:
+    struct Entry {
+        // position of the message in the channel, the oldest message has
+        // front_
+        int64_t order;
+        MessagePtr message;
+    };
+
+    void insert(const QString &key, Entry entry);
+    void erase(const QString &key, int64_t order);
+
+    mutable std::mutex mutex_;
+    std::unordered_map<QString, std::deque<Entry>> entries_;
+    int64_t front_ = 0;
+    int64_t back_ = 0;
+};
+
+}  // namespace chatterino
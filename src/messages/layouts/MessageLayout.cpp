@@ -1,7 +1,10 @@
 #include "messages/layouts/MessageLayout.hpp"
 
 #include "Application.hpp"
+#include "debug/AssertInGuiThread.hpp"
 #include "debug/Benchmark.hpp"
+#include "debug/Trace.hpp"
+#include "messages/MemoryUsage.hpp"
 #include "messages/Message.hpp"
 #include "messages/MessageElement.hpp"
 #include "messages/layouts/MessageLayoutContainer.hpp"
@@ -16,6 +19,8 @@
 #include <QPainter>
 #include <QThread>
 #include <QtGlobal>
+#include <tuple>
+#include <unordered_map>
 
 #define MARGIN_LEFT (int)(8 * this->scale)
 #define MARGIN_RIGHT (int)(8 * this->scale)
@@ -36,11 +41,108 @@ namespace {
                        base.blueF() * (1 - alpha) + apply.blueF() * alpha);
         return result;
     }
+
+    // Everything the container of a layout depends on
+    struct LayoutKey {
+        const Message *message;
+        int width;
+        float scale;
+        int64_t elementFlags;
+        int layoutFlags;
+        int generation;
+
+        bool operator==(const LayoutKey &other) const
+        {
+            return std::tie(this->message, this->width, this->scale,
+                            this->elementFlags, this->layoutFlags,
+                            this->generation) ==
+                   std::tie(other.message, other.width, other.scale,
+                            other.elementFlags, other.layoutFlags,
+                            other.generation);
+        }
+    };
+
+    struct LayoutKeyHash {
+        size_t operator()(const LayoutKey &key) const
+        {
+            auto hash = std::hash<const Message *>()(key.message);
+            for (auto value : {size_t(key.width), size_t(key.scale * 1000),
+                               size_t(key.elementFlags),
+                               size_t(key.layoutFlags),
+                               size_t(key.generation)})
+            {
+                hash = hash * 31 + value;
+            }
+            return hash;
+        }
+    };
+}  // namespace
+
+struct MessageLayout::Shared {
+    explicit Shared(std::shared_ptr<MessageLayoutContainer> _container)
+        : container(std::move(_container))
+    {
+    }
+
+    std::shared_ptr<MessageLayoutContainer> container;
+    // number of loading elements when the layout was made
+    int loadingElements = 0;
+};
+
+namespace {
+    // Splits that show the same channel lay out every message the same way,
+    // so the layouts are only made once. Only accessed from the gui thread.
+    class SharedLayouts
+    {
+    public:
+        template <typename Shared>
+        std::shared_ptr<Shared> find(const LayoutKey &key)
+        {
+            auto it = this->layouts_.find(key);
+            if (it == this->layouts_.end())
+            {
+                return nullptr;
+            }
+
+            return std::static_pointer_cast<Shared>(it->second.lock());
+        }
+
+        void insert(const LayoutKey &key, std::shared_ptr<void> shared)
+        {
+            this->layouts_[key] = shared;
+
+            // forget the layouts of messages that aren't shown anymore
+            if (++this->insertions_ % 1024 == 0)
+            {
+                for (auto it = this->layouts_.begin();
+                     it != this->layouts_.end();)
+                {
+                    if (it->second.expired())
+                        it = this->layouts_.erase(it);
+                    else
+                        ++it;
+                }
+            }
+        }
+
+    private:
+        std::unordered_map<LayoutKey, std::weak_ptr<void>, LayoutKeyHash>
+            layouts_;
+        size_t insertions_ = 0;
+    };
+
+    SharedLayouts &sharedLayouts()
+    {
+        static SharedLayouts layouts;
+        return layouts;
+    }
 }  // namespace
 
 MessageLayout::MessageLayout(MessagePtr message)
     : message_(std::move(message))
-    , container_(std::make_shared<MessageLayoutContainer>())
+    , shared_(std::make_shared<Shared>(
+          std::make_shared<MessageLayoutContainer>()))
+    , container_(this->shared_->container)
 {
     DebugCount::increase("message layout");
 }
@@ -96,23 +198,91 @@ bool MessageLayout::layout(int width, float scale, MessageElementFlags flags)
     layoutRequired |= this->scale_ != scale;
     this->scale_ = scale;
 
+    // check if the message was disabled (e.g. the user was timed out), which
+    // hides its elements with the "hide moderated" setting
+    bool disabled = this->message_->flags.has(MessageFlag::Disabled);
+    layoutRequired |= this->disabled_ != disabled;
+    this->disabled_ = disabled;
+
+    // check if images finished loading since the last layout
+    if (this->hasLoadedImages())
+    {
+        layoutRequired = true;
+        this->flags.set(MessageLayoutFlag::RequiresBufferUpdate);
+    }
+
     if (!layoutRequired)
     {
         return false;
     }
 
-    int oldHeight = this->container_->getHeight();
     this->actuallyLayout(width, flags);
-    if (widthChanged || this->container_->getHeight() != oldHeight)
-    {
-        this->deleteBuffer();
-    }
-    this->invalidateBuffer();
+    this->invalidateContent();
 
     return true;
 }
 
+bool MessageLayout::hasLoadedImages() const
+{
+    return this->loadingElements_ > 0 &&
+           this->container_->getLoadingElementCount() < this->loadingElements_;
+}
+
 void MessageLayout::actuallyLayout(int width, MessageElementFlags flags)
+{
+    assertInGuiThread();
+
+    auto key = LayoutKey{
+        this->message_.get(),
+        width,
+        this->scale_,
+        int64_t(flags.value()),
+        (this->flags.has(MessageLayoutFlag::AlternateBackground) ? 1 : 0) |
+            (this->flags.has(MessageLayoutFlag::IgnoreHighlights) ? 2 : 0) |
+            (this->flags.has(MessageLayoutFlag::Expanded) ? 4 : 0) |
+            (this->disabled_ ? 8 : 0),
+        getApp()->windows->getGeneration(),
+    };
+
+    // another view already laid out the message the same way, unless one of
+    // its images finished loading since then
+    auto shared = sharedLayouts().find<Shared>(key);
+    if (shared && shared->container->getLoadingElementCount() ==
+                      shared->loadingElements)
+    {
+        this->shared_ = shared;
+    }
+    else
+    {
+        // when no other view uses the current layout, its container and the
+        // memory of its elements can be used again
+        auto container =
+            this->shared_.use_count() == 1 && this->container_.use_count() == 2
+                ? this->shared_->container
+                : std::make_shared<MessageLayoutContainer>();
+
+        this->shared_ = std::make_shared<Shared>(std::move(container));
+        this->layoutContainer(*this->shared_->container, width, flags);
+        this->shared_->loadingElements =
+            this->shared_->container->getLoadingElementCount();
+
+        sharedLayouts().insert(key, this->shared_);
+    }
+
+    this->container_ = this->shared_->container;
+    this->height_ = this->container_->getHeight();
+    this->loadingElements_ = this->shared_->loadingElements;
+
+    // collapsed state
+    this->flags.unset(MessageLayoutFlag::Collapsed);
+    if (this->container_->isCollapsed())
+    {
+        this->flags.set(MessageLayoutFlag::Collapsed);
+    }
+}
+
+void MessageLayout::layoutContainer(MessageLayoutContainer &container,
+                                    int width, MessageElementFlags flags)
 {
     this->layoutCount_++;
     auto messageFlags = this->message_->flags;
@@ -124,7 +294,7 @@ void MessageLayout::actuallyLayout(int width, MessageElementFlags flags)
         messageFlags.unset(MessageFlag::Collapsed);
     }
 
-    this->container_->begin(width, this->scale_, messageFlags);
+    container.begin(width, this->scale_, messageFlags);
 
     for (const auto &element : this->message_->elements)
     {
@@ -146,60 +316,22 @@ void MessageLayout::actuallyLayout(int width, MessageElementFlags flags)
             continue;
         }
 
-        element->addToContainer(*this->container_, flags);
+        element->addToContainer(container, flags);
     }
 
-    if (this->height_ != this->container_->getHeight())
-    {
-        this->deleteBuffer();
-    }
-
-    this->container_->end();
-    this->height_ = this->container_->getHeight();
-
-    // collapsed state
-    this->flags.unset(MessageLayoutFlag::Collapsed);
-    if (this->container_->isCollapsed())
-    {
-        this->flags.set(MessageLayoutFlag::Collapsed);
-    }
+    container.end();
 }
 
 // Painting
-void MessageLayout::paint(QPainter &painter, int width, int y, int messageIndex,
-                          Selection &selection, bool isLastReadMessage,
-                          bool isWindowFocused, bool isMentions)
+void MessageLayout::paintOverlay(QPainter &painter, int width, int y,
+                                 int messageIndex, Selection &selection,
+                                 bool isLastReadMessage, bool isWindowFocused,
+                                 bool isMentions)
 {
-    auto app = getApp();
-    QPixmap *pixmap = this->buffer_.get();
-
-    // create new buffer if required
-    if (!pixmap)
-    {
-#if defined(Q_OS_MACOS) || defined(Q_OS_LINUX)
-        pixmap = new QPixmap(int(width * painter.device()->devicePixelRatioF()),
-                             int(container_->getHeight() *
-                                 painter.device()->devicePixelRatioF()));
-        pixmap->setDevicePixelRatio(painter.device()->devicePixelRatioF());
-#else
-        pixmap =
-            new QPixmap(width, std::max(16, this->container_->getHeight()));
-#endif
-
-        this->buffer_ = std::shared_ptr<QPixmap>(pixmap);
-        this->bufferValid_ = false;
-        DebugCount::increase("message drawing buffers");
-    }
-
-    if (!this->bufferValid_ || !selection.isEmpty())
-    {
-        this->updateBuffer(pixmap, messageIndex, selection);
-    }
+    TraceSpan span("MessageLayout::paintOverlay", "paint");
 
-    // draw on buffer
-    painter.drawPixmap(0, y, *pixmap);
-    //    painter.drawPixmap(0, y, this->container.width,
-    //    this->container.getHeight(), *pixmap);
+    auto app = getApp();
+    auto height = this->container_->getHeight();
 
     // draw gif emotes
     this->container_->paintAnimatedElements(painter, y);
@@ -207,15 +339,15 @@ void MessageLayout::paint(QPainter &painter, int width, int y, int messageIndex,
     // draw disabled
     if (this->message_->flags.has(MessageFlag::Disabled))
     {
-        painter.fillRect(0, y, pixmap->width(), pixmap->height(),
+        painter.fillRect(0, y, width, height,
                          app->themes->messages.disabled);
-        //        painter.fillRect(0, y, pixmap->width(), pixmap->height(),
+        //        painter.fillRect(0, y, width, height,
         //                         QBrush(QColor(64, 64, 64, 64)));
     }
 
     if (this->message_->flags.has(MessageFlag::RecentMessage))
     {
-        painter.fillRect(0, y, pixmap->width(), pixmap->height(),
+        painter.fillRect(0, y, width, height,
                          app->themes->messages.disabled);
     }
 
@@ -225,7 +357,7 @@ void MessageLayout::paint(QPainter &painter, int width, int y, int messageIndex,
         getSettings()->enableRedeemedHighlight.getValue())
     {
         painter.fillRect(
-            0, y, this->scale_ * 4, pixmap->height(),
+            0, y, this->scale_ * 4, height,
             *ColorProvider::instance().color(ColorType::RedeemedHighlight));
     }
 
@@ -261,23 +393,22 @@ void MessageLayout::paint(QPainter &painter, int width, int y, int messageIndex,
         QBrush brush(color, static_cast<Qt::BrushStyle>(
                                 getSettings()->lastMessagePattern.getValue()));
 
-        painter.fillRect(0, y + this->container_->getHeight() - 1,
-                         pixmap->width(), 1, brush);
+        painter.fillRect(0, y + height - 1, width, 1, brush);
     }
-
-    this->bufferValid_ = true;
 }
 
-void MessageLayout::updateBuffer(QPixmap *buffer, int /*messageIndex*/,
-                                 Selection & /*selection*/)
+void MessageLayout::paintContent(QPainter &painter, int width, int y)
 {
-    if (buffer->isNull())
-        return;
+    TraceSpan span("MessageLayout::paintContent", "paint");
 
     auto app = getApp();
     auto settings = getSettings();
 
-    QPainter painter(buffer);
+    auto rect = QRect(0, 0, width, this->container_->getHeight());
+
+    painter.save();
+    painter.translate(0, y);
+    painter.setClipRect(rect);
     painter.setRenderHint(QPainter::SmoothPixmapTransform);
 
     // draw background
@@ -328,7 +459,7 @@ void MessageLayout::updateBuffer(QPixmap *buffer, int /*messageIndex*/,
         backgroundColor = QColor("#4A273D");
     }
 
-    painter.fillRect(buffer->rect(), backgroundColor);
+    painter.fillRect(rect, backgroundColor);
 
     // draw message
     this->container_->paintElements(painter);
@@ -336,41 +467,40 @@ void MessageLayout::updateBuffer(QPixmap *buffer, int /*messageIndex*/,
 #ifdef FOURTF
     // debug
     painter.setPen(QColor(255, 0, 0));
-    painter.drawRect(buffer->rect().x(), buffer->rect().y(),
-                     buffer->rect().width() - 1, buffer->rect().height() - 1);
+    painter.drawRect(rect.x(), rect.y(), rect.width() - 1, rect.height() - 1);
 
     QTextOption option;
     option.setAlignment(Qt::AlignRight | Qt::AlignTop);
 
     painter.drawText(QRectF(1, 1, this->container_->getWidth() - 3, 1000),
                      QString::number(this->layoutCount_) + ", " +
-                         QString::number(++this->bufferUpdatedCount_),
+                         QString::number(this->contentVersion_),
                      option);
 #endif
+
+    painter.restore();
 }
 
-void MessageLayout::invalidateBuffer()
+void MessageLayout::invalidateContent()
 {
-    this->bufferValid_ = false;
+    this->contentVersion_++;
 }
 
-void MessageLayout::deleteBuffer()
+unsigned int MessageLayout::getContentVersion() const
 {
-    if (this->buffer_ != nullptr)
-    {
-        DebugCount::decrease("message drawing buffers");
-
-        this->buffer_ = nullptr;
-    }
+    return this->contentVersion_;
 }
 
-void MessageLayout::deleteCache()
+void MessageLayout::addAnimatedRegion(QRegion &region, int y) const
 {
-    this->deleteBuffer();
+    this->container_->addAnimatedRegion(region, y);
+}
 
-#ifdef XD
-    this->container_->clear();
-#endif
+void MessageLayout::addMemoryUsage(MemoryUsage &usage) const
+{
+    // views showing the same channel share their containers, each of them
+    // counts the container
+    usage.layouts += sizeof(MessageLayout) + this->container_->getMemoryUsage();
 }
 
 // Elements
@@ -4,6 +4,7 @@
 #include "common/FlagsEnum.hpp"
 
 #include <QPixmap>
+#include <QRegion>
 #include <boost/noncopyable.hpp>
 #include <cinttypes>
 #include <memory>
@@ -15,6 +16,7 @@ using MessagePtr = std::shared_ptr<const Message>;
 
 struct Selection;
 struct MessageLayoutContainer;
+struct MemoryUsage;
 class MessageLayoutElement;
 
 enum class MessageElementFlag : int64_t;
@@ -43,14 +45,24 @@ public:
     MessageLayoutFlags flags;
 
     bool layout(int width, float scale_, MessageElementFlags flags);
+    // Returns true if images that were loading during the last layout have
+    // finished loading since
+    bool hasLoadedImages() const;
 
     // Painting
-    void paint(QPainter &painter, int width, int y, int messageIndex,
-               Selection &selection, bool isLastReadMessage,
-               bool isWindowFocused, bool isMentions);
-    void invalidateBuffer();
-    void deleteBuffer();
-    void deleteCache();
+    // Paints the static part of the message (background and elements). The
+    // result only changes when the content version does, so views can keep
+    // it around.
+    void paintContent(QPainter &painter, int width, int y);
+    // Paints everything that changes between frames on top of the content
+    void paintOverlay(QPainter &painter, int width, int y, int messageIndex,
+                      Selection &selection, bool isLastReadMessage,
+                      bool isWindowFocused, bool isMentions);
+    void invalidateContent();
+    unsigned int getContentVersion() const;
+    // Adds the area of animated elements to region, y being the top of the
+    // message
+    void addAnimatedRegion(QRegion &region, int y) const;
 
     // Elements
     const MessageLayoutElement *getElementAt(QPoint point);
@@ -62,21 +74,29 @@ public:
 
     // Misc
     bool isDisabled() const;
+    // Adds the estimated size of the layout, the message isn't included
+    void addMemoryUsage(MemoryUsage &usage) const;
 
 private:
+    // Layout results shared by all views that show the message with the same
+    // width, scale and flags
+    struct Shared;
+
     // variables
     MessagePtr message_;
+    std::shared_ptr<Shared> shared_;
     std::shared_ptr<MessageLayoutContainer> container_;
-    std::shared_ptr<QPixmap> buffer_{};
-    bool bufferValid_ = false;
 
     int height_ = 0;
 
     int currentLayoutWidth_ = -1;
     int layoutState_ = -1;
     float scale_ = -1;
+    bool disabled_ = false;
     unsigned int layoutCount_ = 0;
-    unsigned int bufferUpdatedCount_ = 0;
+    unsigned int contentVersion_ = 0;
+    // number of images that weren't loaded during the last layout
+    int loadingElements_ = 0;
 
     MessageElementFlags currentWordFlags_;
 
@@ -84,7 +104,8 @@ private:
 
     // methods
     void actuallyLayout(int width, MessageElementFlags flags);
-    void updateBuffer(QPixmap *pixmap, int messageIndex, Selection &selection);
+    void layoutContainer(MessageLayoutContainer &container, int width,
+                         MessageElementFlags flags);
 };
 
 using MessageLayoutPtr = std::shared_ptr<MessageLayout>;
@@ -1,6 +1,7 @@
 #include "MessageLayoutContainer.hpp"
 
 #include "Application.hpp"
+#include "messages/MemoryUsage.hpp"
 #include "messages/Message.hpp"
 #include "messages/MessageElement.hpp"
 #include "messages/Selection.hpp"
@@ -11,6 +12,7 @@
 
 #include <QDebug>
 #include <QPainter>
+#include <algorithm>
 
 #define COMPACT_EMOTES_OFFSET 4
 #define MAX_UNCOLLAPSED_LINES \
@@ -51,7 +53,9 @@ void MessageLayoutContainer::begin(int width, float scale, MessageFlags flags)
 
 void MessageLayoutContainer::clear()
 {
+    this->animatedElements_.clear();
     this->elements_.clear();
+    this->arena_.reset();
     this->lines_.clear();
 
     this->height_ = 0;
@@ -63,6 +67,19 @@ void MessageLayoutContainer::clear()
     this->charIndex_ = 0;
 }
 
+void MessageLayoutContainer::ElementDeleter::operator()(
+    MessageLayoutElement *element) const
+{
+    if (this->inArena)
+    {
+        element->~MessageLayoutElement();
+    }
+    else
+    {
+        delete element;
+    }
+}
+
 void MessageLayoutContainer::addElement(MessageLayoutElement *element)
 {
     if (!this->fitsInLine(element->getRect().width()))
@@ -87,9 +104,10 @@ bool MessageLayoutContainer::canAddElements()
 void MessageLayoutContainer::_addElement(MessageLayoutElement *element,
                                          bool forceAdd)
 {
+    ElementPtr owned(element, ElementDeleter{this->arena_.contains(element)});
+
     if (!this->canAddElements() && !forceAdd)
     {
-        delete element;
         return;
     }
 
@@ -180,7 +198,7 @@ void MessageLayoutContainer::_addElement(MessageLayoutElement *element,
     element->setLine(this->line_);
 
     // add element
-    this->elements_.push_back(std::unique_ptr<MessageLayoutElement>(element));
+    this->elements_.push_back(std::move(owned));
 
     // set current x
     if (!element->getCreator().getFlags().has(
@@ -293,7 +311,7 @@ void MessageLayoutContainer::end()
                                      MessageColor::Link);
         static QString dotdotdotText("...");
 
-        auto *element = new TextLayoutElement(
+        auto *element = this->createElement<TextLayoutElement>(
             dotdotdot, dotdotdotText,
             QSize(this->dotdotdotWidth_, this->textLineHeight_),
             QColor("#00D80A"), FontStyle::ChatMediumBold, this->scale_);
@@ -317,6 +335,14 @@ void MessageLayoutContainer::end()
         this->lines_.back().endIndex = this->elements_.size();
         this->lines_.back().endCharIndex = this->charIndex_;
     }
+
+    for (const auto &element : this->elements_)
+    {
+        if (element->isAnimated())
+        {
+            this->animatedElements_.push_back(element.get());
+        }
+    }
 }
 
 bool MessageLayoutContainer::canCollapse()
@@ -330,9 +356,38 @@ bool MessageLayoutContainer::isCollapsed()
     return this->isCollapsed_;
 }
 
+int MessageLayoutContainer::getLoadingElementCount() const
+{
+    return int(std::count_if(this->elements_.begin(), this->elements_.end(),
+                             [](const auto &element) {
+                                 return element->isLoading();
+                             }));
+}
+
+int64_t MessageLayoutContainer::getMemoryUsage() const
+{
+    auto bytes = int64_t(sizeof(MessageLayoutContainer)) +
+                 this->elements_.capacity() * sizeof(this->elements_[0]) +
+                 this->lines_.capacity() * sizeof(Line) +
+                 this->animatedElements_.capacity() * sizeof(void *) +
+                 this->arena_.capacity();
+
+    // the layout elements don't add much to their base class
+    for (auto &&element : this->elements_)
+    {
+        if (!element.get_deleter().inArena)
+        {
+            bytes += sizeof(MessageLayoutElement);
+        }
+        bytes += MemoryUsage::stringSize(element->getText());
+    }
+
+    return bytes;
+}
+
 MessageLayoutElement *MessageLayoutContainer::getElementAt(QPoint point)
 {
-    for (std::unique_ptr<MessageLayoutElement> &element : this->elements_)
+    for (auto &element : this->elements_)
     {
         if (element->getRect().contains(point))
         {
@@ -346,7 +401,7 @@ MessageLayoutElement *MessageLayoutContainer::getElementAt(QPoint point)
 // painting
 void MessageLayoutContainer::paintElements(QPainter &painter)
 {
-    for (const std::unique_ptr<MessageLayoutElement> &element : this->elements_)
+    for (const auto &element : this->elements_)
     {
 #ifdef FOURTF
         painter.setPen(QColor(0, 255, 0));
@@ -360,12 +415,21 @@ void MessageLayoutContainer::paintElements(QPainter &painter)
 void MessageLayoutContainer::paintAnimatedElements(QPainter &painter,
                                                    int yOffset)
 {
-    for (const std::unique_ptr<MessageLayoutElement> &element : this->elements_)
+    for (auto *element : this->animatedElements_)
     {
         element->paintAnimated(painter, yOffset);
     }
 }
 
+void MessageLayoutContainer::addAnimatedRegion(QRegion &region,
+                                               int yOffset) const
+{
+    for (auto *element : this->animatedElements_)
+    {
+        region += element->getRect().translated(0, yOffset);
+    }
+}
+
 void MessageLayoutContainer::paintSelection(QPainter &painter, int messageIndex,
                                             Selection &selection, int yOffset)
 {
@@ -2,6 +2,8 @@
 
 #include <QPoint>
 #include <QRect>
+#include <QRegion>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -9,6 +11,7 @@
 #include "common/FlagsEnum.hpp"
 #include "messages/Selection.hpp"
 #include "messages/layouts/MessageLayoutElement.hpp"
+#include "util/Arena.hpp"
 
 class QPainter;
 
@@ -59,6 +62,16 @@ struct MessageLayoutContainer {
 
     void clear();
     bool canAddElements();
+
+    // Creates an element in memory owned by the container, which is reused
+    // when the container gets laid out again. The element has to be passed
+    // to one of the addElement methods.
+    template <typename T, typename... Args>
+    T *createElement(Args &&...args)
+    {
+        return this->arena_.create<T>(std::forward<Args>(args)...);
+    }
+
     void addElement(MessageLayoutElement *element);
     void addElementNoLineBreak(MessageLayoutElement *element);
     void breakLine();
@@ -69,6 +82,8 @@ struct MessageLayoutContainer {
     // painting
     void paintElements(QPainter &painter);
     void paintAnimatedElements(QPainter &painter, int yOffset);
+    // Adds the area covered by animated elements to region
+    void addAnimatedRegion(QRegion &region, int yOffset) const;
     void paintSelection(QPainter &painter, int messageIndex,
                         Selection &selection, int yOffset);
 
@@ -80,6 +95,11 @@ struct MessageLayoutContainer {
 
     bool isCollapsed();
 
+    // Number of elements that are still waiting for their image
+    int getLoadingElementCount() const;
+    // Estimated bytes used by the container and its elements
+    int64_t getMemoryUsage() const;
+
 private:
     struct Line {
         int startIndex;
@@ -89,6 +109,14 @@ private:
         QRect rect;
     };
 
+    struct ElementDeleter {
+        // elements created in the arena must not be freed
+        bool inArena = false;
+
+        void operator()(MessageLayoutElement *element) const;
+    };
+    using ElementPtr = std::unique_ptr<MessageLayoutElement, ElementDeleter>;
+
     // helpers
     void _addElement(MessageLayoutElement *element, bool forceAdd = false);
     bool canCollapse();
@@ -110,8 +138,12 @@ private:
     bool canAddMessages_ = true;
     bool isCollapsed_ = false;
 
-    std::vector<std::unique_ptr<MessageLayoutElement>> elements_;
+    // declared before the elements, which have to be destroyed first
+    Arena arena_;
+    std::vector<ElementPtr> elements_;
     std::vector<Line> lines_;
+    // elements that were animated when the layout ended
+    std::vector<MessageLayoutElement *> animatedElements_;
 };
 
 }  // namespace chatterino
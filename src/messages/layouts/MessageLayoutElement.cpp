@@ -91,6 +91,16 @@ FlagsEnum<MessageElementFlag> MessageLayoutElement::getFlags() const
     return this->creator_.getFlags();
 }
 
+bool MessageLayoutElement::isLoading() const
+{
+    return false;
+}
+
+bool MessageLayoutElement::isAnimated() const
+{
+    return false;
+}
+
 //
 // IMAGE
 //
@@ -179,6 +189,16 @@ int ImageLayoutElement::getXFromIndex(int index)
     }
 }
 
+bool ImageLayoutElement::isLoading() const
+{
+    return !this->image_->isEmpty() && !this->image_->loaded();
+}
+
+bool ImageLayoutElement::isAnimated() const
+{
+    return this->image_ != nullptr && this->image_->animated();
+}
+
 //
 // IMAGE WITH BACKGROUND
 //
@@ -210,9 +230,10 @@ void ImageWithBackgroundLayoutElement::paint(QPainter &painter)
 // TEXT
 //
 
-TextLayoutElement::TextLayoutElement(MessageElement &_creator, QString &_text,
-                                     const QSize &_size, QColor _color,
-                                     FontStyle _style, float _scale)
+TextLayoutElement::TextLayoutElement(MessageElement &_creator,
+                                     const QString &_text, const QSize &_size,
+                                     QColor _color, FontStyle _style,
+                                     float _scale)
     : MessageLayoutElement(_creator, _size)
     , color_(_color)
     , style_(_style)
@@ -221,15 +242,9 @@ TextLayoutElement::TextLayoutElement(MessageElement &_creator, QString &_text,
     this->setText(_text);
 }
 
-void TextLayoutElement::listenToLinkChanges()
+const Link &TextLayoutElement::getLink() const
 {
-    this->managedConnections_.emplace_back(
-        static_cast<TextElement &>(this->getCreator())
-            .linkChanged.connect([this]() {
-                // log("Old link: {}", this->getCreator().getLink().value);
-                // log("This link: {}", this->getLink().value);
-                this->setLink(this->getCreator().getLink());
-            }));
+    return this->getCreator().getLink();
 }
 
 void TextLayoutElement::addCopyTextToString(QString &str, int from,
@@ -411,12 +426,11 @@ int TextIconLayoutElement::getXFromIndex(int index)
 //
 
 MultiColorTextLayoutElement::MultiColorTextLayoutElement(
-    MessageElement &_creator, QString &_text, const QSize &_size,
+    MessageElement &_creator, const QString &_text, const QSize &_size,
     std::vector<PajSegment> segments, FontStyle _style, float _scale)
     : TextLayoutElement(_creator, _text, _size, QColor{}, _style, _scale)
-    , segments_(segments)
+    , segments_(std::move(segments))
 {
-    this->setText(_text);
 }
 
 void MultiColorTextLayoutElement::paint(QPainter &painter)
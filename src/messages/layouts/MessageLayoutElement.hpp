@@ -43,8 +43,12 @@ public:
     virtual void paintAnimated(QPainter &painter, int yOffset) = 0;
     virtual int getMouseOverIndex(const QPoint &abs) const = 0;
     virtual int getXFromIndex(int index) = 0;
+    // Returns true while the element is waiting for its image to load
+    virtual bool isLoading() const;
+    // Returns true if the element is drawn by paintAnimated
+    virtual bool isAnimated() const;
 
-    const Link &getLink() const;
+    virtual const Link &getLink() const;
     const QString &getText() const;
     FlagsEnum<MessageElementFlag> getFlags() const;
 
@@ -74,6 +78,8 @@ protected:
     void paintAnimated(QPainter &painter, int yOffset) override;
     int getMouseOverIndex(const QPoint &abs) const override;
     int getXFromIndex(int index) override;
+    bool isLoading() const override;
+    bool isAnimated() const override;
 
     ImagePtr image_;
 };
@@ -95,11 +101,13 @@ private:
 class TextLayoutElement : public MessageLayoutElement
 {
 public:
-    TextLayoutElement(MessageElement &creator_, QString &text,
+    TextLayoutElement(MessageElement &creator_, const QString &text,
                       const QSize &size, QColor color_, FontStyle style_,
                       float scale_);
 
-    void listenToLinkChanges();
+    // Text elements always use the link of their creator, which can still
+    // change after the layout was made (e.g. once a link was resolved).
+    const Link &getLink() const override;
 
 protected:
     void addCopyTextToString(QString &str, int from = 0,
@@ -113,8 +121,6 @@ protected:
     QColor color_;
     FontStyle style_;
     float scale_;
-
-    std::vector<pajlada::Signals::ScopedConnection> managedConnections_;
 };
 
 // TEXT ICON
@@ -149,7 +155,7 @@ struct PajSegment {
 class MultiColorTextLayoutElement : public TextLayoutElement
 {
 public:
-    MultiColorTextLayoutElement(MessageElement &creator_, QString &text,
+    MultiColorTextLayoutElement(MessageElement &creator_, const QString &text,
                                 const QSize &size,
                                 std::vector<PajSegment> segments,
                                 FontStyle style_, float scale_);
@@ -25,6 +25,7 @@ void LinkResolver::getLinkInfo(
     NetworkRequest(Env::get().linkResolverUrl.arg(QString::fromUtf8(
                        QUrl::toPercentEncoding(url, "", "/:"))))
         .caller(caller)
+        .priority(NetworkRequestPriority::Interactive)
         .timeout(30000)
         .onSuccess(
             [successCallback, url](NetworkResult result) mutable -> Outcome {
@@ -143,6 +143,7 @@ void BttvEmotes::loadEmotes()
 {
     NetworkRequest(QString(globalEmoteApiUrl))
         .timeout(30000)
+        .revalidate()
         .onSuccess([this](auto result) -> Outcome {
             auto emotes = this->global_.get();
             auto pair = parseGlobalEmotes(result.parseJsonArray(), *emotes);
@@ -162,6 +163,7 @@ void BttvEmotes::loadChannel(std::weak_ptr<Channel> channel,
 {
     NetworkRequest(QString(bttvChannelEmoteApiUrl) + channelId)
         .timeout(20000)
+        .revalidate()
         .onSuccess([callback = std::move(callback), channel,
                     &channelDisplayName,
                     manualRefresh](auto result) -> Outcome {
@@ -4,159 +4,69 @@
 #include "messages/Emote.hpp"
 #include "singletons/Settings.hpp"
 
-#include <rapidjson/error/en.h>
-#include <rapidjson/error/error.h>
-#include <rapidjson/rapidjson.h>
-#include <QFile>
 #include <boost/variant.hpp>
 #include <memory>
-#include "common/QLogging.hpp"
 
 namespace chatterino {
 namespace {
 
-    auto toneNames = std::map<QString, QString>{
-        {"1F3FB", "tone1"}, {"1F3FC", "tone2"}, {"1F3FD", "tone3"},
-        {"1F3FE", "tone4"}, {"1F3FF", "tone5"},
-    };
-
-    void parseEmoji(const std::shared_ptr<EmojiData> &emojiData,
-                    const rapidjson::Value &unparsedEmoji,
-                    QString shortCode = QString())
+    std::shared_ptr<EmojiData> makeEmojiData(const EmojiTableEntry &entry)
     {
-        std::array<uint32_t, 9> unicodeBytes;
-
-        struct {
-            bool apple;
-            bool google;
-            bool twitter;
-            bool facebook;
-        } capabilities;
-
-        if (!shortCode.isEmpty())
-        {
-            emojiData->shortCodes.push_back(shortCode);
-        }
-        else
-        {
-            const auto &shortCodes = unparsedEmoji["short_names"];
-            for (const auto &_shortCode : shortCodes.GetArray())
-            {
-                emojiData->shortCodes.emplace_back(_shortCode.GetString());
-            }
-        }
-
-        rj::getSafe(unparsedEmoji, "non_qualified",
-                    emojiData->nonQualifiedCode);
-        rj::getSafe(unparsedEmoji, "unified", emojiData->unifiedCode);
-
-        rj::getSafe(unparsedEmoji, "has_img_apple", capabilities.apple);
-        rj::getSafe(unparsedEmoji, "has_img_google", capabilities.google);
-        rj::getSafe(unparsedEmoji, "has_img_twitter", capabilities.twitter);
-        rj::getSafe(unparsedEmoji, "has_img_facebook", capabilities.facebook);
-
-        if (capabilities.apple)
-        {
-            emojiData->capabilities.insert("Apple");
-        }
-        if (capabilities.google)
-        {
-            emojiData->capabilities.insert("Google");
-        }
-        if (capabilities.twitter)
-        {
-            emojiData->capabilities.insert("Twitter");
-        }
-        if (capabilities.facebook)
-        {
-            emojiData->capabilities.insert("Facebook");
-        }
+        auto emojiData = std::make_shared<EmojiData>();
 
-        QStringList unicodeCharacters;
-        if (!emojiData->nonQualifiedCode.isEmpty())
-        {
-            unicodeCharacters =
-                emojiData->nonQualifiedCode.toLower().split('-');
-        }
-        else
-        {
-            unicodeCharacters = emojiData->unifiedCode.toLower().split('-');
-        }
-        if (unicodeCharacters.length() < 1)
+        emojiData->value =
+            QString::fromUcs4(&emojiTableCodepoints[entry.valueOffset],
+                              entry.valueLength);
+        emojiData->unifiedCode = QString::fromLatin1(entry.unifiedCode);
+        if (entry.nonQualifiedCode != nullptr)
         {
-            return;
+            emojiData->nonQualifiedCode =
+                QString::fromLatin1(entry.nonQualifiedCode);
         }
 
-        int numUnicodeBytes = 0;
+        emojiData->capabilities =
+            static_cast<EmojiCapability>(entry.capabilities);
 
-        for (const QString &unicodeCharacter : unicodeCharacters)
+        emojiData->shortCodes.reserve(entry.shortCodesCount);
+        for (int i = 0; i < entry.shortCodesCount; ++i)
         {
-            unicodeBytes.at(numUnicodeBytes++) =
-                QString(unicodeCharacter).toUInt(nullptr, 16);
+            emojiData->shortCodes.emplace_back(QString::fromLatin1(
+                emojiTableShortCodes[entry.shortCodesOffset + i]));
         }
 
-        emojiData->value =
-            QString::fromUcs4(unicodeBytes.data(), numUnicodeBytes);
+        return emojiData;
     }
 
-    // getToneNames takes a tones and returns their names in the same order
-    // The format of the tones is: "1F3FB-1F3FB" or "1F3FB"
-    // The output of the tone names is: "tone1-tone1" or "tone1"
-    QString getToneNames(const QString &tones)
-    {
-        auto toneParts = tones.split('-');
-        QStringList toneNameResults;
-        for (const auto &tonePart : toneParts)
-        {
-            auto toneNameIt = toneNames.find(tonePart);
-            if (toneNameIt == toneNames.end())
-            {
-                qDebug() << "Tone with key" << tonePart
-                         << "does not exist in tone names map";
-                continue;
-            }
-
-            toneNameResults.append(toneNameIt->second);
-        }
-
-        assert(!toneNameResults.isEmpty());
+}  // namespace
 
-        return toneNameResults.join('-');
+void Emojis::load()
+{
+    // the table might have been loaded during startup already
+    if (this->shortCodes.empty())
+    {
+        this->loadTable();
     }
 
-}  // namespace
+    this->loadEmojiSet();
+}
 
-void Emojis::load()
+void Emojis::loadTable()
 {
     this->loadEmojis();
 
     this->sortEmojis();
-
-    this->loadEmojiSet();
 }
 
 void Emojis::loadEmojis()
 {
+    // The table is generated from resources/emoji.json by
+    // resources/generate_emoji_table.py
     // Current version: https://github.com/iamcal/emoji-data/blob/v7.0.2/emoji.json (Emoji version 13.1 (2021))
-    QFile file(":/emoji.json");
-    file.open(QFile::ReadOnly);
-    QTextStream s1(&file);
-    QString data = s1.readAll();
-    rapidjson::Document root;
-    rapidjson::ParseResult result = root.Parse(data.toUtf8(), data.length());
-
-    if (result.Code() != rapidjson::kParseErrorNone)
-    {
-        qCWarning(chatterinoEmoji)
-            << "JSON parse error:" << rapidjson::GetParseError_En(result.Code())
-            << "(" << result.Offset() << ")";
-        return;
-    }
+    this->shortCodes.reserve(emojiTableSize);
 
-    for (const auto &unparsedEmoji : root.GetArray())
+    for (size_t i = 0; i < emojiTableSize; ++i)
     {
-        auto emojiData = std::make_shared<EmojiData>();
-        parseEmoji(emojiData, unparsedEmoji);
+        auto emojiData = makeEmojiData(emojiTable[i]);
 
         for (const auto &shortCode : emojiData->shortCodes)
         {
@@ -167,31 +77,6 @@ void Emojis::loadEmojis()
         this->emojiFirstByte_[emojiData->value.at(0)].append(emojiData);
 
         this->emojis.insert(emojiData->unifiedCode, emojiData);
-
-        if (unparsedEmoji.HasMember("skin_variations"))
-        {
-            for (const auto &skinVariation :
-                 unparsedEmoji["skin_variations"].GetObject())
-            {
-                auto toneName = getToneNames(skinVariation.name.GetString());
-                const auto &variation = skinVariation.value;
-
-                auto variationEmojiData = std::make_shared<EmojiData>();
-
-                parseEmoji(variationEmojiData, variation,
-                           emojiData->shortCodes[0] + "_" + toneName);
-
-                this->emojiShortCodeToEmoji_.insert(
-                    variationEmojiData->shortCodes[0], variationEmojiData);
-                this->shortCodes.push_back(variationEmojiData->shortCodes[0]);
-
-                this->emojiFirstByte_[variationEmojiData->value.at(0)].append(
-                    variationEmojiData);
-
-                this->emojis.insert(variationEmojiData->unifiedCode,
-                                    variationEmojiData);
-            }
-        }
     }
 }
 
@@ -244,7 +129,16 @@ void Emojis::loadEmojiSet()
             };
             // clang-format on
 
-            if (emoji->capabilities.count(emojiSetToUse) == 0)
+            static std::map<QString, EmojiCapability> emojiSetCapabilities = {
+                {"Twitter", EmojiCapability::Twitter},
+                {"Facebook", EmojiCapability::Facebook},
+                {"Apple", EmojiCapability::Apple},
+                {"Google", EmojiCapability::Google},
+            };
+
+            auto capabilityIt = emojiSetCapabilities.find(emojiSetToUse);
+            if (capabilityIt == emojiSetCapabilities.end() ||
+                !emoji->capabilities.has(capabilityIt->second))
             {
                 emojiSetToUse = "Twitter";
             }
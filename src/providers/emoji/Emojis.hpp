@@ -1,5 +1,7 @@
 #pragma once
 
+#include "autogenerated/EmojiTableAutogen.hpp"
+#include "common/FlagsEnum.hpp"
 #include "util/ConcurrentMap.hpp"
 
 #include <QMap>
@@ -26,7 +28,7 @@ struct EmojiData {
     // i.e. thinking
     std::vector<QString> shortCodes;
 
-    std::set<QString> capabilities;
+    FlagsEnum<EmojiCapability> capabilities;
 
     std::vector<EmojiData> variations;
 
@@ -40,6 +42,9 @@ class Emojis
 public:
     void initialize();
     void load();
+    // Builds the emoji maps without touching the settings, so it can run on
+    // another thread before load
+    void loadTable();
     std::vector<boost::variant<EmotePtr, QString>> parse(const QString &text);
 
     EmojiMap emojis;
@@ -186,6 +186,7 @@ void FfzEmotes::loadEmotes()
     NetworkRequest(url)
 
         .timeout(30000)
+        .revalidate()
         .onSuccess([this](auto result) -> Outcome {
             auto emotes = this->emotes();
             auto pair = parseGlobalEmotes(result.parseJson(), *emotes);
@@ -210,6 +211,7 @@ void FfzEmotes::loadChannel(
     NetworkRequest("https://api.frankerfacez.com/v1/room/id/" + channelId)
 
         .timeout(20000)
+        .revalidate()
         .onSuccess([emoteCallback = std::move(emoteCallback),
                     modBadgeCallback = std::move(modBadgeCallback),
                     vipBadgeCallback = std::move(vipBadgeCallback), channel,
@@ -1,5 +1,6 @@
 #include "AbstractIrcServer.hpp"
 
+#include "common/Args.hpp"
 #include "common/Channel.hpp"
 #include "common/Common.hpp"
 #include "common/QLogging.hpp"
@@ -98,6 +99,12 @@ void AbstractIrcServer::connect()
 {
     assert(this->initialized_);
 
+    // captures are replayed without connecting to the servers
+    if (getArgs().replayFile)
+    {
+        return;
+    }
+
     this->disconnect();
 
     if (this->hasSeparateWriteConnection())
@@ -387,6 +394,10 @@ void AbstractIrcServer::addFakeMessage(const QString &data)
     {
         this->readConnectionMessageReceived(fakeMessage);
     }
+
+    // the message is parented to the connection, don't keep it around for
+    // as long as the connection exists
+    fakeMessage->deleteLater();
 }
 
 void AbstractIrcServer::privateMessageReceived(
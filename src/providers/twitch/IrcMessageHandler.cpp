@@ -3,6 +3,7 @@
 #include "Application.hpp"
 #include "common/QLogging.hpp"
 #include "controllers/accounts/AccountController.hpp"
+#include "debug/Trace.hpp"
 #include "messages/LimitedQueue.hpp"
 #include "messages/Message.hpp"
 #include "providers/twitch/TwitchAccountManager.hpp"
@@ -230,6 +231,8 @@ std::vector<MessagePtr> IrcMessageHandler::parsePrivMessage(
 void IrcMessageHandler::handlePrivMessage(Communi::IrcPrivateMessage *message,
                                           TwitchIrcServer &server)
 {
+    TraceSpan span("IrcMessageHandler::handlePrivMessage", "irc");
+
     this->addMessage(message, message->target(), message->content(), server,
                      false, message->isAction());
 }
@@ -240,6 +243,8 @@ void IrcMessageHandler::addMessage(Communi::IrcMessage *_message,
                                    TwitchIrcServer &server, bool isSub,
                                    bool isAction)
 {
+    TraceSpan span("IrcMessageHandler::addMessage", "irc");
+
     QString channelName;
     if (!trimChannelName(target, channelName))
     {
@@ -331,6 +336,8 @@ void IrcMessageHandler::addMessage(Communi::IrcMessage *_message,
 
 void IrcMessageHandler::handleRoomStateMessage(Communi::IrcMessage *message)
 {
+    TraceSpan span("IrcMessageHandler::handleRoomStateMessage", "irc");
+
     const auto &tags = message->tags();
     auto app = getApp();
 
@@ -391,6 +398,8 @@ void IrcMessageHandler::handleRoomStateMessage(Communi::IrcMessage *message)
 
 void IrcMessageHandler::handleClearChatMessage(Communi::IrcMessage *message)
 {
+    TraceSpan span("IrcMessageHandler::handleClearChatMessage", "irc");
+
     // check parameter count
     if (message->parameters().length() < 1)
     {
@@ -441,17 +450,12 @@ void IrcMessageHandler::handleClearChatMessage(Communi::IrcMessage *message)
                        calculateMessageTimestamp(message))
             .release();
     chan->addOrReplaceTimeout(timeoutMsg);
-
-    // refresh all
-    app->windows->repaintVisibleChatWidgets(chan.get());
-    if (getSettings()->hideModerated)
-    {
-        app->windows->forceLayoutChannelViews();
-    }
 }
 
 void IrcMessageHandler::handleClearMessageMessage(Communi::IrcMessage *message)
 {
+    TraceSpan span("IrcMessageHandler::handleClearMessageMessage", "irc");
+
     // check parameter count
     if (message->parameters().length() < 1)
     {
@@ -497,6 +501,8 @@ void IrcMessageHandler::handleClearMessageMessage(Communi::IrcMessage *message)
 
 void IrcMessageHandler::handleUserStateMessage(Communi::IrcMessage *message)
 {
+    TraceSpan span("IrcMessageHandler::handleUserStateMessage", "irc");
+
     auto currentUser = getApp()->accounts->twitch.getCurrent();
 
     // set received emote-sets, used in TwitchAccount::loadUserstateEmotes
@@ -545,6 +551,8 @@ void IrcMessageHandler::handleUserStateMessage(Communi::IrcMessage *message)
 
 void IrcMessageHandler::handleWhisperMessage(Communi::IrcMessage *message)
 {
+    TraceSpan span("IrcMessageHandler::handleWhisperMessage", "irc");
+
     auto app = getApp();
     MessageParseArgs args;
 
@@ -644,6 +652,8 @@ std::vector<MessagePtr> IrcMessageHandler::parseUserNoticeMessage(
 void IrcMessageHandler::handleUserNoticeMessage(Communi::IrcMessage *message,
                                                 TwitchIrcServer &server)
 {
+    TraceSpan span("IrcMessageHandler::handleUserNoticeMessage", "irc");
+
     auto tags = message->tags();
     auto parameters = message->parameters();
 
@@ -789,6 +799,8 @@ std::vector<MessagePtr> IrcMessageHandler::parseNoticeMessage(
 
 void IrcMessageHandler::handleNoticeMessage(Communi::IrcNoticeMessage *message)
 {
+    TraceSpan span("IrcMessageHandler::handleNoticeMessage", "irc");
+
     auto app = getApp();
     auto builtMessages = this->parseNoticeMessage(message);
 
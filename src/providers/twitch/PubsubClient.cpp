@@ -1,5 +1,6 @@
 #include "providers/twitch/PubsubClient.hpp"
 
+#include "common/Env.hpp"
 #include "providers/twitch/PubsubActions.hpp"
 #include "providers/twitch/PubsubHelpers.hpp"
 #include "singletons/Settings.hpp"
@@ -13,8 +14,6 @@
 #include <thread>
 #include "common/QLogging.hpp"
 
-#define TWITCH_PUBSUB_URL "wss://pubsub-edge.twitch.tv"
-
 using websocketpp::lib::bind;
 using websocketpp::lib::placeholders::_1;
 using websocketpp::lib::placeholders::_2;
@@ -868,7 +867,8 @@ PubSub::PubSub()
 void PubSub::addClient()
 {
     websocketpp::lib::error_code ec;
-    auto con = this->websocketClient.get_connection(TWITCH_PUBSUB_URL, ec);
+    auto con = this->websocketClient.get_connection(
+        Env::get().twitchPubsubUrl.toStdString(), ec);
 
     if (ec)
     {
@@ -1107,6 +1107,25 @@ void PubSub::onMessage(websocketpp::connection_hdl hdl,
     }
 }
 
+void PubSub::addFakeMessage(const QString &payload)
+{
+    rapidjson::Document msg;
+    rapidjson::ParseResult res = msg.Parse(payload.toUtf8());
+
+    if (!res || !msg.IsObject())
+    {
+        qCDebug(chatterinoPubsub) << "Error parsing fake message" << payload;
+        return;
+    }
+
+    QString type;
+    if (rj::getSafe(msg, "type", type) && type == "MESSAGE" &&
+        msg.HasMember("data") && msg["data"].IsObject())
+    {
+        this->handleMessageResponse(msg["data"]);
+    }
+}
+
 void PubSub::onConnectionOpen(WebsocketHandle hdl)
 {
     auto client =
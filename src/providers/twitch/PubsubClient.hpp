@@ -162,6 +162,10 @@ public:
 
     std::vector<std::unique_ptr<rapidjson::Document>> requests;
 
+    // Handles payload as if it was received from the server. Used to replay
+    // captured traffic.
+    void addFakeMessage(const QString &payload);
+
 private:
     void listenToTopic(const QString &topic,
                        std::shared_ptr<TwitchAccount> account);
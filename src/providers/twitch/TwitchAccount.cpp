@@ -1,6 +1,7 @@
 #include "providers/twitch/TwitchAccount.hpp"
 
 #include <QThread>
+#include <QTimer>
 
 #include "Application.hpp"
 #include "common/Channel.hpp"
@@ -18,6 +19,7 @@
 #include "providers/twitch/api/Helix.hpp"
 #include "providers/twitch/api/Kraken.hpp"
 #include "singletons/Emotes.hpp"
+#include "util/PostToThread.hpp"
 #include "util/QStringHash.hpp"
 #include "util/RapidjsonHelpers.hpp"
 
@@ -31,6 +33,12 @@ TwitchAccount::TwitchAccount(const QString &username, const QString &oauthToken,
     , userId_(userID)
     , isAnon_(username == ANONYMOUS_USERNAME)
 {
+    this->emotesChangedTimer_.setSingleShot(true);
+    this->emotesChangedTimer_.setInterval(100);
+    QObject::connect(&this->emotesChangedTimer_, &QTimer::timeout, [this] {
+        this->emotesChangedQueued_ = false;
+        this->emotesChanged.invoke();
+    });
 }
 
 QString TwitchAccount::toString() const
@@ -173,8 +181,9 @@ void TwitchAccount::checkFollow(const QString targetUserID,
         onFinished(FollowResult_Following);
     };
 
+    // shown on user cards
     getHelix()->getUserFollow(this->getUserId(), targetUserID, onResponse,
-                              [] {});
+                              [] {}, NetworkRequestPriority::Interactive);
 }
 
 SharedAccessGuard<const std::set<TwitchUser>> TwitchAccount::accessBlocks()
@@ -263,6 +272,8 @@ void TwitchAccount::loadEmotes()
                     emoteData->emoteSets.emplace_back(emoteSet);
                 }
             }
+            this->invokeEmotesChanged();
+
             // Getting userstate emotes from Ivr
             this->loadUserstateEmotes();
         },
@@ -407,6 +418,7 @@ void TwitchAccount::loadUserstateEmotes()
                               });
                     emoteData->emoteSets.emplace_back(newUserEmoteSet);
                 }
+                this->invokeEmotesChanged();
             },
             [] {
                 // fetching emotes failed, ivr API might be down
@@ -538,7 +550,7 @@ void TwitchAccount::loadEmoteSetData(std::shared_ptr<EmoteSet> emoteSet)
 
     getHelix()->getEmoteSetData(
         emoteSet->key,
-        [emoteSet](HelixEmoteSetData emoteSetData) {
+        [this, emoteSet](HelixEmoteSetData emoteSetData) {
             // Follower emotes can be only used in their origin channel
             if (emoteSetData.emoteType == "follower")
             {
@@ -556,6 +568,7 @@ void TwitchAccount::loadEmoteSetData(std::shared_ptr<EmoteSet> emoteSet)
                 // most (if not all) emotes that fail to load are time limited event emotes owned by Twitch
                 emoteSet->channelName = "twitch";
                 emoteSet->text = "Twitch";
+                this->invokeEmotesChanged();
 
                 return;
             }
@@ -565,14 +578,16 @@ void TwitchAccount::loadEmoteSetData(std::shared_ptr<EmoteSet> emoteSet)
             {
                 // emoteSet->channelName = QString();
                 emoteSet->text = "Twitch Global";
+                this->invokeEmotesChanged();
                 return;
             }
 
             getHelix()->getUserById(
                 emoteSetData.ownerId,
-                [emoteSet](HelixUser user) {
+                [this, emoteSet](HelixUser user) {
                     emoteSet->channelName = user.login;
                     emoteSet->text = user.displayName;
+                    this->invokeEmotesChanged();
                 },
                 [emoteSetData] {
                     qCWarning(chatterinoTwitch)
@@ -586,4 +601,18 @@ void TwitchAccount::loadEmoteSetData(std::shared_ptr<EmoteSet> emoteSet)
         });
 }
 
+void TwitchAccount::invokeEmotesChanged()
+{
+    // the owners of many sets are resolved at the same time, only notify once
+    // for all of them
+    if (this->emotesChangedQueued_.exchange(true))
+    {
+        return;
+    }
+
+    // queued events of the timer are dropped when the account is destroyed
+    QMetaObject::invokeMethod(&this->emotesChangedTimer_, "start",
+                              Qt::QueuedConnection);
+}
+
 }  // namespace chatterino
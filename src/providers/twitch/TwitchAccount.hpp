@@ -13,7 +13,10 @@
 #include <QColor>
 #include <QElapsedTimer>
 #include <QString>
+#include <QTimer>
+#include <pajlada/signals/signal.hpp>
 
+#include <atomic>
 #include <functional>
 #include <mutex>
 #include <set>
@@ -122,6 +125,9 @@ public:
     SharedAccessGuard<const TwitchAccountEmoteData> accessEmotes() const;
     SharedAccessGuard<const std::unordered_map<QString, EmoteMap>>
         accessLocalEmotes() const;
+    // Invoked on the gui thread whenever emote sets were loaded or their
+    // owners were resolved
+    pajlada::Signals::NoArgSignal emotesChanged;
 
     // Automod actions
     void autoModAllow(const QString msgID, ChannelPtr channel);
@@ -129,6 +135,7 @@ public:
 
 private:
     void loadEmoteSetData(std::shared_ptr<EmoteSet> emoteSet);
+    void invokeEmotesChanged();
 
     QString oauthClient_;
     QString oauthToken_;
@@ -145,6 +152,9 @@ private:
     //    std::map<UserId, TwitchAccountEmoteData> emotes;
     UniqueAccess<TwitchAccountEmoteData> emotes_;
     UniqueAccess<std::unordered_map<QString, EmoteMap>> localEmotes_;
+    std::atomic_bool emotesChangedQueued_{false};
+    // lives on the gui thread, emotesChanged is invoked when it times out
+    QTimer emotesChangedTimer_;
 };
 
 }  // namespace chatterino
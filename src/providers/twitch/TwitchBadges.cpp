@@ -28,6 +28,7 @@ void TwitchBadges::loadTwitchBadges()
         "https://badges.twitch.tv/v1/badges/global/display?language=en");
 
     NetworkRequest(url)
+        .revalidate()
         .onSuccess([this](auto result) -> Outcome {
             {
                 auto root = result.parseJson();
@@ -192,6 +193,7 @@ void TwitchBadges::loadEmoteImage(const QString &name, ImagePtr image,
     NetworkRequest(image->url().string)
         .concurrent()
         .cache()
+        .priority(NetworkRequestPriority::Image)
         .onSuccess([this, name, callback](auto result) -> Outcome {
             auto data = result.getData();
 
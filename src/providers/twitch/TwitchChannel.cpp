@@ -1,6 +1,7 @@
 #include "providers/twitch/TwitchChannel.hpp"
 
 #include "Application.hpp"
+#include "common/Args.hpp"
 #include "common/Common.hpp"
 #include "common/Env.hpp"
 #include "common/NetworkRequest.hpp"
@@ -26,18 +27,30 @@
 #include "widgets/Window.hpp"
 
 #include <rapidjson/document.h>
+#include <rapidjson/reader.h>
 #include <IrcConnection>
 #include <QJsonArray>
 #include <QJsonObject>
 #include <QJsonValue>
 #include <QThread>
+#include <QThreadPool>
 #include <QTimer>
 
+#include <algorithm>
+
 namespace chatterino {
 namespace {
     constexpr char MAGIC_MESSAGE_SUFFIX[] = u8" \U000E0000";
     constexpr int TITLE_REFRESH_PERIOD = 10000;
     constexpr int CLIP_CREATION_COOLDOWN = 5000;
+    constexpr int RECENT_MESSAGES_MAX_THREADS = 4;
+    constexpr int CHATTERS_REFRESH_PERIOD = 5 * 60 * 1000;
+    // The first chatter refresh of each channel restored at startup is
+    // delayed by one of these slots, so restoring many channels doesn't
+    // request (and parse) all of their chatter lists at once, now and every
+    // refresh period after.
+    constexpr int CHATTERS_REFRESH_SLOTS = 60;
+    constexpr int CHATTERS_REFRESH_SLOT_LENGTH = 2000;
     const QString CLIPS_LINK("https://clips.twitch.tv/%1");
     const QString CLIPS_FAILURE_CLIPS_DISABLED_TEXT(
         "Failed to create a clip - the streamer has clips disabled entirely or "
@@ -91,6 +104,8 @@ namespace {
         auto newMessage = Communi::IrcMessage::fromData(s.toUtf8(), nullptr);
         newMessage->setTags(message->tags());
 
+        delete message;
+
         return newMessage;
     }
 
@@ -120,27 +135,189 @@ namespace {
 
         return messages;
     }
-    std::pair<Outcome, std::unordered_set<QString>> parseChatters(
-        const QJsonObject &jsonRoot)
+
+    // Recent messages are parsed and built on their own pool, so restoring
+    // many channels can't hog the global thread pool. Each channel's history
+    // is built by a single job, which keeps its messages in order.
+    QThreadPool *recentMessagesPool()
+    {
+        static QThreadPool *pool = [] {
+            auto *pool = new QThreadPool(qApp);
+            pool->setMaxThreadCount(
+                std::max(1, std::min(RECENT_MESSAGES_MAX_THREADS,
+                                     QThread::idealThreadCount())));
+            return pool;
+        }();
+
+        return pool;
+    }
+
+    // Runs on recentMessagesPool
+    void buildRecentMessages(std::weak_ptr<Channel> weak,
+                             const NetworkResult &result, QDate lastDate)
+    {
+        auto shared = weak.lock();
+        if (!shared)
+            return;
+
+        auto messages = parseRecentMessages(result.parseJson(), shared);
+
+        auto &handler = IrcMessageHandler::instance();
+
+        std::vector<MessagePtr> allBuiltMessages;
+        allBuiltMessages.reserve(messages.size());
+
+        for (auto message : messages)
+        {
+            if (message->tags().contains("rm-received-ts"))
+            {
+                QDate msgDate =
+                    QDateTime::fromMSecsSinceEpoch(
+                        message->tags().value("rm-received-ts").toLongLong())
+                        .date();
+                if (msgDate != lastDate)
+                {
+                    lastDate = msgDate;
+                    auto msg = makeSystemMessage(
+                        QLocale().toString(msgDate, QLocale::LongFormat),
+                        QTime(0, 0));
+                    msg->flags.set(MessageFlag::RecentMessage);
+                    allBuiltMessages.emplace_back(msg);
+                }
+            }
+
+            for (auto builtMessage :
+                 handler.parseMessage(shared.get(), message))
+            {
+                builtMessage->flags.set(MessageFlag::RecentMessage);
+                allBuiltMessages.emplace_back(builtMessage);
+            }
+
+            delete message;
+        }
+
+        // the channel is moved so it can only be destroyed on the GUI thread
+        postToThread([shared = std::move(shared), lastDate,
+                      messages = std::move(allBuiltMessages)]() mutable {
+            shared->lastDate_ = lastDate;
+            shared->addMessagesAtStart(messages);
+        });
+    }
+
+    // Collects the user names in /chatters/<category>/ of a chatters
+    // response while it's being parsed, without building a document
+    class ChattersHandler
+        : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>,
+                                              ChattersHandler>
     {
-        static QStringList categories = {"broadcaster", "vips",   "moderators",
-                                         "staff",       "admins", "global_mods",
-                                         "viewers"};
+    public:
+        std::vector<QString> chatters;
+        int chatterCount = 0;
+
+        bool Key(const char *str, rapidjson::SizeType length, bool)
+        {
+            this->key_ = QByteArray(str, int(length));
+            return true;
+        }
 
-        auto usernames = std::unordered_set<QString>();
+        bool StartObject()
+        {
+            this->inChatters_ = this->depth_ == 1 && this->key_ == "chatters";
+            this->depth_++;
+            return true;
+        }
 
-        // parse json
-        QJsonObject jsonCategories = jsonRoot.value("chatters").toObject();
+        bool EndObject(rapidjson::SizeType)
+        {
+            this->depth_--;
+            if (this->depth_ == 1)
+            {
+                this->inChatters_ = false;
+            }
+            return true;
+        }
+
+        bool StartArray()
+        {
+            static const QByteArray categories[] = {
+                "broadcaster", "vips",   "moderators", "staff",
+                "admins",      "global_mods", "viewers"};
+
+            this->inCategory_ =
+                this->inChatters_ && this->depth_ == 2 &&
+                std::find(std::begin(categories), std::end(categories),
+                          this->key_) != std::end(categories);
+            this->depth_++;
+            return true;
+        }
+
+        bool EndArray(rapidjson::SizeType)
+        {
+            this->depth_--;
+            this->inCategory_ = false;
+            return true;
+        }
+
+        bool String(const char *str, rapidjson::SizeType length, bool)
+        {
+            if (this->inCategory_)
+            {
+                this->chatters.push_back(
+                    QString::fromUtf8(str, int(length)).toLower());
+            }
+            return true;
+        }
 
-        for (const auto &category : categories)
+        bool Int(int value)
         {
-            for (auto jsonCategory : jsonCategories.value(category).toArray())
+            if (this->depth_ == 1 && this->key_ == "chatter_count")
             {
-                usernames.insert(jsonCategory.toString());
+                this->chatterCount = value;
             }
+            return true;
         }
 
-        return {Success, std::move(usernames)};
+        bool Uint(unsigned value)
+        {
+            return this->Int(int(value));
+        }
+
+    private:
+        // copied, rapidjson reuses the memory of the key for the next token
+        QByteArray key_;
+        int depth_ = 0;
+        bool inChatters_ = false;
+        bool inCategory_ = false;
+    };
+
+    // Returns the sorted chatters of a chatters response
+    Outcome parseChatters(const QByteArray &data,
+                          std::vector<QString> &chatters, int &chatterCount)
+    {
+        ChattersHandler handler;
+        rapidjson::Reader reader;
+        rapidjson::StringStream stream(data.constData());
+
+        if (reader.Parse(stream, handler).IsError())
+        {
+            return Failure;
+        }
+
+        std::sort(handler.chatters.begin(), handler.chatters.end());
+        handler.chatters.erase(
+            std::unique(handler.chatters.begin(), handler.chatters.end()),
+            handler.chatters.end());
+
+        chatters = std::move(handler.chatters);
+        chatterCount = handler.chatterCount;
+        return Success;
+    }
+
+    // Captures are replayed without loading anything from Twitch, so the
+    // channels only show what's in the capture
+    bool isReplaying()
+    {
+        return bool(getArgs().replayFile);
     }
 }  // namespace
 
@@ -177,6 +354,11 @@ TwitchChannel::TwitchChannel(const QString &name, BttvEmotes &bttv,
     // room id loaded -> refresh live status
     this->roomIdChanged.connect([this]() {
         this->refreshPubsub();
+        if (isReplaying())
+        {
+            return;
+        }
+
         this->refreshTitle();
         this->refreshLiveStatus();
         this->refreshBadges();
@@ -189,12 +371,14 @@ TwitchChannel::TwitchChannel(const QString &name, BttvEmotes &bttv,
     QObject::connect(&this->chattersListTimer_, &QTimer::timeout, [=] {
         this->refreshChatters();
     });
-    this->chattersListTimer_.start(5 * 60 * 1000);
 
     QObject::connect(&this->liveStatusTimer_, &QTimer::timeout, [=] {
         this->refreshLiveStatus();
     });
-    this->liveStatusTimer_.start(60 * 1000);
+    if (!isReplaying())
+    {
+        this->liveStatusTimer_.start(60 * 1000);
+    }
 
     // debugging
 #if 0
@@ -206,9 +390,26 @@ TwitchChannel::TwitchChannel(const QString &name, BttvEmotes &bttv,
 
 void TwitchChannel::initialize()
 {
+    if (isReplaying())
+    {
+        return;
+    }
+
     this->fetchDisplayName();
-    this->refreshChatters();
     this->refreshBadges();
+
+    // channels opened by the user get their chatters right away
+    auto delay = 0;
+    if (getApp()->isStartingUp())
+    {
+        static int chattersRefreshSlot = 0;
+        delay = chattersRefreshSlot++ % CHATTERS_REFRESH_SLOTS *
+                CHATTERS_REFRESH_SLOT_LENGTH;
+    }
+    QTimer::singleShot(delay, &this->chattersListTimer_, [this] {
+        this->refreshChatters();
+        this->chattersListTimer_.start(CHATTERS_REFRESH_PERIOD);
+    });
 }
 
 bool TwitchChannel::isEmpty() const
@@ -763,7 +964,7 @@ void TwitchChannel::parseLiveStatus(bool live, const HelixStream &stream)
 
 void TwitchChannel::loadRecentMessages()
 {
-    if (!getSettings()->loadTwitchMessageHistoryOnConnect)
+    if (!getSettings()->loadTwitchMessageHistoryOnConnect || isReplaying())
     {
         return;
     }
@@ -780,44 +981,16 @@ void TwitchChannel::loadRecentMessages()
             if (!shared)
                 return Failure;
 
-            auto messages = parseRecentMessages(result.parseJson(), shared);
-
-            auto &handler = IrcMessageHandler::instance();
+            // channels the user is looking at get their history first
+            auto priority =
+                getApp()->windows->isChannelVisible(shared.get()) ? 1 : 0;
 
-            std::vector<MessagePtr> allBuiltMessages;
-
-            for (auto message : messages)
-            {
-                if (message->tags().contains("rm-received-ts"))
-                {
-                    QDate msgDate = QDateTime::fromMSecsSinceEpoch(
-                                        message->tags()
-                                            .value("rm-received-ts")
-                                            .toLongLong())
-                                        .date();
-                    if (msgDate != shared.get()->lastDate_)
-                    {
-                        shared.get()->lastDate_ = msgDate;
-                        auto msg = makeSystemMessage(
-                            QLocale().toString(msgDate, QLocale::LongFormat),
-                            QTime(0, 0));
-                        msg->flags.set(MessageFlag::RecentMessage);
-                        allBuiltMessages.emplace_back(msg);
-                    }
-                }
-
-                for (auto builtMessage :
-                     handler.parseMessage(shared.get(), message))
-                {
-                    builtMessage->flags.set(MessageFlag::RecentMessage);
-                    allBuiltMessages.emplace_back(builtMessage);
-                }
-            }
-
-            postToThread(
-                [shared, messages = std::move(allBuiltMessages)]() mutable {
-                    shared->addMessagesAtStart(messages);
-                });
+            auto lastDate = shared->lastDate_;
+            recentMessagesPool()->start(
+                new LambdaRunnable([weak, result, lastDate] {
+                    buildRecentMessages(weak, result, lastDate);
+                }),
+                priority);
 
             return Success;
         })
@@ -864,16 +1037,31 @@ void TwitchChannel::refreshChatters()
                     return Failure;
                 }
 
-                auto data = result.parseJson();
-                this->chatterCount_ = data.value("chatter_count").toInt();
-
-                auto pair = parseChatters(std::move(data));
-                if (pair.first)
-                {
-                    this->updateOnlineChatters(pair.second);
-                }
-
-                return pair.first;
+                // big channels have hundreds of thousands of chatters, they
+                // are parsed and compared to the last list in the background
+                QThreadPool::globalInstance()->start(new LambdaRunnable(
+                    [this, shared = std::move(shared), result]() mutable {
+                        std::vector<QString> chatters;
+                        int chatterCount = 0;
+                        auto outcome = parseChatters(result.getData(),
+                                                     chatters, chatterCount);
+                        if (outcome)
+                        {
+                            this->updateOnlineChatters(std::move(chatters));
+                        }
+
+                        // the channel is moved so it can only be destroyed on
+                        // the GUI thread
+                        postToThread([this, shared = std::move(shared),
+                                      outcome, chatterCount] {
+                            if (outcome)
+                            {
+                                this->chatterCount_ = chatterCount;
+                            }
+                        });
+                    }));
+
+                return Success;
             })
         .execute();
 }
@@ -910,7 +1098,7 @@ void TwitchChannel::refreshBadges()
     auto url = Url{"https://badges.twitch.tv/v1/badges/channels/" +
                    this->roomId() + "/display?language=en"};
     NetworkRequest(url.string)
-
+        .revalidate()
         .onSuccess([this,
                     weak = weakOf<Channel>(this)](auto result) -> Outcome {
             auto shared = weak.lock();
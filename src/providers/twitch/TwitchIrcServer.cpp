@@ -15,8 +15,10 @@
 #include "providers/twitch/TwitchAccount.hpp"
 #include "providers/twitch/TwitchChannel.hpp"
 #include "providers/twitch/TwitchHelpers.hpp"
+#include "util/DebugCount.hpp"
 #include "util/PostToThread.hpp"
 
+#include <QDateTime>
 #include <QMetaEnum>
 
 // using namespace Communi;
@@ -106,6 +108,21 @@ void TwitchIrcServer::privateMessageReceived(
     Communi::IrcPrivateMessage *message)
 {
     IrcMessageHandler::instance().handlePrivMessage(message, *this);
+
+    DebugCount::increase("irc messages received");
+
+    // time between the server sending the message and it being added to
+    // the channel, only meaningful if the clocks are in sync (e.g. when
+    // connected to a local test server)
+    bool ok = false;
+    auto sentAt = message->tags().value("tmi-sent-ts").toLongLong(&ok);
+    if (ok)
+    {
+        static double averageLatency = 0;
+        auto latency = QDateTime::currentMSecsSinceEpoch() - sentAt;
+        averageLatency = averageLatency * 0.9 + double(latency) * 0.1;
+        DebugCount::set("irc message latency (ms)", int64_t(averageLatency));
+    }
 }
 
 void TwitchIrcServer::readConnectionMessageReceived(
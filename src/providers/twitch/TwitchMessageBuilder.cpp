@@ -4,6 +4,8 @@
 #include "controllers/accounts/AccountController.hpp"
 #include "controllers/ignores/IgnoreController.hpp"
 #include "controllers/ignores/IgnorePhrase.hpp"
+#include "controllers/ignores/IgnorePhraseMatcher.hpp"
+#include "debug/Trace.hpp"
 #include "messages/Message.hpp"
 #include "providers/chatterino/ChatterinoBadges.hpp"
 #include "providers/ffz/FfzBadges.hpp"
@@ -167,6 +169,8 @@ void TwitchMessageBuilder::triggerHighlights()
 
 MessagePtr TwitchMessageBuilder::build()
 {
+    TraceSpan span("TwitchMessageBuilder::build", "irc");
+
     // PARSE
     this->userId_ = this->ircMessage->tag("user-id").toString();
 
@@ -736,52 +740,128 @@ void TwitchMessageBuilder::appendUsername()
 void TwitchMessageBuilder::runIgnoreReplaces(
     std::vector<TwitchEmoteOccurence> &twitchEmotes)
 {
-    auto phrases = getCSettings().ignoredMessages.readOnly();
-    auto removeEmotesInRange = [](int pos, int len,
-                                  auto &twitchEmotes) mutable {
-        auto it = std::partition(
-            twitchEmotes.begin(), twitchEmotes.end(),
-            [pos, len](const auto &item) {
-                return !((item.start >= pos) && item.start < (pos + len));
-            });
-        for (auto copy = it; copy != twitchEmotes.end(); ++copy)
+    auto matcher = IgnorePhraseMatcher::current();
+    auto replacements = matcher->findReplacements(this->originalMessage_);
+
+    if (replacements.empty())
+    {
+        return;
+    }
+
+    // Build the new message. All replacements were found in the original
+    // message, so the emote indices only need to be remapped once.
+    QString message;
+    std::vector<int> newStarts;
+    newStarts.reserve(replacements.size());
+
+    int last = 0;
+    for (const auto &replacement : replacements)
+    {
+        message +=
+            this->originalMessage_.midRef(last, replacement.start - last);
+        newStarts.push_back(message.size());
+        message += replacement.text;
+        last = replacement.start + replacement.length;
+    }
+    message += this->originalMessage_.midRef(last);
+
+    // Shift emotes after each replacement, and take out the ones inside a
+    // replacement
+    std::sort(twitchEmotes.begin(), twitchEmotes.end(),
+              [](const auto &a, const auto &b) {
+                  return a.start < b.start;
+              });
+
+    std::vector<std::vector<TwitchEmoteOccurence>> replacedEmotes(
+        replacements.size());
+    std::vector<TwitchEmoteOccurence> keptEmotes;
+    keptEmotes.reserve(twitchEmotes.size());
+
+    size_t current = 0;
+    int shift = 0;
+    for (auto &emote : twitchEmotes)
+    {
+        while (current < replacements.size() &&
+               replacements[current].start + replacements[current].length <=
+                   emote.start)
+        {
+            shift += replacements[current].text.size() -
+                     replacements[current].length;
+            current++;
+        }
+
+        if (current < replacements.size() &&
+            emote.start >= replacements[current].start)
         {
-            if ((*copy).ptr == nullptr)
+            replacedEmotes[current].push_back(std::move(emote));
+            continue;
+        }
+
+        emote.start += shift;
+        emote.end += shift;
+        keptEmotes.push_back(std::move(emote));
+    }
+
+    twitchEmotes = std::move(keptEmotes);
+    this->originalMessage_ = message;
+
+    // Emotes can still be part of the words around the replaced text, or be
+    // inserted by the replacement itself
+    for (size_t i = 0; i < replacements.size(); i++)
+    {
+        const auto &replacement = replacements[i];
+
+        int pos1 = newStarts[i];
+        while (pos1 > 0)
+        {
+            if (message[pos1 - 1] == ' ')
+            {
+                break;
+            }
+            --pos1;
+        }
+        int pos2 = newStarts[i] + replacement.text.size();
+        while (pos2 < message.length())
+        {
+            if (message[pos2] == ' ')
             {
-                qCDebug(chatterinoTwitch)
-                    << "remem nullptr" << (*copy).name.string;
+                break;
             }
+            ++pos2;
         }
-        std::vector<TwitchEmoteOccurence> v(it, twitchEmotes.end());
-        twitchEmotes.erase(it, twitchEmotes.end());
-        return v;
-    };
 
-    auto shiftIndicesAfter = [&twitchEmotes](int pos, int by) mutable {
-        for (auto &item : twitchEmotes)
+        auto midExtendedRef = message.midRef(pos1, pos2 - pos1);
+
+        for (auto &tup : replacedEmotes[i])
         {
-            auto &index = item.start;
-            if (index >= pos)
+            if (tup.ptr == nullptr)
+            {
+                qCDebug(chatterinoTwitch) << "v nullptr" << tup.name.string;
+                continue;
+            }
+            QRegularExpression emoteregex(
+                "\\b" + QRegularExpression::escape(tup.name.string) + "\\b",
+                QRegularExpression::UseUnicodePropertiesOption);
+            auto match = emoteregex.match(midExtendedRef);
+            if (match.hasMatch())
             {
-                index += by;
-                item.end += by;
+                tup.start = pos1 + match.capturedStart();
+                tup.end = tup.start + tup.name.string.length() - 1;
+                twitchEmotes.push_back(std::move(tup));
             }
         }
-    };
 
-    auto addReplEmotes = [&twitchEmotes](const IgnorePhrase &phrase,
-                                         const QStringRef &midrepl,
-                                         int startIndex) mutable {
-        if (!phrase.containsEmote())
+        const auto *phrase = replacement.phrase;
+        if (!phrase->containsEmote())
         {
-            return;
+            continue;
         }
 
-        QVector<QStringRef> words = midrepl.split(' ');
+        QVector<QStringRef> words = midExtendedRef.split(' ');
         int pos = 0;
         for (const auto &word : words)
         {
-            for (const auto &emote : phrase.getEmotes())
+            for (const auto &emote : phrase->getEmotes())
             {
                 if (word == emote.first.string)
                 {
@@ -791,8 +871,8 @@ void TwitchMessageBuilder::runIgnoreReplaces(
                             << "emote null" << emote.first.string;
                     }
                     twitchEmotes.push_back(TwitchEmoteOccurence{
-                        startIndex + pos,
-                        startIndex + pos + emote.first.string.length(),
+                        pos1 + pos,
+                        pos1 + pos + emote.first.string.length() - 1,
                         emote.second,
                         emote.first,
                     });
@@ -800,155 +880,6 @@ void TwitchMessageBuilder::runIgnoreReplaces(
             }
             pos += word.length() + 1;
         }
-    };
-
-    for (const auto &phrase : *phrases)
-    {
-        if (phrase.isBlock())
-        {
-            continue;
-        }
-        const auto &pattern = phrase.getPattern();
-        if (pattern.isEmpty())
-        {
-            continue;
-        }
-        if (phrase.isRegex())
-        {
-            const auto &regex = phrase.getRegex();
-            if (!regex.isValid())
-            {
-                continue;
-            }
-            QRegularExpressionMatch match;
-            int from = 0;
-            while ((from = this->originalMessage_.indexOf(regex, from,
-                                                          &match)) != -1)
-            {
-                int len = match.capturedLength();
-                auto vret = removeEmotesInRange(from, len, twitchEmotes);
-                auto mid = this->originalMessage_.mid(from, len);
-                mid.replace(regex, phrase.getReplace());
-
-                int midsize = mid.size();
-                this->originalMessage_.replace(from, len, mid);
-                int pos1 = from;
-                while (pos1 > 0)
-                {
-                    if (this->originalMessage_[pos1 - 1] == ' ')
-                    {
-                        break;
-                    }
-                    --pos1;
-                }
-                int pos2 = from + midsize;
-                while (pos2 < this->originalMessage_.length())
-                {
-                    if (this->originalMessage_[pos2] == ' ')
-                    {
-                        break;
-                    }
-                    ++pos2;
-                }
-
-                shiftIndicesAfter(from + len, midsize - len);
-
-                auto midExtendedRef =
-                    this->originalMessage_.midRef(pos1, pos2 - pos1);
-
-                for (auto &tup : vret)
-                {
-                    if (tup.ptr == nullptr)
-                    {
-                        qCDebug(chatterinoTwitch)
-                            << "v nullptr" << tup.name.string;
-                        continue;
-                    }
-                    QRegularExpression emoteregex(
-                        "\\b" + tup.name.string + "\\b",
-                        QRegularExpression::UseUnicodePropertiesOption);
-                    auto _match = emoteregex.match(midExtendedRef);
-                    if (_match.hasMatch())
-                    {
-                        int last = _match.lastCapturedIndex();
-                        for (int i = 0; i <= last; ++i)
-                        {
-                            tup.start = from + _match.capturedStart();
-                            twitchEmotes.push_back(std::move(tup));
-                        }
-                    }
-                }
-
-                addReplEmotes(phrase, midExtendedRef, pos1);
-
-                from += midsize;
-            }
-        }
-        else
-        {
-            int from = 0;
-            while ((from = this->originalMessage_.indexOf(
-                        pattern, from, phrase.caseSensitivity())) != -1)
-            {
-                int len = pattern.size();
-                auto vret = removeEmotesInRange(from, len, twitchEmotes);
-                auto replace = phrase.getReplace();
-
-                int replacesize = replace.size();
-                this->originalMessage_.replace(from, len, replace);
-
-                int pos1 = from;
-                while (pos1 > 0)
-                {
-                    if (this->originalMessage_[pos1 - 1] == ' ')
-                    {
-                        break;
-                    }
-                    --pos1;
-                }
-                int pos2 = from + replacesize;
-                while (pos2 < this->originalMessage_.length())
-                {
-                    if (this->originalMessage_[pos2] == ' ')
-                    {
-                        break;
-                    }
-                    ++pos2;
-                }
-
-                shiftIndicesAfter(from + len, replacesize - len);
-
-                auto midExtendedRef =
-                    this->originalMessage_.midRef(pos1, pos2 - pos1);
-
-                for (auto &tup : vret)
-                {
-                    if (tup.ptr == nullptr)
-                    {
-                        qCDebug(chatterinoTwitch)
-                            << "v nullptr" << tup.name.string;
-                        continue;
-                    }
-                    QRegularExpression emoteregex(
-                        "\\b" + tup.name.string + "\\b",
-                        QRegularExpression::UseUnicodePropertiesOption);
-                    auto match = emoteregex.match(midExtendedRef);
-                    if (match.hasMatch())
-                    {
-                        int last = match.lastCapturedIndex();
-                        for (int i = 0; i <= last; ++i)
-                        {
-                            tup.start = from + match.capturedStart();
-                            twitchEmotes.push_back(std::move(tup));
-                        }
-                    }
-                }
-
-                addReplEmotes(phrase, midExtendedRef, pos1);
-
-                from += replacesize;
-            }
-        }
     }
 }
 
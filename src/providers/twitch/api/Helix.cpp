@@ -11,7 +11,8 @@ static Helix *instance = nullptr;
 
 void Helix::fetchUsers(QStringList userIds, QStringList userLogins,
                        ResultCallback<std::vector<HelixUser>> successCallback,
-                       HelixFailureCallback failureCallback)
+                       HelixFailureCallback failureCallback,
+                       NetworkRequestPriority priority)
 {
     QUrlQuery urlQuery;
 
@@ -27,6 +28,7 @@ void Helix::fetchUsers(QStringList userIds, QStringList userLogins,
 
     // TODO: set on success and on error
     this->makeRequest("users", urlQuery)
+        .priority(priority)
         .onSuccess([successCallback, failureCallback](auto result) -> Outcome {
             auto root = result.parseJson();
             auto data = root.value("data");
@@ -57,7 +59,8 @@ void Helix::fetchUsers(QStringList userIds, QStringList userLogins,
 
 void Helix::getUserByName(QString userName,
                           ResultCallback<HelixUser> successCallback,
-                          HelixFailureCallback failureCallback)
+                          HelixFailureCallback failureCallback,
+                          NetworkRequestPriority priority)
 {
     QStringList userIds;
     QStringList userLogins{std::move(userName)};
@@ -73,12 +76,13 @@ void Helix::getUserByName(QString userName,
             }
             successCallback(users[0]);
         },
-        failureCallback);
+        failureCallback, priority);
 }
 
 void Helix::getUserById(QString userId,
                         ResultCallback<HelixUser> successCallback,
-                        HelixFailureCallback failureCallback)
+                        HelixFailureCallback failureCallback,
+                        NetworkRequestPriority priority)
 {
     QStringList userIds{std::move(userId)};
     QStringList userLogins;
@@ -93,13 +97,13 @@ void Helix::getUserById(QString userId,
             }
             successCallback(users[0]);
         },
-        failureCallback);
+        failureCallback, priority);
 }
 
 void Helix::fetchUsersFollows(
     QString fromId, QString toId,
     ResultCallback<HelixUsersFollowsResponse> successCallback,
-    HelixFailureCallback failureCallback)
+    HelixFailureCallback failureCallback, NetworkRequestPriority priority)
 {
     assert(!fromId.isEmpty() || !toId.isEmpty());
 
@@ -117,6 +121,7 @@ void Helix::fetchUsersFollows(
 
     // TODO: set on success and on error
     this->makeRequest("users/follows", urlQuery)
+        .priority(priority)
         .onSuccess([successCallback, failureCallback](auto result) -> Outcome {
             auto root = result.parseJson();
             if (root.empty())
@@ -136,16 +141,16 @@ void Helix::fetchUsersFollows(
 
 void Helix::getUserFollowers(
     QString userId, ResultCallback<HelixUsersFollowsResponse> successCallback,
-    HelixFailureCallback failureCallback)
+    HelixFailureCallback failureCallback, NetworkRequestPriority priority)
 {
     this->fetchUsersFollows("", std::move(userId), std::move(successCallback),
-                            std::move(failureCallback));
+                            std::move(failureCallback), priority);
 }
 
 void Helix::getUserFollow(
     QString userId, QString targetId,
     ResultCallback<bool, HelixUsersFollowsRecord> successCallback,
-    HelixFailureCallback failureCallback)
+    HelixFailureCallback failureCallback, NetworkRequestPriority priority)
 {
     this->fetchUsersFollows(
         std::move(userId), std::move(targetId),
@@ -158,7 +163,7 @@ void Helix::getUserFollow(
 
             successCallback(true, response.data[0]);
         },
-        std::move(failureCallback));
+        std::move(failureCallback), priority);
 }
 
 void Helix::fetchStreams(
@@ -306,6 +311,7 @@ void Helix::searchGames(QString gameName,
     urlQuery.addQueryItem("query", gameName);
 
     this->makeRequest("search/categories", urlQuery)
+        .priority(NetworkRequestPriority::Interactive)
         .onSuccess([successCallback, failureCallback](auto result) -> Outcome {
             auto root = result.parseJson();
             auto data = root.value("data");
@@ -364,6 +370,7 @@ void Helix::followUser(QString userId, QString targetId,
     urlQuery.addQueryItem("to_id", targetId);
 
     this->makeRequest("users/follows", urlQuery)
+        .priority(NetworkRequestPriority::Interactive)
         .type(NetworkRequestType::Post)
         .onSuccess([successCallback](auto /*result*/) -> Outcome {
             successCallback();
@@ -386,6 +393,7 @@ void Helix::unfollowUser(QString userId, QString targetId,
     urlQuery.addQueryItem("to_id", targetId);
 
     this->makeRequest("users/follows", urlQuery)
+        .priority(NetworkRequestPriority::Interactive)
         .type(NetworkRequestType::Delete)
         .onSuccess([successCallback](auto /*result*/) -> Outcome {
             successCallback();
@@ -407,6 +415,7 @@ void Helix::createClip(QString channelId,
     urlQuery.addQueryItem("broadcaster_id", channelId);
 
     this->makeRequest("clips", urlQuery)
+        .priority(NetworkRequestPriority::Interactive)
         .type(NetworkRequestType::Post)
         .header("Content-Type", "application/json")
         .onSuccess([successCallback, failureCallback](auto result) -> Outcome {
@@ -495,6 +504,7 @@ void Helix::createStreamMarker(
     payload.insert("user_id", QJsonValue(broadcasterId));
 
     this->makeRequest("streams/markers", QUrlQuery())
+        .priority(NetworkRequestPriority::Interactive)
         .type(NetworkRequestType::Post)
         .header("Content-Type", "application/json")
         .payload(QJsonDocument(payload).toJson(QJsonDocument::Compact))
@@ -586,6 +596,7 @@ void Helix::blockUser(QString targetUserId,
     urlQuery.addQueryItem("target_user_id", targetUserId);
 
     this->makeRequest("users/blocks", urlQuery)
+        .priority(NetworkRequestPriority::Interactive)
         .type(NetworkRequestType::Put)
         .onSuccess([successCallback](auto /*result*/) -> Outcome {
             successCallback();
@@ -606,6 +617,7 @@ void Helix::unblockUser(QString targetUserId,
     urlQuery.addQueryItem("target_user_id", targetUserId);
 
     this->makeRequest("users/blocks", urlQuery)
+        .priority(NetworkRequestPriority::Interactive)
         .type(NetworkRequestType::Delete)
         .onSuccess([successCallback](auto /*result*/) -> Outcome {
             successCallback();
@@ -648,6 +660,7 @@ void Helix::updateChannel(QString broadcasterId, QString gameId,
     data.setObject(obj);
     urlQuery.addQueryItem("broadcaster_id", broadcasterId);
     this->makeRequest("channels", urlQuery)
+        .priority(NetworkRequestPriority::Interactive)
         .type(NetworkRequestType::Patch)
         .header("Content-Type", "application/json")
         .payload(data.toJson())
@@ -673,6 +686,7 @@ void Helix::manageAutoModMessages(
     payload.insert("action", action);
 
     this->makeRequest("moderation/automod/message", QUrlQuery())
+        .priority(NetworkRequestPriority::Interactive)
         .type(NetworkRequestType::Post)
         .header("Content-Type", "application/json")
         .payload(QJsonDocument(payload).toJson(QJsonDocument::Compact))
@@ -732,6 +746,7 @@ void Helix::getCheermotes(
     urlQuery.addQueryItem("broadcaster_id", broadcasterId);
 
     this->makeRequest("bits/cheermotes", urlQuery)
+        .revalidate()
         .onSuccess([successCallback, failureCallback](auto result) -> Outcome {
             auto root = result.parseJson();
             auto data = root.value("data");
@@ -321,30 +321,40 @@ class Helix final : boost::noncopyable
 {
 public:
     // https://dev.twitch.tv/docs/api/reference#get-users
-    void fetchUsers(QStringList userIds, QStringList userLogins,
-                    ResultCallback<std::vector<HelixUser>> successCallback,
-                    HelixFailureCallback failureCallback);
-    void getUserByName(QString userName,
-                       ResultCallback<HelixUser> successCallback,
-                       HelixFailureCallback failureCallback);
-    void getUserById(QString userId, ResultCallback<HelixUser> successCallback,
-                     HelixFailureCallback failureCallback);
+    // Lookups for the user (e.g. user cards) pass
+    // NetworkRequestPriority::Interactive
+    void fetchUsers(
+        QStringList userIds, QStringList userLogins,
+        ResultCallback<std::vector<HelixUser>> successCallback,
+        HelixFailureCallback failureCallback,
+        NetworkRequestPriority priority = NetworkRequestPriority::Metadata);
+    void getUserByName(
+        QString userName, ResultCallback<HelixUser> successCallback,
+        HelixFailureCallback failureCallback,
+        NetworkRequestPriority priority = NetworkRequestPriority::Metadata);
+    void getUserById(
+        QString userId, ResultCallback<HelixUser> successCallback,
+        HelixFailureCallback failureCallback,
+        NetworkRequestPriority priority = NetworkRequestPriority::Metadata);
 
     // https://dev.twitch.tv/docs/api/reference#get-users-follows
     void fetchUsersFollows(
         QString fromId, QString toId,
         ResultCallback<HelixUsersFollowsResponse> successCallback,
-        HelixFailureCallback failureCallback);
+        HelixFailureCallback failureCallback,
+        NetworkRequestPriority priority = NetworkRequestPriority::Metadata);
 
     void getUserFollowers(
         QString userId,
         ResultCallback<HelixUsersFollowsResponse> successCallback,
-        HelixFailureCallback failureCallback);
+        HelixFailureCallback failureCallback,
+        NetworkRequestPriority priority = NetworkRequestPriority::Metadata);
 
     void getUserFollow(
         QString userId, QString targetId,
         ResultCallback<bool, HelixUsersFollowsRecord> successCallback,
-        HelixFailureCallback failureCallback);
+        HelixFailureCallback failureCallback,
+        NetworkRequestPriority priority = NetworkRequestPriority::Metadata);
 
     // https://dev.twitch.tv/docs/api/reference#get-streams
     void fetchStreams(QStringList userIds, QStringList userLogins,
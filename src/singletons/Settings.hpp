@@ -189,6 +189,8 @@ public:
                                            false};
     BoolSetting enableEmoteImages = {"/emotes/enableEmoteImages", true};
     BoolSetting animateEmotes = {"/emotes/enableGifAnimations", true};
+    BoolSetting decodeAnimatedEmotesOnDemand = {
+        "/emotes/decodeAnimatedEmotesOnDemand", false};
     FloatSetting emoteScale = {"/emotes/scale", 1.f};
 
     QStringSetting emojiSet = {"/emotes/emojiSet", "Twitter"};
@@ -363,6 +365,8 @@ public:
         "/misc/twitch/messageHistoryLimit",
         800,
     };
+    // in MiB, split between all channels, 0 only limits the message count
+    IntSetting scrollbackMemoryBudget = {"/misc/scrollbackMemoryBudget", 0};
 
     IntSetting emotesTooltipPreview = {"/misc/emotesTooltipPreview", 1};
     BoolSetting openLinksIncognito = {"/misc/openLinksIncognito", 0};
@@ -9,6 +9,12 @@
 
 namespace chatterino {
 
+namespace {
+
+    constexpr size_t MAX_NORMALIZED_COLORS = 4096;
+
+}  // namespace
+
 Theme::Theme()
 {
     this->update();
@@ -31,6 +37,8 @@ void Theme::actuallyUpdate(double hue, double multiplier)
 {
     BaseTheme::actuallyUpdate(hue, multiplier);
 
+    this->normalizedColors_.clear();
+
     auto getColor = [multiplier](double h, double s, double l, double a = 1.0) {
         return QColor::fromHslF(h, s, ((l - 0.5) * multiplier) + 0.5, a);
     };
@@ -119,6 +127,27 @@ void Theme::normalizeColor(QColor &color)
     }
 }
 
+QColor Theme::getNormalizedColor(const QColor &color)
+{
+    auto it = this->normalizedColors_.find(color.rgba());
+    if (it != this->normalizedColors_.end())
+    {
+        return it->second;
+    }
+
+    // custom colors (e.g. of usernames) can add up over time
+    if (this->normalizedColors_.size() >= MAX_NORMALIZED_COLORS)
+    {
+        this->normalizedColors_.clear();
+    }
+
+    auto normalized = color;
+    this->normalizeColor(normalized);
+    this->normalizedColors_.emplace(color.rgba(), normalized);
+
+    return normalized;
+}
+
 Theme *getTheme()
 {
     return getApp()->themes;
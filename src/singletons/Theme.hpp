@@ -9,6 +9,8 @@
 #include <pajlada/settings/setting.hpp>
 #include <singletons/Settings.hpp>
 
+#include <unordered_map>
+
 namespace chatterino {
 
 class WindowManager;
@@ -49,6 +51,9 @@ public:
     } splits;
 
     void normalizeColor(QColor &color);
+    // Same as normalizeColor, but the results are remembered until the theme
+    // changes. Only use this from the GUI thread.
+    QColor getNormalizedColor(const QColor &color);
 
 private:
     void actuallyUpdate(double hue, double multiplier) override;
@@ -58,6 +63,9 @@ private:
     double middleLookupTable_[360] = {};
     double minLookupTable_[360] = {};
 
+    // keyed by the rgba value of the color
+    std::unordered_map<QRgb, QColor> normalizedColors_;
+
     pajlada::Signals::NoArgSignal repaintVisibleChatWidgets_;
 
     friend class WindowManager;
@@ -207,6 +207,11 @@ void WindowManager::layoutChannelViews(Channel *channel)
     this->layoutRequested.invoke(channel);
 }
 
+void WindowManager::layoutMessages(const std::vector<MessagePtr> &messages)
+{
+    this->messagesLayoutRequested.invoke(messages);
+}
+
 void WindowManager::forceLayoutChannelViews()
 {
     this->incGeneration();
@@ -244,6 +249,36 @@ Window &WindowManager::getSelectedWindow()
     return *this->selectedWindow_;
 }
 
+bool WindowManager::isChannelVisible(const Channel *channel)
+{
+    assertInGuiThread();
+
+    for (auto *window : this->windows_)
+    {
+        if (!window->isVisible() || window->isMinimized())
+        {
+            continue;
+        }
+
+        auto *container = dynamic_cast<SplitContainer *>(
+            window->getNotebook().getSelectedPage());
+        if (container == nullptr)
+        {
+            continue;
+        }
+
+        for (auto *split : container->getSplits())
+        {
+            if (split->getChannel().get() == channel)
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
 Window &WindowManager::createWindow(WindowType type, bool show)
 {
     assertInGuiThread();
@@ -312,6 +347,11 @@ void WindowManager::initialize(Settings &settings, Paths &paths)
         {
             windowLayout = getArgs().customChannelLayout.value();
         }
+        else if (this->preloadedLayout_)
+        {
+            windowLayout = std::move(*this->preloadedLayout_);
+            this->preloadedLayout_ = boost::none;
+        }
         else
         {
             windowLayout = this->loadWindowLayoutFromFile();
@@ -645,6 +685,14 @@ void WindowManager::incGeneration()
     this->generation_++;
 }
 
+void WindowManager::preloadWindowLayout()
+{
+    if (!getArgs().customChannelLayout)
+    {
+        this->preloadedLayout_ = this->loadWindowLayoutFromFile();
+    }
+}
+
 WindowLayout WindowManager::loadWindowLayoutFromFile() const
 {
     return WindowLayout::loadFromFile(this->windowLayoutFilePath);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <boost/optional.hpp>
 #include <memory>
 #include "common/Channel.hpp"
 #include "common/FlagsEnum.hpp"
@@ -30,6 +31,10 @@ public:
     WindowManager();
     ~WindowManager() override;
 
+    // Reads the window layout file ahead of initialize. Only parses the
+    // file, so it can run on any thread.
+    void preloadWindowLayout();
+
     static void encodeChannel(IndirectChannel channel, QJsonObject &obj);
     static void encodeFilters(Split *split, QJsonArray &arr);
     static IndirectChannel decodeChannel(const SplitDescriptor &descriptor);
@@ -44,6 +49,10 @@ public:
     // Tell a channel (or all channels if channel is nullptr) to redo their
     // layout
     void layoutChannelViews(Channel *channel = nullptr);
+    // Tell the views showing one of the messages to redo their layout, e.g.
+    // after the messages were disabled. This includes views of other
+    // channels, like the mentions split or user cards.
+    void layoutMessages(const std::vector<MessagePtr> &messages);
 
     // Force all channel views to redo their layout
     // This is called, for example, when the emote scale or timestamp format has
@@ -54,6 +63,11 @@ public:
 
     Window &getMainWindow();
     Window &getSelectedWindow();
+
+    // Returns true if the channel is shown in a split on the selected tab of
+    // a visible window
+    bool isChannelVisible(const Channel *channel);
+
     Window &createWindow(WindowType type, bool show = true);
 
     void select(Split *split);
@@ -89,6 +103,11 @@ public:
     // channel is a nullptr, need to redo their layout
     pajlada::Signals::Signal<Channel *> layoutRequested;
 
+    // This signal fires whenever views showing one of the messages need to
+    // redo their layout
+    pajlada::Signals::Signal<const std::vector<MessagePtr> &>
+        messagesLayoutRequested;
+
     pajlada::Signals::NoArgSignal wordFlagsChanged;
 
     // This signal fires every 100ms and can be used to trigger random things that require a recheck.
@@ -110,6 +129,9 @@ private:
     // Contains the full path to the window layout file, e.g. /home/pajlada/.local/share/Chatterino/Settings/window-layout.json
     const QString windowLayoutFilePath;
 
+    // set by preloadWindowLayout, used up by initialize
+    boost::optional<WindowLayout> preloadedLayout_;
+
     bool initialized_ = false;
 
     QPoint emotePopupPos_;
@@ -0,0 +1,78 @@
+#include "util/Arena.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+
+namespace chatterino {
+
+namespace {
+
+    constexpr size_t FIRST_BLOCK_SIZE = 512;
+
+}  // namespace
+
+void *Arena::allocate(size_t size, size_t alignment)
+{
+    // blocks are allocated with new[], which aligns them for any type
+    assert(alignment <= alignof(std::max_align_t));
+
+    if (!this->blocks_.empty())
+    {
+        auto &block = this->blocks_.back();
+        auto offset = (this->used_ + alignment - 1) / alignment * alignment;
+
+        if (offset + size <= block.size)
+        {
+            this->used_ = offset + size;
+            return block.data.get() + offset;
+        }
+    }
+
+    auto blockSize = this->blocks_.empty() ? FIRST_BLOCK_SIZE
+                                           : this->blocks_.back().size * 2;
+    blockSize = std::max(blockSize, size);
+
+    this->blocks_.push_back({std::make_unique<char[]>(blockSize), blockSize});
+    this->used_ = size;
+
+    return this->blocks_.back().data.get();
+}
+
+bool Arena::contains(const void *ptr) const
+{
+    // std::less gives a total order even for pointers into different arrays
+    std::less<const void *> less;
+
+    return std::any_of(this->blocks_.begin(), this->blocks_.end(),
+                       [&](const Block &block) {
+                           return !less(ptr, block.data.get()) &&
+                                  less(ptr, block.data.get() + block.size);
+                       });
+}
+
+void Arena::reset()
+{
+    if (this->blocks_.size() > 1)
+    {
+        auto size = size_t(this->capacity());
+
+        this->blocks_.clear();
+        this->blocks_.push_back({std::make_unique<char[]>(size), size});
+    }
+
+    this->used_ = 0;
+}
+
+int64_t Arena::capacity() const
+{
+    int64_t bytes = 0;
+    for (auto &&block : this->blocks_)
+    {
+        bytes += block.size;
+    }
+
+    return bytes;
+}
+
+}  // namespace chatterino
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <boost/noncopyable.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace chatterino {
+
+/// Hands out memory from a few large blocks. Objects created in the arena
+/// have to be destroyed by calling their destructor, their memory is only
+/// given back by reset, which keeps the blocks around to be used again.
+class Arena : boost::noncopyable
+{
+public:
+    template <typename T, typename... Args>
+    T *create(Args &&...args)
+    {
+        return new (this->allocate(sizeof(T), alignof(T)))
+            T(std::forward<Args>(args)...);
+    }
+
+    void *allocate(size_t size, size_t alignment);
+
+    /// Returns true if ptr points into memory of the arena
+    bool contains(const void *ptr) const;
+
+    /// Makes all memory available again. Objects created in the arena have to
+    /// be destroyed before. If more than one block was used, they're replaced
+    /// by a single block that's large enough for all of them.
+    void reset();
+
+    /// Bytes allocated for the blocks
+    int64_t capacity() const;
+
+private:
+    struct Block {
+        std::unique_ptr<char[]> data;
+        size_t size;
+    };
+
+    std::vector<Block> blocks_;
+    // bytes used in the last block
+    size_t used_ = 0;
+};
+
+}  // namespace chatterino
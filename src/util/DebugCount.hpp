@@ -43,6 +43,20 @@ public:
         }
     }
 
+    static void set(const QString &name, int64_t value)
+    {
+        auto counts = counts_.access();
+
+        counts->insert(name, value);
+    }
+
+    static int64_t get(const QString &name)
+    {
+        auto counts = counts_.access();
+
+        return counts->value(name, 0);
+    }
+
     static QString getDebugText()
     {
         auto counts = counts_.access();
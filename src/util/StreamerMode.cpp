@@ -2,14 +2,11 @@
 
 #include "Application.hpp"
 #include "common/QLogging.hpp"
+#include "debug/AssertInGuiThread.hpp"
 #include "messages/MessageBuilder.hpp"
 #include "providers/twitch/TwitchIrcServer.hpp"
 #include "singletons/Settings.hpp"
-#include "singletons/WindowManager.hpp"
-#include "widgets/Notebook.hpp"
-#include "widgets/Window.hpp"
-#include "widgets/helper/NotebookTab.hpp"
-#include "widgets/splits/Split.hpp"
+#include "util/PostToThread.hpp"
 
 #ifdef USEWINSDK
 #    include <Windows.h>
@@ -19,14 +16,19 @@
 #    pragma comment(lib, "Wtsapi32.lib")
 #endif
 
+#include <QDir>
+#include <QFile>
 #include <QProcess>
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 namespace chatterino {
 
 constexpr int cooldownInS = 10;
 
-bool shouldShowWarning = true;
-
 const QStringList &broadcastingBinaries()
 {
 #ifdef USEWINSDK
@@ -37,102 +39,247 @@ const QStringList &broadcastingBinaries()
     return bins;
 }
 
-bool isInStreamerMode()
-{
-    switch (getSettings()->enableStreamerMode.getEnum())
-    {
-        case StreamerModeSetting::Enabled:
-            return true;
-        case StreamerModeSetting::Disabled:
-            return false;
-        case StreamerModeSetting::DetectObs:
-
-#if defined(Q_OS_LINUX) || defined(Q_OS_MACOS)
+namespace {
 
-            static bool cache = false;
-            static QDateTime time = QDateTime();
+#if defined(Q_OS_LINUX)
+    bool isBroadcasterRunning()
+    {
+        // Same as "pgrep -x", but without spawning a process
+        auto pids = QDir("/proc").entryList(QDir::Dirs | QDir::NoDotAndDotDot);
 
-            if (time.isValid() &&
-                time.addSecs(cooldownInS) > QDateTime::currentDateTime())
+        for (const auto &pid : pids)
+        {
+            if (pid.isEmpty() || !pid.at(0).isDigit())
             {
-                return cache;
+                continue;
             }
-            time = QDateTime::currentDateTime();
 
-            QProcess p;
-            p.start("pgrep", {"-x", broadcastingBinaries().join("|")},
-                    QIODevice::NotOpen);
+            QFile comm("/proc/" + pid + "/comm");
+            if (!comm.open(QFile::ReadOnly))
+            {
+                // the process has already exited
+                continue;
+            }
 
-            if (p.waitForFinished(1000) &&
-                p.exitStatus() == QProcess::NormalExit)
+            auto name = QString::fromUtf8(comm.readAll()).trimmed();
+            if (broadcastingBinaries().contains(name))
             {
-                cache = (p.exitCode() == 0);
-                return (p.exitCode() == 0);
+                return true;
             }
+        }
 
-            // Fallback to false and showing a warning
+        return false;
+    }
+#elif defined(Q_OS_MACOS)
+    bool isBroadcasterRunning()
+    {
+        static bool shouldShowWarning = true;
 
-            if (shouldShowWarning)
-            {
-                shouldShowWarning = false;
+        QProcess p;
+        p.start("pgrep", {"-x", broadcastingBinaries().join("|")},
+                QIODevice::NotOpen);
 
+        if (p.waitForFinished(1000) && p.exitStatus() == QProcess::NormalExit)
+        {
+            return p.exitCode() == 0;
+        }
+
+        // Fallback to false and showing a warning
+
+        if (shouldShowWarning)
+        {
+            shouldShowWarning = false;
+
+            postToThread([] {
                 getApp()->twitch2->addGlobalSystemMessage(
                     "Streamer Mode is set to Automatic, but pgrep is missing. "
                     "Install it to fix the issue or set Streamer Mode to "
                     "Enabled or Disabled in the Settings.");
-            }
+            });
+        }
 
-            qCWarning(chatterinoStreamerMode) << "pgrep execution timed out!";
+        qCWarning(chatterinoStreamerMode) << "pgrep execution timed out!";
 
-            cache = false;
+        return false;
+    }
+#elif defined(USEWINSDK)
+    bool isBroadcasterRunning()
+    {
+        if (!IsWindowsVistaOrGreater())
+        {
             return false;
+        }
+
+        WTS_PROCESS_INFO *pWPIs = nullptr;
+        DWORD dwProcCount = 0;
+        bool found = false;
+
+        if (WTSEnumerateProcesses(WTS_CURRENT_SERVER_HANDLE, NULL, 1, &pWPIs,
+                                  &dwProcCount))
+        {
+            //Go through all processes retrieved
+            for (DWORD i = 0; i < dwProcCount; i++)
+            {
+                QString processName = QString::fromUtf16(
+                    reinterpret_cast<char16_t *>(pWPIs[i].pProcessName));
+
+                if (broadcastingBinaries().contains(processName))
+                {
+                    found = true;
+                    break;
+                }
+            }
+        }
+
+        if (pWPIs)
+        {
+            WTSFreeMemory(pWPIs);
+        }
+
+        return found;
+    }
+#else
+    bool isBroadcasterRunning()
+    {
+        return false;
+    }
 #endif
 
-#ifdef USEWINSDK
-            if (!IsWindowsVistaOrGreater())
+    // Polls for broadcasting software on its own thread, so checking if
+    // streamer mode is active never blocks the caller.
+    class StreamerModeWatcher
+    {
+    public:
+        StreamerModeWatcher()
+        {
+            getSettings()->enableStreamerMode.connect(
+                [this](const auto &value, auto) {
+                    this->setMode(StreamerModeSetting(value));
+                },
+                this->connections_);
+
+            this->lastNotified_ = this->isActive();
+
+            this->thread_ = std::thread([this] {
+                this->run();
+            });
+        }
+
+        ~StreamerModeWatcher()
+        {
             {
-                return false;
+                std::lock_guard<std::mutex> lock(this->mutex_);
+                this->stopped_ = true;
             }
-            static bool cache = false;
-            static QDateTime time = QDateTime();
+            this->condition_.notify_one();
 
-            if (time.isValid() &&
-                time.addSecs(cooldownInS) > QDateTime::currentDateTime())
+            if (this->thread_.joinable())
             {
-                return cache;
+                this->thread_.join();
             }
-            time = QDateTime::currentDateTime();
+        }
 
-            WTS_PROCESS_INFO *pWPIs = nullptr;
-            DWORD dwProcCount = 0;
+        bool isActive() const
+        {
+            switch (this->mode_.load(std::memory_order_relaxed))
+            {
+                case StreamerModeSetting::Enabled:
+                    return true;
+                case StreamerModeSetting::DetectObs:
+                    return this->detected_.load(std::memory_order_relaxed);
+                default:
+                    return false;
+            }
+        }
 
-            if (WTSEnumerateProcesses(WTS_CURRENT_SERVER_HANDLE, NULL, 1,
-                                      &pWPIs, &dwProcCount))
+    private:
+        void setMode(StreamerModeSetting mode)
+        {
+            this->mode_ = mode;
+
+            if (mode == StreamerModeSetting::DetectObs)
             {
-                //Go through all processes retrieved
-                for (DWORD i = 0; i < dwProcCount; i++)
+                // detect right away instead of waiting for the next poll
+                this->condition_.notify_one();
+            }
+
+            this->notifyIfChanged();
+        }
+
+        // Can be called from any thread
+        void notifyIfChanged()
+        {
+            postToThread([this] {
+                // the value is read on the GUI thread, so the signal never
+                // reports an outdated value
+                auto active = this->isActive();
+                if (active != this->lastNotified_)
                 {
-                    QString processName = QString::fromUtf16(
-                        reinterpret_cast<char16_t *>(pWPIs[i].pProcessName));
-
-                    if (broadcastingBinaries().contains(processName))
-                    {
-                        cache = true;
-                        return true;
-                    }
+                    this->lastNotified_ = active;
+                    streamerModeChanged().invoke(active);
                 }
-            }
+            });
+        }
+
+        void run()
+        {
+            std::unique_lock<std::mutex> lock(this->mutex_);
 
-            if (pWPIs)
+            while (!this->stopped_)
             {
-                WTSFreeMemory(pWPIs);
+                if (this->mode_ == StreamerModeSetting::DetectObs)
+                {
+                    lock.unlock();
+                    this->detected_ = isBroadcasterRunning();
+                    this->notifyIfChanged();
+                    lock.lock();
+                }
+
+                this->condition_.wait_for(lock,
+                                          std::chrono::seconds(cooldownInS));
             }
+        }
 
-            cache = false;
-#endif
-            return false;
-    }
-    return false;
+        std::atomic<StreamerModeSetting> mode_{StreamerModeSetting::Disabled};
+        // Broadcasting software counts as running until the first detection
+        // finished, so nothing is shown that streamer mode would hide
+        std::atomic<bool> detected_{true};
+        // only accessed from the GUI thread
+        bool lastNotified_{false};
+
+        std::thread thread_;
+        std::mutex mutex_;
+        std::condition_variable condition_;
+        bool stopped_{false};
+
+        std::vector<pajlada::Signals::ScopedConnection> connections_;
+    };
+
+    // Created by initStreamerMode, read from any thread afterwards
+    std::atomic<StreamerModeWatcher *> watcher{nullptr};
+
+}  // namespace
+
+void initStreamerMode()
+{
+    assertInGuiThread();
+
+    // the watcher connects to the settings, which may only be accessed from
+    // the GUI thread
+    static StreamerModeWatcher instance;
+    watcher = &instance;
+}
+
+bool isInStreamerMode()
+{
+    auto *instance = watcher.load();
+    return instance != nullptr && instance->isActive();
+}
+
+pajlada::Signals::Signal<bool> &streamerModeChanged()
+{
+    static pajlada::Signals::Signal<bool> signal;
+    return signal;
 }
 
 }  // namespace chatterino
@@ -1,12 +1,24 @@
 #pragma once
 
 #include <QStringList>
+#include <pajlada/signals/signal.hpp>
 
 namespace chatterino {
 
 enum StreamerModeSetting { Disabled = 0, Enabled = 1, DetectObs = 2 };
 
 const QStringList &broadcastingBinaries();
+
+/// Starts watching the streamer mode setting and detecting broadcasting
+/// software. Has to be called from the GUI thread before isInStreamerMode is
+/// used from other threads.
+void initStreamerMode();
+
+/// Only reads a cached flag, detection of broadcasting software runs on a
+/// background thread. Returns false before initStreamerMode was called.
 bool isInStreamerMode();
 
+/// Invoked on the GUI thread whenever isInStreamerMode() changes its value
+pajlada::Signals::Signal<bool> &streamerModeChanged();
+
 }  // namespace chatterino
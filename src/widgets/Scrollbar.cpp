@@ -12,13 +12,14 @@
 #include <QPainter>
 #include <QTimer>
 
+#include <algorithm>
 #include <cmath>
 
 #define MIN_THUMB_HEIGHT 10
 
 namespace chatterino {
 
-Scrollbar::Scrollbar(ChannelView *parent)
+Scrollbar::Scrollbar(QWidget *parent)
     : BaseWidget(parent)
     , currentValueAnimation_(this, "currentValue_")
 {
@@ -28,23 +29,129 @@ Scrollbar::Scrollbar(ChannelView *parent)
         QEasingCurve(QEasingCurve::OutCubic));
 
     setMouseTracking(true);
+
+    getSettings()->enableRedeemedHighlight.connect(
+        [this](auto, auto) {
+            this->invalidateHighlightStrip();
+            this->update();
+        },
+        this->connections_);
+
+    // highlight colors are changed in place, so rerender the strip whenever
+    // the channel views get laid out again
+    this->connections_.push_back(
+        getApp()->windows->layoutRequested.connect([this](Channel *) {
+            this->invalidateHighlightStrip();
+        }));
 }
 
 void Scrollbar::addHighlight(ScrollbarHighlight highlight)
 {
-    ScrollbarHighlight deleted;
-    this->highlights_.pushBack(highlight, deleted);
+    auto &highlights = this->highlights_;
+
+    if (!highlight.isNull())
+    {
+        highlights.entries.emplace_back(
+            highlights.start + int64_t(highlights.count), highlight);
+    }
+
+    // mirrors LimitedQueue::pushBack, which drops the first item once the
+    // limit is reached
+    if (++highlights.count >= this->highlightsLimit_)
+    {
+        highlights.count--;
+        highlights.start++;
+
+        while (!highlights.entries.empty() &&
+               highlights.entries.front().first < highlights.start)
+        {
+            highlights.entries.pop_front();
+        }
+    }
+
+    this->highlightsChanged_ = true;
 }
 
 void Scrollbar::addHighlightsAtStart(
     const std::vector<ScrollbarHighlight> &_highlights)
 {
-    this->highlights_.pushFront(_highlights);
+    auto &highlights = this->highlights_;
+
+    // mirrors LimitedQueue::pushFront, which only accepts as many items from
+    // the end as there is space for
+    auto accepted = std::min(this->highlightsLimit_ - highlights.count,
+                             _highlights.size());
+
+    for (size_t i = 0; i < accepted; i++)
+    {
+        const auto &highlight = _highlights[_highlights.size() - 1 - i];
+
+        highlights.start--;
+        if (!highlight.isNull())
+        {
+            highlights.entries.emplace_front(highlights.start, highlight);
+        }
+    }
+    highlights.count += accepted;
+
+    this->highlightsChanged_ = true;
+}
+
+void Scrollbar::removeHighlightFromStart()
+{
+    auto &highlights = this->highlights_;
+
+    if (highlights.count == 0)
+    {
+        return;
+    }
+
+    highlights.count--;
+    highlights.start++;
+
+    while (!highlights.entries.empty() &&
+           highlights.entries.front().first < highlights.start)
+    {
+        highlights.entries.pop_front();
+    }
+
+    this->highlightsChanged_ = true;
 }
 
 void Scrollbar::replaceHighlight(size_t index, ScrollbarHighlight replacement)
 {
-    this->highlights_.replaceItem(index, replacement);
+    auto &highlights = this->highlights_;
+
+    if (index >= highlights.count)
+    {
+        return;
+    }
+
+    auto absoluteIndex = highlights.start + int64_t(index);
+    auto it = std::lower_bound(
+        highlights.entries.begin(), highlights.entries.end(), absoluteIndex,
+        [](const auto &entry, int64_t value) {
+            return entry.first < value;
+        });
+    bool exists = it != highlights.entries.end() && it->first == absoluteIndex;
+
+    if (replacement.isNull())
+    {
+        if (exists)
+        {
+            highlights.entries.erase(it);
+        }
+    }
+    else if (exists)
+    {
+        it->second = replacement;
+    }
+    else
+    {
+        highlights.entries.emplace(it, absoluteIndex, replacement);
+    }
+
+    this->highlightsChanged_ = true;
 }
 
 void Scrollbar::pauseHighlights()
@@ -59,17 +166,81 @@ void Scrollbar::unpauseHighlights()
 
 void Scrollbar::clearHighlights()
 {
-    this->highlights_.clear();
+    this->highlights_ = Highlights();
+    this->highlightsChanged_ = true;
+}
+
+void Scrollbar::updateHighlightSnapshot()
+{
+    if (!this->highlightsPaused_ && this->highlightsChanged_)
+    {
+        this->highlightSnapshot_ = this->highlights_;
+        this->highlightsChanged_ = false;
+        this->invalidateHighlightStrip();
+    }
+}
+
+void Scrollbar::invalidateHighlightStrip()
+{
+    this->highlightStripValid_ = false;
 }
 
-LimitedQueueSnapshot<ScrollbarHighlight> Scrollbar::getHighlightSnapshot()
+void Scrollbar::renderHighlightStrip()
 {
-    if (!this->highlightsPaused_)
+    auto dpr = this->devicePixelRatioF();
+    auto size = this->size() * dpr;
+
+    if (this->highlightStrip_.size() != size)
+    {
+        this->highlightStrip_ = QPixmap(size);
+    }
+    this->highlightStrip_.setDevicePixelRatio(dpr);
+    this->highlightStrip_.fill(Qt::transparent);
+    this->highlightStripValid_ = true;
+
+    const auto &snapshot = this->highlightSnapshot_;
+    if (snapshot.count == 0 || snapshot.entries.empty())
     {
-        this->highlightSnapshot_ = this->highlights_.getSnapshot();
+        return;
     }
 
-    return this->highlightSnapshot_;
+    QPainter painter(&this->highlightStrip_);
+
+    bool enableRedeemedHighlights = getSettings()->enableRedeemedHighlight;
+
+    int w = this->width();
+    float dY = float(this->height()) / float(snapshot.count);
+    int highlightHeight =
+        int(std::ceil(std::max<float>(this->scale() * 2, dY)));
+
+    for (const auto &[index, highlight] : snapshot.entries)
+    {
+        if (highlight.isRedeemedHighlight() && !enableRedeemedHighlights)
+        {
+            continue;
+        }
+
+        float y = float(index - snapshot.start) * dY;
+
+        QColor color = highlight.getColor();
+        color.setAlpha(255);
+
+        switch (highlight.getStyle())
+        {
+            case ScrollbarHighlight::Default: {
+                painter.fillRect(w / 8 * 3, int(y), w / 4, highlightHeight,
+                                 color);
+            }
+            break;
+
+            case ScrollbarHighlight::Line: {
+                painter.fillRect(0, int(y), w, 1, color);
+            }
+            break;
+
+            case ScrollbarHighlight::None:;
+        }
+    }
 }
 
 void Scrollbar::scrollToBottom(bool animate)
@@ -250,8 +421,6 @@ void Scrollbar::paintEvent(QPaintEvent *)
     QPainter painter(this);
     painter.fillRect(rect(), this->theme->scrollbars.background);
 
-    bool enableRedeemedHighlights = getSettings()->enableRedeemedHighlight;
-
     //    painter.fillRect(QRect(xOffset, 0, width(), this->buttonHeight),
     //                     this->themeManager->ScrollbarArrow);
     //    painter.fillRect(QRect(xOffset, height() - this->buttonHeight,
@@ -273,56 +442,34 @@ void Scrollbar::paintEvent(QPaintEvent *)
     }
 
     // draw highlights
-    auto snapshot = this->getHighlightSnapshot();
-    size_t snapshotLength = snapshot.size();
+    this->updateHighlightSnapshot();
 
-    if (snapshotLength == 0)
+    if (this->highlightSnapshot_.entries.empty())
     {
         return;
     }
 
-    int w = this->width();
-    float y = 0;
-    float dY = float(this->height()) / float(snapshotLength);
-    int highlightHeight =
-        int(std::ceil(std::max<float>(this->scale() * 2, dY)));
-
-    for (size_t i = 0; i < snapshotLength; i++)
+    if (!this->highlightStripValid_ ||
+        this->highlightStrip_.size() !=
+            this->size() * this->devicePixelRatioF())
     {
-        ScrollbarHighlight const &highlight = snapshot[i];
-
-        if (!highlight.isNull())
-        {
-            if (!highlight.isRedeemedHighlight() || enableRedeemedHighlights)
-            {
-                QColor color = highlight.getColor();
-                color.setAlpha(255);
-
-                switch (highlight.getStyle())
-                {
-                    case ScrollbarHighlight::Default: {
-                        painter.fillRect(w / 8 * 3, int(y), w / 4,
-                                         highlightHeight, color);
-                    }
-                    break;
-
-                    case ScrollbarHighlight::Line: {
-                        painter.fillRect(0, int(y), w, 1, color);
-                    }
-                    break;
-
-                    case ScrollbarHighlight::None:;
-                }
-            }
-        }
-
-        y += dY;
+        this->renderHighlightStrip();
     }
+
+    painter.drawPixmap(0, 0, this->highlightStrip_);
 }
 
 void Scrollbar::resizeEvent(QResizeEvent *)
 {
     this->resize(int(16 * this->scale()), this->height());
+    this->invalidateHighlightStrip();
+}
+
+void Scrollbar::themeChangedEvent()
+{
+    BaseWidget::themeChangedEvent();
+
+    this->invalidateHighlightStrip();
 }
 
 void Scrollbar::mouseMoveEvent(QMouseEvent *event)
@@ -1,29 +1,31 @@
 #pragma once
 
-#include "messages/LimitedQueue.hpp"
 #include "widgets/BaseWidget.hpp"
 #include "widgets/helper/ScrollbarHighlight.hpp"
 
-#include <QMutex>
+#include <QPixmap>
 #include <QPropertyAnimation>
 #include <QWidget>
 #include <pajlada/signals/signal.hpp>
 
-namespace chatterino {
+#include <cstdint>
+#include <deque>
 
-class ChannelView;
+namespace chatterino {
 
 class Scrollbar : public BaseWidget
 {
     Q_OBJECT
 
 public:
-    Scrollbar(ChannelView *parent = nullptr);
+    Scrollbar(QWidget *parent = nullptr);
 
     void addHighlight(ScrollbarHighlight highlight);
     void addHighlightsAtStart(
         const std::vector<ScrollbarHighlight> &highlights_);
     void replaceHighlight(size_t index, ScrollbarHighlight replacement);
+    // mirrors LimitedQueue::popFront
+    void removeHighlightFromStart();
 
     void pauseHighlights();
     void unpauseHighlights();
@@ -59,6 +61,7 @@ public:
 protected:
     void paintEvent(QPaintEvent *) override;
     void resizeEvent(QResizeEvent *) override;
+    void themeChangedEvent() override;
     void mouseMoveEvent(QMouseEvent *event) override;
     void mousePressEvent(QMouseEvent *event) override;
     void mouseReleaseEvent(QMouseEvent *event) override;
@@ -67,16 +70,32 @@ protected:
 private:
     Q_PROPERTY(qreal currentValue_ READ getCurrentValue WRITE setCurrentValue)
 
-    LimitedQueueSnapshot<ScrollbarHighlight> getHighlightSnapshot();
+    // Only non-null highlights are stored. Their indices are absolute, so
+    // trimming the oldest message doesn't require touching every entry.
+    // The message count mirrors the LimitedQueue in ChannelView.
+    struct Highlights {
+        std::deque<std::pair<int64_t, ScrollbarHighlight>> entries;
+        int64_t start = 0;
+        size_t count = 0;
+    };
+
+    void updateHighlightSnapshot();
+    void renderHighlightStrip();
+    void invalidateHighlightStrip();
     void updateScroll();
 
-    QMutex mutex_;
-
     QPropertyAnimation currentValueAnimation_;
 
-    LimitedQueue<ScrollbarHighlight> highlights_;
+    const size_t highlightsLimit_ = 1000;
+    Highlights highlights_;
+    bool highlightsChanged_{false};
     bool highlightsPaused_{false};
-    LimitedQueueSnapshot<ScrollbarHighlight> highlightSnapshot_;
+    Highlights highlightSnapshot_;
+
+    // highlights are rendered into this strip, which is only redrawn when
+    // the highlights or the size of the scrollbar change
+    QPixmap highlightStrip_;
+    bool highlightStripValid_{false};
 
     bool atBottom_{false};
 
@@ -99,6 +118,8 @@ private:
 
     pajlada::Signals::NoArgSignal currentValueChanged_;
     pajlada::Signals::NoArgSignal desiredValueChanged_;
+
+    std::vector<pajlada::Signals::ScopedConnection> connections_;
 };
 
 }  // namespace chatterino
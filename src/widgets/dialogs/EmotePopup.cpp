@@ -4,43 +4,26 @@
 #include "common/CompletionModel.hpp"
 #include "controllers/accounts/AccountController.hpp"
 #include "debug/Benchmark.hpp"
-#include "messages/Message.hpp"
-#include "messages/MessageBuilder.hpp"
 #include "providers/twitch/TwitchChannel.hpp"
 #include "singletons/Emotes.hpp"
 #include "singletons/WindowManager.hpp"
 #include "util/Shortcut.hpp"
 #include "widgets/Notebook.hpp"
 #include "widgets/Scrollbar.hpp"
-#include "widgets/helper/ChannelView.hpp"
+#include "widgets/helper/EmoteGrid.hpp"
 
 #include <QHBoxLayout>
+#include <QLineEdit>
 #include <QShortcut>
 #include <QTabWidget>
 
 namespace chatterino {
 namespace {
-    auto makeTitleMessage(const QString &title)
+    EmoteGrid::Section makeEmoteSection(const QString &key,
+                                        const QString &title,
+                                        const EmoteMap &map)
     {
-        MessageBuilder builder;
-        builder.emplace<TextElement>(title, MessageElementFlag::Text);
-        builder->flags.set(MessageFlag::Centered);
-        return builder.release();
-    }
-    auto makeEmoteMessage(const EmoteMap &map,
-                          const MessageElementFlag &emoteFlag)
-    {
-        MessageBuilder builder;
-        builder->flags.set(MessageFlag::Centered);
-        builder->flags.set(MessageFlag::DisableCompactEmotes);
-
-        if (map.empty())
-        {
-            builder.emplace<TextElement>("no emotes available",
-                                         MessageElementFlag::Text,
-                                         MessageColor::System);
-            return builder.release();
-        }
+        EmoteGrid::Section section{key, title, {}};
 
         std::vector<std::pair<EmoteName, EmotePtr>> vec(map.begin(), map.end());
         std::sort(vec.begin(), vec.end(),
@@ -51,21 +34,19 @@ namespace {
                   });
         for (const auto &emote : vec)
         {
-            builder
-                .emplace<EmoteElement>(
-                    emote.second,
-                    MessageElementFlags{MessageElementFlag::AlwaysShow,
-                                        emoteFlag})
-                ->setLink(Link(Link::InsertText, emote.first.string));
+            section.items.push_back({emote.second, emote.first.string});
         }
 
-        return builder.release();
+        return section;
     }
     void addEmoteSets(
         std::vector<std::shared_ptr<TwitchAccount::EmoteSet>> sets,
-        Channel &globalChannel, Channel &subChannel, QString currentChannelName)
+        std::vector<EmoteGrid::Section> &globalSections,
+        std::vector<EmoteGrid::Section> &subSections,
+        QString currentChannelName)
     {
-        QMap<QString, QPair<bool, std::vector<MessagePtr>>> mapOfSets;
+        // one section per channel, with the emotes of all of its sets
+        QMap<QString, QPair<bool, EmoteGrid::Section>> mapOfSets;
 
         for (const auto &set : sets)
         {
@@ -79,50 +60,34 @@ namespace {
             auto channelName = set->channelName;
             auto text = set->text.isEmpty() ? "Twitch" : set->text;
 
-            // EMOTES
-            MessageBuilder builder;
-            builder->flags.set(MessageFlag::Centered);
-            builder->flags.set(MessageFlag::DisableCompactEmotes);
-
             // If value of map is empty, create init pair and add title.
             if (mapOfSets.find(channelName) == mapOfSets.end())
             {
-                std::vector<MessagePtr> b;
-                b.push_back(makeTitleMessage(text));
-                mapOfSets[channelName] = qMakePair(set->key == "0", b);
+                mapOfSets[channelName] = qMakePair(
+                    set->key == "0",
+                    EmoteGrid::Section{"twitch:" + channelName, text, {}});
             }
 
+            // EMOTES
+            auto &items = mapOfSets[channelName].second.items;
             for (const auto &emote : set->emotes)
             {
-                builder
-                    .emplace<EmoteElement>(
-                        getApp()->emotes->twitch.getOrCreateEmote(emote.id,
-                                                                  emote.name),
-                        MessageElementFlags{MessageElementFlag::AlwaysShow,
-                                            MessageElementFlag::TwitchEmote})
-                    ->setLink(Link(Link::InsertText, emote.name.string));
+                items.push_back({getApp()->emotes->twitch.getOrCreateEmote(
+                                     emote.id, emote.name),
+                                 emote.name.string});
             }
-
-            mapOfSets[channelName].second.push_back(builder.release());
         }
 
-        // Output to channel all created messages,
-        // That contain title or emotes.
         // Put current channel emotes at the top
-        auto currentChannelPair = mapOfSets[currentChannelName];
-        for (auto message : currentChannelPair.second)
+        if (mapOfSets.contains(currentChannelName))
         {
-            subChannel.addMessage(message);
+            subSections.push_back(mapOfSets.take(currentChannelName).second);
         }
-        mapOfSets.remove(currentChannelName);
 
-        foreach (auto pair, mapOfSets)
+        for (auto &pair : mapOfSets)
         {
-            auto &channel = pair.first ? globalChannel : subChannel;
-            for (auto message : pair.second)
-            {
-                channel.addMessage(message);
-            }
+            (pair.first ? globalSections : subSections)
+                .push_back(std::move(pair.second));
         }
     }
 }  // namespace
@@ -136,6 +101,11 @@ EmotePopup::EmotePopup(QWidget *parent)
     auto layout = new QVBoxLayout(this);
     this->getLayoutContainer()->setLayout(layout);
 
+    this->search_ = new QLineEdit(this);
+    this->search_->setPlaceholderText("Search emotes");
+    this->search_->setClearButtonEnabled(true);
+    layout->addWidget(this->search_);
+
     auto notebook = new Notebook(this);
     layout->addWidget(notebook);
     layout->setMargin(0);
@@ -145,12 +115,8 @@ EmotePopup::EmotePopup(QWidget *parent)
     };
 
     auto makeView = [&](QString tabTitle) {
-        auto view = new ChannelView();
+        auto view = new EmoteGrid();
 
-        view->setOverrideFlags(MessageElementFlags{
-            MessageElementFlag::Default, MessageElementFlag::AlwaysShow,
-            MessageElementFlag::EmoteImages});
-        view->setEnableScrollingToBottom(false);
         notebook->addPage(view, tabTitle);
         view->linkClicked.connect(clicked);
 
@@ -162,7 +128,20 @@ EmotePopup::EmotePopup(QWidget *parent)
     this->globalEmotesView_ = makeView("Global");
     this->viewEmojis_ = makeView("Emojis");
 
+    this->subEmotesView_->setEmptyText("no subscription emotes available");
+
+    QObject::connect(this->search_, &QLineEdit::textChanged, this,
+                     [this](const QString &text) {
+                         for (auto view :
+                              {this->subEmotesView_, this->channelEmotesView_,
+                               this->globalEmotesView_, this->viewEmojis_})
+                         {
+                             view->setFilter(text);
+                         }
+                     });
+
     this->loadEmojis();
+    this->search_->setFocus();
 
     // CTRL + 1-8 to open corresponding tab
     for (auto i = 0; i < 8; i++)
@@ -190,95 +169,104 @@ EmotePopup::EmotePopup(QWidget *parent)
     // Scroll with Page Up / Page Down
     createWindowShortcut(this, "PgUp", [=] {
         auto &scrollbar =
-            dynamic_cast<ChannelView *>(notebook->getSelectedPage())
+            dynamic_cast<EmoteGrid *>(notebook->getSelectedPage())
                 ->getScrollBar();
         scrollbar.offset(-scrollbar.getLargeChange());
     });
     createWindowShortcut(this, "PgDown", [=] {
         auto &scrollbar =
-            dynamic_cast<ChannelView *>(notebook->getSelectedPage())
+            dynamic_cast<EmoteGrid *>(notebook->getSelectedPage())
                 ->getScrollBar();
         scrollbar.offset(scrollbar.getLargeChange());
     });
 }
 
+EmotePopup::~EmotePopup()
+{
+    this->emotesChangedConnection_.disconnect();
+}
+
 void EmotePopup::loadChannel(ChannelPtr _channel)
 {
     BenchmarkGuard guard("loadChannel");
 
     this->setWindowTitle("Emotes in #" + _channel->getName());
 
-    auto twitchChannel = dynamic_cast<TwitchChannel *>(_channel.get());
-    if (twitchChannel == nullptr)
+    this->connections_.clear();
+    this->emotesChangedConnection_.disconnect();
+
+    if (dynamic_cast<TwitchChannel *>(_channel.get()) == nullptr)
         return;
 
-    auto addEmotes = [&](Channel &channel, const EmoteMap &map,
-                         const QString &title,
-                         const MessageElementFlag &emoteFlag) {
-        channel.addMessage(makeTitleMessage(title));
-        channel.addMessage(makeEmoteMessage(map, emoteFlag));
+    std::weak_ptr<Channel> weakChannel = _channel;
+    auto load = [this, weakChannel] {
+        auto channel = weakChannel.lock();
+        if (!channel)
+            return;
+        auto twitchChannel = static_cast<TwitchChannel *>(channel.get());
+
+        std::vector<EmoteGrid::Section> subSections;
+        std::vector<EmoteGrid::Section> globalSections;
+        std::vector<EmoteGrid::Section> channelSections;
+
+        // twitch
+        addEmoteSets(
+            getApp()->accounts->twitch.getCurrent()->accessEmotes()->emoteSets,
+            globalSections, subSections, channel->getName());
+
+        // global
+        globalSections.push_back(
+            makeEmoteSection("bttv", "BetterTTV",
+                             *twitchChannel->globalBttv().emotes()));
+        globalSections.push_back(
+            makeEmoteSection("ffz", "FrankerFaceZ",
+                             *twitchChannel->globalFfz().emotes()));
+
+        // channel
+        channelSections.push_back(makeEmoteSection(
+            "bttv", "BetterTTV", *twitchChannel->bttvEmotes()));
+        channelSections.push_back(makeEmoteSection(
+            "ffz", "FrankerFaceZ", *twitchChannel->ffzEmotes()));
+
+        // sections that didn't change keep their search index
+        this->subEmotesView_->setSections(std::move(subSections));
+        this->globalEmotesView_->setSections(std::move(globalSections));
+        this->channelEmotesView_->setSections(std::move(channelSections));
     };
 
-    auto subChannel = std::make_shared<Channel>("", Channel::Type::None);
-    auto globalChannel = std::make_shared<Channel>("", Channel::Type::None);
-    auto channelChannel = std::make_shared<Channel>("", Channel::Type::None);
-
-    // twitch
-    addEmoteSets(
-        getApp()->accounts->twitch.getCurrent()->accessEmotes()->emoteSets,
-        *globalChannel, *subChannel, _channel->getName());
-
-    // global
-    addEmotes(*globalChannel, *twitchChannel->globalBttv().emotes(),
-              "BetterTTV", MessageElementFlag::BttvEmote);
-    addEmotes(*globalChannel, *twitchChannel->globalFfz().emotes(),
-              "FrankerFaceZ", MessageElementFlag::FfzEmote);
+    load();
 
-    // channel
-    addEmotes(*channelChannel, *twitchChannel->bttvEmotes(), "BetterTTV",
-              MessageElementFlag::BttvEmote);
-    addEmotes(*channelChannel, *twitchChannel->ffzEmotes(), "FrankerFaceZ",
-              MessageElementFlag::FfzEmote);
-
-    this->globalEmotesView_->setChannel(globalChannel);
-    this->subEmotesView_->setChannel(subChannel);
-    this->channelEmotesView_->setChannel(channelChannel);
-
-    if (subChannel->getMessageSnapshot().size() == 0)
-    {
-        MessageBuilder builder;
-        builder->flags.set(MessageFlag::Centered);
-        builder->flags.set(MessageFlag::DisableCompactEmotes);
-        builder.emplace<TextElement>("no subscription emotes available",
-                                     MessageElementFlag::Text,
-                                     MessageColor::System);
-        subChannel->addMessage(builder.release());
-    }
+    // the twitch emote sets are loaded (and named) in the background
+    auto connectAccount = [this, load] {
+        this->emotesChangedConnection_.disconnect();
+        this->emotesChangedConnection_ =
+            getApp()->accounts->twitch.getCurrent()->emotesChanged.connect(
+                load);
+    };
+    connectAccount();
+
+    this->connections_.push_back(
+        getApp()->accounts->twitch.currentUserChanged.connect(
+            [load, connectAccount] {
+                connectAccount();
+                load();
+            }));
 }
 
 void EmotePopup::loadEmojis()
 {
     auto &emojis = getApp()->emotes->emojis.emojis;
 
-    ChannelPtr emojiChannel(new Channel("", Channel::Type::None));
-
-    // emojis
-    MessageBuilder builder;
-    builder->flags.set(MessageFlag::Centered);
-    builder->flags.set(MessageFlag::DisableCompactEmotes);
-
-    emojis.each([&builder](const auto &key, const auto &value) {
-        builder
-            .emplace<EmoteElement>(
-                value->emote,
-                MessageElementFlags{MessageElementFlag::AlwaysShow,
-                                    MessageElementFlag::EmojiAll})
-            ->setLink(
-                Link(Link::Type::InsertText, ":" + value->shortCodes[0] + ":"));
+    EmoteGrid::Section section{"emojis", QString(), {}};
+
+    emojis.each([&section](const auto &key, const auto &value) {
+        section.items.push_back(
+            {value->emote, ":" + value->shortCodes[0] + ":"});
     });
-    emojiChannel->addMessage(builder.release());
 
-    this->viewEmojis_->setChannel(emojiChannel);
+    std::vector<EmoteGrid::Section> sections;
+    sections.push_back(std::move(section));
+    this->viewEmojis_->setSections(std::move(sections));
 }
 
 void EmotePopup::closeEvent(QCloseEvent *event)
@@ -4,10 +4,12 @@
 
 #include <pajlada/signals/signal.hpp>
 
+class QLineEdit;
+
 namespace chatterino {
 
 struct Link;
-class ChannelView;
+class EmoteGrid;
 class Channel;
 using ChannelPtr = std::shared_ptr<Channel>;
 
@@ -15,6 +17,7 @@ class EmotePopup : public BasePopup
 {
 public:
     EmotePopup(QWidget *parent = nullptr);
+    ~EmotePopup() override;
 
     void loadChannel(ChannelPtr channel);
     void loadEmojis();
@@ -24,10 +27,15 @@ public:
     pajlada::Signals::Signal<Link> linkClicked;
 
 private:
-    ChannelView *globalEmotesView_{};
-    ChannelView *channelEmotesView_{};
-    ChannelView *subEmotesView_{};
-    ChannelView *viewEmojis_{};
+    QLineEdit *search_{};
+    EmoteGrid *globalEmotesView_{};
+    EmoteGrid *channelEmotesView_{};
+    EmoteGrid *subEmotesView_{};
+    EmoteGrid *viewEmojis_{};
+
+    std::vector<pajlada::Signals::ScopedConnection> connections_;
+    // emotesChanged of the current account, reconnected when it changes
+    pajlada::Signals::Connection emotesChangedConnection_;
 };
 
 }  // namespace chatterino
@@ -77,15 +77,11 @@ namespace {
 
     ChannelPtr filterMessages(const QString &userName, ChannelPtr channel)
     {
-        LimitedQueueSnapshot<MessagePtr> snapshot =
-            channel->getMessageSnapshot();
-
         ChannelPtr channelPtr(
             new Channel(channel->getName(), Channel::Type::None));
 
-        for (size_t i = 0; i < snapshot.size(); i++)
+        for (auto &message : channel->findUserMessages(userName))
         {
-            MessagePtr message = snapshot[i];
             if (checkMessageUserName(userName, message))
             {
                 channelPtr->addMessage(message);
@@ -680,7 +676,8 @@ void UserInfoPopup::updateUserData()
             },
             [] {
                 // on failure
-            });
+            },
+            NetworkRequestPriority::Interactive);
 
         // get follow state
         currentUser->checkFollow(user.id, [this, hack](auto result) {
@@ -769,7 +766,8 @@ void UserInfoPopup::updateUserData()
     };
 
     getHelix()->getUserByName(this->userName_, onUserFetched,
-                              onUserFetchFailed);
+                              onUserFetchFailed,
+                              NetworkRequestPriority::Interactive);
 
     this->ui_.follow->setEnabled(false);
     this->ui_.block->setEnabled(false);
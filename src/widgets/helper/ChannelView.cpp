@@ -4,6 +4,7 @@
 #include <QDate>
 #include <QDebug>
 #include <QDesktopServices>
+#include <QElapsedTimer>
 #include <QGraphicsBlurEffect>
 #include <QMessageBox>
 #include <QPainter>
@@ -20,8 +21,11 @@
 #include "controllers/accounts/AccountController.hpp"
 #include "controllers/commands/CommandController.hpp"
 #include "debug/Benchmark.hpp"
+#include "debug/Trace.hpp"
 #include "messages/Emote.hpp"
+#include "messages/Image.hpp"
 #include "messages/LimitedQueueSnapshot.hpp"
+#include "messages/MemoryUsage.hpp"
 #include "messages/Message.hpp"
 #include "messages/MessageBuilder.hpp"
 #include "messages/MessageElement.hpp"
@@ -36,6 +40,7 @@
 #include "singletons/TooltipPreviewImage.hpp"
 #include "singletons/WindowManager.hpp"
 #include "util/Clipboard.hpp"
+#include "util/DebugCount.hpp"
 #include "util/DistanceBetweenPoints.hpp"
 #include "util/IncognitoBrowser.hpp"
 #include "util/StreamerMode.hpp"
@@ -52,6 +57,11 @@
 #define DRAW_WIDTH (this->width())
 #define SELECTION_RESUME_SCROLLING_MSG_THRESHOLD 3
 #define CHAT_HOVER_PAUSE_DURATION 1000
+// Hidden views that missed more messages than this are rebuilt at once
+// instead of appending the messages one by one
+#define DEFERRED_CATCH_UP_LIMIT 200
+// Paints taking longer than one frame at 60 fps
+#define SLOW_PAINT_US 16667
 
 namespace chatterino {
 namespace {
@@ -199,13 +209,17 @@ void ChannelView::initializeSignals()
         this->connections_);
 
     connections_.push_back(getApp()->windows->gifRepaintRequested.connect([&] {
-        this->queueUpdate();
+        if (!this->animatedRegion_.isEmpty())
+        {
+            this->update(this->animatedRegion_);
+        }
     }));
 
     connections_.push_back(
         getApp()->windows->layoutRequested.connect([&](Channel *channel) {
             if (this->isVisible() &&
-                (channel == nullptr || this->channel_.get() == channel))
+                (channel == nullptr || this->channel_.get() == channel ||
+                 this->underlyingChannel_.get() == channel))
             {
                 this->queueLayout();
             }
@@ -214,6 +228,36 @@ void ChannelView::initializeSignals()
     connections_.push_back(getApp()->fonts->fontChanged.connect([this] {
         this->queueLayout();
     }));
+
+    // hidden views are laid out when they're shown again
+    connections_.push_back(Image::imagesLoaded().connect([this] {
+        auto loaded = [](MessageLayout &layout) {
+            return layout.hasLoadedImages();
+        };
+
+        if (this->isVisible() && this->anyVisibleLayout(loaded))
+        {
+            this->queueLayout();
+        }
+    }));
+
+    // the messages might be shown in views of other channels too, e.g. in
+    // the mentions split
+    connections_.push_back(getApp()->windows->messagesLayoutRequested.connect(
+        [this](const std::vector<MessagePtr> &messages) {
+            auto shows = [&messages](MessageLayout &layout) {
+                return std::any_of(messages.begin(), messages.end(),
+                                   [&layout](const MessagePtr &message) {
+                                       return message.get() ==
+                                              layout.getMessage();
+                                   });
+            };
+
+            if (this->isVisible() && this->anyVisibleLayout(shows))
+            {
+                this->queueLayout();
+            }
+        }));
 }
 
 bool ChannelView::pausable() const
@@ -379,7 +423,7 @@ void ChannelView::queueLayout()
 
 void ChannelView::performLayout(bool causedByScrollbar)
 {
-    // BenchmarkGuard benchmark("layout");
+    TraceSpan span("ChannelView::performLayout", "layout");
 
     /// Get messages and check if there are at least 1
     auto messages = this->getMessagesSnapshot();
@@ -426,6 +470,33 @@ void ChannelView::layoutVisibleMessages(
         this->queueUpdate();
 }
 
+bool ChannelView::anyVisibleLayout(
+    const std::function<bool(MessageLayout &)> &predicate)
+{
+    auto messages = this->getMessagesSnapshot();
+    const auto start = size_t(this->scrollBar_->getCurrentValue());
+
+    if (messages.size() <= start)
+    {
+        return false;
+    }
+
+    auto y = int(-(messages[start]->getHeight() *
+                   (fmod(this->scrollBar_->getCurrentValue(), 1))));
+
+    for (auto i = start; i < messages.size() && y <= this->height(); i++)
+    {
+        if (predicate(*messages[i]))
+        {
+            return true;
+        }
+
+        y += messages[i]->getHeight();
+    }
+
+    return false;
+}
+
 void ChannelView::updateScrollbar(
     LimitedQueueSnapshot<MessageLayoutPtr> &messages, bool causedByScrollbar)
 {
@@ -572,6 +643,22 @@ LimitedQueueSnapshot<MessageLayoutPtr> ChannelView::getMessagesSnapshot()
     return this->snapshot_;
 }
 
+MemoryUsage ChannelView::getMemoryUsage()
+{
+    MemoryUsage usage;
+
+    auto messages = this->messages_.getSnapshot();
+    for (size_t i = 0; i < messages.size(); i++)
+    {
+        messages[i]->getMessage()->addMemoryUsage(usage);
+        messages[i]->addMemoryUsage(usage);
+    }
+
+    usage.buffers += MemoryUsage::pixmapSize(this->backingStore_.pixmap);
+
+    return usage;
+}
+
 ChannelPtr ChannelView::channel()
 {
     return this->channel_;
@@ -589,11 +676,25 @@ void ChannelView::setChannel(ChannelPtr underlyingChannel)
 
     this->clearMessages();
     this->scrollBar_->clearHighlights();
+    this->deferred_ = {};
 
     /// make copy of channel and expose
     this->channel_ = std::make_unique<Channel>(underlyingChannel->getName(),
                                                underlyingChannel->getType());
 
+    // Start out with the messages of the underlying channel, so the layouts
+    // can be (re)built from channel_ alone
+    {
+        auto snapshot = underlyingChannel->getMessageSnapshot();
+        std::vector<MessagePtr> messages;
+        messages.reserve(snapshot.size());
+        for (size_t i = 0; i < snapshot.size(); i++)
+        {
+            messages.push_back(snapshot[i]);
+        }
+        this->channel_->addMessagesAtStart(messages);
+    }
+
     //
     // Proxy channel connections
     // Use a proxy channel to keep filtered messages past the time they are removed from their origin channel
@@ -681,35 +782,18 @@ void ChannelView::setChannel(ChannelPtr underlyingChannel)
             this->messageReplaced(index, replacement);
         }));
 
-    auto snapshot = underlyingChannel->getMessageSnapshot();
+    this->underlyingChannel_ = underlyingChannel;
 
-    for (size_t i = 0; i < snapshot.size(); i++)
+    if (this->isVisible())
     {
-        MessageLayoutPtr deleted;
-
-        auto messageLayout = new MessageLayout(snapshot[i]);
-
-        if (this->lastMessageHasAlternateBackground_)
-        {
-            messageLayout->flags.set(MessageLayoutFlag::AlternateBackground);
-        }
-        this->lastMessageHasAlternateBackground_ =
-            !this->lastMessageHasAlternateBackground_;
-
-        if (underlyingChannel->shouldIgnoreHighlights())
-        {
-            messageLayout->flags.set(MessageLayoutFlag::IgnoreHighlights);
-        }
-
-        this->messages_.pushBack(MessageLayoutPtr(messageLayout), deleted);
-        if (this->showScrollbarHighlights())
-        {
-            this->scrollBar_->addHighlight(
-                snapshot[i]->getScrollBarHighlight());
-        }
+        this->rebuildMessages();
+    }
+    else
+    {
+        // most views are in tabs that aren't selected, only create the
+        // layouts once they're needed
+        this->deferred_.rebuild = true;
     }
-
-    this->underlyingChannel_ = underlyingChannel;
 
     this->queueLayout();
     this->queueUpdate();
@@ -776,53 +860,38 @@ bool ChannelView::hasSourceChannel() const
 void ChannelView::messageAppended(MessagePtr &message,
                                   boost::optional<MessageFlags> overridingFlags)
 {
-    MessageLayoutPtr deleted;
-
     auto *messageFlags = &message->flags;
     if (overridingFlags)
     {
         messageFlags = overridingFlags.get_ptr();
     }
 
-    auto messageRef = new MessageLayout(message);
-
-    if (this->lastMessageHasAlternateBackground_)
+    if (!this->isVisible())
     {
-        messageRef->flags.set(MessageLayoutFlag::AlternateBackground);
+        this->deferred_.appended++;
     }
-    if (this->channel_->shouldIgnoreHighlights())
-    {
-        messageRef->flags.set(MessageLayoutFlag::IgnoreHighlights);
-    }
-    this->lastMessageHasAlternateBackground_ =
-        !this->lastMessageHasAlternateBackground_;
-
-    if (!this->scrollBar_->isAtBottom() &&
-        this->scrollBar_->getCurrentValueAnimation().state() ==
-            QPropertyAnimation::Running)
+    else
     {
-        QEventLoop loop;
-
-        connect(&this->scrollBar_->getCurrentValueAnimation(),
-                &QAbstractAnimation::stateChanged, &loop, &QEventLoop::quit);
+        if (!this->scrollBar_->isAtBottom() &&
+            this->scrollBar_->getCurrentValueAnimation().state() ==
+                QPropertyAnimation::Running)
+        {
+            QEventLoop loop;
 
-        loop.exec();
-    }
+            connect(&this->scrollBar_->getCurrentValueAnimation(),
+                    &QAbstractAnimation::stateChanged, &loop,
+                    &QEventLoop::quit);
 
-    if (this->messages_.pushBack(MessageLayoutPtr(messageRef), deleted))
-    {
-        if (this->paused())
-        {
-            if (!this->scrollBar_->isAtBottom())
-                this->pauseScrollOffset_--;
+            loop.exec();
         }
-        else
+
+        if (this->appendMessageLayout(message))
         {
-            if (this->scrollBar_->isAtBottom())
-                this->scrollBar_->scrollToBottom();
-            else
-                this->scrollBar_->offset(-1);
+            this->firstLayoutRemoved();
         }
+
+        this->messageWasAdded_ = true;
+        this->queueLayout();
     }
 
     if (!messageFlags->has(MessageFlag::DoNotTriggerNotification))
@@ -841,18 +910,17 @@ void ChannelView::messageAppended(MessagePtr &message,
             this->tabHighlightRequested.invoke(HighlightState::NewMessage);
         }
     }
-
-    if (this->showScrollbarHighlights())
-    {
-        this->scrollBar_->addHighlight(message->getScrollBarHighlight());
-    }
-
-    this->messageWasAdded_ = true;
-    this->queueLayout();
 }
 
 void ChannelView::messageAddedAtStart(std::vector<MessagePtr> &messages)
 {
+    // Hidden views add the layouts right away as well, so they keep their
+    // scroll position. The layouts are only laid out once they're shown.
+    if (this->deferred_.rebuild)
+    {
+        return;
+    }
+
     std::vector<MessageLayoutPtr> messageRefs;
     messageRefs.resize(messages.size());
 
@@ -893,11 +961,16 @@ void ChannelView::messageAddedAtStart(std::vector<MessagePtr> &messages)
     }
 
     this->messageWasAdded_ = true;
-    this->queueLayout();
+    if (this->isVisible())
+    {
+        this->queueLayout();
+    }
 }
 
 void ChannelView::messageRemoveFromStart(MessagePtr &message)
 {
+    // The selection is moved right away, a rebuild of the view moves it to
+    // the same messages again.
     if (this->paused())
     {
         this->pauseSelectionOffset_ += 1;
@@ -910,11 +983,54 @@ void ChannelView::messageRemoveFromStart(MessagePtr &message)
         this->selection_.end.messageIndex--;
     }
 
-    this->queueLayout();
+    // The layout is dropped as well, so the message can be freed. The
+    // channel might remove messages before the view reaches its own limit,
+    // e.g. to stay within its memory budget.
+    auto layouts = this->messages_.getSnapshot();
+    if (layouts.size() > 0 && layouts[0]->getMessage() == message.get())
+    {
+        MessageLayoutPtr deleted;
+        this->messages_.popFront(deleted);
+        if (this->showScrollbarHighlights())
+        {
+            this->scrollBar_->removeHighlightFromStart();
+        }
+        this->firstLayoutRemoved();
+    }
+
+    if (this->isVisible())
+    {
+        this->queueLayout();
+    }
+}
+
+void ChannelView::firstLayoutRemoved()
+{
+    if (this->paused())
+    {
+        if (!this->scrollBar_->isAtBottom())
+            this->pauseScrollOffset_--;
+    }
+    else
+    {
+        if (this->scrollBar_->isAtBottom())
+            this->scrollBar_->scrollToBottom();
+        else
+            this->scrollBar_->offset(-1);
+    }
 }
 
 void ChannelView::messageReplaced(size_t index, MessagePtr &replacement)
 {
+    // Messages appended while the view was hidden are only missing at the
+    // end of messages_, so index also refers to the layout in hidden views.
+    // Replacements of messages that don't have a layout yet are picked up
+    // once the view catches up.
+    if (this->deferred_.rebuild)
+    {
+        return;
+    }
+
     if (index >= this->messages_.getSnapshot().size())
     {
         return;
@@ -940,7 +1056,155 @@ void ChannelView::messageReplaced(size_t index, MessagePtr &replacement)
                                        replacement->getScrollBarHighlight());
 
     this->messages_.replaceItem(message, newItem);
-    this->queueLayout();
+    if (this->isVisible())
+    {
+        this->queueLayout();
+    }
+}
+
+bool ChannelView::appendMessageLayout(const MessagePtr &message)
+{
+    auto *layout = new MessageLayout(message);
+
+    if (this->lastMessageHasAlternateBackground_)
+    {
+        layout->flags.set(MessageLayoutFlag::AlternateBackground);
+    }
+    this->lastMessageHasAlternateBackground_ =
+        !this->lastMessageHasAlternateBackground_;
+
+    if (this->channel_->shouldIgnoreHighlights())
+    {
+        layout->flags.set(MessageLayoutFlag::IgnoreHighlights);
+    }
+
+    if (this->showScrollbarHighlights())
+    {
+        this->scrollBar_->addHighlight(message->getScrollBarHighlight());
+    }
+
+    MessageLayoutPtr deleted;
+    return this->messages_.pushBack(MessageLayoutPtr(layout), deleted);
+}
+
+void ChannelView::rebuildMessages()
+{
+    // The last read indicator, the scroll position and the selection are
+    // moved to the same messages in the new layouts. While paused, the
+    // scroll position and the selection lag behind messages_ by the pause
+    // offsets.
+    auto oldLayouts = this->messages_.getSnapshot();
+    auto messageAt = [&](int index) -> const Message * {
+        if (index < 0 || size_t(index) >= oldLayouts.size())
+        {
+            return nullptr;
+        }
+        return oldLayouts[index]->getMessage();
+    };
+
+    auto lastRead = this->lastReadMessage_;
+    auto *lastReadMessage = lastRead ? lastRead->getMessage() : nullptr;
+
+    auto atBottom = this->scrollBar_->isAtBottom();
+    auto scrollValue =
+        this->scrollBar_->getDesiredValue() + this->pauseScrollOffset_;
+    auto *topMessage = messageAt(int(scrollValue));
+
+    auto selection = this->selection_;
+    auto *selectionStart = messageAt(selection.start.messageIndex -
+                                     this->pauseSelectionOffset_);
+    auto *selectionEnd =
+        messageAt(selection.end.messageIndex - this->pauseSelectionOffset_);
+
+    this->messages_.clear();
+    this->scrollBar_->clearHighlights();
+    this->selection_ = Selection();
+    this->lastMessageHasAlternateBackground_ = false;
+    this->lastMessageHasAlternateBackgroundReverse_ = true;
+
+    auto snapshot = this->channel_->getMessageSnapshot();
+    for (size_t i = 0; i < snapshot.size(); i++)
+    {
+        this->appendMessageLayout(snapshot[i]);
+    }
+
+    auto layouts = this->messages_.getSnapshot();
+    std::unordered_map<const Message *, int> indices;
+    for (size_t i = 0; i < layouts.size(); i++)
+    {
+        indices[layouts[i]->getMessage()] = int(i);
+    }
+    auto indexOf = [&](const Message *message) {
+        auto it = indices.find(message);
+        return it == indices.end() ? -1 : it->second;
+    };
+
+    if (indexOf(lastReadMessage) != -1)
+    {
+        this->lastReadMessage_ = layouts[indexOf(lastReadMessage)];
+    }
+
+    auto topIndex = indexOf(topMessage);
+    if (!atBottom && topIndex != -1)
+    {
+        auto fraction = scrollValue - std::floor(scrollValue);
+
+        this->scrollBar_->setMaximum(layouts.size());
+        this->scrollBar_->setDesiredValue(topIndex + fraction -
+                                          this->pauseScrollOffset_);
+    }
+    else
+    {
+        this->scrollBar_->scrollToBottom();
+    }
+
+    auto startIndex = indexOf(selectionStart);
+    auto endIndex = indexOf(selectionEnd);
+    if (!selection.isEmpty() && startIndex != -1 && endIndex != -1)
+    {
+        this->selection_ = Selection(
+            SelectionItem(startIndex + this->pauseSelectionOffset_,
+                          selection.start.charIndex),
+            SelectionItem(endIndex + this->pauseSelectionOffset_,
+                          selection.end.charIndex));
+    }
+
+    this->messageWasAdded_ = true;
+}
+
+void ChannelView::materializeMessages()
+{
+    auto appended = this->deferred_.appended;
+    auto rebuild = this->deferred_.rebuild;
+    this->deferred_ = {};
+
+    if (!this->channel_ || (appended == 0 && !rebuild))
+    {
+        return;
+    }
+
+    auto snapshot = this->channel_->getMessageSnapshot();
+
+    if (rebuild || appended > DEFERRED_CATCH_UP_LIMIT ||
+        appended > snapshot.size())
+    {
+        this->rebuildMessages();
+    }
+    else
+    {
+        for (auto i = snapshot.size() - appended; i < snapshot.size(); i++)
+        {
+            if (this->appendMessageLayout(snapshot[i]))
+            {
+                if (this->scrollBar_->isAtBottom())
+                    this->scrollBar_->scrollToBottom();
+                else
+                    this->scrollBar_->offset(-1);
+            }
+        }
+
+        this->messageWasAdded_ = true;
+    }
 }
 
 void ChannelView::updateLastReadMessage()
@@ -1030,16 +1294,17 @@ MessageElementFlags ChannelView::getFlags() const
     return flags;
 }
 
-void ChannelView::paintEvent(QPaintEvent * /*event*/)
+void ChannelView::paintEvent(QPaintEvent *event)
 {
     //    BenchmarkGuard benchmark("paint");
 
-    QPainter painter(this);
+    QElapsedTimer timer;
+    timer.start();
 
-    painter.fillRect(rect(), this->theme->splits.background);
+    QPainter painter(this);
 
     // draw messages
-    this->drawMessages(painter);
+    this->drawMessages(painter, event->region());
 
     // draw paused sign
     if (this->paused())
@@ -1049,34 +1314,64 @@ void ChannelView::paintEvent(QPaintEvent * /*event*/)
         painter.fillRect(QRectF(5, a / 4, a / 4, a), brush);
         painter.fillRect(QRectF(15, a / 4, a / 4, a), brush);
     }
+
+    // moving average over all views
+    static double averagePaintTime = 0;
+    auto elapsed = timer.nsecsElapsed() / 1000;
+    averagePaintTime = averagePaintTime * 0.9 + double(elapsed) * 0.1;
+    DebugCount::set("channel view paint time (us)",
+                    int64_t(averagePaintTime));
+
+    if (elapsed > SLOW_PAINT_US)
+    {
+        DebugCount::increase("channel view slow paints");
+    }
 }
 
-// if overlays is false then it draws the message, if true then it draws things
-// such as the grey overlay when a message is disabled
-void ChannelView::drawMessages(QPainter &painter)
+// The content of the messages comes from the backing store, overlays such as
+// the grey overlay when a message is disabled are drawn on top of it
+void ChannelView::drawMessages(QPainter &painter, const QRegion &region)
 {
     auto messagesSnapshot = this->getMessagesSnapshot();
 
     size_t start = size_t(this->scrollBar_->getCurrentValue());
 
-    if (start >= messagesSnapshot.size())
+    this->animatedRegion_ = QRegion();
+
+    std::vector<BackingStoreRow> rows;
+
+    if (start < messagesSnapshot.size())
     {
-        return;
+        int y = int(-(messagesSnapshot[start].get()->getHeight() *
+                      (fmod(this->scrollBar_->getCurrentValue(), 1))));
+
+        for (size_t i = start; i < messagesSnapshot.size(); ++i)
+        {
+            auto &layout = messagesSnapshot[i];
+
+            rows.push_back({layout, y, layout->getContentVersion(), false});
+
+            y += layout->getHeight();
+            if (y > this->height())
+            {
+                break;
+            }
+        }
     }
 
-    int y = int(-(messagesSnapshot[start].get()->getHeight() *
-                  (fmod(this->scrollBar_->getCurrentValue(), 1))));
+    this->updateBackingStore(rows);
+    painter.drawPixmap(0, 0, this->backingStore_.pixmap);
 
-    MessageLayout *end = nullptr;
     bool windowFocused = this->window() == QApplication::activeWindow();
 
     auto app = getApp();
     bool isMentions =
         this->underlyingChannel_ == app->twitch.server->mentionsChannel;
 
-    for (size_t i = start; i < messagesSnapshot.size(); ++i)
+    for (size_t i = 0; i < rows.size(); ++i)
     {
-        MessageLayout *layout = messagesSnapshot[i].get();
+        MessageLayout *layout = rows[i].layout.get();
+        int y = rows[i].y;
 
         bool isLastMessage = false;
         if (getSettings()->showLastMessageIndicator)
@@ -1084,54 +1379,104 @@ void ChannelView::drawMessages(QPainter &painter)
             isLastMessage = this->lastReadMessage_.get() == layout;
         }
 
-        layout->paint(painter, DRAW_WIDTH, y, i, this->selection_,
-                      isLastMessage, windowFocused, isMentions);
-
-        y += layout->getHeight();
-
-        end = layout;
-        if (y > this->height())
+        // only messages with animated emotes are repainted while the
+        // animations play
+        if (region.intersects(
+                QRect(0, y, this->width(), layout->getHeight())))
         {
-            break;
+            layout->paintOverlay(painter, DRAW_WIDTH, y, int(start + i),
+                                 this->selection_, isLastMessage,
+                                 windowFocused, isMentions);
         }
+        layout->addAnimatedRegion(this->animatedRegion_, y);
     }
+}
+
+void ChannelView::updateBackingStore(std::vector<BackingStoreRow> &rows)
+{
+    auto &store = this->backingStore_;
 
-    if (end == nullptr)
+#if defined(Q_OS_MACOS) || defined(Q_OS_LINUX)
+    auto pixelRatio = this->devicePixelRatioF();
+#else
+    qreal pixelRatio = 1;
+#endif
+
+    auto size = QSize(int(this->width() * pixelRatio),
+                      int(this->height() * pixelRatio));
+
+    if (store.pixmap.size() != size ||
+        store.pixmap.devicePixelRatioF() != pixelRatio)
     {
-        return;
+        store.pixmap = QPixmap(size);
+        store.pixmap.setDevicePixelRatio(pixelRatio);
+        store.rows.clear();
     }
 
-    // remove messages that are on screen
-    // the messages that are left at the end get their buffers reset
-    for (size_t i = start; i < messagesSnapshot.size(); ++i)
+    auto findPainted = [&](const BackingStoreRow &row) {
+        return std::find_if(store.rows.begin(), store.rows.end(),
+                            [&](const BackingStoreRow &painted) {
+                                return painted.layout == row.layout &&
+                                       painted.version == row.version;
+                            });
+    };
+
+    // move the pixmap along with the messages if the view was scrolled
+    for (auto &row : rows)
     {
-        auto it = this->messagesOnScreen_.find(messagesSnapshot[i]);
-        if (it != this->messagesOnScreen_.end())
+        auto painted = findPainted(row);
+        if (painted == store.rows.end())
         {
-            this->messagesOnScreen_.erase(it);
+            continue;
         }
-    }
 
-    // delete the message buffers that aren't on screen
-    for (const std::shared_ptr<MessageLayout> &item : this->messagesOnScreen_)
-    {
-        item->deleteBuffer();
+        auto dy = row.y - painted->y;
+        auto scaledDy = dy * pixelRatio;
+
+        // can't be moved without smearing the pixels
+        if (dy == 0 || std::abs(dy) >= this->height() ||
+            scaledDy != std::round(scaledDy))
+        {
+            break;
+        }
+
+        store.pixmap.scroll(0, int(scaledDy), store.pixmap.rect());
+
+        for (auto &moved : store.rows)
+        {
+            moved.y += dy;
+            moved.complete = moved.complete && moved.y >= 0 &&
+                             moved.y + moved.layout->getHeight() <=
+                                 this->height();
+        }
+        break;
     }
 
-    this->messagesOnScreen_.clear();
+    QPainter painter(&store.pixmap);
+    int bottom = 0;
 
-    // add all messages on screen to the map
-    for (size_t i = start; i < messagesSnapshot.size(); ++i)
+    for (auto &row : rows)
     {
-        std::shared_ptr<MessageLayout> layout = messagesSnapshot[i];
-
-        this->messagesOnScreen_.insert(layout);
+        auto height = row.layout->getHeight();
+        auto painted = findPainted(row);
 
-        if (layout.get() == end)
+        if (painted == store.rows.end() || !painted->complete ||
+            painted->y != row.y)
         {
-            break;
+            row.layout->paintContent(painter, DRAW_WIDTH, row.y);
         }
+
+        row.complete = row.y >= 0 && row.y + height <= this->height();
+        bottom = row.y + height;
     }
+
+    if (bottom < this->height())
+    {
+        painter.fillRect(0, bottom, this->width(), this->height() - bottom,
+                         this->theme->splits.background);
+    }
+
+    store.rows = rows;
 }
 
 void ChannelView::wheelEvent(QWheelEvent *event)
@@ -2028,14 +2373,20 @@ void ChannelView::mouseDoubleClickEvent(QMouseEvent *event)
     }
 }
 
-void ChannelView::hideEvent(QHideEvent *)
+void ChannelView::showEvent(QShowEvent *event)
 {
-    for (auto &layout : this->messagesOnScreen_)
-    {
-        layout->deleteBuffer();
-    }
+    BaseWidget::showEvent(event);
+
+    this->materializeMessages();
+
+    // images might have been loaded while the view was hidden
+    this->queueLayout();
+}
 
-    this->messagesOnScreen_.clear();
+void ChannelView::hideEvent(QHideEvent *)
+{
+    this->backingStore_.pixmap = QPixmap();
+    this->backingStore_.rows.clear();
 }
 
 void ChannelView::showUserInfoPopup(const QString &userName)
@@ -6,6 +6,7 @@
 #include <QWheelEvent>
 #include <QWidget>
 #include <pajlada/signals/signal.hpp>
+#include <functional>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -39,6 +40,7 @@ class Scrollbar;
 class EffectLabel;
 struct Link;
 class MessageLayoutElement;
+struct MemoryUsage;
 
 enum class PauseReason {
     Mouse,
@@ -95,6 +97,10 @@ public:
     LimitedQueueSnapshot<MessageLayoutPtr> getMessagesSnapshot();
     void queueLayout();
 
+    // Estimated memory used by the messages of the view, their layouts and
+    // the backing store
+    MemoryUsage getMemoryUsage();
+
     void clearMessages();
     void showUserInfoPopup(const QString &userName);
 
@@ -123,6 +129,7 @@ protected:
     void mouseReleaseEvent(QMouseEvent *event) override;
     void mouseDoubleClickEvent(QMouseEvent *event) override;
 
+    void showEvent(QShowEvent *) override;
     void hideEvent(QHideEvent *) override;
 
     void handleLinkClick(QMouseEvent *event, const Link &link,
@@ -142,13 +149,29 @@ private:
     void messageRemoveFromStart(MessagePtr &message);
     void messageReplaced(size_t index, MessagePtr &replacement);
 
+    // Creates the layout for a message and appends it. Returns true if a
+    // layout got removed from the start.
+    bool appendMessageLayout(const MessagePtr &message);
+    // Keeps the scroll position on the same messages after the first layout
+    // was removed
+    void firstLayoutRemoved();
+    // Recreates all layouts from the messages in channel_
+    void rebuildMessages();
+    // Catches up with the messages that were added while the view was hidden
+    void materializeMessages();
+
     void performLayout(bool causedByScollbar = false);
     void layoutVisibleMessages(
         LimitedQueueSnapshot<MessageLayoutPtr> &messages);
+    // Returns true if predicate returns true for one of the visible layouts
+    bool anyVisibleLayout(
+        const std::function<bool(MessageLayout &)> &predicate);
     void updateScrollbar(LimitedQueueSnapshot<MessageLayoutPtr> &messages,
                          bool causedByScrollbar);
 
-    void drawMessages(QPainter &painter);
+    void drawMessages(QPainter &painter, const QRegion &region);
+    struct BackingStoreRow;
+    void updateBackingStore(std::vector<BackingStoreRow> &rows);
     void setSelection(const SelectionItem &start, const SelectionItem &end);
     MessageElementFlags getFlags() const;
     void selectWholeMessage(MessageLayout *layout, int &messageIndex);
@@ -238,10 +261,34 @@ private:
 
     LimitedQueue<MessageLayoutPtr> messages_;
 
+    // Hidden views don't create layouts for new messages. They only keep
+    // track of what changed in channel_ and catch up once they're shown.
+    struct {
+        // number of messages appended to channel_ while hidden
+        size_t appended = 0;
+        // messages_ has to be rebuilt from channel_
+        bool rebuild = false;
+    } deferred_;
+
     std::vector<pajlada::Signals::ScopedConnection> connections_;
     std::vector<pajlada::Signals::ScopedConnection> channelConnections_;
 
-    std::unordered_set<std::shared_ptr<MessageLayout>> messagesOnScreen_;
+    // The content of the visible messages is painted into a single pixmap.
+    // Messages that didn't change are kept, scrolling just moves the pixmap.
+    struct BackingStoreRow {
+        MessageLayoutPtr layout;
+        int y;
+        unsigned int version;
+        // the message was painted completely, nothing was cut off
+        bool complete;
+    };
+    struct {
+        QPixmap pixmap;
+        std::vector<BackingStoreRow> rows;
+    } backingStore_;
+    // area of the animated elements that were drawn in the last paint, only
+    // this is repainted when the animations advance
+    QRegion animatedRegion_;
 
     static constexpr int leftPadding = 8;
     static constexpr int scrollbarPadding = 8;
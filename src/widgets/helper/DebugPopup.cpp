@@ -1,29 +1,208 @@
 #include "DebugPopup.hpp"
 
+#include "Application.hpp"
+#include "common/Channel.hpp"
+#include "debug/Trace.hpp"
+#include "messages/Image.hpp"
+#include "messages/MemoryUsage.hpp"
+#include "providers/twitch/TwitchIrcServer.hpp"
 #include "util/DebugCount.hpp"
+#include "widgets/helper/ChannelView.hpp"
 
+#include <QApplication>
+#include <QFile>
+#include <QFileDialog>
 #include <QFontDatabase>
 #include <QHBoxLayout>
+#include <QJsonArray>
+#include <QJsonDocument>
 #include <QLabel>
+#include <QPushButton>
 #include <QTimer>
+#include <QVBoxLayout>
+
+#include <algorithm>
 
 namespace chatterino {
+namespace {
+
+    // how many of the channels and views using the most memory are shown
+    constexpr size_t MEMORY_TOP_COUNT = 5;
+
+    using NamedUsage = std::pair<QString, MemoryUsage>;
+
+    struct MemoryReport {
+        // biggest first
+        std::vector<NamedUsage> channels;
+        std::vector<NamedUsage> views;
+    };
+
+    void sortByTotal(std::vector<NamedUsage> &usages)
+    {
+        std::sort(usages.begin(), usages.end(), [](auto &&a, auto &&b) {
+            return a.second.total() > b.second.total();
+        });
+    }
+
+    MemoryReport measureMemory()
+    {
+        MemoryReport report;
+
+        getApp()->twitch2->forEachChannelAndSpecialChannels(
+            [&](ChannelPtr channel) {
+                report.channels.emplace_back(channel->getName(),
+                                             channel->getMemoryUsage());
+            });
+
+        for (auto *widget : QApplication::allWidgets())
+        {
+            if (auto *view = dynamic_cast<ChannelView *>(widget))
+            {
+                auto channel = view->channel();
+                auto name = channel ? channel->getName() : QString();
+                if (!view->isVisible())
+                {
+                    name += " (hidden)";
+                }
+                report.views.emplace_back(name, view->getMemoryUsage());
+            }
+        }
+
+        sortByTotal(report.channels);
+        sortByTotal(report.views);
+
+        return report;
+    }
+
+    QString formatTop(const QString &title,
+                      const std::vector<NamedUsage> &usages)
+    {
+        auto text = title + ":\n";
+        for (size_t i = 0; i < std::min(usages.size(), MEMORY_TOP_COUNT); i++)
+        {
+            auto &&[name, usage] = usages[i];
+            text += QString("  %1 KiB %2 (%3 messages)\n")
+                        .arg(usage.total() / 1024, 7)
+                        .arg(name)
+                        .arg(usage.messageCount);
+        }
+        return text;
+    }
+
+    QJsonArray toJson(const std::vector<NamedUsage> &usages)
+    {
+        QJsonArray array;
+        for (auto &&[name, usage] : usages)
+        {
+            auto object = usage.toJson();
+            object.insert("name", name);
+            array.append(object);
+        }
+        return array;
+    }
+
+    bool exportMemoryReport(const QString &path)
+    {
+        auto report = measureMemory();
+
+        QFile file(path);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        {
+            return false;
+        }
+
+        file.write(QJsonDocument(QJsonObject{
+                                     {"channels", toJson(report.channels)},
+                                     {"views", toJson(report.views)},
+                                 })
+                       .toJson());
+
+        return file.error() == QFileDevice::NoError;
+    }
+
+}  // namespace
 
 DebugPopup::DebugPopup()
 {
     auto *layout = new QHBoxLayout(this);
+    auto *labels = new QVBoxLayout;
     auto *text = new QLabel(this);
+    auto *memoryText = new QLabel(this);
     auto *timer = new QTimer(this);
+    // going through every message takes a while
+    auto *memoryTimer = new QTimer(this);
 
     timer->setInterval(300);
     QObject::connect(timer, &QTimer::timeout, [text] {
-        text->setText(DebugCount::getDebugText());
+        auto images = Image::registryStats();
+        auto lookups = std::max<uint64_t>(1, images.hits + images.misses);
+
+        text->setText(DebugCount::getDebugText() +
+                      QString("image registry: %1 (%2% hits)\n")
+                          .arg(images.size)
+                          .arg(100 * images.hits / lookups));
     });
     timer->start();
 
+    auto updateMemoryText = [memoryText] {
+        auto report = measureMemory();
+        memoryText->setText(
+            formatTop("memory of channels", report.channels) +
+            formatTop("memory of splits", report.views));
+    };
+    updateMemoryText();
+
+    memoryTimer->setInterval(5000);
+    QObject::connect(memoryTimer, &QTimer::timeout, updateMemoryText);
+    memoryTimer->start();
+
     text->setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    memoryText->setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+
+    labels->addWidget(text);
+    labels->addWidget(memoryText);
+    labels->addStretch(1);
+    layout->addLayout(labels);
+
+    auto *buttons = new QVBoxLayout;
+    auto *trace = new QPushButton(this);
+    auto *exportTrace = new QPushButton("Export trace...", this);
+    auto *exportMemory = new QPushButton("Export memory usage...", this);
+
+    auto updateTraceText = [trace] {
+        trace->setText(Trace::isEnabled() ? "Stop tracing" : "Start tracing");
+    };
+    updateTraceText();
+
+    QObject::connect(trace, &QPushButton::clicked, [updateTraceText] {
+        Trace::setEnabled(!Trace::isEnabled());
+        updateTraceText();
+    });
+    QObject::connect(exportTrace, &QPushButton::clicked, [this] {
+        auto path = QFileDialog::getSaveFileName(
+            this, "Export trace", "chatterino-trace.json",
+            "Trace (*.json)");
+        if (!path.isEmpty())
+        {
+            Trace::exportJson(path);
+        }
+    });
+
+    QObject::connect(exportMemory, &QPushButton::clicked, [this] {
+        auto path = QFileDialog::getSaveFileName(
+            this, "Export memory usage", "chatterino-memory.json",
+            "Memory usage (*.json)");
+        if (!path.isEmpty())
+        {
+            exportMemoryReport(path);
+        }
+    });
 
-    layout->addWidget(text);
+    buttons->addWidget(trace);
+    buttons->addWidget(exportTrace);
+    buttons->addWidget(exportMemory);
+    buttons->addStretch(1);
+    layout->addLayout(buttons);
 }
 
 }  // namespace chatterino
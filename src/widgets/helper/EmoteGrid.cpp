@@ -0,0 +1,546 @@
+#include "widgets/helper/EmoteGrid.hpp"
+
+#include "Application.hpp"
+#include "messages/Emote.hpp"
+#include "messages/Image.hpp"
+#include "singletons/Fonts.hpp"
+#include "singletons/Settings.hpp"
+#include "singletons/Theme.hpp"
+#include "singletons/TooltipPreviewImage.hpp"
+#include "singletons/WindowManager.hpp"
+#include "widgets/Scrollbar.hpp"
+#include "widgets/TooltipWidget.hpp"
+
+#include <QMouseEvent>
+#include <QPainter>
+#include <QWheelEvent>
+#include <algorithm>
+
+// sizes at a scale of 1
+#define EMOTE_GRID_CELL 36
+#define EMOTE_GRID_EMOTE 28
+#define EMOTE_GRID_TITLE 28
+#define EMOTE_GRID_MARGIN 4
+
+namespace chatterino {
+
+EmoteGrid::IndexedSection::IndexedSection(Section _section)
+    : section(std::move(_section))
+{
+    this->names.reserve(this->section.items.size());
+    for (auto &item : this->section.items)
+    {
+        this->names.push_back(item.text.toLower());
+    }
+
+    for (int i = 0; i < int(this->names.size()); i++)
+    {
+        for (int offset = 0; offset < this->names[i].size(); offset++)
+        {
+            this->suffixes.emplace_back(i, offset);
+        }
+    }
+
+    std::sort(this->suffixes.begin(), this->suffixes.end(),
+              [this](const auto &l, const auto &r) {
+                  return this->names[l.first]
+                             .midRef(l.second)
+                             .compare(this->names[r.first].midRef(r.second)) <
+                         0;
+              });
+
+    this->filter(QString());
+}
+
+void EmoteGrid::IndexedSection::filter(const QString &text)
+{
+    this->visible.clear();
+
+    if (text.isEmpty())
+    {
+        for (int i = 0; i < int(this->section.items.size()); i++)
+        {
+            this->visible.push_back(i);
+        }
+        return;
+    }
+
+    auto it = std::lower_bound(
+        this->suffixes.begin(), this->suffixes.end(), text,
+        [this](const std::pair<int, int> &suffix, const QString &query) {
+            return this->names[suffix.first]
+                       .midRef(suffix.second)
+                       .compare(query) < 0;
+        });
+
+    for (; it != this->suffixes.end() &&
+           this->names[it->first].midRef(it->second).startsWith(text);
+         ++it)
+    {
+        this->visible.push_back(it->first);
+    }
+
+    // keep the order of the section
+    std::sort(this->visible.begin(), this->visible.end());
+    this->visible.erase(
+        std::unique(this->visible.begin(), this->visible.end()),
+        this->visible.end());
+}
+
+EmoteGrid::EmoteGrid(QWidget *parent)
+    : BaseWidget(parent)
+    , scrollBar_(new Scrollbar(this))
+{
+    this->setMouseTracking(true);
+
+    this->scrollBar_->getCurrentValueChanged().connect([this] {
+        this->update();
+    });
+
+    this->connections_.push_back(
+        getApp()->windows->gifRepaintRequested.connect([this] {
+            if (!this->animatedRegion_.isEmpty())
+            {
+                this->update(this->animatedRegion_);
+            }
+        }));
+
+    this->connections_.push_back(Image::imagesLoaded().connect([this] {
+        if (!this->loadingRegion_.isEmpty())
+        {
+            this->update(this->loadingRegion_);
+        }
+    }));
+}
+
+void EmoteGrid::setSections(std::vector<Section> sections)
+{
+    auto sameItems = [](const Section &a, const Section &b) {
+        return std::equal(a.items.begin(), a.items.end(), b.items.begin(),
+                          b.items.end(), [](const Item &l, const Item &r) {
+                              return l.emote == r.emote && l.text == r.text;
+                          });
+    };
+
+    std::vector<std::unique_ptr<IndexedSection>> indexed;
+    indexed.reserve(sections.size());
+
+    for (auto &section : sections)
+    {
+        auto it = std::find_if(
+            this->sections_.begin(), this->sections_.end(),
+            [&](const std::unique_ptr<IndexedSection> &old) {
+                return old && old->section.key == section.key &&
+                       sameItems(old->section, section);
+            });
+
+        if (it != this->sections_.end())
+        {
+            (*it)->section.title = section.title;
+            indexed.push_back(std::move(*it));
+        }
+        else
+        {
+            indexed.push_back(
+                std::make_unique<IndexedSection>(std::move(section)));
+            indexed.back()->filter(this->filter_);
+        }
+    }
+
+    this->sections_ = std::move(indexed);
+    this->hovered_ = {};
+
+    this->updateRows();
+    this->update();
+}
+
+void EmoteGrid::setEmptyText(const QString &text)
+{
+    this->emptyText_ = text;
+    this->update();
+}
+
+void EmoteGrid::setFilter(const QString &text)
+{
+    auto filter = text.trimmed().toLower();
+    if (filter == this->filter_)
+    {
+        return;
+    }
+    this->filter_ = filter;
+
+    for (auto &section : this->sections_)
+    {
+        section->filter(this->filter_);
+    }
+
+    this->hovered_ = {};
+    this->scrollBar_->setDesiredValue(0);
+
+    this->updateRows();
+    this->update();
+}
+
+Scrollbar &EmoteGrid::getScrollBar()
+{
+    return *this->scrollBar_;
+}
+
+int EmoteGrid::cellSize() const
+{
+    return int(EMOTE_GRID_CELL * this->scale());
+}
+
+int EmoteGrid::columns() const
+{
+    auto width = this->width() - this->scrollBar_->width() -
+                 int(2 * EMOTE_GRID_MARGIN * this->scale());
+    return std::max(1, width / this->cellSize());
+}
+
+int EmoteGrid::titleHeight() const
+{
+    return int(EMOTE_GRID_TITLE * this->scale());
+}
+
+int EmoteGrid::scrollOffset() const
+{
+    return this->scrollBar_->isVisible()
+               ? int(this->scrollBar_->getCurrentValue())
+               : 0;
+}
+
+void EmoteGrid::updateRows()
+{
+    this->rows_.clear();
+
+    auto columns = this->columns();
+    auto cellSize = this->cellSize();
+    auto titleHeight = this->titleHeight();
+    int y = int(EMOTE_GRID_MARGIN * this->scale());
+
+    for (int i = 0; i < int(this->sections_.size()); i++)
+    {
+        auto &visible = this->sections_[i]->visible;
+
+        // sections without matches are left out while searching
+        if (visible.empty() && !this->filter_.isEmpty())
+        {
+            continue;
+        }
+
+        if (!this->sections_[i]->section.title.isEmpty())
+        {
+            this->rows_.push_back(
+                {Row::Type::Title, i, 0, 0, y, titleHeight});
+            y += titleHeight;
+        }
+
+        if (visible.empty())
+        {
+            this->rows_.push_back({Row::Type::Empty, i, 0, 0, y, titleHeight});
+            y += titleHeight;
+            continue;
+        }
+
+        for (int first = 0; first < int(visible.size()); first += columns)
+        {
+            auto count = std::min(columns, int(visible.size()) - first);
+            this->rows_.push_back(
+                {Row::Type::Emotes, i, first, count, y, cellSize});
+            y += cellSize;
+        }
+    }
+
+    this->contentHeight_ = y + int(EMOTE_GRID_MARGIN * this->scale());
+    this->updateScrollbar();
+}
+
+void EmoteGrid::updateScrollbar()
+{
+    this->scrollBar_->setMaximum(this->contentHeight_);
+    this->scrollBar_->setLargeChange(this->height());
+    this->scrollBar_->setSmallChange(this->cellSize());
+    this->scrollBar_->setVisible(this->contentHeight_ > this->height());
+
+    // clamp the scroll position to the new content
+    this->scrollBar_->setDesiredValue(this->scrollBar_->getDesiredValue());
+}
+
+std::pair<size_t, size_t> EmoteGrid::rowsIn(int top, int bottom) const
+{
+    auto first = std::upper_bound(this->rows_.begin(), this->rows_.end(), top,
+                                  [](int top, const Row &row) {
+                                      return top < row.y + row.height;
+                                  });
+    auto last = std::lower_bound(first, this->rows_.end(), bottom,
+                                 [](const Row &row, int bottom) {
+                                     return row.y < bottom;
+                                 });
+
+    return {size_t(first - this->rows_.begin()),
+            size_t(last - this->rows_.begin())};
+}
+
+EmoteGrid::Hit EmoteGrid::hitTest(QPoint point) const
+{
+    auto y = point.y() + this->scrollOffset();
+    auto rows = this->rowsIn(y, y + 1);
+    if (rows.first == rows.second)
+    {
+        return {};
+    }
+
+    auto &row = this->rows_[rows.first];
+    if (row.type != Row::Type::Emotes)
+    {
+        return {};
+    }
+
+    auto cellSize = this->cellSize();
+    auto width = this->width() - this->scrollBar_->width();
+    auto left = (width - this->columns() * cellSize) / 2;
+    auto column = (point.x() - left) / cellSize;
+    if (point.x() < left || column >= row.count)
+    {
+        return {};
+    }
+
+    auto &section = *this->sections_[row.section];
+    return {row.section, section.visible[row.first + column],
+            QRect(left + column * cellSize, row.y, cellSize, cellSize)};
+}
+
+void EmoteGrid::paintEvent(QPaintEvent *event)
+{
+    QPainter painter(this);
+
+    painter.fillRect(this->rect(), this->theme->splits.background);
+
+    this->animatedRegion_ = QRegion();
+    this->loadingRegion_ = QRegion();
+
+    auto &textColor = this->theme->messages.textColors.regular;
+    auto &systemColor = this->theme->messages.textColors.system;
+
+    if (this->rows_.empty())
+    {
+        painter.setFont(getFonts()->getFont(FontStyle::ChatMedium,
+                                            this->scale()));
+        painter.setPen(systemColor);
+        painter.drawText(
+            QRect(0, 0, this->width() - this->scrollBar_->width(),
+                  this->titleHeight() * 2),
+            Qt::AlignCenter,
+            this->filter_.isEmpty() ? this->emptyText_ : "no emotes found");
+        return;
+    }
+
+    auto offset = this->scrollOffset();
+    auto width = this->width() - this->scrollBar_->width();
+    auto cellSize = this->cellSize();
+    auto maxSize = QSizeF(cellSize - 2 * EMOTE_GRID_MARGIN * this->scale(),
+                          EMOTE_GRID_EMOTE * this->scale());
+    auto left = (width - this->columns() * cellSize) / 2;
+
+    // All rows on screen are walked, not only the ones in the clip rect, so
+    // repainting a single cell (e.g. when it's hovered) still finds all
+    // animated emotes
+    auto clip = event->rect();
+    auto rows = this->rowsIn(offset, offset + this->height());
+
+    for (auto i = rows.first; i < rows.second; i++)
+    {
+        auto &row = this->rows_[i];
+        auto &section = *this->sections_[row.section];
+        auto y = row.y - offset;
+        auto inClip = clip.intersects(QRect(0, y, width, row.height));
+
+        if (row.type != Row::Type::Emotes && !inClip)
+        {
+            continue;
+        }
+
+        if (row.type == Row::Type::Title)
+        {
+            painter.setFont(getFonts()->getFont(FontStyle::ChatMediumBold,
+                                                this->scale()));
+            painter.setPen(textColor);
+            painter.drawText(QRect(0, y, width, row.height), Qt::AlignCenter,
+                             section.section.title);
+            continue;
+        }
+
+        if (row.type == Row::Type::Empty)
+        {
+            painter.setFont(getFonts()->getFont(FontStyle::ChatMedium,
+                                                this->scale()));
+            painter.setPen(systemColor);
+            painter.drawText(QRect(0, y, width, row.height), Qt::AlignCenter,
+                             "no emotes available");
+            continue;
+        }
+
+        for (int column = 0; column < row.count; column++)
+        {
+            auto index = section.visible[row.first + column];
+            auto &item = section.section.items[index];
+            auto cell = QRect(left + column * cellSize, y, cellSize, cellSize);
+
+            // only the emotes on screen are loaded
+            auto &image = item.emote->images.getImageOrLoaded(this->scale());
+            if (image->animated())
+            {
+                this->animatedRegion_ += cell;
+            }
+
+            // a smaller image might be shown until the best one is loaded
+            auto &best = item.emote->images.getImage(this->scale());
+            if (!best->isEmpty() && !best->loaded())
+            {
+                this->loadingRegion_ += cell;
+            }
+
+            if (!clip.intersects(cell))
+            {
+                continue;
+            }
+
+            if (this->hovered_.section == row.section &&
+                this->hovered_.item == index)
+            {
+                painter.fillRect(cell, this->theme->messages.selection);
+            }
+
+            auto pixmap = image->pixmapOrLoad();
+            if (!pixmap || image->isEmpty())
+            {
+                continue;
+            }
+
+            // shrink big and wide emotes to fit into the cell
+            QSizeF size(image->width() * this->scale(),
+                        image->height() * this->scale());
+            if (size.width() > maxSize.width() ||
+                size.height() > maxSize.height())
+            {
+                size.scale(maxSize, Qt::KeepAspectRatio);
+            }
+            auto target = QRectF(cell.x() + (cellSize - size.width()) / 2,
+                                 cell.y() + (cellSize - size.height()) / 2,
+                                 size.width(), size.height());
+
+            painter.drawPixmap(target, *pixmap, QRectF(pixmap->rect()));
+        }
+    }
+}
+
+void EmoteGrid::resizeEvent(QResizeEvent *)
+{
+    this->scrollBar_->setGeometry(this->width() - this->scrollBar_->width(), 0,
+                                  this->scrollBar_->width(), this->height());
+    this->scrollBar_->raise();
+
+    this->updateRows();
+    this->update();
+}
+
+void EmoteGrid::scaleChangedEvent(float)
+{
+    this->updateRows();
+    this->update();
+}
+
+void EmoteGrid::wheelEvent(QWheelEvent *event)
+{
+    if (!event->angleDelta().y() || !this->scrollBar_->isVisible())
+    {
+        return;
+    }
+
+    float mouseMultiplier = getSettings()->mouseScrollMultiplier;
+    this->scrollBar_->offset(-event->angleDelta().y() * qreal(1.5) *
+                             mouseMultiplier);
+}
+
+void EmoteGrid::mouseMoveEvent(QMouseEvent *event)
+{
+    auto hit = this->hitTest(event->pos());
+    this->setHovered(hit);
+
+    if (hit.section == -1)
+    {
+        TooltipWidget::instance()->hide();
+        this->setCursor(Qt::ArrowCursor);
+        return;
+    }
+
+    this->setCursor(Qt::PointingHandCursor);
+    this->showTooltip(this->sections_[hit.section]->section.items[hit.item],
+                      event->globalPos(), event->modifiers());
+}
+
+void EmoteGrid::mouseReleaseEvent(QMouseEvent *event)
+{
+    if (event->button() != Qt::LeftButton)
+    {
+        return;
+    }
+
+    auto hit = this->hitTest(event->pos());
+    if (hit.section == -1)
+    {
+        return;
+    }
+
+    auto &item = this->sections_[hit.section]->section.items[hit.item];
+    this->linkClicked.invoke(Link(Link::InsertText, item.text));
+}
+
+void EmoteGrid::leaveEvent(QEvent *)
+{
+    this->setHovered({});
+    TooltipWidget::instance()->hide();
+}
+
+void EmoteGrid::setHovered(const Hit &hit)
+{
+    if (hit == this->hovered_)
+    {
+        return;
+    }
+
+    auto offset = this->scrollOffset();
+    this->update(this->hovered_.rect.translated(0, -offset));
+    this->update(hit.rect.translated(0, -offset));
+    this->hovered_ = hit;
+}
+
+void EmoteGrid::showTooltip(const Item &item, QPoint globalPos,
+                            Qt::KeyboardModifiers modifiers)
+{
+    auto tooltipWidget = TooltipWidget::instance();
+    auto &tooltipPreviewImage = TooltipPreviewImage::instance();
+
+    tooltipPreviewImage.setImageScale(0, 0);
+    if (getSettings()->emotesTooltipPreview.getValue() &&
+        (modifiers == Qt::ShiftModifier ||
+         getSettings()->emotesTooltipPreview.getValue() == 1))
+    {
+        tooltipPreviewImage.setImage(item.emote->images.getImage(3.0));
+    }
+    else
+    {
+        tooltipPreviewImage.setImage(nullptr);
+    }
+
+    tooltipWidget->moveTo(this, globalPos);
+    tooltipWidget->setWordWrap(false);
+    tooltipWidget->setText(item.emote->tooltip.string);
+    tooltipWidget->adjustSize();
+    tooltipWidget->setWindowFlag(Qt::WindowStaysOnTopHint, true);
+    tooltipWidget->show();
+    tooltipWidget->raise();
+}
+
+}  // namespace chatterino
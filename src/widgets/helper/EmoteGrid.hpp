@@ -0,0 +1,128 @@
+#pragma once
+
+#include "messages/Link.hpp"
+#include "widgets/BaseWidget.hpp"
+
+#include <QRegion>
+#include <pajlada/signals/signal.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace chatterino {
+
+struct Emote;
+using EmotePtr = std::shared_ptr<const Emote>;
+
+class Scrollbar;
+
+/// Shows emotes in a grid of equally sized cells, grouped into titled
+/// sections. Only the rows that are on screen are painted (and their images
+/// loaded), so sections can hold thousands of emotes.
+class EmoteGrid : public BaseWidget
+{
+public:
+    struct Item {
+        EmotePtr emote;
+        // inserted into the input when the emote is clicked, also what the
+        // emote is found by
+        QString text;
+    };
+
+    struct Section {
+        // identifies the section between calls to setSections
+        QString key;
+        QString title;
+        std::vector<Item> items;
+    };
+
+    EmoteGrid(QWidget *parent = nullptr);
+
+    // Sections whose key and emotes didn't change keep their search index,
+    // so this can be called again whenever the emotes change
+    void setSections(std::vector<Section> sections);
+    // shown when there are no sections
+    void setEmptyText(const QString &text);
+    // only shows the emotes whose text contains text (case insensitive)
+    void setFilter(const QString &text);
+
+    Scrollbar &getScrollBar();
+
+    pajlada::Signals::Signal<Link> linkClicked;
+
+protected:
+    void paintEvent(QPaintEvent *) override;
+    void resizeEvent(QResizeEvent *) override;
+    void wheelEvent(QWheelEvent *event) override;
+    void mouseMoveEvent(QMouseEvent *event) override;
+    void mouseReleaseEvent(QMouseEvent *event) override;
+    void leaveEvent(QEvent *) override;
+    void scaleChangedEvent(float scale) override;
+
+private:
+    // Search index of a section: every suffix of every lowercase item text,
+    // sorted, so the items containing a text are the ones with a suffix
+    // starting with it
+    struct IndexedSection {
+        Section section;
+        std::vector<QString> names;
+        // (item, offset into its name)
+        std::vector<std::pair<int, int>> suffixes;
+        // items that match the filter
+        std::vector<int> visible;
+
+        explicit IndexedSection(Section section);
+        void filter(const QString &text);
+    };
+
+    struct Row {
+        enum class Type { Title, Emotes, Empty } type;
+        int section;
+        // visible items of the section shown in the row
+        int first;
+        int count;
+        int y;
+        int height;
+    };
+
+    struct Hit {
+        int section = -1;
+        int item = -1;
+        // in content coordinates, so it stays valid while scrolling
+        QRect rect;
+
+        bool operator==(const Hit &other) const
+        {
+            return this->section == other.section && this->item == other.item;
+        }
+    };
+
+    void updateRows();
+    void updateScrollbar();
+    int cellSize() const;
+    int columns() const;
+    int titleHeight() const;
+    int scrollOffset() const;
+    // returns the visible rows, which overlap [top, bottom)
+    std::pair<size_t, size_t> rowsIn(int top, int bottom) const;
+    Hit hitTest(QPoint point) const;
+    void setHovered(const Hit &hit);
+    void showTooltip(const Item &item, QPoint globalPos,
+                     Qt::KeyboardModifiers modifiers);
+
+    Scrollbar *scrollBar_;
+    std::vector<std::unique_ptr<IndexedSection>> sections_;
+    std::vector<Row> rows_;
+    int contentHeight_ = 0;
+    QString filter_;
+    QString emptyText_;
+    Hit hovered_;
+    // area of the animated emotes painted last time
+    QRegion animatedRegion_;
+    // area of the emotes that were still loading when painted last time
+    QRegion loadingRegion_;
+
+    std::vector<pajlada::Signals::ScopedConnection> connections_;
+};
+
+}  // namespace chatterino
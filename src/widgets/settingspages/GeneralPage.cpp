@@ -296,6 +296,9 @@ void GeneralPage::initLayout(GeneralPageView &layout)
     layout.addCheckbox("Animate", s.animateEmotes);
     layout.addCheckbox("Animate only when Chatterino is focused",
                        s.animationsWhenFocused);
+    layout.addCheckbox(
+        "Decode animated emotes while playing (less memory, more CPU)",
+        s.decodeAnimatedEmotesOnDemand);
     layout.addCheckbox("Enable emote auto-completion by typing :",
                        s.emoteCompletionWithColon);
     layout.addDropdown<float>(
@@ -659,6 +662,9 @@ void GeneralPage::initLayout(GeneralPageView &layout)
     // TODO: Change phrasing to use better english once we can tag settings, right now it's kept as history instead of historical so that the setting shows up when the user searches for history
     layout.addIntInput("Max number of history messages to load on connect",
                        s.twitchMessageHistoryLimit, 10, 800, 10);
+    layout.addIntInput("Memory for the messages of all channels in MB (0 = no "
+                       "limit)",
+                       s.scrollbackMemoryBudget, 0, 16384, 50);
 
     layout.addCheckbox("Enable experimental IRC support (requires restart)",
                        s.enableExperimentalIrc);
@@ -215,6 +215,11 @@ SplitHeader::SplitHeader(Split *_split)
     getSettings()->headerStreamTitle.connect(_, this->managedConnections_);
     getSettings()->headerGame.connect(_, this->managedConnections_);
     getSettings()->headerUptime.connect(_, this->managedConnections_);
+
+    // the tooltip hides the viewer count in streamer mode
+    this->managedConnect(streamerModeChanged(), [this](bool) {
+        this->updateChannelText();
+    });
 }
 
 void SplitHeader::initializeLayout()
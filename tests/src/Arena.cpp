@@ -0,0 +1,50 @@
+#include "util/Arena.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace chatterino;
+
+TEST(Arena, ReusesMemoryAfterReset)
+{
+    Arena arena;
+
+    std::vector<std::string *> strings;
+    for (int i = 0; i < 100; i++)
+    {
+        auto *string = arena.create<std::string>(std::to_string(i));
+        EXPECT_TRUE(arena.contains(string));
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(string) % alignof(std::string),
+                  0U);
+        strings.push_back(string);
+    }
+
+    for (int i = 0; i < 100; i++)
+    {
+        EXPECT_EQ(*strings[i], std::to_string(i));
+    }
+
+    std::string outside;
+    EXPECT_FALSE(arena.contains(&outside));
+
+    for (auto *string : strings)
+    {
+        string->~basic_string();
+    }
+
+    auto capacity = arena.capacity();
+    EXPECT_GE(capacity, int64_t(100 * sizeof(std::string)));
+
+    // the blocks got merged into one, which fits everything again
+    arena.reset();
+    EXPECT_EQ(arena.capacity(), capacity);
+
+    for (int i = 0; i < 100; i++)
+    {
+        arena.allocate(sizeof(std::string), alignof(std::string));
+    }
+    EXPECT_EQ(arena.capacity(), capacity);
+}
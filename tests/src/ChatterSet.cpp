@@ -82,3 +82,54 @@ TEST(ChatterSet, MaxSizeLastUsed)
     EXPECT_TRUE(set.contains("pajlada"));
     EXPECT_TRUE(set.contains("Pajlada"));
 }
+
+TEST(ChatterSet, Diff)
+{
+    auto diff = chatterino::ChatterDiff::between({"a", "b", "c"},
+                                                 {"b", "c", "d", "e"});
+
+    EXPECT_EQ(diff.joined, std::vector<QString>({"d", "e"}));
+    EXPECT_EQ(diff.parted, std::vector<QString>({"a"}));
+    EXPECT_EQ(diff.onlineCount, 4u);
+}
+
+TEST(ChatterSet, UpdateOnlineChatters)
+{
+    chatterino::ChatterSet set;
+
+    set.addRecentChatter("Pajlada");
+    set.updateOnlineChatters(
+        chatterino::ChatterDiff::between({}, {"forsen", "pajlada"}));
+
+    EXPECT_TRUE(set.contains("forsen"));
+    EXPECT_TRUE(set.contains("pajlada"));
+    // the casing of recent chatters is kept
+    EXPECT_EQ(set.filterByPrefix("pa"), std::vector<QString>({"Pajlada"}));
+
+    set.updateOnlineChatters(
+        chatterino::ChatterDiff::between({"forsen", "pajlada"}, {"forsen"}));
+
+    EXPECT_TRUE(set.contains("forsen"));
+    EXPECT_FALSE(set.contains("pajlada"));
+}
+
+TEST(ChatterSet, UpdateOnlineChattersBelowLimit)
+{
+    using chatterino::ChatterSet;
+
+    std::vector<QString> many;
+    for (size_t i = 0; i < ChatterSet::chatterLimit; ++i)
+    {
+        many.push_back(QString("user-%1").arg(i, 4, 10, QChar('0')));
+    }
+    std::vector<QString> few(many.begin() + 1, many.end());
+
+    ChatterSet set;
+    set.updateOnlineChatters(chatterino::ChatterDiff::between({}, many));
+    EXPECT_FALSE(set.contains("user-0001"));
+
+    // everyone online is added once there are less chatters than the limit
+    set.updateOnlineChatters(chatterino::ChatterDiff::between(many, few));
+    EXPECT_TRUE(set.contains("user-0001"));
+    EXPECT_FALSE(set.contains("user-0000"));
+}
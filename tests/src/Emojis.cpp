@@ -36,6 +36,12 @@ TEST(Emojis, ShortcodeParsing)
             // expected output
             "👨‍⚕️",
         },
+        {
+            // input
+            ":santa_tone1:",
+            // expected output
+            "🎅🏻",
+        },
     };
 
     for (const auto &test : tests)
@@ -0,0 +1,94 @@
+#include "controllers/ignores/IgnorePhraseMatcher.hpp"
+
+#include "controllers/ignores/IgnorePhrase.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace chatterino;
+
+namespace {
+
+IgnorePhrase buildIgnorePhrase(const QString &pattern, bool isRegex,
+                               bool isBlock, const QString &replace = {},
+                               bool isCaseSensitive = false)
+{
+    return IgnorePhrase(pattern, isRegex, isBlock, replace, isCaseSensitive);
+}
+
+IgnorePhraseMatcher buildMatcher(std::vector<IgnorePhrase> phrases)
+{
+    return IgnorePhraseMatcher(
+        std::make_shared<const std::vector<IgnorePhrase>>(std::move(phrases)));
+}
+
+QString applyReplacements(const IgnorePhraseMatcher &matcher,
+                          const QString &text)
+{
+    QString result;
+    int last = 0;
+    for (const auto &replacement : matcher.findReplacements(text))
+    {
+        result += text.midRef(last, replacement.start - last);
+        result += replacement.text;
+        last = replacement.start + replacement.length;
+    }
+    result += text.midRef(last);
+
+    return result;
+}
+
+}  // namespace
+
+TEST(IgnorePhraseMatcher, Block)
+{
+    auto matcher = buildMatcher({
+        buildIgnorePhrase("forsen", false, true),
+        buildIgnorePhrase("^!\\w+", true, true),
+        buildIgnorePhrase("CaseSensitive", false, true, {}, true),
+        buildIgnorePhrase("replaced", false, false, "x"),
+    });
+
+    EXPECT_EQ(matcher.findBlock("hello FORSEN")->getPattern(), "forsen");
+    EXPECT_EQ(matcher.findBlock("!command")->getPattern(), "^!\\w+");
+    EXPECT_EQ(matcher.findBlock("CaseSensitive")->getPattern(),
+              "CaseSensitive");
+
+    EXPECT_EQ(matcher.findBlock("not a !command"), nullptr);
+    EXPECT_EQ(matcher.findBlock("casesensitive"), nullptr);
+    EXPECT_EQ(matcher.findBlock("replaced"), nullptr);
+}
+
+TEST(IgnorePhraseMatcher, Replace)
+{
+    auto matcher = buildMatcher({
+        buildIgnorePhrase("foo", false, false, "bar"),
+        buildIgnorePhrase("b(a+)z", true, false, "q\\1q"),
+        buildIgnorePhrase("foobar", false, false, "never"),
+        buildIgnorePhrase("blocked", false, true),
+    });
+
+    EXPECT_EQ(applyReplacements(matcher, "foo baz FOO"), "bar qaq bar");
+    EXPECT_EQ(applyReplacements(matcher, "foobar"), "barbar");
+    EXPECT_EQ(applyReplacements(matcher, "blocked"), "blocked");
+
+    auto replacements = matcher.findReplacements("x foo baaz");
+    ASSERT_EQ(replacements.size(), size_t(2));
+    EXPECT_EQ(replacements[0].start, 2);
+    EXPECT_EQ(replacements[0].length, 3);
+    EXPECT_EQ(replacements[1].start, 6);
+    EXPECT_EQ(replacements[1].length, 4);
+    EXPECT_EQ(replacements[1].text, "qaaq");
+}
+
+TEST(IgnorePhraseMatcher, ReplaceWithBackreference)
+{
+    // backreferences can't be combined into a single regex, the phrases are
+    // matched one by one instead
+    auto matcher = buildMatcher({
+        buildIgnorePhrase("(\\w)\\1{3,}", true, false, "\\1"),
+        buildIgnorePhrase("spam", false, false, "ham"),
+    });
+
+    EXPECT_EQ(applyReplacements(matcher, "aaaaaa spam"), "a ham");
+    EXPECT_EQ(applyReplacements(matcher, "spam bbbb"), "ham b");
+}
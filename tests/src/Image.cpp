@@ -0,0 +1,213 @@
+#include "messages/Image.hpp"
+
+#include <gtest/gtest.h>
+#include <QBuffer>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QImageReader>
+
+#include <algorithm>
+
+using namespace chatterino;
+
+namespace {
+
+// An animated gif with a different picture in every frame. The pixels are
+// stored without compression: a clear code is emitted before the code table
+// grows past 9 bit codes.
+QByteArray makeAnimatedGif(int size, int frameCount)
+{
+    QByteArray gif("GIF89a");
+    auto put16 = [&gif](int value) {
+        gif.append(char(value & 0xff));
+        gif.append(char((value >> 8) & 0xff));
+    };
+
+    put16(size);
+    put16(size);
+    // global color table with 256 entries
+    gif.append(char(0xf7));
+    gif.append(char(0));
+    gif.append(char(0));
+    for (int i = 0; i < 256; i++)
+    {
+        gif.append(char(i));
+        gif.append(char(255 - i));
+        gif.append(char(i * 7));
+    }
+
+    // loop forever
+    gif.append("\x21\xff\x0bNETSCAPE2.0\x03\x01\x00\x00\x00", 19);
+
+    for (int frame = 0; frame < frameCount; frame++)
+    {
+        // 50ms per frame
+        gif.append("\x21\xf9\x04\x04", 4);
+        put16(5);
+        gif.append("\x00\x00", 2);
+
+        gif.append(char(0x2c));
+        put16(0);
+        put16(0);
+        put16(size);
+        put16(size);
+        gif.append(char(0));
+
+        // 8 bit colors, the codes are 9 bits wide
+        gif.append(char(8));
+
+        QByteArray data;
+        uint32_t bits = 0;
+        int bitCount = 0;
+        auto writeCode = [&](uint32_t code) {
+            bits |= code << bitCount;
+            bitCount += 9;
+            while (bitCount >= 8)
+            {
+                data.append(char(bits & 0xff));
+                bits >>= 8;
+                bitCount -= 8;
+            }
+        };
+
+        constexpr uint32_t clearCode = 256;
+        constexpr uint32_t endCode = 257;
+
+        int sinceClear = 0;
+        writeCode(clearCode);
+        for (int y = 0; y < size; y++)
+        {
+            for (int x = 0; x < size; x++)
+            {
+                if (sinceClear == 250)
+                {
+                    writeCode(clearCode);
+                    sinceClear = 0;
+                }
+                writeCode(uint32_t(x * 3 + y + frame * 16) & 0xff);
+                sinceClear++;
+            }
+        }
+        writeCode(endCode);
+        if (bitCount > 0)
+        {
+            data.append(char(bits & 0xff));
+        }
+
+        for (int i = 0; i < data.size(); i += 255)
+        {
+            auto length = std::min(255, data.size() - i);
+            gif.append(char(length));
+            gif.append(data.mid(i, length));
+        }
+        gif.append(char(0));
+    }
+
+    gif.append(char(0x3b));
+
+    return gif;
+}
+
+struct DecodeMeasurement {
+    int frames = 0;
+    int64_t bytes = 0;
+    double msPerImage = 0;
+};
+
+DecodeMeasurement measureDecode(const QByteArray &gif, bool firstOnly)
+{
+    constexpr int iterations = 20;
+
+    DecodeMeasurement result;
+    QElapsedTimer timer;
+    timer.start();
+
+    for (int i = 0; i < iterations; i++)
+    {
+        QBuffer buffer;
+        buffer.setData(gif);
+        buffer.open(QIODevice::ReadOnly);
+        QImageReader reader(&buffer);
+
+        auto frames = detail::readFrames(
+            reader, Url{"https://example.com/animated.gif"}, firstOnly);
+
+        result.frames = frames.size();
+        result.bytes = 0;
+        for (auto &&frame : frames)
+        {
+            result.bytes += int64_t(frame.image.bytesPerLine()) *
+                            frame.image.height();
+        }
+    }
+
+    result.msPerImage = double(timer.nsecsElapsed()) / 1e6 / iterations;
+
+    return result;
+}
+
+}  // namespace
+
+TEST(Image, FromUrlSharesImages)
+{
+    auto before = Image::registryStats();
+
+    auto a = Image::fromUrl(Url{"https://example.com/shared.png"});
+    auto b = Image::fromUrl(Url{"https://example.com/shared.png"});
+    auto c = Image::fromUrl(Url{"https://example.com/other.png"});
+
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, c);
+
+    auto after = Image::registryStats();
+    EXPECT_EQ(after.size, before.size + 2);
+    EXPECT_EQ(after.hits, before.hits + 1);
+    EXPECT_EQ(after.misses, before.misses + 2);
+}
+
+TEST(Image, RegistryForgetsReleasedImages)
+{
+    auto before = Image::registryStats();
+
+    {
+        auto image = Image::fromUrl(Url{"https://example.com/released.png"});
+        EXPECT_EQ(Image::registryStats().size, before.size + 1);
+    }
+
+    EXPECT_EQ(Image::registryStats().size, before.size);
+
+    // the url gets a new image once the old one is gone
+    auto image = Image::fromUrl(Url{"https://example.com/released.png"});
+    EXPECT_EQ(Image::registryStats().misses, before.misses + 2);
+}
+
+// Compares decoding every frame up front with decoding only the first one,
+// like it's done with "Decode animated emotes while playing"
+TEST(Image, DecodeOnDemandMeasurements)
+{
+    constexpr int frameCount = 60;
+    auto gif = makeAnimatedGif(112, frameCount);
+
+    auto all = measureDecode(gif, false);
+    auto first = measureDecode(gif, true);
+
+    qDebug().noquote()
+        << QString("all frames: %1 frames, %2 KiB decoded, %3 ms")
+               .arg(all.frames)
+               .arg(all.bytes / 1024)
+               .arg(all.msPerImage, 0, 'f', 2);
+    // the encoded bytes are kept to decode the other frames while shown
+    qDebug().noquote()
+        << QString("first frame: %1 frame, %2 KiB decoded + %3 KiB encoded, "
+                   "%4 ms")
+               .arg(first.frames)
+               .arg(first.bytes / 1024)
+               .arg(gif.size() / 1024)
+               .arg(first.msPerImage, 0, 'f', 2);
+
+    EXPECT_EQ(all.frames, frameCount);
+    EXPECT_EQ(first.frames, 1);
+    EXPECT_EQ(first.bytes * frameCount, all.bytes);
+    EXPECT_LT(first.bytes + gif.size(), all.bytes);
+    EXPECT_LT(first.msPerImage, all.msPerImage);
+}
@@ -0,0 +1,77 @@
+#include "messages/LimitedQueue.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace chatterino;
+
+namespace {
+
+std::vector<int> items(LimitedQueue<int> &queue)
+{
+    auto snapshot = queue.getSnapshot();
+
+    std::vector<int> result;
+    for (size_t i = 0; i < snapshot.size(); i++)
+    {
+        result.push_back(snapshot[i]);
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(LimitedQueue, PopFront)
+{
+    LimitedQueue<int> queue(1000);
+
+    int deleted = -1;
+    EXPECT_FALSE(queue.popFront(deleted));
+
+    for (int i = 0; i < 5; i++)
+    {
+        queue.pushBack(i, deleted);
+    }
+
+    auto before = queue.getSnapshot();
+
+    EXPECT_TRUE(queue.popFront(deleted));
+    EXPECT_EQ(deleted, 0);
+    EXPECT_EQ(items(queue), (std::vector<int>{1, 2, 3, 4}));
+
+    // snapshots taken before aren't changed
+    ASSERT_EQ(before.size(), 5U);
+    EXPECT_EQ(before[0], 0);
+
+    queue.pushBack(5, deleted);
+    EXPECT_EQ(items(queue), (std::vector<int>{1, 2, 3, 4, 5}));
+}
+
+TEST(LimitedQueue, PopFrontAcrossChunks)
+{
+    LimitedQueue<int> queue(1000);
+
+    int deleted = -1;
+    for (int i = 0; i < 250; i++)
+    {
+        queue.pushBack(i, deleted);
+    }
+
+    for (int i = 0; i < 120; i++)
+    {
+        ASSERT_TRUE(queue.popFront(deleted));
+        EXPECT_EQ(deleted, i);
+    }
+
+    auto remaining = items(queue);
+    ASSERT_EQ(remaining.size(), 130U);
+    EXPECT_EQ(remaining.front(), 120);
+    EXPECT_EQ(remaining.back(), 249);
+
+    while (queue.popFront(deleted))
+    {
+    }
+    EXPECT_TRUE(queue.empty());
+
+    queue.pushBack(1, deleted);
+    EXPECT_EQ(items(queue), (std::vector<int>{1}));
+}
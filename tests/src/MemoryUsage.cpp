@@ -0,0 +1,43 @@
+#include "messages/MemoryUsage.hpp"
+
+#include "messages/Message.hpp"
+#include "messages/MessageElement.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace chatterino;
+
+TEST(MemoryUsage, Message)
+{
+    Message empty;
+
+    MemoryUsage emptyUsage;
+    empty.addMemoryUsage(emptyUsage);
+
+    EXPECT_EQ(emptyUsage.messageCount, 1);
+    EXPECT_GE(emptyUsage.messages, int64_t(sizeof(Message)));
+    EXPECT_EQ(emptyUsage.elements, 0);
+
+    auto text = QString("a longer message with a few words in it");
+
+    Message message;
+    message.messageText = text;
+    message.elements.emplace_back(
+        std::make_unique<TextElement>(text, MessageElementFlag::Text));
+    message.elements.emplace_back(
+        std::make_unique<TextElement>("short", MessageElementFlag::Text));
+
+    MemoryUsage usage;
+    message.addMemoryUsage(usage);
+
+    EXPECT_EQ(usage.messageCount, 1);
+    EXPECT_GE(usage.messages - emptyUsage.messages,
+              MemoryUsage::stringSize(text));
+    EXPECT_GE(usage.elements, int64_t(2 * sizeof(TextElement)) +
+                                  MemoryUsage::stringSize("short"));
+    EXPECT_EQ(usage.total(), usage.messages + usage.elements);
+
+    auto json = usage.toJson();
+    EXPECT_EQ(json.value("messageCount").toInt(), 1);
+    EXPECT_EQ(json.value("total").toDouble(), double(usage.total()));
+}
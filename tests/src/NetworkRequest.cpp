@@ -6,6 +6,7 @@
 
 #include "common/Outcome.hpp"
 #include "common/QLogging.hpp"
+#include "util/DebugCount.hpp"
 
 #include <gtest/gtest.h>
 
@@ -18,6 +19,19 @@ static QString getStatusURL(int code)
     return QString("http://httpbin.org/status/%1").arg(code);
 }
 
+// requests that were sent to the network
+int64_t startedRequests()
+{
+    int64_t started = 0;
+    for (auto priority :
+         {NetworkRequestPriority::Interactive, NetworkRequestPriority::Metadata,
+          NetworkRequestPriority::Image})
+    {
+        started += NetworkManager::stats(priority).started;
+    }
+    return started;
+}
+
 }  // namespace
 
 TEST(NetworkRequest, Success)
@@ -334,3 +348,98 @@ TEST(NetworkRequest, FinallyCallbackOnTimeout)
     EXPECT_FALSE(onSuccessCalled);
     EXPECT_TRUE(NetworkManager::workerThread.isRunning());
 }
+
+TEST(NetworkRequest, CoalescedRequests)
+{
+    const int requestCount = 3;
+    auto url = getStatusURL(200);
+
+    EXPECT_TRUE(NetworkManager::workerThread.isRunning());
+
+    std::mutex mut;
+    int successCount = 0;
+    std::condition_variable requestDoneCondition;
+
+    auto startedBefore = startedRequests();
+    auto coalescedBefore = DebugCount::get("http request coalesced");
+
+    // identical requests get the result of the first one
+    for (int i = 0; i < requestCount; ++i)
+    {
+        NetworkRequest(url)
+            .onSuccess([&mut, &successCount, &requestDoneCondition](
+                           NetworkResult result) -> Outcome {
+                EXPECT_EQ(result.status(), 200);
+
+                {
+                    std::unique_lock lck(mut);
+                    successCount++;
+                }
+                requestDoneCondition.notify_one();
+                return Success;
+            })
+            .execute();
+    }
+
+    // Wait for the requests to finish
+    std::unique_lock lck(mut);
+    requestDoneCondition.wait(lck, [&successCount] {
+        return successCount == requestCount;
+    });
+
+    EXPECT_EQ(successCount, requestCount);
+
+    // only the first request was sent, the others waited for it
+    EXPECT_EQ(startedRequests(), startedBefore + 1);
+    EXPECT_EQ(DebugCount::get("http request coalesced"),
+              coalescedBefore + requestCount - 1);
+}
+
+TEST(NetworkRequest, OfflineSendsNothing)
+{
+    auto url = getStatusURL(200);
+
+    auto before = startedRequests();
+
+    NetworkManager::setOffline(true);
+
+    std::mutex mut;
+    bool requestDone = false;
+    std::condition_variable requestDoneCondition;
+
+    NetworkRequest(url)
+        .onSuccess([&mut, &requestDone,
+                    &requestDoneCondition](NetworkResult result) -> Outcome {
+            // nothing may be sent while offline
+            EXPECT_TRUE(false);
+
+            {
+                std::unique_lock lck(mut);
+                requestDone = true;
+            }
+            requestDoneCondition.notify_one();
+            return Success;
+        })
+        .onError([&mut, &requestDone,
+                  &requestDoneCondition](NetworkResult result) {
+            EXPECT_EQ(result.status(), 0);
+
+            {
+                std::unique_lock lck(mut);
+                requestDone = true;
+            }
+            requestDoneCondition.notify_one();
+        })
+        .execute();
+
+    {
+        std::unique_lock lck(mut);
+        requestDoneCondition.wait(lck, [&requestDone] {
+            return requestDone;
+        });
+    }
+
+    NetworkManager::setOffline(false);
+
+    EXPECT_EQ(startedRequests(), before);
+}
@@ -0,0 +1,52 @@
+#include "common/StartupTasks.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+using namespace chatterino;
+
+TEST(StartupTasks, Dependencies)
+{
+    StartupTasks tasks;
+
+    std::mutex mutex;
+    std::vector<QString> order;
+    auto run = [&](QString name) {
+        return [&, name] {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(name);
+        };
+    };
+
+    using Thread = StartupTasks::Thread;
+
+    auto background = tasks.add("background", Thread::Background, {},
+                                run("background"));
+    auto first = tasks.add("first", Thread::Gui, {}, run("first"));
+    auto second =
+        tasks.add("second", Thread::Gui, {first, background}, run("second"));
+    tasks.add("independent", Thread::Gui, {}, run("independent"));
+    tasks.add("after second", Thread::Background, {second},
+              run("after second"));
+
+    tasks.runAll();
+
+    ASSERT_EQ(order.size(), 5U);
+
+    auto indexOf = [&](const QString &name) {
+        return std::find(order.begin(), order.end(), name) - order.begin();
+    };
+    EXPECT_LT(indexOf("first"), indexOf("second"));
+    EXPECT_LT(indexOf("background"), indexOf("second"));
+    EXPECT_LT(indexOf("second"), indexOf("after second"));
+
+    auto timings = tasks.timings();
+    ASSERT_EQ(timings.size(), 5U);
+    for (size_t i = 1; i < timings.size(); i++)
+    {
+        EXPECT_LE(timings[i - 1].start, timings[i].start);
+    }
+}
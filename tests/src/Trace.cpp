@@ -0,0 +1,97 @@
+#include "debug/Trace.hpp"
+
+#include <gtest/gtest.h>
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <thread>
+
+using namespace chatterino;
+
+TEST(Trace, ExportJson)
+{
+    Trace::clear();
+
+    {
+        TraceSpan disabled("disabled");
+    }
+
+    Trace::setEnabled(true);
+    {
+        TraceSpan outer("outer", "test");
+        TraceSpan inner("inner", "test");
+        inner.setDetail("\"quoted\"");
+    }
+    Trace::setEnabled(false);
+
+    auto path = QDir::temp().filePath("chatterino-test-trace.json");
+    ASSERT_TRUE(Trace::exportJson(path));
+
+    QFile file(path);
+    ASSERT_TRUE(file.open(QIODevice::ReadOnly));
+    auto root = QJsonDocument::fromJson(file.readAll()).object();
+    file.remove();
+
+    QStringList names;
+    for (auto &&value : root.value("traceEvents").toArray())
+    {
+        auto event = value.toObject();
+        if (event.value("ph").toString() != "X")
+        {
+            continue;
+        }
+
+        names.append(event.value("name").toString());
+        EXPECT_GE(event.value("dur").toDouble(), 0);
+        if (event.value("name").toString() == "inner")
+        {
+            EXPECT_EQ(
+                event.value("args").toObject().value("detail").toString(),
+                QString("\"quoted\""));
+        }
+    }
+
+    // inner ends first
+    EXPECT_EQ(names, QStringList({"inner", "outer"}));
+}
+
+TEST(Trace, ReusesBuffersOfFinishedThreads)
+{
+    auto path = QDir::temp().filePath("chatterino-test-trace-threads.json");
+
+    auto threadCount = [&path] {
+        EXPECT_TRUE(Trace::exportJson(path));
+
+        QFile file(path);
+        EXPECT_TRUE(file.open(QIODevice::ReadOnly));
+        auto root = QJsonDocument::fromJson(file.readAll()).object();
+        file.remove();
+
+        int count = 0;
+        for (auto &&value : root.value("traceEvents").toArray())
+        {
+            if (value.toObject().value("ph").toString() == "M")
+            {
+                count++;
+            }
+        }
+        return count;
+    };
+
+    auto before = threadCount();
+
+    Trace::setEnabled(true);
+    for (int i = 0; i < 5; i++)
+    {
+        std::thread([] {
+            TraceSpan span("thread", "test");
+        }).join();
+    }
+    Trace::setEnabled(false);
+
+    // the threads ran one after another, so they all used the same buffer
+    EXPECT_LE(threadCount(), before + 1);
+}
@@ -0,0 +1,71 @@
+#include "messages/UserMessageIndex.hpp"
+
+#include "messages/Message.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace chatterino;
+
+namespace {
+
+MessagePtr makeMessage(const QString &loginName,
+                       const QString &timeoutUser = QString())
+{
+    auto message = std::make_shared<Message>();
+    message->loginName = loginName;
+    message->timeoutUser = timeoutUser;
+    return message;
+}
+
+}  // namespace
+
+TEST(UserMessageIndex, AppendAndTrim)
+{
+    UserMessageIndex index;
+
+    auto first = makeMessage("pajlada");
+    auto second = makeMessage("forsen");
+    auto third = makeMessage("Pajlada");
+    auto timeout = makeMessage("", "pajlada");
+
+    index.append(first);
+    index.append(second);
+    index.append(third);
+    index.append(timeout);
+
+    EXPECT_EQ(index.find("PAJLADA"),
+              std::vector<MessagePtr>({first, third, timeout}));
+    EXPECT_EQ(index.find("forsen"), std::vector<MessagePtr>({second}));
+    EXPECT_TRUE(index.find("nobody").empty());
+
+    index.removeFirst(first);
+    index.removeFirst(second);
+
+    EXPECT_EQ(index.find("pajlada"), std::vector<MessagePtr>({third, timeout}));
+    EXPECT_TRUE(index.find("forsen").empty());
+}
+
+TEST(UserMessageIndex, PrependAndReplace)
+{
+    UserMessageIndex index;
+
+    auto a = makeMessage("pajlada");
+    auto b = makeMessage("forsen");
+    auto c = makeMessage("pajlada");
+    auto deleted = makeMessage("", "msg:1234");
+
+    index.append(c);
+    index.append(deleted);
+    index.prepend({a, b});
+
+    EXPECT_EQ(index.find("pajlada"), std::vector<MessagePtr>({a, c}));
+    EXPECT_TRUE(index.find("msg:1234").empty());
+
+    // the queue is now a, b, c, deleted
+    auto replacement = makeMessage("pajlada");
+    index.replace(1, b, replacement);
+
+    EXPECT_EQ(index.find("pajlada"),
+              std::vector<MessagePtr>({a, replacement, c}));
+    EXPECT_TRUE(index.find("forsen").empty());
+}
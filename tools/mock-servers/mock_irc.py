@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+# Local stand-in for irc.chat.twitch.tv. It accepts any login, answers the
+# commands Chatterino sends and floods the joined channels with synthetic or
+# recorded PRIVMSGs at a fixed rate.
+#
+# Point Chatterino at it with
+#   CHATTERINO2_TWITCH_SERVER_HOST=127.0.0.1
+#   CHATTERINO2_TWITCH_SERVER_PORT=6667
+#   CHATTERINO2_TWITCH_SERVER_SECURE=false
+import argparse
+import asyncio
+import itertools
+import re
+import time
+import uuid
+import zlib
+
+# Connections buffering more than this are considered too slow and new
+# messages are dropped for them, like Twitch does
+MAX_WRITE_BUFFER = 4 * 1024 * 1024
+
+SERVER = 'tmi.twitch.tv'
+
+
+def now_ms():
+    return int(time.time() * 1000)
+
+
+def room_id(channel):
+    return zlib.crc32(channel.encode()) % 100000000
+
+
+WORDS = ('Kappa PogChamp LUL that was actually insane no way he hits that '
+         'again chat is this real KEKW first time watching the stream today '
+         'what is the song called widepeepoHappy gg').split()
+
+
+def synthetic_messages(words=WORDS):
+    for i in itertools.count():
+        user = f'loaduser{i % 500}'
+        text = ' '.join(words[(i + j) % len(words)] for j in range(1 + i % 12))
+        yield user, text
+
+
+class Client:
+    def __init__(self, server, reader, writer):
+        self.server = server
+        self.reader = reader
+        self.writer = writer
+        self.nick = 'justinfan'
+        self.channels = set()
+
+    def send(self, line):
+        if self.writer.transport.get_write_buffer_size() > MAX_WRITE_BUFFER:
+            self.server.stats['dropped'] += 1
+            return
+        self.writer.write(line.encode() + b'\r\n')
+
+    async def run(self):
+        try:
+            while True:
+                line = await self.reader.readline()
+                if not line:
+                    break
+                self.handle(line.decode(errors='replace').rstrip('\r\n'))
+        except ConnectionError:
+            pass
+        finally:
+            self.server.clients.discard(self)
+            self.writer.close()
+
+    def handle(self, line):
+        command, _, params = line.partition(' ')
+        command = command.upper()
+
+        if command == 'NICK':
+            self.nick = params.strip()
+            for (code, text) in [('001', 'Welcome, GLHF!'),
+                                 ('002', f'Your host is {SERVER}'),
+                                 ('003', 'This server is rather new'),
+                                 ('004', '-'), ('375', '-'),
+                                 ('372', 'You are in a maze of twisty '
+                                         'passages.'),
+                                 ('376', '>')]:
+                self.send(f':{SERVER} {code} {self.nick} :{text}')
+        elif command == 'CAP':
+            caps = params.partition(':')[2]
+            self.send(f':{SERVER} CAP * ACK :{caps}')
+        elif command == 'PING':
+            self.send(f':{SERVER} PONG {SERVER} {params}')
+        elif command == 'JOIN':
+            for channel in params.split(','):
+                self.join(channel.strip().lower())
+        elif command == 'PART':
+            for channel in params.split(','):
+                channel = channel.strip().lower()
+                self.channels.discard(channel)
+                prefix = f'{self.nick}!{self.nick}@{self.nick}.{SERVER}'
+                self.send(f':{prefix} PART {channel}')
+        elif command == 'PRIVMSG':
+            # echo the message back like Twitch does with USERSTATE
+            channel = params.split(' ', 1)[0]
+            self.send(f'@badges=;color=;display-name={self.nick};'
+                      f'emote-sets=0;mod=0;subscriber=0;user-type= '
+                      f':{SERVER} USERSTATE {channel}')
+
+    def join(self, channel):
+        if not channel.startswith('#'):
+            return
+        self.channels.add(channel)
+        prefix = f'{self.nick}!{self.nick}@{self.nick}.{SERVER}'
+        self.send(f':{prefix} JOIN {channel}')
+        self.send(f':{self.nick}.{SERVER} 353 {self.nick} = {channel} '
+                  f':{self.nick}')
+        self.send(f':{self.nick}.{SERVER} 366 {self.nick} {channel} '
+                  f':End of /NAMES list')
+        self.send(f'@emote-only=0;followers-only=-1;r9k=0;'
+                  f'room-id={room_id(channel[1:])};slow=0;subs-only=0 '
+                  f':{SERVER} ROOMSTATE {channel}')
+
+
+class IrcServer:
+    def __init__(self, rate, replay=None):
+        self.rate = rate
+        self.replay = replay
+        self.clients = set()
+        self.stats = {'sent': 0, 'dropped': 0}
+        self.server = None
+        self.replay_index = 0
+
+    async def start(self, host, port):
+        self.server = await asyncio.start_server(self.on_connect, host, port)
+        asyncio.ensure_future(self.flood())
+
+    async def on_connect(self, reader, writer):
+        client = Client(self, reader, writer)
+        self.clients.add(client)
+        await client.run()
+
+    def joined_channels(self):
+        return sorted(set().union(*(c.channels for c in self.clients)))
+
+    def messages(self):
+        if self.replay:
+            with open(self.replay, encoding='utf-8') as f:
+                lines = [l.rstrip('\r\n') for l in f if ' PRIVMSG #' in l]
+            for line in itertools.cycle(lines):
+                yield self.rewrite(line)
+        else:
+            channels = itertools.count()
+            for user, text in synthetic_messages():
+                joined = self.joined_channels()
+                if not joined:
+                    yield None
+                    continue
+                channel = joined[next(channels) % len(joined)]
+                yield (f'@badge-info=;badges=;color=#1E90FF;'
+                       f'display-name={user};emotes=;flags=;'
+                       f'id={uuid.uuid4()};mod=0;'
+                       f'room-id={room_id(channel[1:])};subscriber=0;'
+                       f'tmi-sent-ts={now_ms()};turbo=0;'
+                       f'user-id={room_id(user)};user-type= '
+                       f':{user}!{user}@{user}.{SERVER} PRIVMSG {channel} '
+                       f':{text}')
+
+    def rewrite(self, line):
+        # recorded messages are sent to the joined channels in turn, with
+        # fresh ids and timestamps
+        joined = self.joined_channels()
+        if not joined:
+            return None
+        channel = joined[self.replay_index % len(joined)]
+        self.replay_index += 1
+        line = re.sub(r'PRIVMSG #\S+', f'PRIVMSG {channel}', line, count=1)
+        line = re.sub(r'tmi-sent-ts=\d*', f'tmi-sent-ts={now_ms()}', line)
+        line = re.sub(r'(^@|;)id=[^; ]*', rf'\1id={uuid.uuid4()}', line)
+        line = re.sub(r'room-id=\d*', f'room-id={room_id(channel[1:])}', line)
+        return line
+
+    async def flood(self):
+        messages = self.messages()
+        start = time.monotonic()
+        generated = 0
+        while True:
+            await asyncio.sleep(0.01)
+            due = int((time.monotonic() - start) * self.rate)
+            while generated < due:
+                generated += 1
+                line = next(messages)
+                if line is None:
+                    continue
+                channel = line.split(' PRIVMSG ', 1)[1].split(' ', 1)[0]
+                for client in list(self.clients):
+                    if channel in client.channels:
+                        client.send(line)
+                self.stats['sent'] += 1
+
+
+async def main():
+    parser = argparse.ArgumentParser(
+        description='Local stand-in for the Twitch IRC server')
+    parser.add_argument('--host', default='127.0.0.1')
+    parser.add_argument('--port', type=int, default=6667)
+    parser.add_argument('--rate', type=float, default=100,
+                        help='messages per second over all channels')
+    parser.add_argument('--replay', help='file with recorded IRC lines')
+    args = parser.parse_args()
+
+    server = IrcServer(args.rate, args.replay)
+    await server.start(args.host, args.port)
+    print(f'irc: listening on {args.host}:{args.port}')
+
+    while True:
+        sent = server.stats['sent']
+        await asyncio.sleep(1)
+        print(f'irc: {server.stats["sent"] - sent} msg/s, '
+              f'{server.stats["dropped"]} dropped, '
+              f'{len(server.joined_channels())} channels')
+
+
+if __name__ == '__main__':
+    asyncio.run(main())
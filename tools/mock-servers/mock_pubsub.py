@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+# Local stand-in for pubsub-edge.twitch.tv. It acknowledges every LISTEN,
+# answers PINGs and sends channel point redemptions to the channels that are
+# listened to at a fixed rate.
+#
+# Chatterino only connects with TLS, so the server needs a certificate (see
+# throughput.py for how to make a self-signed one). Point Chatterino at it
+# with
+#   CHATTERINO2_TWITCH_PUBSUB_URL=wss://127.0.0.1:9443
+#
+# Only the parts of RFC 6455 Chatterino uses are implemented: no extensions,
+# no fragmented messages.
+import argparse
+import asyncio
+import base64
+import hashlib
+import json
+import ssl
+import struct
+import time
+import uuid
+
+WEBSOCKET_GUID = '258EAFA5-E914-47DA-95CA-C5AB0DC85B11'
+
+OP_TEXT = 0x1
+OP_CLOSE = 0x8
+OP_PING = 0x9
+OP_PONG = 0xA
+
+
+def make_ssl_context(cert, key):
+    context = ssl.SSLContext(ssl.PROTOCOL_TLS_SERVER)
+    context.load_cert_chain(cert, key)
+    # Chatterino's websocket client only speaks TLS 1.0
+    context.minimum_version = ssl.TLSVersion.TLSv1
+    context.set_ciphers('DEFAULT:@SECLEVEL=0')
+    return context
+
+
+def encode_frame(opcode, payload):
+    header = bytes([0x80 | opcode])
+    length = len(payload)
+    if length < 126:
+        header += bytes([length])
+    elif length < 1 << 16:
+        header += bytes([126]) + struct.pack('!H', length)
+    else:
+        header += bytes([127]) + struct.pack('!Q', length)
+    return header + payload
+
+
+async def read_frame(reader):
+    first, second = await reader.readexactly(2)
+    opcode = first & 0x0F
+    length = second & 0x7F
+    if length == 126:
+        length, = struct.unpack('!H', await reader.readexactly(2))
+    elif length == 127:
+        length, = struct.unpack('!Q', await reader.readexactly(8))
+    mask = await reader.readexactly(4) if second & 0x80 else b'\0\0\0\0'
+    payload = await reader.readexactly(length)
+    return opcode, bytes(b ^ mask[i % 4] for i, b in enumerate(payload))
+
+
+def redemption(channel_id, index):
+    user = f'loaduser{index % 500}'
+    return {
+        'type': 'reward-redeemed',
+        'data': {
+            'timestamp': time.strftime('%Y-%m-%dT%H:%M:%SZ', time.gmtime()),
+            'redemption': {
+                'id': str(uuid.uuid4()),
+                'user': {
+                    'id': str(index % 500),
+                    'login': user,
+                    'display_name': user,
+                },
+                'channel_id': channel_id,
+                'redeemed_at': time.strftime('%Y-%m-%dT%H:%M:%SZ',
+                                             time.gmtime()),
+                'reward': {
+                    'id': str(uuid.uuid5(uuid.NAMESPACE_URL, channel_id)),
+                    'channel_id': channel_id,
+                    'title': 'Hydrate',
+                    'prompt': '',
+                    'cost': 100,
+                    'is_user_input_required': False,
+                    'image': None,
+                },
+                'status': 'FULFILLED',
+            },
+        },
+    }
+
+
+class Client:
+    def __init__(self, server, reader, writer):
+        self.server = server
+        self.reader = reader
+        self.writer = writer
+        self.topics = set()
+
+    def send_json(self, value):
+        self.send(OP_TEXT, json.dumps(value).encode())
+
+    def send(self, opcode, payload):
+        self.writer.write(encode_frame(opcode, payload))
+
+    async def handshake(self):
+        request = await self.reader.readuntil(b'\r\n\r\n')
+        headers = {}
+        for line in request.decode().split('\r\n')[1:]:
+            name, _, value = line.partition(':')
+            headers[name.strip().lower()] = value.strip()
+
+        key = headers.get('sec-websocket-key', '')
+        accept = base64.b64encode(
+            hashlib.sha1((key + WEBSOCKET_GUID).encode()).digest()).decode()
+        self.writer.write(('HTTP/1.1 101 Switching Protocols\r\n'
+                           'Upgrade: websocket\r\n'
+                           'Connection: Upgrade\r\n'
+                           f'Sec-WebSocket-Accept: {accept}\r\n'
+                           '\r\n').encode())
+
+    async def run(self):
+        try:
+            await self.handshake()
+            while True:
+                opcode, payload = await read_frame(self.reader)
+                if opcode == OP_CLOSE:
+                    self.send(OP_CLOSE, payload[:2])
+                    break
+                elif opcode == OP_PING:
+                    self.send(OP_PONG, payload)
+                elif opcode == OP_TEXT:
+                    self.handle(json.loads(payload))
+        except (asyncio.IncompleteReadError, ConnectionError, ssl.SSLError):
+            pass
+        finally:
+            self.server.clients.discard(self)
+            self.writer.close()
+
+    def handle(self, message):
+        kind = message.get('type')
+        if kind == 'PING':
+            self.send_json({'type': 'PONG'})
+        elif kind in ('LISTEN', 'UNLISTEN'):
+            topics = set(message.get('data', {}).get('topics', []))
+            if kind == 'LISTEN':
+                self.topics |= topics
+            else:
+                self.topics -= topics
+            self.send_json({'type': 'RESPONSE',
+                            'nonce': message.get('nonce', ''),
+                            'error': ''})
+
+
+class PubSubServer:
+    def __init__(self, rate):
+        self.rate = rate
+        self.clients = set()
+        self.stats = {'sent': 0}
+
+    async def start(self, host, port, context):
+        await asyncio.start_server(self.on_connect, host, port, ssl=context)
+        asyncio.ensure_future(self.flood())
+
+    async def on_connect(self, reader, writer):
+        client = Client(self, reader, writer)
+        self.clients.add(client)
+        await client.run()
+
+    async def flood(self):
+        start = time.monotonic()
+        generated = 0
+        while True:
+            await asyncio.sleep(0.01)
+            due = int((time.monotonic() - start) * self.rate)
+            while generated < due:
+                generated += 1
+                topics = sorted(
+                    [(topic, client) for client in self.clients
+                     for topic in client.topics
+                     if topic.startswith('community-points-channel-v1.')],
+                    key=lambda listened: listened[0])
+                if not topics:
+                    continue
+                topic, client = topics[generated % len(topics)]
+                channel_id = topic.rsplit('.', 1)[1]
+                client.send_json({
+                    'type': 'MESSAGE',
+                    'data': {
+                        'topic': topic,
+                        'message': json.dumps(redemption(channel_id,
+                                                         generated)),
+                    },
+                })
+                self.stats['sent'] += 1
+
+
+async def main():
+    parser = argparse.ArgumentParser(
+        description='Local stand-in for the Twitch PubSub server')
+    parser.add_argument('--host', default='127.0.0.1')
+    parser.add_argument('--port', type=int, default=9443)
+    parser.add_argument('--rate', type=float, default=1,
+                        help='redemptions per second over all channels')
+    parser.add_argument('--cert', required=True)
+    parser.add_argument('--key', required=True)
+    args = parser.parse_args()
+
+    server = PubSubServer(args.rate)
+    await server.start(args.host, args.port,
+                       make_ssl_context(args.cert, args.key))
+    print(f'pubsub: listening on {args.host}:{args.port}')
+
+    while True:
+        await asyncio.sleep(1)
+
+
+if __name__ == '__main__':
+    asyncio.run(main())
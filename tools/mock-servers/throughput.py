@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+# Runs Chatterino against the local IRC and PubSub servers and reports how
+# many messages per second it keeps up with.
+#
+#   ./throughput.py --chatterino ../../build/bin/chatterino \
+#       --channels 20 --rate 500 --duration 60
+#
+# Chatterino writes its debug counters (the ones in the debug popup) to the
+# file in CHATTERINO2_STATS_FILE every second, the numbers in the report are
+# taken from there:
+#   - received: PRIVMSGs handled per second
+#   - latency: moving average of the time between the server sending a
+#     message and Chatterino adding it to its channel
+#   - slow paints: paints of a chat view that took longer than a frame
+#
+# Anonymous users don't listen to PubSub topics, log in to an account in the
+# Chatterino instance to get channel point redemptions as well.
+import argparse
+import asyncio
+import os
+import subprocess
+import tempfile
+import time
+
+from mock_irc import IrcServer
+from mock_pubsub import PubSubServer, make_ssl_context
+
+
+def make_certificate(directory):
+    cert = os.path.join(directory, 'cert.pem')
+    key = os.path.join(directory, 'key.pem')
+    subprocess.run(['openssl', 'req', '-x509', '-newkey', 'rsa:2048',
+                    '-nodes', '-subj', '/CN=localhost', '-days', '1',
+                    '-keyout', key, '-out', cert],
+                   check=True, stdout=subprocess.DEVNULL,
+                   stderr=subprocess.DEVNULL)
+    return cert, key
+
+
+def read_stats(path):
+    stats = {}
+    try:
+        with open(path, encoding='utf-8') as f:
+            for line in f:
+                name, _, value = line.rpartition(': ')
+                try:
+                    stats[name] = int(value)
+                except ValueError:
+                    pass
+    except OSError:
+        pass
+    return stats
+
+
+async def run(args, directory):
+    irc = IrcServer(args.rate, args.replay)
+    await irc.start('127.0.0.1', args.irc_port)
+
+    pubsub = PubSubServer(args.pubsub_rate)
+    cert, key = make_certificate(directory)
+    await pubsub.start('127.0.0.1', args.pubsub_port,
+                       make_ssl_context(cert, key))
+
+    stats_file = os.path.join(directory, 'stats.txt')
+    env = dict(os.environ,
+               CHATTERINO2_TWITCH_SERVER_HOST='127.0.0.1',
+               CHATTERINO2_TWITCH_SERVER_PORT=str(args.irc_port),
+               CHATTERINO2_TWITCH_SERVER_SECURE='false',
+               CHATTERINO2_TWITCH_PUBSUB_URL=
+               f'wss://127.0.0.1:{args.pubsub_port}',
+               # don't load the history of the test channels
+               CHATTERINO2_RECENT_MESSAGES_URL='http://127.0.0.1:1/%1',
+               CHATTERINO2_STATS_FILE=stats_file)
+
+    channels = ';'.join(f't:loadtest{i}' for i in range(args.channels))
+    process = None
+    if args.chatterino:
+        process = subprocess.Popen([args.chatterino, '--channels', channels],
+                                   env=env)
+    else:
+        print('start Chatterino with:')
+        for name in ['CHATTERINO2_TWITCH_SERVER_HOST',
+                     'CHATTERINO2_TWITCH_SERVER_PORT',
+                     'CHATTERINO2_TWITCH_SERVER_SECURE',
+                     'CHATTERINO2_TWITCH_PUBSUB_URL',
+                     'CHATTERINO2_RECENT_MESSAGES_URL',
+                     'CHATTERINO2_STATS_FILE']:
+            print(f'  {name}={env[name]}')
+        print(f'  chatterino --channels "{channels}"')
+
+    try:
+        # wait until all channels are joined
+        while len(irc.joined_channels()) < args.channels:
+            await asyncio.sleep(0.1)
+        await asyncio.sleep(args.warmup)
+
+        before = read_stats(stats_file)
+        sent_before = irc.stats['sent']
+        dropped_before = irc.stats['dropped']
+        start = time.monotonic()
+
+        samples = []
+        while time.monotonic() - start < args.duration:
+            await asyncio.sleep(1)
+            samples.append(read_stats(stats_file))
+
+        elapsed = time.monotonic() - start
+        after = samples[-1] if samples else before
+    finally:
+        if process:
+            process.terminate()
+            process.wait()
+
+    def delta(name):
+        return after.get(name, 0) - before.get(name, 0)
+
+    latencies = [s['irc message latency (ms)'] for s in samples
+                 if 'irc message latency (ms)' in s]
+
+    print(f'channels:     {args.channels}')
+    print(f'sent:         {(irc.stats["sent"] - sent_before) / elapsed:.0f} '
+          f'msg/s ({irc.stats["dropped"] - dropped_before} dropped by the '
+          f'server)')
+    print(f'received:     {delta("irc messages received") / elapsed:.0f} '
+          f'msg/s')
+    if latencies:
+        print(f'latency:      {sum(latencies) / len(latencies):.0f} ms '
+              f'average, {max(latencies)} ms worst second')
+    print(f'slow paints:  {delta("channel view slow paints")}')
+    print(f'paint time:   {after.get("channel view paint time (us)", 0)} us')
+    print(f'redemptions:  {pubsub.stats["sent"]}')
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Measures Chatterino against local Twitch servers')
+    parser.add_argument('--chatterino',
+                        help='binary to start, otherwise start it yourself')
+    parser.add_argument('--channels', type=int, default=10)
+    parser.add_argument('--rate', type=float, default=100,
+                        help='IRC messages per second over all channels')
+    parser.add_argument('--replay', help='file with recorded IRC lines')
+    parser.add_argument('--pubsub-rate', type=float, default=1,
+                        help='redemptions per second over all channels')
+    parser.add_argument('--duration', type=float, default=30,
+                        help='seconds to measure')
+    parser.add_argument('--warmup', type=float, default=5,
+                        help='seconds to wait before measuring')
+    parser.add_argument('--irc-port', type=int, default=6667)
+    parser.add_argument('--pubsub-port', type=int, default=9443)
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as directory:
+        asyncio.run(run(args, directory))
+
+
+if __name__ == '__main__':
+    main()
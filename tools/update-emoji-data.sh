@@ -1,2 +1,3 @@
 #!/bin/bash
 wget https://raw.githubusercontent.com/iamcal/emoji-data/master/emoji.json -O ../resources/emoji.json
+(cd ../resources && python3 generate_emoji_table.py)